@@ -0,0 +1,161 @@
+/*
+
+ File        		: bgcache.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the background cache. The parts of the
+									main screen that only change with the settings are drawn
+									once for each combination and kept as a whole frame in
+									SDRAM, after the overlay. Coming back to the main screen
+									copies the saved frame into the back buffer with the DMA2D
+									instead of drawing it all again. When every slot is in use
+									the one used least recently is replaced.
+
+*/
+
+#ifndef __BGCACHE_H
+#define __BGCACHE_H
+
+#include "main.h"
+
+// Whole frames kept at once
+#define BG_CACHE_SLOTS 4
+// Set to 1 to time a screen switch that draws the background against one that
+// copies it from the cache at start up, see bgCacheBenchmark() in main.c
+#ifndef BG_BENCH
+#define BG_BENCH 0
+#endif
+
+typedef struct
+{
+	FB_PIXEL *pixels;
+	uint32_t key;
+	bool valid;
+	uint32_t lastUsed;
+} BG_SLOT;
+
+typedef struct
+{
+	uint32_t hits;          // Backgrounds copied from the cache
+	uint32_t misses;        // Backgrounds that had to be drawn
+	uint32_t evictions;     // Saved backgrounds thrown out to make room
+	uint32_t lastTicks;     // Time the last screen switch took to draw (ms)
+	uint32_t hitTicks;      // Longest switch that used the cache (ms)
+	uint32_t missTicks;     // Longest switch that had to draw the background (ms)
+	uint32_t lastCycles;    // The same three on the DWT cycle counter
+	uint32_t hitCycles;
+	uint32_t missCycles;
+} BG_STATS;
+
+// The frame buffers, overlay and slots are laid out one after another from the start of
+// SDRAM, and have to end inside it. The array's size goes negative, stopping the build, if not
+typedef char BG_FITS_SDRAM[((((2 + BG_CACHE_SLOTS) * FB_SIZE * sizeof(FB_PIXEL)) +
+	(OVERLAY_WIDTH * OVERLAY_HEIGHT * sizeof(uint16_t))) <= FB_SDRAM_SIZE) ? 1 : -1];
+
+BG_SLOT bgSlots[BG_CACHE_SLOTS];
+BG_STATS bgStats;
+uint32_t bgClock = 0;
+
+// Puts the slots in SDRAM straight after the overlay. Must be called after overlayInit()
+void bgCacheInit(void)
+{
+	int i;
+
+	for (i = 0; i < BG_CACHE_SLOTS; i++)
+	{
+		bgSlots[i].pixels = (FB_PIXEL *)(overlay.pixels + (OVERLAY_WIDTH * OVERLAY_HEIGHT)) + (i * FB_SIZE);
+		bgSlots[i].valid = false;
+		bgSlots[i].lastUsed = 0;
+	}
+	memset(&bgStats, 0, sizeof(bgStats));
+}
+
+// First byte of SDRAM after the last slot
+uint8_t *bgCacheEnd(void)
+{
+	return (uint8_t *)(bgSlots[BG_CACHE_SLOTS - 1].pixels + FB_SIZE);
+}
+
+// Packs the settings the background depends on into one key
+uint32_t bgCacheKey(uint32_t scheme, uint32_t tempUnit, uint32_t distUnit)
+{
+	return (scheme << 2) | ((tempUnit & 1) << 1) | (distUnit & 1);
+}
+
+// Copies the saved background for 'key' into the back buffer. Returns false
+// when it isn't in the cache, so it has to be drawn
+bool bgCacheRestore(uint32_t key)
+{
+	int i;
+
+	for (i = 0; i < BG_CACHE_SLOTS; i++)
+	{
+		if (bgSlots[i].valid && bgSlots[i].key == key)
+		{
+			bgSlots[i].lastUsed = ++bgClock;
+			fbBlockCopy(bgSlots[i].pixels, FB_WIDTH, fbSurface->pixels, FB_WIDTH, FB_WIDTH, FB_HEIGHT);
+			fbMarkDamage(0, 0, FB_WIDTH, FB_HEIGHT);
+			fbPixelWrites += FB_SIZE;
+			// Whatever the text slots were showing has been covered
+			textInvalidateSlots();
+			bgStats.hits++;
+			return true;
+		}
+	}
+	bgStats.misses++;
+	return false;
+}
+
+// Saves the back buffer as the background for 'key', over the least recently used slot
+void bgCacheStore(uint32_t key)
+{
+	BG_SLOT *slot = &bgSlots[0];
+	int i;
+
+	for (i = 0; i < BG_CACHE_SLOTS; i++)
+	{
+		if (!bgSlots[i].valid || bgSlots[i].key == key)
+		{
+			slot = &bgSlots[i];
+			break;
+		}
+		if (bgSlots[i].lastUsed < slot->lastUsed)
+		{
+			slot = &bgSlots[i];
+		}
+	}
+	if (slot->valid && slot->key != key)
+	{
+		bgStats.evictions++;
+	}
+
+	// The copy has to start from the finished drawing
+	fbSync();
+	fbBlockCopy(fbSurface->pixels, FB_WIDTH, slot->pixels, FB_WIDTH, FB_WIDTH, FB_HEIGHT);
+	slot->key = key;
+	slot->valid = true;
+	slot->lastUsed = ++bgClock;
+}
+
+// Records how long a screen switch took from the tick 'start' and the cycle count
+// 'startCycle', 'cached' being whether the background came from the cache
+void bgCacheTime(uint32_t start, uint32_t startCycle, bool cached)
+{
+	// Anything the DMA2D is still copying is part of the switch
+	fbSync();
+	bgStats.lastCycles = DWT->CYCCNT - startCycle;
+	bgStats.lastTicks = HAL_GetTick() - start;
+	if (cached)
+	{
+		bgStats.hitTicks = bgStats.lastTicks > bgStats.hitTicks ? bgStats.lastTicks : bgStats.hitTicks;
+		bgStats.hitCycles = bgStats.lastCycles > bgStats.hitCycles ? bgStats.lastCycles : bgStats.hitCycles;
+	}
+	else
+	{
+		bgStats.missTicks = bgStats.lastTicks > bgStats.missTicks ? bgStats.lastTicks : bgStats.missTicks;
+		bgStats.missCycles = bgStats.lastCycles > bgStats.missCycles ? bgStats.lastCycles : bgStats.missCycles;
+	}
+}
+
+#endif
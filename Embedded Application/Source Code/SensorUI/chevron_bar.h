@@ -0,0 +1,96 @@
+/*
+
+ File        		: chevron_bar.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for a row of distance chevrons that remembers
+									which of them are lit, so changing the distance only repaints
+									the chevrons that actually change colour.
+
+*/
+
+#ifndef __CHEVRON_BAR_H
+#define __CHEVRON_BAR_H
+
+#include "main.h"
+
+// Gap between the starting x values of neighbouring chevrons
+#define CHEVRON_SPACING 17
+// Most chevrons one bar can hold, one bit each in 'lit'
+#define CHEVRON_BAR_MAX 32
+
+// Drawn by sensor_ui.h
+void fillChevron(int x, bool isReverse, uint32_t colour);
+
+typedef struct
+{
+	int count;          // Number of chevrons in the bar
+	bool isReverse;     // Right hand bars are mirrored
+	uint32_t lit;       // Bit i is set when chevron i is showing colourOn
+	uint32_t colourOff;
+	uint32_t colourOn;
+	bool valid;         // False until the whole bar has been painted once
+	uint32_t redraws;   // Chevrons repainted so far
+} CHEVRON_BAR;
+
+void chevronBarInit(CHEVRON_BAR *bar, int count, bool isReverse)
+{
+	bar->count = count > CHEVRON_BAR_MAX ? CHEVRON_BAR_MAX : count;
+	bar->isReverse = isReverse;
+	bar->lit = 0;
+	bar->valid = false;
+	bar->redraws = 0;
+}
+
+// Forgets what is on screen, so the next update repaints every chevron
+void chevronBarInvalidate(CHEVRON_BAR *bar)
+{
+	bar->valid = false;
+}
+
+// Lights the first 'numLit' chevrons, counting out from the edge of the screen.
+// Returns how many chevrons had to be repainted
+int chevronBarSet(CHEVRON_BAR *bar, int numLit, uint32_t colourOff, uint32_t colourOn)
+{
+	uint32_t want, changed;
+	int i, redrawn = 0;
+
+	if (numLit < 0)
+	{
+		numLit = 0;
+	}
+	if (numLit > bar->count)
+	{
+		numLit = bar->count;
+	}
+	want = numLit == 32 ? 0xFFFFFFFF : (1u << numLit) - 1;
+
+	// A new colour scheme changes every chevron, not just the ones that switch on or off
+	if (!bar->valid || colourOff != bar->colourOff || colourOn != bar->colourOn)
+	{
+		changed = bar->count == 32 ? 0xFFFFFFFF : (1u << bar->count) - 1;
+	}
+	else
+	{
+		changed = want ^ bar->lit;
+	}
+
+	for (i = 0; i < bar->count; i++)
+	{
+		if (changed & (1u << i))
+		{
+			fillChevron(i * CHEVRON_SPACING, bar->isReverse, (want & (1u << i)) ? colourOn : colourOff);
+			redrawn++;
+		}
+	}
+
+	bar->lit = want;
+	bar->colourOff = colourOff;
+	bar->colourOn = colourOn;
+	bar->valid = true;
+	bar->redraws += redrawn;
+	return redrawn;
+}
+
+#endif
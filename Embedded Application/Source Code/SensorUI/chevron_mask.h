@@ -0,0 +1,188 @@
+/*
+
+ File        		: chevron_mask.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file that rasterizes the chevron shape once into a
+									run-length mask, one run per row. Drawing a chevron is then a
+									matter of filling those runs in any colour, mirrored for the
+									right hand side, instead of walking the polygon edges again.
+									The same runs can be expanded into an A8 mask for DMA2D.
+
+*/
+
+#ifndef __CHEVRON_MASK_H
+#define __CHEVRON_MASK_H
+
+#include "main.h"
+
+// Width of the box a chevron is drawn in
+#define CHEVRON_WIDTH 18
+// Set to 1 to blend chevrons through an A8 mask with DMA2D instead of filling the runs
+#ifndef CHEVRON_USE_DMA2D
+#define CHEVRON_USE_DMA2D 0
+#endif
+// Set to 1 to time the mask against the old ways of filling a chevron at start up,
+// see chevronBenchmark() in sensor_ui.h
+#ifndef CHEVRON_BENCH
+#define CHEVRON_BENCH 0
+#endif
+// The blend writes RGB565, so it can't be used with CLUT frame buffers
+#if HUD_USE_CLUT
+#undef CHEVRON_USE_DMA2D
+#define CHEVRON_USE_DMA2D 0
+#endif
+
+// The pixels 'start' up to 'start + len' of one row, relative to the left of the chevron
+typedef struct
+{
+	uint8_t start;
+	uint8_t len;
+} CHEVRON_RUN;
+
+typedef struct
+{
+	CHEVRON_RUN rows[FB_HEIGHT];
+	bool built;
+	uint32_t pixels;    // Pixels covered by one chevron
+} CHEVRON_MASK;
+
+CHEVRON_MASK chevronMask;
+#if CHEVRON_USE_DMA2D
+uint8_t chevronA8[2][FB_HEIGHT * CHEVRON_WIDTH];
+#endif
+
+// Works out the corners of a chevron relative to the starting x value. The
+// chevron itself is not convex, so it is split into a top and bottom half that
+// meet at y=136. Reversed chevrons are mirrored across the screen
+void chevronHalves(int x, bool isReverse, RASTER_POINT top[4], RASTER_POINT bottom[4])
+{
+	int i;
+
+	top[0].x = x;		top[0].y = 136;
+	top[1].x = x+7;		top[1].y = 0;
+	top[2].x = x+18;	top[2].y = 0;
+	top[3].x = x+11;	top[3].y = 136;
+	bottom[0].x = x;	bottom[0].y = 136;
+	bottom[1].x = x+11;	bottom[1].y = 136;
+	bottom[2].x = x+18;	bottom[2].y = 272;
+	bottom[3].x = x+7;	bottom[3].y = 272;
+
+	if (isReverse)
+	{
+		for (i = 0; i < 4; i++)
+		{
+			top[i].x = FB_WIDTH - 1 - top[i].x;
+			bottom[i].x = FB_WIDTH - 1 - bottom[i].x;
+		}
+	}
+}
+
+// Span handler that records each row of the chevron at x=0 into the mask
+void chevronMaskSpan(int y, int x0, int x1)
+{
+	chevronMask.rows[y].start = (uint8_t)x0;
+	chevronMask.rows[y].len = (uint8_t)(x1 - x0);
+	chevronMask.pixels += x1 - x0;
+}
+
+// Expands the runs into an 18 pixel wide A8 mask, mirrored when 'isReverse' is set
+void chevronMaskToA8(bool isReverse, uint8_t *dst)
+{
+	int y, i, col;
+
+	memset(dst, 0, FB_HEIGHT * CHEVRON_WIDTH);
+	for (y = 0; y < FB_HEIGHT; y++)
+	{
+		for (i = 0; i < chevronMask.rows[y].len; i++)
+		{
+			col = chevronMask.rows[y].start + i;
+			dst[y * CHEVRON_WIDTH + (isReverse ? CHEVRON_WIDTH - 1 - col : col)] = 255;
+		}
+	}
+}
+
+// Rasterizes the chevron shape, only the first call does any work
+void chevronMaskBuild(void)
+{
+	RASTER_POINT top[4], bottom[4];
+
+	if (chevronMask.built)
+	{
+		return;
+	}
+	memset(chevronMask.rows, 0, sizeof(chevronMask.rows));
+	chevronMask.pixels = 0;
+	chevronHalves(0, false, top, bottom);
+	rasterConvex(top, 4, chevronMaskSpan);
+	rasterConvex(bottom, 4, chevronMaskSpan);
+#if CHEVRON_USE_DMA2D
+	chevronMaskToA8(false, chevronA8[0]);
+	chevronMaskToA8(true, chevronA8[1]);
+#endif
+	chevronMask.built = true;
+}
+
+// Left edge of the box a chevron starting at 'x' is drawn in
+int chevronMaskLeft(int x, bool isReverse)
+{
+	return isReverse ? FB_WIDTH - 1 - CHEVRON_WIDTH - x : x;
+}
+
+// Paints a chevron in 'colour' from the mask. Reversed chevrons are the mirror
+// image across the screen, where column c lands on column FB_WIDTH-2-c
+void chevronMaskBlit(int x, bool isReverse, uint32_t colour)
+{
+	int left = chevronMaskLeft(x, isReverse), y;
+#if CHEVRON_USE_DMA2D
+	int w = CHEVRON_WIDTH, skip = 0;
+#endif
+
+	chevronMaskBuild();
+	if (fbRejects(left, 0, CHEVRON_WIDTH, FB_HEIGHT, chevronMask.pixels))
+	{
+		return;
+	}
+	fbMarkDamage(left, 0, CHEVRON_WIDTH, FB_HEIGHT);
+#if CHEVRON_USE_DMA2D
+	// The mask covers the full height of the screen, so it can only be blended
+	// into a whole frame buffer with nothing clipped above or below. A chevron
+	// hanging over the sides of the clip is cut down
+	if (fbSurface->width == FB_WIDTH && fbClip.y0 == 0 && fbClip.y1 == FB_HEIGHT)
+	{
+		if (left < fbClip.x0)
+		{
+			skip = fbClip.x0 - left;
+			w -= skip;
+			left = fbClip.x0;
+		}
+		if (left + w > fbClip.x1)
+		{
+			w = fbClip.x1 - left;
+		}
+		if (w > 0)
+		{
+			fbSync();
+			dma2dBlendA8(chevronA8[isReverse ? 1 : 0] + skip, CHEVRON_WIDTH, fbSurface->pixels + left,
+				FB_WIDTH, w, FB_HEIGHT, colour, NULL);
+			fbPixelWrites += chevronMask.pixels;
+		}
+		return;
+	}
+#endif
+	for (y = 0; y < FB_HEIGHT; y++)
+	{
+		if (isReverse)
+		{
+			fbFillSpan(FB_WIDTH - 1 - x - chevronMask.rows[y].start - chevronMask.rows[y].len, y,
+				chevronMask.rows[y].len, colour);
+		}
+		else
+		{
+			fbFillSpan(x + chevronMask.rows[y].start, y, chevronMask.rows[y].len, colour);
+		}
+	}
+}
+
+#endif
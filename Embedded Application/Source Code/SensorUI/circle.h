@@ -0,0 +1,189 @@
+/*
+
+ File        		: circle.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file that draws circles from octant tables. The
+									radii the layout uses have their Bresenham octant worked out
+									ahead of time, other radii are worked out when drawn. Each
+									octant is turned into horizontal spans and rows outside the
+									requested range are skipped, so part of a circle can be drawn
+									without touching the pixels that are cut off.
+
+*/
+
+#ifndef __CIRCLE_H
+#define __CIRCLE_H
+
+#include "main.h"
+
+// Largest radius that can be drawn, octant offsets are stored in a byte
+#define CIRCLE_MAX_RADIUS 255
+// Longest octant, a little over CIRCLE_MAX_RADIUS / sqrt(2)
+#define CIRCLE_MAX_OCTANT 184
+
+// The octant from the top of the circle going clockwise. Entry x is the
+// distance up from the centre to the pixel in column x, the last entry can
+// be just past the 45 degree line. Made with the same steps as circleOctant(),
+// 'tests/test_circle generate' prints them again and the test checks they match
+
+// Radius 4, the degree symbols
+const uint8_t circleOctant4[4] =
+{
+	4, 4, 3, 2
+};
+
+// Radius 71, the temperature dial
+const uint8_t circleOctant71[51] =
+{
+	71, 71, 71, 71, 71, 71, 71, 71, 70, 70, 70, 70, 70, 70, 69, 69,
+	69, 69, 68, 68, 68, 67, 67, 67, 66, 66, 66, 65, 65, 64, 64, 63,
+	63, 62, 62, 61, 60, 60, 59, 58, 58, 57, 56, 55, 55, 54, 53, 52,
+	51, 50, 49
+};
+
+// Radius 130, the lean gauge
+const uint8_t circleOctant130[93] =
+{
+	130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129,
+	129, 129, 129, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 126, 126, 126,
+	126, 125, 125, 125, 125, 124, 124, 124, 123, 123, 123, 122, 122, 122, 121, 121,
+	120, 120, 120, 119, 119, 118, 118, 117, 117, 116, 116, 115, 115, 114, 114, 113,
+	112, 112, 111, 111, 110, 109, 109, 108, 107, 107, 106, 105, 105, 104, 103, 102,
+	101, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90
+};
+
+typedef struct
+{
+	int radius;
+	int count;
+	const uint8_t *offsets;
+} CIRCLE_TABLE;
+
+const CIRCLE_TABLE circleTables[] =
+{
+	{4, sizeof(circleOctant4), circleOctant4},
+	{71, sizeof(circleOctant71), circleOctant71},
+	{130, sizeof(circleOctant130), circleOctant130}
+};
+
+// Works out the octant of a circle with Bresenham's circle algorithm
+// Reference = https://www.geeksforgeeks.org/bresenhams-circle-drawing-algorithm/
+// Returns the number of entries written to 'offsets'
+int circleOctant(int radius, uint8_t *offsets)
+{
+	int x = 0, y = radius, dp = 3 - (2 * radius);
+
+	offsets[0] = (uint8_t)y;
+	while (y >= x)
+	{
+		x++;
+
+		// Checks decision parameter and correspondingly updates d, x and y
+		if (dp > 0)
+		{
+			y--;
+			dp = dp + (4 * (x - y)) + 10;
+		}
+		else
+		{
+			dp = dp + (4 * x) + 6;
+		}
+		offsets[x] = (uint8_t)y;
+	}
+	return x + 1;
+}
+
+// Finds the octant for 'radius', using 'scratch' when there is no table for it.
+// Returns the number of entries, 0 if the radius can't be drawn
+int circleFindOctant(int radius, const uint8_t **offsets, uint8_t *scratch)
+{
+	int i;
+
+	if (radius < 1 || radius > CIRCLE_MAX_RADIUS)
+	{
+		return 0;
+	}
+	for (i = 0; i < (int)(sizeof(circleTables) / sizeof(circleTables[0])); i++)
+	{
+		if (circleTables[i].radius == radius)
+		{
+			*offsets = circleTables[i].offsets;
+			return circleTables[i].count;
+		}
+	}
+	*offsets = scratch;
+	return circleOctant(radius, scratch);
+}
+
+// Fills columns x0 to x1 (both included) of row 'y' if the row is between 'yMin' and 'yMax'
+void circleSpan(int y, int x0, int x1, int yMin, int yMax)
+{
+	if (y >= yMin && y < yMax)
+	{
+		fbFillSpan(x0, y, x1 - x0 + 1, fbColour);
+	}
+}
+
+// Draws the rows of a circle from 'yMin' up to (but not including) 'yMax' in the current colour.
+// Runs of pixels along the top and bottom become one span, the sides are one pixel per row
+void circleDrawRows(int centerX, int centerY, int radius, int yMin, int yMax)
+{
+	uint8_t scratch[CIRCLE_MAX_OCTANT];
+	const uint8_t *offsets;
+	int count, i, start, y;
+
+	if (yMin < fbClip.y0)
+	{
+		yMin = fbClip.y0;
+	}
+	if (yMax > fbClip.y1)
+	{
+		yMax = fbClip.y1;
+	}
+	// Rows outside the clip are never walked, and a circle wholly outside it is skipped
+	if (yMin >= yMax || fbRejects(centerX - radius, centerY - radius, (2 * radius) + 1, (2 * radius) + 1, 0) ||
+		centerY + radius < yMin || centerY - radius >= yMax)
+	{
+		return;
+	}
+	count = circleFindOctant(radius, &offsets, scratch);
+
+	for (i = 0; i < count; i = start)
+	{
+		// Top and bottom, columns with the same offset share a row
+		y = offsets[i];
+		for (start = i; start < count && offsets[start] == y; start++);
+		if (i == 0)
+		{
+			circleSpan(centerY - y, centerX - (start - 1), centerX + (start - 1), yMin, yMax);
+			if (y != 0)
+			{
+				circleSpan(centerY + y, centerX - (start - 1), centerX + (start - 1), yMin, yMax);
+			}
+		}
+		else
+		{
+			circleSpan(centerY - y, centerX - (start - 1), centerX - i, yMin, yMax);
+			circleSpan(centerY - y, centerX + i, centerX + (start - 1), yMin, yMax);
+			circleSpan(centerY + y, centerX - (start - 1), centerX - i, yMin, yMax);
+			circleSpan(centerY + y, centerX + i, centerX + (start - 1), yMin, yMax);
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		// Left and right, one pixel each side on every row
+		y = offsets[i];
+		circleSpan(centerY - i, centerX - y, centerX - y, yMin, yMax);
+		circleSpan(centerY - i, centerX + y, centerX + y, yMin, yMax);
+		if (i != 0)
+		{
+			circleSpan(centerY + i, centerX - y, centerX - y, yMin, yMax);
+			circleSpan(centerY + i, centerX + y, centerX + y, yMin, yMax);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+
+ File        		: damage.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file that keeps a short list of the rectangles of
+									the screen that have been drawn over since the last frame.
+									Rectangles are merged when that doesn't cost any extra pixels
+									and the list never grows past DAMAGE_MAX_RECTS, so flushing a
+									frame only touches the areas that actually changed.
+
+*/
+
+#ifndef __DAMAGE_H
+#define __DAMAGE_H
+
+#include "main.h"
+
+// Most rectangles kept before the cheapest pair gets merged together
+#define DAMAGE_MAX_RECTS 16
+
+// A damaged area, x1 and y1 are one past the last column and row
+typedef struct
+{
+	int x0, y0;
+	int x1, y1;
+} DAMAGE_RECT;
+
+typedef struct
+{
+	// One spare slot holds a new rectangle while the cheapest pair is found
+	DAMAGE_RECT rects[DAMAGE_MAX_RECTS + 1];
+	int count;
+	// What the last flushed frame cost
+	uint32_t lastPixels;
+	uint32_t lastRects;
+	uint32_t maxPixels;
+} DAMAGE_LIST;
+
+// Called once for every rectangle when a list is flushed
+typedef void (*DAMAGE_FLUSH)(int x, int y, int w, int h);
+
+int damageRectArea(const DAMAGE_RECT *r)
+{
+	return (r->x1 - r->x0) * (r->y1 - r->y0);
+}
+
+// Smallest rectangle covering both 'a' and 'b'
+DAMAGE_RECT damageUnion(const DAMAGE_RECT *a, const DAMAGE_RECT *b)
+{
+	DAMAGE_RECT u;
+
+	u.x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+	u.y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+	u.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+	u.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+	return u;
+}
+
+// Number of extra pixels that would be flushed if 'a' and 'b' were merged
+int damageMergeCost(const DAMAGE_RECT *a, const DAMAGE_RECT *b)
+{
+	DAMAGE_RECT u = damageUnion(a, b);
+
+	return damageRectArea(&u) - damageRectArea(a) - damageRectArea(b);
+}
+
+void damageRemove(DAMAGE_LIST *list, int i)
+{
+	list->count--;
+	list->rects[i] = list->rects[list->count];
+}
+
+// Adds a 'w' by 'h' area to the list. Rectangles that overlap closely enough
+// to be no more expensive as one are merged straight away
+void damageAdd(DAMAGE_LIST *list, int x, int y, int w, int h)
+{
+	DAMAGE_RECT r;
+	int i, j, best, bestI, bestJ, cost;
+	bool merged;
+
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
+	r.x0 = x;
+	r.y0 = y;
+	r.x1 = x + w;
+	r.y1 = y + h;
+
+	// Keep folding the new rectangle into the list until nothing else is worth merging
+	do
+	{
+		merged = false;
+		for (i = 0; i < list->count; i++)
+		{
+			if (damageMergeCost(&r, &list->rects[i]) <= 0)
+			{
+				r = damageUnion(&r, &list->rects[i]);
+				damageRemove(list, i);
+				merged = true;
+				break;
+			}
+		}
+	} while (merged);
+
+	if (list->count == DAMAGE_MAX_RECTS)
+	{
+		// No room, so merge whichever two rectangles waste the fewest pixels together.
+		// The new rectangle takes part as well, in the last slot
+		list->rects[list->count++] = r;
+		// Overlapping pairs have a negative cost, so start above anything a pair can cost
+		best = INT_MAX;
+		bestI = 0;
+		bestJ = 1;
+		for (i = 0; i < list->count; i++)
+		{
+			for (j = i + 1; j < list->count; j++)
+			{
+				cost = damageMergeCost(&list->rects[i], &list->rects[j]);
+				if (cost < best)
+				{
+					best = cost;
+					bestI = i;
+					bestJ = j;
+				}
+			}
+		}
+		list->rects[bestI] = damageUnion(&list->rects[bestI], &list->rects[bestJ]);
+		damageRemove(list, bestJ);
+		return;
+	}
+
+	list->rects[list->count++] = r;
+}
+
+// Number of pixels a flush will move, any overlap is counted twice just as it is copied twice
+uint32_t damageArea(const DAMAGE_LIST *list)
+{
+	uint32_t area = 0;
+	int i;
+
+	for (i = 0; i < list->count; i++)
+	{
+		area += damageRectArea(&list->rects[i]);
+	}
+	return area;
+}
+
+void damageClear(DAMAGE_LIST *list)
+{
+	list->count = 0;
+}
+
+// Hands every damaged rectangle to 'flush', records what the frame cost and empties the list
+void damageFlush(DAMAGE_LIST *list, DAMAGE_FLUSH flush)
+{
+	int i;
+
+	for (i = 0; i < list->count; i++)
+	{
+		flush(list->rects[i].x0, list->rects[i].y0,
+			list->rects[i].x1 - list->rects[i].x0, list->rects[i].y1 - list->rects[i].y0);
+	}
+	list->lastPixels = damageArea(list);
+	list->lastRects = list->count;
+	if (list->lastPixels > list->maxPixels)
+	{
+		list->maxPixels = list->lastPixels;
+	}
+	damageClear(list);
+}
+
+#endif
@@ -0,0 +1,338 @@
+/*
+
+ File        		: displaylist.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for display lists. While a list is being
+									recorded the drawing helpers in sensor_ui.h store what they
+									would have drawn instead of drawing it. When recording ends
+									the commands are grouped by colour, without moving anything
+									past a command it overlaps, and replaying the list draws them
+									in one pass with only the colour changes that are needed. A
+									static screen can be recorded once and replayed each time it
+									is shown.
+
+*/
+
+#ifndef __DISPLAYLIST_H
+#define __DISPLAYLIST_H
+
+#include "main.h"
+
+// Most commands and characters of text one list can hold
+#define DL_MAX_COMMANDS 96
+#define DL_TEXT_POOL 256
+
+// Drawn by sensor_ui.h
+void drawLineSegment(int x0, int y0, int x1, int y1);
+
+typedef enum
+{
+	DL_FILL_RECT,    // x, y, a = width, b = height
+	DL_RECTANGLE,    // x, y, a = dx, b = dy, like drawRectangle()
+	DL_HLINE,        // x, y, a = length
+	DL_VLINE,        // x, y, a = length
+	DL_LINE,         // x, y to a, b
+	DL_CIRCLE,       // x, y = centre, a = radius
+	DL_STRING        // x, y, text in the pool
+} DL_OP;
+
+typedef struct
+{
+	uint8_t op;
+	uint16_t colour;
+	uint16_t back;          // Only used by DL_STRING
+	int16_t x, y, a, b;
+	uint16_t text;          // Offset of the string in the text pool
+	const GLCD_FONT *font;
+	DAMAGE_RECT box;        // Every pixel the command can touch
+} DL_COMMAND;
+
+typedef struct
+{
+	uint32_t commands;      // Commands in the list
+	uint32_t stateChanges;  // Colour changes made by the last replay
+	uint32_t stateDropped;  // Colour changes left out because the colour was already set
+	uint32_t recordedChanges; // Colour changes the commands would have needed in the order they were recorded
+	uint32_t pixels;        // Pixels written by the last replay
+	uint32_t replays;
+	uint32_t overflows;     // Commands lost because the list was full
+} DL_STATS;
+
+typedef struct
+{
+	DL_COMMAND cmds[DL_MAX_COMMANDS];
+	int count;
+	char text[DL_TEXT_POOL];
+	int textUsed;
+	bool recorded;          // Set once recording has finished
+	DL_STATS stats;
+} DISPLAY_LIST;
+
+// The list the drawing helpers are adding to, NULL when they should draw straight away
+DISPLAY_LIST *dlRecording = NULL;
+
+// Starts recording into 'list', throwing away anything it held
+void dlBegin(DISPLAY_LIST *list)
+{
+	list->count = 0;
+	list->textUsed = 0;
+	list->recorded = false;
+	memset(&list->stats, 0, sizeof(list->stats));
+	dlRecording = list;
+}
+
+bool dlOverlaps(const DAMAGE_RECT *a, const DAMAGE_RECT *b)
+{
+	return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+bool dlSameColours(const DL_COMMAND *a, const DL_COMMAND *b)
+{
+	return a->colour == b->colour && (a->op != DL_STRING || b->op != DL_STRING || a->back == b->back);
+}
+
+// Adds a command to the list being recorded. Returns false when nothing is being
+// recorded, so the caller should draw it now instead
+bool dlCapture(DL_OP op, int x, int y, int a, int b, uint32_t colour, uint32_t back, const char *str)
+{
+	DISPLAY_LIST *list = dlRecording;
+	DL_COMMAND *cmd;
+	int len;
+
+	if (list == NULL)
+	{
+		return false;
+	}
+	len = str != NULL ? (int)strlen(str) + 1 : 0;
+	if (list->count == DL_MAX_COMMANDS || list->textUsed + len > DL_TEXT_POOL)
+	{
+		list->stats.overflows++;
+		return true;
+	}
+
+	cmd = &list->cmds[list->count++];
+	cmd->op = (uint8_t)op;
+	cmd->colour = (uint16_t)colour;
+	cmd->back = (uint16_t)back;
+	cmd->x = (int16_t)x;
+	cmd->y = (int16_t)y;
+	cmd->a = (int16_t)a;
+	cmd->b = (int16_t)b;
+	cmd->font = fbFont;
+	cmd->text = (uint16_t)list->textUsed;
+	if (str != NULL)
+	{
+		memcpy(&list->text[list->textUsed], str, len);
+		list->textUsed += len;
+	}
+
+	switch (op)
+	{
+		case DL_FILL_RECT:
+			cmd->box.x0 = x;
+			cmd->box.y0 = y;
+			cmd->box.x1 = x + a;
+			cmd->box.y1 = y + b;
+			break;
+		case DL_RECTANGLE:
+			cmd->box.x0 = x;
+			cmd->box.y0 = y;
+			cmd->box.x1 = x + a + 1;
+			cmd->box.y1 = y + b + 1;
+			break;
+		case DL_HLINE:
+			cmd->box.x0 = x;
+			cmd->box.y0 = y;
+			cmd->box.x1 = x + a;
+			cmd->box.y1 = y + 1;
+			break;
+		case DL_VLINE:
+			cmd->box.x0 = x;
+			cmd->box.y0 = y;
+			cmd->box.x1 = x + 1;
+			cmd->box.y1 = y + a;
+			break;
+		case DL_LINE:
+			cmd->box.x0 = x < a ? x : a;
+			cmd->box.y0 = y < b ? y : b;
+			cmd->box.x1 = (x > a ? x : a) + 1;
+			cmd->box.y1 = (y > b ? y : b) + 1;
+			break;
+		case DL_CIRCLE:
+			cmd->box.x0 = x - a;
+			cmd->box.y0 = y - a;
+			cmd->box.x1 = x + a + 1;
+			cmd->box.y1 = y + a + 1;
+			break;
+		case DL_STRING:
+			cmd->box.x0 = x;
+			cmd->box.y0 = y;
+			cmd->box.x1 = x + (fbFont != NULL ? (len - 1) * fbFont->width : 0);
+			cmd->box.y1 = y + (fbFont != NULL ? fbFont->height : 0);
+			break;
+	}
+	return true;
+}
+
+// Colour changes needed to draw the commands in the order they are in
+uint32_t dlCountChanges(const DISPLAY_LIST *list)
+{
+	uint32_t changes = 0;
+	int i;
+
+	for (i = 0; i < list->count; i++)
+	{
+		if (i == 0 || !dlSameColours(&list->cmds[i], &list->cmds[i - 1]))
+		{
+			changes++;
+		}
+	}
+	return changes;
+}
+
+// Stops recording and groups the commands by colour. A command is moved back to
+// just after the last one of its colour, as long as it doesn't jump over anything
+// it overlaps, so the screen looks exactly the same as drawing them in order
+void dlEnd(void)
+{
+	DISPLAY_LIST *list = dlRecording;
+	DL_COMMAND cmd;
+	int i, k, pos;
+
+	if (list == NULL)
+	{
+		return;
+	}
+	dlRecording = NULL;
+	list->stats.recordedChanges = dlCountChanges(list);
+
+	for (i = 1; i < list->count; i++)
+	{
+		cmd = list->cmds[i];
+		pos = i;
+		for (k = i - 1; k >= 0; k--)
+		{
+			if (dlSameColours(&list->cmds[k], &cmd))
+			{
+				pos = k + 1;
+				break;
+			}
+			if (dlOverlaps(&list->cmds[k].box, &cmd.box))
+			{
+				break;
+			}
+		}
+		if (pos < i)
+		{
+			memmove(&list->cmds[pos + 1], &list->cmds[pos], (i - pos) * sizeof(DL_COMMAND));
+			list->cmds[pos] = cmd;
+		}
+	}
+
+	list->stats.commands = list->count;
+	list->recorded = true;
+}
+
+// Sets the drawing colours for a command, counting only the changes that do something
+void dlSetColours(DISPLAY_LIST *list, const DL_COMMAND *cmd)
+{
+	bool changed = cmd->colour != fbColour || (cmd->op == DL_STRING && cmd->back != fbBackColour);
+
+	if (changed)
+	{
+		fbSetColour(cmd->colour);
+		if (cmd->op == DL_STRING)
+		{
+			fbSetBackColour(cmd->back);
+		}
+		list->stats.stateChanges++;
+	}
+	else
+	{
+		list->stats.stateDropped++;
+	}
+}
+
+void dlExecute(const DISPLAY_LIST *list, const DL_COMMAND *cmd)
+{
+	GLCD_FONT *oldFont = fbFont;
+
+	switch (cmd->op)
+	{
+		case DL_FILL_RECT:
+			fbFillRect(cmd->x, cmd->y, cmd->a, cmd->b, fbColour);
+			// Covering the whole screen wipes out the text slots, the same as fillBackground()
+			if (cmd->x <= 0 && cmd->y <= 0 && cmd->x + cmd->a >= FB_WIDTH && cmd->y + cmd->b >= FB_HEIGHT)
+			{
+				textInvalidateSlots();
+			}
+			break;
+		case DL_RECTANGLE:
+			fbSync();
+			fbDrawRectangle(cmd->x, cmd->y, cmd->a, cmd->b);
+			fbPutPixel(cmd->x + cmd->a, cmd->y + cmd->b);
+			fbMarkDamage(cmd->x, cmd->y, cmd->a + 1, cmd->b + 1);
+			break;
+		case DL_HLINE:
+			fbMarkDamage(cmd->x, cmd->y, cmd->a, 1);
+			fbDrawHLine(cmd->x, cmd->y, cmd->a);
+			break;
+		case DL_VLINE:
+			fbSync();
+			fbMarkDamage(cmd->x, cmd->y, 1, cmd->a);
+			fbDrawVLine(cmd->x, cmd->y, cmd->a);
+			break;
+		case DL_LINE:
+			fbSync();
+			fbMarkLineDamage(cmd->x, cmd->y, cmd->a, cmd->b);
+			drawLineSegment(cmd->x, cmd->y, cmd->a, cmd->b);
+			break;
+		case DL_CIRCLE:
+			fbSync();
+			fbMarkDamage(cmd->box.x0, cmd->box.y0, cmd->box.x1 - cmd->box.x0, cmd->box.y1 - cmd->box.y0);
+			circleDrawRows(cmd->x, cmd->y, cmd->a, 0, FB_HEIGHT);
+			break;
+		case DL_STRING:
+			fbSetFont((GLCD_FONT *)cmd->font);
+			textDrawString(cmd->x, cmd->y, &list->text[cmd->text], fbColour, fbBackColour);
+			fbSetFont(oldFont);
+			break;
+	}
+}
+
+// Draws the commands that touch 'area' into the current surface, without resetting
+// the list's statistics. Used by the tile renderer to draw one tile at a time
+void dlReplayArea(DISPLAY_LIST *list, const DAMAGE_RECT *area)
+{
+	DISPLAY_LIST *recording = dlRecording;
+	int i;
+
+	// Nothing drawn by the list should end up being recorded somewhere else
+	dlRecording = NULL;
+	for (i = 0; i < list->count; i++)
+	{
+		if (dlOverlaps(&list->cmds[i].box, area))
+		{
+			dlSetColours(list, &list->cmds[i]);
+			dlExecute(list, &list->cmds[i]);
+		}
+	}
+	dlRecording = recording;
+}
+
+// Draws everything in the list into the back buffer
+void dlReplay(DISPLAY_LIST *list)
+{
+	DAMAGE_RECT screen = {0, 0, FB_WIDTH, FB_HEIGHT};
+	uint32_t startPixels = fbPixelWrites;
+
+	list->stats.stateChanges = 0;
+	list->stats.stateDropped = 0;
+	dlReplayArea(list, &screen);
+	list->stats.pixels = fbPixelWrites - startPixels;
+	list->stats.replays++;
+}
+
+#endif
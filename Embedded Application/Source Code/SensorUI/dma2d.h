@@ -0,0 +1,207 @@
+/*
+
+ File        		: dma2d.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file that drives the DMA2D (Chrom-ART) engine for
+									register-to-memory fills, memory-to-memory copies and A8 mask
+									blends of RGB565 pixels. When the engine is not available (or HUD_USE_DMA2D is
+									set to 0) the same calls are done by the CPU, giving the same
+									pixels so the drawing code can be run against a plain buffer.
+
+*/
+
+#ifndef __DMA2D_H
+#define __DMA2D_H
+
+#include "main.h"
+
+// The device header defines DMA2D on the F746, so the engine is used by default
+#ifndef HUD_USE_DMA2D
+#ifdef DMA2D
+#define HUD_USE_DMA2D 1
+#else
+#define HUD_USE_DMA2D 0
+#endif
+#endif
+
+// Transfer modes written into DMA2D_CR
+#define DMA2D_MODE_M2M (0x0 << 16)
+#define DMA2D_MODE_BLEND (0x2 << 16)
+#define DMA2D_MODE_R2M (0x3 << 16)
+// Pixel format codes for RGB565 and 8-bit alpha masks
+#define DMA2D_FORMAT_RGB565 0x2
+#define DMA2D_FORMAT_A8 0x9
+
+// Called from the DMA2D interrupt once a transfer has finished
+typedef void (*DMA2D_CALLBACK)(void);
+
+volatile bool dma2dBusy = false;
+DMA2D_CALLBACK dma2dDone = NULL;
+
+void dma2dInit(void)
+{
+#if HUD_USE_DMA2D
+	__HAL_RCC_DMA2D_CLK_ENABLE();
+	HAL_NVIC_SetPriority(DMA2D_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+#endif
+}
+
+// Blocks until the last transfer has written all of its pixels
+void dma2dWait(void)
+{
+	while (dma2dBusy);
+}
+
+#if HUD_USE_DMA2D
+void DMA2D_IRQHandler(void)
+{
+	DMA2D_CALLBACK done = dma2dDone;
+
+	if (DMA2D->ISR & DMA2D_ISR_TCIF)
+	{
+		DMA2D->IFCR = DMA2D_IFCR_CTCIF;
+		dma2dDone = NULL;
+		dma2dBusy = false;
+		if (done != NULL)
+		{
+			done();
+		}
+	}
+}
+
+// Starts the transfer set up in the registers, the CPU is free until it finishes
+void dma2dStart(uint32_t mode, int w, int h, DMA2D_CALLBACK done)
+{
+	dma2dDone = done;
+	dma2dBusy = true;
+	DMA2D->NLR = ((uint32_t)w << 16) | (uint32_t)h;
+	DMA2D->CR = mode | DMA2D_CR_TCIE | DMA2D_CR_START;
+}
+#endif
+
+// Fills a 'w' by 'h' block at 'dst', where 'pitch' is the width of a whole row
+// in pixels. Returns straight away, 'done' (which can be NULL) is called once
+// the pixels have been written
+void dma2dFill(uint16_t *dst, int pitch, int w, int h, uint32_t colour, DMA2D_CALLBACK done)
+{
+#if HUD_USE_DMA2D
+	dma2dWait();
+	DMA2D->OPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OCOLR = colour & 0xFFFF;
+	DMA2D->OMAR = (uint32_t)dst;
+	DMA2D->OOR = pitch - w;
+	dma2dStart(DMA2D_MODE_R2M, w, h, done);
+#else
+	int i, j;
+
+	for (j = 0; j < h; j++)
+	{
+		for (i = 0; i < w; i++)
+		{
+			dst[i] = (uint16_t)colour;
+		}
+		dst += pitch;
+	}
+	if (done != NULL)
+	{
+		done();
+	}
+#endif
+}
+
+// Copies a 'w' by 'h' block of pixels from 'src' to 'dst', each with its own row pitch
+void dma2dCopy(const uint16_t *src, int srcPitch, uint16_t *dst, int dstPitch, int w, int h, DMA2D_CALLBACK done)
+{
+#if HUD_USE_DMA2D
+	dma2dWait();
+	DMA2D->FGMAR = (uint32_t)src;
+	DMA2D->FGOR = srcPitch - w;
+	DMA2D->FGPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OMAR = (uint32_t)dst;
+	DMA2D->OOR = dstPitch - w;
+	dma2dStart(DMA2D_MODE_M2M, w, h, done);
+#else
+	int j;
+
+	for (j = 0; j < h; j++)
+	{
+		memcpy(dst, src, w * sizeof(uint16_t));
+		src += srcPitch;
+		dst += dstPitch;
+	}
+	if (done != NULL)
+	{
+		done();
+	}
+#endif
+}
+
+// Widens an RGB565 colour to the RGB888 the DMA2D colour registers take
+uint32_t dma2dRGB888(uint32_t colour)
+{
+	uint32_t r = (colour >> 11) & 0x1F;
+	uint32_t g = (colour >> 5) & 0x3F;
+	uint32_t b = colour & 0x1F;
+
+	return (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+// Mixes 'fg' over 'bg' by 'alpha' (0 to 255), one channel at a time
+uint16_t dma2dBlendPixel(uint32_t fg, uint32_t bg, uint32_t alpha)
+{
+	uint32_t r, g, b;
+
+	r = ((((fg >> 11) & 0x1F) * alpha) + (((bg >> 11) & 0x1F) * (255 - alpha))) / 255;
+	g = ((((fg >> 5) & 0x3F) * alpha) + (((bg >> 5) & 0x3F) * (255 - alpha))) / 255;
+	b = (((fg & 0x1F) * alpha) + ((bg & 0x1F) * (255 - alpha))) / 255;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// Paints 'colour' through an 8-bit alpha mask onto a 'w' by 'h' block at 'dst'.
+// Pixels where the mask is 0 are left as they were
+void dma2dBlendA8(const uint8_t *mask, int maskPitch, uint16_t *dst, int dstPitch, int w, int h, uint32_t colour, DMA2D_CALLBACK done)
+{
+#if HUD_USE_DMA2D
+	dma2dWait();
+	DMA2D->FGMAR = (uint32_t)mask;
+	DMA2D->FGOR = maskPitch - w;
+	DMA2D->FGPFCCR = DMA2D_FORMAT_A8;
+	DMA2D->FGCOLR = dma2dRGB888(colour);
+	DMA2D->BGMAR = (uint32_t)dst;
+	DMA2D->BGOR = dstPitch - w;
+	DMA2D->BGPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OMAR = (uint32_t)dst;
+	DMA2D->OOR = dstPitch - w;
+	dma2dStart(DMA2D_MODE_BLEND, w, h, done);
+#else
+	int i, j;
+
+	for (j = 0; j < h; j++)
+	{
+		for (i = 0; i < w; i++)
+		{
+			if (mask[i] == 255)
+			{
+				dst[i] = (uint16_t)colour;
+			}
+			else if (mask[i] != 0)
+			{
+				dst[i] = dma2dBlendPixel(colour, dst[i], mask[i]);
+			}
+		}
+		mask += maskPitch;
+		dst += dstPitch;
+	}
+	if (done != NULL)
+	{
+		done();
+	}
+#endif
+}
+
+#endif
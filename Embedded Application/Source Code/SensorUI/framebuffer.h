@@ -0,0 +1,778 @@
+/*
+
+ File        		: framebuffer.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file that draws straight into the RGB565 frame
+									buffers in SDRAM. There are two buffers: the LTDC shows the
+									front one while everything is drawn into the back one, and
+									fbPresent() swaps them on the vertical blank so the rider
+									never sees a half drawn frame. Fills are done a whole
+									horizontal span at a time and larger blocks are handed to
+									the DMA2D engine. Drawing records the areas it touches in
+									fbDamage so a present only has to copy those. The pixels
+									are RGB565, or palette indexes in CLUT mode (palette.h).
+
+*/
+
+#ifndef __FRAMEBUFFER_H
+#define __FRAMEBUFFER_H
+
+#include "main.h"
+
+#define FB_WIDTH GLCD_WIDTH
+#define FB_HEIGHT GLCD_HEIGHT
+// Number of pixels in one whole frame buffer
+#define FB_SIZE (FB_WIDTH * FB_HEIGHT)
+// Blocks smaller than this are quicker to fill with the CPU than to set up a DMA2D transfer
+#define FB_DMA2D_MIN_PIXELS 256
+// Longest fbPresent() will wait for the LTDC before swapping the buffers itself (ms)
+#define FB_PRESENT_TIMEOUT 50
+// SDRAM on the board. The GLCD driver's frame buffer is at its start, and the back
+// buffer, overlay and background cache follow it, see bgcache.h for the check they fit
+#define FB_SDRAM_SIZE 0x00800000
+// Long lines are marked as damaged in pieces this many pixels long, so the damage hugs the line
+#define FB_LINE_DAMAGE_STEP 16
+// Most clip rectangles that can be pushed at once
+#define FB_CLIP_DEPTH 4
+// Pixels in one 32-bit word of a frame buffer
+#define FB_PIXELS_PER_WORD (4 / (int)sizeof(FB_PIXEL))
+// Set to 1 to time the fills against one GLCD_DrawPixel() call per pixel at start
+// up, see fbFillBenchmark()
+#ifndef FB_FILL_BENCH
+#define FB_FILL_BENCH 0
+#endif
+
+// A block of pixels that can be drawn into, one row after another.
+// Drawing is done in screen coordinates, 'x' and 'y' are where the surface's
+// top left pixel sits on screen (0, 0 for the frame buffers)
+typedef struct
+{
+	FB_PIXEL *pixels;
+	int width;
+	int height;
+	int x, y;
+} FB_SURFACE;
+
+// Counters for how frames have reached the screen
+typedef struct
+{
+	uint32_t presents;     // Frames swapped onto the screen
+	uint32_t vblanks;      // Vertical blanks seen by the LTDC line interrupt
+	uint32_t missedVsyncs; // Vertical blanks a finished frame had to wait past
+	uint32_t lastLatency;  // Time from fbPresent() to the swap (ms)
+	uint32_t maxLatency;
+} FB_PRESENT_STATS;
+
+// Counters for drawing cut away by the clip rectangle
+typedef struct
+{
+	uint32_t pixels;       // Pixel writes left out because they were outside the clip
+	uint32_t rejected;     // Shapes left out altogether before being rasterized
+} FB_CLIP_STATS;
+
+FB_SURFACE fbBuffer[2];
+int fbFront = 0;
+FB_SURFACE *fbSurface = &fbBuffer[1];
+
+// Everything drawn into the back buffer since the last present
+DAMAGE_LIST fbDamage;
+FB_PRESENT_STATS fbStats;
+
+// Where drawing is allowed: the surface, cut down by every rectangle pushed with
+// fbPushClip(). 'x1' and 'y1' are one past the last column and row
+DAMAGE_RECT fbClip;
+DAMAGE_RECT fbClipStack[FB_CLIP_DEPTH];
+int fbClipDepth = 0;
+FB_CLIP_STATS fbClipStats;
+
+// Every pixel drawn by the CPU or the DMA2D, pixels drawn twice are counted twice
+uint32_t fbPixelWrites = 0;
+// Cleared while drawing into something that isn't a frame buffer, such as a tile
+bool fbDamageEnabled = true;
+
+// Set by fbPresent() and cleared by the LTDC interrupt once the swap is done
+volatile uint32_t fbFlipAddress = 0;
+volatile uint32_t fbFlipVblank;
+volatile uint32_t fbFlipTick;
+volatile uint32_t fbVblanks = 0;
+// DWT cycle count at the last vertical blank, and the time between the last two
+volatile uint32_t fbVblankStamp = 0;
+volatile uint32_t fbVblankCycles = 0;
+
+// Colours and font used by the pixel, line and text functions
+uint16_t fbColour = GLCD_COLOR_BLACK;
+uint16_t fbBackColour = GLCD_COLOR_WHITE;
+GLCD_FONT *fbFont = NULL;
+
+// Works out fbClip again after the surface or the clip stack has changed
+void fbUpdateClip(void)
+{
+	DAMAGE_RECT *top;
+
+	fbClip.x0 = fbSurface->x;
+	fbClip.y0 = fbSurface->y;
+	fbClip.x1 = fbSurface->x + fbSurface->width;
+	fbClip.y1 = fbSurface->y + fbSurface->height;
+	if (fbClipDepth > 0)
+	{
+		top = &fbClipStack[fbClipDepth - 1];
+		fbClip.x0 = top->x0 > fbClip.x0 ? top->x0 : fbClip.x0;
+		fbClip.y0 = top->y0 > fbClip.y0 ? top->y0 : fbClip.y0;
+		fbClip.x1 = top->x1 < fbClip.x1 ? top->x1 : fbClip.x1;
+		fbClip.y1 = top->y1 < fbClip.y1 ? top->y1 : fbClip.y1;
+	}
+}
+
+// Points drawing at another surface
+void fbSetSurface(FB_SURFACE *surface)
+{
+	fbSurface = surface;
+	fbUpdateClip();
+}
+
+// Only lets drawing touch the 'w' by 'h' block at 'x', 'y' as well as whatever
+// was already allowed, until the matching fbPopClip(). Returns false if the
+// stack is full, in which case the clip is left as it was
+bool fbPushClip(int x, int y, int w, int h)
+{
+	DAMAGE_RECT *rect;
+
+	if (fbClipDepth == FB_CLIP_DEPTH)
+	{
+		return false;
+	}
+	rect = &fbClipStack[fbClipDepth];
+	rect->x0 = x;
+	rect->y0 = y;
+	rect->x1 = x + w;
+	rect->y1 = y + h;
+	// Each entry already holds everything below it cut down, so only the top is checked
+	if (fbClipDepth > 0)
+	{
+		rect->x0 = rect->x0 > rect[-1].x0 ? rect->x0 : rect[-1].x0;
+		rect->y0 = rect->y0 > rect[-1].y0 ? rect->y0 : rect[-1].y0;
+		rect->x1 = rect->x1 < rect[-1].x1 ? rect->x1 : rect[-1].x1;
+		rect->y1 = rect->y1 < rect[-1].y1 ? rect->y1 : rect[-1].y1;
+	}
+	fbClipDepth++;
+	fbUpdateClip();
+	return true;
+}
+
+void fbPopClip(void)
+{
+	if (fbClipDepth > 0)
+	{
+		fbClipDepth--;
+		fbUpdateClip();
+	}
+}
+
+// True when nothing of the 'w' by 'h' block at 'x', 'y' is inside the clip, so a
+// shape in that box can be skipped before it is rasterized. 'pixels' is how many
+// writes drawing it would have cost, for the statistics
+bool fbRejects(int x, int y, int w, int h, uint32_t pixels)
+{
+	if (x < fbClip.x1 && y < fbClip.y1 && x + w > fbClip.x0 && y + h > fbClip.y0)
+	{
+		return false;
+	}
+	fbClipStats.rejected++;
+	fbClipStats.pixels += pixels;
+	return true;
+}
+
+// Sets up both frame buffers and the LTDC vertical blank interrupt.
+// Must be called after GLCD_Initialize()
+void fbInit(void)
+{
+	FB_PIXEL *base = (FB_PIXEL *)GLCD_FrameBufferAddress();
+	int i;
+
+	// The second buffer sits straight after the one the GLCD driver set up
+	for (i = 0; i < 2; i++)
+	{
+		fbBuffer[i].pixels = base + (i * FB_SIZE);
+		fbBuffer[i].width = FB_WIDTH;
+		fbBuffer[i].height = FB_HEIGHT;
+		fbBuffer[i].x = 0;
+		fbBuffer[i].y = 0;
+	}
+	fbFront = 0;
+	fbClipDepth = 0;
+	fbSetSurface(&fbBuffer[1]);
+	damageClear(&fbDamage);
+
+	dma2dInit();
+	paletteInit();
+
+	// Interrupt on the first line after the active area, which is the start of the vertical blank
+	LTDC->LIPCR = (LTDC->AWCR & LTDC_AWCR_AAH) + 1;
+	LTDC->ICR = LTDC_ICR_CLIF;
+	LTDC->IER |= LTDC_IER_LIE;
+	HAL_NVIC_SetPriority(LTDC_IRQn, 1, 0);
+	HAL_NVIC_EnableIRQ(LTDC_IRQn);
+}
+
+// Shows the buffer at 'address' and records how long it waited to get there. 'reload' is
+// LTDC_SRCR_IMR to change it straight away, only safe in the blank, or LTDC_SRCR_VBR to
+// have the LTDC change it at the start of the next one
+void fbFlip(uint32_t address, uint32_t reload)
+{
+	uint32_t latency = HAL_GetTick() - fbFlipTick;
+
+	LTDC_Layer1->CFBAR = address;
+	LTDC->SRCR = reload;
+
+	if (fbVblanks - fbFlipVblank > 1)
+	{
+		fbStats.missedVsyncs += fbVblanks - fbFlipVblank - 1;
+	}
+	fbStats.lastLatency = latency;
+	if (latency > fbStats.maxLatency)
+	{
+		fbStats.maxLatency = latency;
+	}
+	fbStats.presents++;
+	fbFlipAddress = 0;
+}
+
+// Moves the lean needle, done by overlay.h
+void overlayVblank(void);
+
+void LTDC_IRQHandler(void)
+{
+	if (LTDC->ISR & LTDC_ISR_LIF)
+	{
+		LTDC->ICR = LTDC_ICR_CLIF;
+		fbVblanks++;
+		fbStats.vblanks = fbVblanks;
+		fbVblankCycles = DWT->CYCCNT - fbVblankStamp;
+		fbVblankStamp = DWT->CYCCNT;
+		paletteLoad();
+
+		// The panel is between frames, so the layer address can change without tearing
+		if (fbFlipAddress != 0)
+		{
+			fbFlip(fbFlipAddress, LTDC_SRCR_IMR);
+		}
+		overlayVblank();
+	}
+}
+
+// Waits for any DMA2D fill or copy to finish so the CPU can safely draw over it.
+// Anything that writes pixels with the CPU should call this first
+void fbSync(void)
+{
+	dma2dWait();
+}
+
+// Records a 'w' by 'h' block of the back buffer as drawn over
+void fbMarkDamage(int x, int y, int w, int h)
+{
+	if (!fbDamageEnabled)
+	{
+		return;
+	}
+	// Only the part that is on screen needs to be copied
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if (x + w > FB_WIDTH)
+	{
+		w = FB_WIDTH - x;
+	}
+	if (y + h > FB_HEIGHT)
+	{
+		h = FB_HEIGHT - y;
+	}
+	damageAdd(&fbDamage, x, y, w, h);
+}
+
+// Records the pixels a line can touch as a run of small blocks rather than one
+// bounding box, so a diagonal needle doesn't damage the whole area around it
+void fbMarkLineDamage(int x0, int y0, int x1, int y1)
+{
+	int steps, pieces, i, ax, ay, bx, by;
+
+	steps = abs(x1 - x0) > abs(y1 - y0) ? abs(x1 - x0) : abs(y1 - y0);
+	pieces = (steps + FB_LINE_DAMAGE_STEP - 1) / FB_LINE_DAMAGE_STEP;
+	if (pieces < 1)
+	{
+		pieces = 1;
+	}
+
+	for (i = 0; i < pieces; i++)
+	{
+		ax = x0 + ((x1 - x0) * i) / pieces;
+		ay = y0 + ((y1 - y0) * i) / pieces;
+		bx = x0 + ((x1 - x0) * (i + 1)) / pieces;
+		by = y0 + ((y1 - y0) * (i + 1)) / pieces;
+		// One pixel either side covers where Bresenham strays from the true line
+		fbMarkDamage((ax < bx ? ax : bx) - 1, (ay < by ? ay : by) - 1, abs(bx - ax) + 3, abs(by - ay) + 3);
+	}
+}
+
+// Fills a block of frame buffer pixels with the DMA2D. It only writes RGB565,
+// so in CLUT mode two pixels are filled as one when the block starts and ends
+// on even columns, and anything else is left to the CPU
+void fbBlockFill(FB_PIXEL *dst, int pitch, int w, int h, uint32_t colour)
+{
+#if HUD_USE_CLUT
+	int j;
+
+	if ((((uintptr_t)dst | (uint32_t)pitch | (uint32_t)w) & 1) == 0)
+	{
+		dma2dFill((uint16_t *)dst, pitch / 2, w / 2, h, (colour & 0xFF) * 0x0101, NULL);
+		return;
+	}
+	fbSync();
+	for (j = 0; j < h; j++)
+	{
+		memset(dst + (j * pitch), (int)(colour & 0xFF), w);
+	}
+#else
+	dma2dFill(dst, pitch, w, h, colour, NULL);
+#endif
+}
+
+// Copies a block of frame buffer pixels with the DMA2D, in pairs in CLUT mode
+// the same way as fbBlockFill()
+void fbBlockCopy(const FB_PIXEL *src, int srcPitch, FB_PIXEL *dst, int dstPitch, int w, int h)
+{
+#if HUD_USE_CLUT
+	int j;
+
+	if ((((uintptr_t)src | (uintptr_t)dst | (uint32_t)srcPitch | (uint32_t)dstPitch | (uint32_t)w) & 1) == 0)
+	{
+		dma2dCopy((const uint16_t *)src, srcPitch / 2, (uint16_t *)dst, dstPitch / 2, w / 2, h, NULL);
+		return;
+	}
+	fbSync();
+	for (j = 0; j < h; j++)
+	{
+		memcpy(dst + (j * dstPitch), src + (j * srcPitch), w);
+	}
+#else
+	dma2dCopy(src, srcPitch, dst, dstPitch, w, h, NULL);
+#endif
+}
+
+// Copies a block from one frame buffer to the other
+void fbCopyRegion(FB_SURFACE *src, FB_SURFACE *dst, int x, int y, int w, int h)
+{
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if (x + w > FB_WIDTH)
+	{
+		w = FB_WIDTH - x;
+	}
+	if (y + h > FB_HEIGHT)
+	{
+		h = FB_HEIGHT - y;
+	}
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
+	fbBlockCopy(src->pixels + (y * FB_WIDTH) + x, FB_WIDTH, dst->pixels + (y * FB_WIDTH) + x, FB_WIDTH, w, h);
+}
+
+// Brings one damaged block of the back buffer up to date with the screen
+void fbFlushRegion(int x, int y, int w, int h)
+{
+	fbCopyRegion(&fbBuffer[fbFront], &fbBuffer[1 - fbFront], x, y, w, h);
+}
+
+// Puts the finished back buffer on screen at the next vertical blank. Once it
+// is showing, only the damaged blocks are copied across so the new back buffer
+// matches the screen again
+void fbPresent(void)
+{
+	uint32_t start;
+	int back = 1 - fbFront;
+	bool timedOut = false;
+
+	if (fbDamage.count == 0)
+	{
+		return;
+	}
+
+	// The frame has to be completely drawn before it can be shown
+	fbSync();
+
+	start = HAL_GetTick();
+	fbFlipTick = start;
+	fbFlipVblank = fbVblanks;
+	fbFlipAddress = (uint32_t)fbBuffer[back].pixels;
+
+	// At most one frame goes by before the interrupt does the swap, sleep until it does.
+	// Interrupts are held off from the check to the sleep, the same as frameWait()
+	__disable_irq();
+	while (fbFlipAddress != 0)
+	{
+		__WFI();
+		__enable_irq();
+		__disable_irq();
+		if (fbFlipAddress != 0 && HAL_GetTick() - start > FB_PRESENT_TIMEOUT)
+		{
+			fbFlip(fbFlipAddress, LTDC_SRCR_VBR);
+			timedOut = true;
+		}
+	}
+	__enable_irq();
+
+	// Without the interrupt the LTDC makes the swap itself at the next blank. The old front
+	// buffer is still on screen until it does, so it can't be drawn into before then. The
+	// LTDC clears the reload bit once it's done, the wait is bounded in case it's stopped
+	start = HAL_GetTick();
+	while (timedOut && (LTDC->SRCR & LTDC_SRCR_VBR) != 0 && HAL_GetTick() - start <= FB_PRESENT_TIMEOUT)
+	{
+	}
+
+	fbFront = back;
+	fbSetSurface(&fbBuffer[1 - fbFront]);
+	damageFlush(&fbDamage, fbFlushRegion);
+}
+
+void fbSetColour(uint32_t colour)
+{
+	fbColour = (uint16_t)colour;
+}
+
+void fbSetBackColour(uint32_t colour)
+{
+	fbBackColour = (uint16_t)colour;
+}
+
+void fbSetFont(GLCD_FONT *font)
+{
+	fbFont = font;
+}
+
+// Address of the pixel at screen position 'x', 'y', which has to be on the surface
+FB_PIXEL *fbAddress(int x, int y)
+{
+	return fbSurface->pixels + ((y - fbSurface->y) * fbSurface->width) + (x - fbSurface->x);
+}
+
+// Whether the whole of a 'w' by 'h' block is inside the clip
+bool fbContains(int x, int y, int w, int h)
+{
+	return x >= fbClip.x0 && y >= fbClip.y0 && x + w <= fbClip.x1 && y + h <= fbClip.y1;
+}
+
+// Draws one pixel in the current colour, anything outside the clip is ignored
+void fbPutPixel(int x, int y)
+{
+	if (!fbContains(x, y, 1, 1))
+	{
+		fbClipStats.pixels++;
+		return;
+	}
+	*fbAddress(x, y) = fbColour;
+	fbPixelWrites++;
+}
+
+// Fills 'len' pixels of row 'y' starting from 'x', clipped to fbClip
+void fbFillSpan(int x, int y, int len, uint32_t colour)
+{
+	FB_PIXEL *dst;
+	uint32_t *dst32;
+	uint32_t word;
+
+	if (len <= 0)
+	{
+		return;
+	}
+	if (y < fbClip.y0 || y >= fbClip.y1)
+	{
+		fbClipStats.pixels += len;
+		return;
+	}
+	if (x < fbClip.x0)
+	{
+		fbClipStats.pixels += fbClip.x0 - x;
+		len -= fbClip.x0 - x;
+		x = fbClip.x0;
+	}
+	if (x + len > fbClip.x1)
+	{
+		fbClipStats.pixels += x + len - fbClip.x1;
+		len = fbClip.x1 - x;
+	}
+	if (len <= 0)
+	{
+		return;
+	}
+
+	fbSync();
+	fbPixelWrites += len;
+	dst = fbAddress(x, y);
+
+	// A row can start part way through a word, so pixels are written on their own
+	// until the rest of the span is on a word boundary
+	while (((uintptr_t)dst & 3) != 0 && len > 0)
+	{
+		*dst++ = (FB_PIXEL)colour;
+		len--;
+	}
+
+	// Two RGB565 or four L8 pixels are packed into every 32-bit store
+#if HUD_USE_CLUT
+	word = (colour & 0xFF) * 0x01010101;
+#else
+	word = (colour & 0xFFFF) | (colour << 16);
+#endif
+	dst32 = (uint32_t *)dst;
+	while (len >= 4 * FB_PIXELS_PER_WORD)
+	{
+		dst32[0] = word;
+		dst32[1] = word;
+		dst32[2] = word;
+		dst32[3] = word;
+		dst32 += 4;
+		len -= 4 * FB_PIXELS_PER_WORD;
+	}
+	while (len >= FB_PIXELS_PER_WORD)
+	{
+		*dst32++ = word;
+		len -= FB_PIXELS_PER_WORD;
+	}
+
+	// Pixels left over at the end of the span
+	dst = (FB_PIXEL *)dst32;
+	while (len-- > 0)
+	{
+		*dst++ = (FB_PIXEL)colour;
+	}
+}
+
+// Same as GLCD_DrawHLine and GLCD_DrawVLine, in the current colour
+void fbDrawHLine(int x, int y, int len)
+{
+	fbFillSpan(x, y, len, fbColour);
+}
+
+void fbDrawVLine(int x, int y, int len)
+{
+	int end = y + len, j;
+
+	if (len <= 0 || fbRejects(x, y, 1, len, len))
+	{
+		return;
+	}
+	if (y < fbClip.y0)
+	{
+		fbClipStats.pixels += fbClip.y0 - y;
+		y = fbClip.y0;
+	}
+	if (end > fbClip.y1)
+	{
+		fbClipStats.pixels += end - fbClip.y1;
+		end = fbClip.y1;
+	}
+	for (j = y; j < end; j++)
+	{
+		*fbAddress(x, j) = fbColour;
+	}
+	if (end > y)
+	{
+		fbPixelWrites += end - y;
+	}
+}
+
+// Same as GLCD_DrawRectangle, the bottom right corner pixel is left out
+void fbDrawRectangle(int x, int y, int w, int h)
+{
+	if (fbRejects(x, y, w + 1, h + 1, 2 * (w + h)))
+	{
+		return;
+	}
+	fbDrawHLine(x, y, w);
+	fbDrawHLine(x, y + h, w);
+	fbDrawVLine(x, y, h);
+	fbDrawVLine(x + w, y, h);
+}
+
+// Fills a 'w' by 'h' block with its top left corner at 'x', 'y'. Large blocks
+// are filled by the DMA2D in the background, fbSync() waits for them
+void fbFillRect(int x, int y, int w, int h, uint32_t colour)
+{
+	int whole = w * h, j;
+
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
+	if (x < fbClip.x0)
+	{
+		w -= fbClip.x0 - x;
+		x = fbClip.x0;
+	}
+	if (y < fbClip.y0)
+	{
+		h -= fbClip.y0 - y;
+		y = fbClip.y0;
+	}
+	if (x + w > fbClip.x1)
+	{
+		w = fbClip.x1 - x;
+	}
+	if (y + h > fbClip.y1)
+	{
+		h = fbClip.y1 - y;
+	}
+	if (w <= 0 || h <= 0)
+	{
+		fbClipStats.rejected++;
+		fbClipStats.pixels += whole;
+		return;
+	}
+	fbClipStats.pixels += whole - (w * h);
+	fbMarkDamage(x, y, w, h);
+
+	if (w * h >= FB_DMA2D_MIN_PIXELS)
+	{
+		fbPixelWrites += w * h;
+		fbBlockFill(fbAddress(x, y), fbSurface->width, w, h, colour);
+		return;
+	}
+
+	for (j = y; j < y + h; j++)
+	{
+		fbFillSpan(x, j, w, colour);
+	}
+}
+
+// Draws one character of the current font in the current colours, the same
+// way GLCD_DrawChar does. Each row of the bitmap is (width+7)/8 bytes, with
+// the left most pixel in the lowest bit. The glyph is cut to the clip once, then
+// the rows inside it are walked with a pointer
+void fbDrawChar(int x, int y, int ch)
+{
+	const uint8_t *bitmap;
+	FB_PIXEL *dst;
+	int bytesPerRow, i, j, i0, i1, j0, j1;
+
+	if (fbFont == NULL || fbRejects(x, y, fbFont->width, fbFont->height, fbFont->width * fbFont->height))
+	{
+		return;
+	}
+
+	// Columns and rows of the glyph that are inside the clip
+	i0 = fbClip.x0 > x ? fbClip.x0 - x : 0;
+	j0 = fbClip.y0 > y ? fbClip.y0 - y : 0;
+	i1 = fbClip.x1 < x + fbFont->width ? fbClip.x1 - x : fbFont->width;
+	j1 = fbClip.y1 < y + fbFont->height ? fbClip.y1 - y : fbFont->height;
+	fbClipStats.pixels += (fbFont->width * fbFont->height) - ((i1 - i0) * (j1 - j0));
+	fbPixelWrites += (i1 - i0) * (j1 - j0);
+
+	bytesPerRow = (fbFont->width + 7) / 8;
+	bitmap = fbFont->bitmap + ((ch - (int)fbFont->offset) * bytesPerRow * fbFont->height) + (j0 * bytesPerRow);
+
+	for (j = j0; j < j1; j++, bitmap += bytesPerRow)
+	{
+		dst = fbAddress(x + i0, y + j);
+		for (i = i0; i < i1; i++)
+		{
+			*dst++ = ((bitmap[i >> 3] >> (i & 7)) & 1) ? fbColour : fbBackColour;
+		}
+	}
+}
+
+// Same as GLCD_DrawString, the characters are placed one font width apart
+void fbDrawString(int x, int y, const char *str)
+{
+	if (fbFont == NULL)
+	{
+		return;
+	}
+	fbSync();
+	fbMarkDamage(x, y, (int)strlen(str) * fbFont->width, fbFont->height);
+	while (*str)
+	{
+		fbDrawChar(x, y, *str++);
+		x += fbFont->width;
+	}
+}
+
+#if FB_FILL_BENCH
+
+typedef struct
+{
+	uint32_t pixels;         // Pixels in each fill timed, the whole screen
+	uint32_t pixelCycles;    // One GLCD_DrawPixel() call per pixel, as fillBackground() used to
+	uint32_t spanCycles;     // fbFillSpan() a row at a time on the CPU
+	uint32_t rectCycles;     // fbFillRect(), which hands a block this big to the DMA2D
+	uint32_t pixelRate;      // The same three as pixels a second
+	uint32_t spanRate;
+	uint32_t rectRate;
+} FB_FILL_BENCH_STATS;
+
+FB_FILL_BENCH_STATS fbFillBenchStats;
+
+// Pixels a second for 'pixels' written in 'cycles' of the core clock
+uint32_t fbFillRate(uint32_t pixels, uint32_t cycles)
+{
+	return cycles != 0 ? (uint32_t)(((float)pixels * (float)SystemCoreClock) / (float)cycles) : 0;
+}
+
+// Fills a whole frame three ways and times each with the DWT. The old way draws on
+// the screen the GLCD driver shows, the other two into the back buffer
+void fbFillBenchmark(void)
+{
+	uint32_t start;
+	int x, y;
+
+	memset(&fbFillBenchStats, 0, sizeof(fbFillBenchStats));
+	fbFillBenchStats.pixels = FB_SIZE;
+
+	start = DWT->CYCCNT;
+	GLCD_SetForegroundColor(GLCD_COLOR_BLUE);
+	for (y = 0; y < FB_HEIGHT; y++)
+	{
+		for (x = 0; x < FB_WIDTH; x++)
+		{
+			GLCD_DrawPixel(x, y);
+		}
+	}
+	fbFillBenchStats.pixelCycles = DWT->CYCCNT - start;
+
+	start = DWT->CYCCNT;
+	for (y = 0; y < FB_HEIGHT; y++)
+	{
+		fbFillSpan(0, y, FB_WIDTH, GLCD_COLOR_BLUE);
+	}
+	fbFillBenchStats.spanCycles = DWT->CYCCNT - start;
+
+	start = DWT->CYCCNT;
+	fbFillRect(0, 0, FB_WIDTH, FB_HEIGHT, GLCD_COLOR_BLUE);
+	fbSync();
+	fbFillBenchStats.rectCycles = DWT->CYCCNT - start;
+
+	fbFillBenchStats.pixelRate = fbFillRate(FB_SIZE, fbFillBenchStats.pixelCycles);
+	fbFillBenchStats.spanRate = fbFillRate(FB_SIZE, fbFillBenchStats.spanCycles);
+	fbFillBenchStats.rectRate = fbFillRate(FB_SIZE, fbFillBenchStats.rectCycles);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,377 @@
+/*
+
+ File        		: fusion.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the lean angle fusion. Every IMU sample
+									is run through either a complementary filter or Madgwick's
+									filter, which follow the gyro through quick changes and only
+									lean on the accelerometer to stop the gyro drifting. That
+									keeps the angle steady while the accelerometer is thrown off
+									by cornering, where the accelerometer on its own reads a
+									lean that is badly wrong. Both filters track which way is
+									down as seen by the MPU, so the angles come out the same
+									way as the accelerometer's own tilt however the MPU is
+									mounted. Everything is single precision for the M7's FPU.
+
+*/
+
+#ifndef __FUSION_H
+#define __FUSION_H
+
+#include "main.h"
+
+#define FUSION_COMPLEMENTARY 0
+#define FUSION_MADGWICK 1
+
+// Filter used until fusionSetFilter() picks another
+#ifndef FUSION_FILTER
+#define FUSION_FILTER FUSION_COMPLEMENTARY
+#endif
+
+// Complementary filter time constant, how long the accelerometer takes to pull the angle round (s)
+#define FUSION_TAU 1.0f
+// Madgwick's filter gain
+#define FUSION_BETA 0.1f
+// The accelerometer is trusted less the further it is from 1 g, and not at all beyond this (g)
+#define FUSION_ACCEL_WINDOW 0.1f
+// Longest gap between samples that is integrated, longer ones are taken as this (s).
+// Long enough for one sample a frame when the MPU is read with IMU_MODE_FRAME
+#define FUSION_MAX_DT 0.05f
+
+// Raw gyro readings to radians a second
+#define FUSION_GYRO_SCALE (IMU_GYRO_SCALE * FAST_RAD_PER_DEG)
+
+typedef struct
+{
+	float roll, pitch, yaw;  // Degrees, roll turned round to match the screen
+	uint32_t micros;         // Time of the sample they were worked out from
+	uint32_t sequence;       // Sequence number of that sample
+} FUSION_OUTPUT;
+
+typedef struct
+{
+	uint32_t updates;
+	uint32_t cycles;         // Time the last update took
+	uint32_t maxCycles;
+	uint32_t totalCycles;    // Time taken over every update, for an average
+	uint32_t rejected;       // Updates where the accelerometer was too far from 1 g to use
+} FUSION_STATS;
+
+typedef struct
+{
+	int filter;
+	bool started;
+	uint32_t lastMicros;
+	float g[3];              // Which way is up as seen by the MPU, complementary filter
+	float q[4];              // Orientation, Madgwick's filter
+	float yaw;               // Turn about the vertical (radians)
+} FUSION_STATE;
+
+FUSION_STATE fusion;
+FUSION_OUTPUT fusionOutput;
+FUSION_STATS fusionStats;
+
+// Starts again from the next sample, with 'filter' being FUSION_COMPLEMENTARY or FUSION_MADGWICK
+void fusionSetFilter(int filter)
+{
+	memset(&fusion, 0, sizeof(fusion));
+	fusion.filter = filter;
+}
+
+void fusionInit(void)
+{
+	memset(&fusionStats, 0, sizeof(fusionStats));
+	memset(&fusionOutput, 0, sizeof(fusionOutput));
+	fusionSetFilter(FUSION_FILTER);
+}
+
+// Starts both filters level with the accelerometer 'a', which has been normalised
+void fusionStart(const float *a)
+{
+	float roll = atan2f(a[1], a[2]) * 0.5f;
+	float pitch = atan2f(-a[0], sqrtf((a[1] * a[1]) + (a[2] * a[2]))) * 0.5f;
+	float cr = cosf(roll), sr = sinf(roll), cp = cosf(pitch), sp = sinf(pitch);
+
+	fusion.g[0] = a[0];
+	fusion.g[1] = a[1];
+	fusion.g[2] = a[2];
+	fusion.q[0] = cr * cp;
+	fusion.q[1] = sr * cp;
+	fusion.q[2] = cr * sp;
+	fusion.q[3] = -sr * sp;
+	fusion.yaw = 0.0f;
+	fusion.started = true;
+}
+
+// Follows the gyro 'w' (rad/s) for 'dt' seconds, then pulls which way is up a
+// little towards the accelerometer 'a', by 'trust' from 0 to 1
+void fusionComplementary(const float *w, const float *a, float dt, float trust)
+{
+	float *g = fusion.g;
+	float cx, cy, cz, k, n;
+
+	// Up is fixed in the world, so seen by the MPU it turns the other way to the gyro
+	cx = (w[1] * g[2]) - (w[2] * g[1]);
+	cy = (w[2] * g[0]) - (w[0] * g[2]);
+	cz = (w[0] * g[1]) - (w[1] * g[0]);
+	g[0] -= cx * dt;
+	g[1] -= cy * dt;
+	g[2] -= cz * dt;
+
+	k = trust * (dt / (FUSION_TAU + dt));
+	g[0] += k * (a[0] - g[0]);
+	g[1] += k * (a[1] - g[1]);
+	g[2] += k * (a[2] - g[2]);
+
+	n = 1.0f / fastSqrt((g[0] * g[0]) + (g[1] * g[1]) + (g[2] * g[2]));
+	g[0] *= n;
+	g[1] *= n;
+	g[2] *= n;
+
+	// Turning about up is the yaw
+	fusion.yaw += ((w[0] * g[0]) + (w[1] * g[1]) + (w[2] * g[2])) * dt;
+}
+
+// Madgwick's gradient descent filter for a gyro and accelerometer
+// Reference: https://x-io.co.uk/open-source-imu-and-ahrs-algorithms/
+void fusionMadgwick(const float *w, const float *a, float dt, float trust)
+{
+	float *q = fusion.q;
+	float q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+	float qDot0, qDot1, qDot2, qDot3, s0, s1, s2, s3, n, beta = FUSION_BETA * trust;
+
+	// Rate of change of the orientation from the gyro
+	qDot0 = 0.5f * ((-q1 * w[0]) - (q2 * w[1]) - (q3 * w[2]));
+	qDot1 = 0.5f * ((q0 * w[0]) + (q2 * w[2]) - (q3 * w[1]));
+	qDot2 = 0.5f * ((q0 * w[1]) - (q1 * w[2]) + (q3 * w[0]));
+	qDot3 = 0.5f * ((q0 * w[2]) + (q1 * w[1]) - (q2 * w[0]));
+
+	if (beta > 0.0f)
+	{
+		// Step towards the orientation where gravity lines up with the accelerometer
+		s0 = (4.0f * q0 * q2 * q2) + (2.0f * q2 * a[0]) + (4.0f * q0 * q1 * q1) - (2.0f * q1 * a[1]);
+		s1 = (4.0f * q1 * q3 * q3) - (2.0f * q3 * a[0]) + (4.0f * q0 * q0 * q1) - (2.0f * q0 * a[1]) - (4.0f * q1) +
+			(8.0f * q1 * q1 * q1) + (8.0f * q1 * q2 * q2) + (4.0f * q1 * a[2]);
+		s2 = (4.0f * q0 * q0 * q2) + (2.0f * q0 * a[0]) + (4.0f * q2 * q3 * q3) - (2.0f * q3 * a[1]) - (4.0f * q2) +
+			(8.0f * q2 * q1 * q1) + (8.0f * q2 * q2 * q2) + (4.0f * q2 * a[2]);
+		s3 = (4.0f * q1 * q1 * q3) - (2.0f * q1 * a[0]) + (4.0f * q2 * q2 * q3) - (2.0f * q2 * a[1]);
+		n = (s0 * s0) + (s1 * s1) + (s2 * s2) + (s3 * s3);
+		if (n > 0.0f)
+		{
+			n = beta / fastSqrt(n);
+			qDot0 -= n * s0;
+			qDot1 -= n * s1;
+			qDot2 -= n * s2;
+			qDot3 -= n * s3;
+		}
+	}
+
+	q0 += qDot0 * dt;
+	q1 += qDot1 * dt;
+	q2 += qDot2 * dt;
+	q3 += qDot3 * dt;
+	n = 1.0f / fastSqrt((q0 * q0) + (q1 * q1) + (q2 * q2) + (q3 * q3));
+	q[0] = q0 * n;
+	q[1] = q1 * n;
+	q[2] = q2 * n;
+	q[3] = q3 * n;
+
+	// Which way is up as seen by the MPU, for the angles
+	fusion.g[0] = 2.0f * ((q[1] * q[3]) - (q[0] * q[2]));
+	fusion.g[1] = 2.0f * ((q[0] * q[1]) + (q[2] * q[3]));
+	fusion.g[2] = (q[0] * q[0]) - (q[1] * q[1]) - (q[2] * q[2]) + (q[3] * q[3]);
+	fusion.yaw = fastAtan2(2.0f * ((q[0] * q[3]) + (q[1] * q[2])), 1.0f - (2.0f * ((q[2] * q[2]) + (q[3] * q[3]))));
+}
+
+// Angle in degrees that axis 'i' of the MPU is tilted up out of level, from the
+// up vector. The same as asin(g[i]) but without leaving the FPU
+float fusionTilt(int i)
+{
+	const float *g = fusion.g;
+
+	return fastAtan2(g[i], fastSqrt((g[0] * g[0]) + (g[1] * g[1]) + (g[2] * g[2]) - (g[i] * g[i]))) *
+		FAST_DEG_PER_RAD;
+}
+
+// Runs one IMU sample through the filter and publishes the angles in fusionOutput
+void fusionUpdate(const IMU_SAMPLE *sample)
+{
+	uint32_t start = DWT->CYCCNT;
+	float a[3], w[3], n, dt, trust;
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		a[i] = (float)sample->accel[i] * IMU_ACCEL_SCALE;
+		w[i] = (float)sample->gyro[i] * FUSION_GYRO_SCALE;
+	}
+	n = fastSqrt((a[0] * a[0]) + (a[1] * a[1]) + (a[2] * a[2]));
+	if (n == 0.0f)
+	{
+		return;
+	}
+
+	// Anything but gravity changes how hard the MPU is pushed, so the accelerometer
+	// is only trusted while that is close to 1 g
+	trust = 1.0f - (fabsf(n - 1.0f) * (1.0f / FUSION_ACCEL_WINDOW));
+	if (trust <= 0.0f)
+	{
+		trust = 0.0f;
+		fusionStats.rejected++;
+	}
+	n = 1.0f / n;
+	a[0] *= n;
+	a[1] *= n;
+	a[2] *= n;
+
+	if (!fusion.started)
+	{
+		fusionStart(a);
+		dt = 0.0f;
+	}
+	else
+	{
+		dt = (float)(sample->micros - fusion.lastMicros) * 1e-6f;
+		dt = dt > FUSION_MAX_DT ? FUSION_MAX_DT : dt;
+	}
+	fusion.lastMicros = sample->micros;
+
+	if (fusion.filter == FUSION_MADGWICK)
+	{
+		fusionMadgwick(w, a, dt, trust);
+	}
+	else
+	{
+		fusionComplementary(w, a, dt, trust);
+	}
+
+	fusionOutput.pitch = fusionTilt(0);
+	// The MPU is facing the opposite way to the screen and so the value is required to be flipped
+	fusionOutput.roll = -fusionTilt(1);
+	fusionOutput.yaw = fusion.yaw * FAST_DEG_PER_RAD;
+	fusionOutput.micros = sample->micros;
+	fusionOutput.sequence = sample->sequence;
+
+	fusionStats.updates++;
+	fusionStats.cycles = DWT->CYCCNT - start;
+	fusionStats.totalCycles += fusionStats.cycles;
+	if (fusionStats.cycles > fusionStats.maxCycles)
+	{
+		fusionStats.maxCycles = fusionStats.cycles;
+	}
+}
+
+#if FAST_MATH_BENCH
+
+typedef struct
+{
+	uint32_t calls;
+	uint32_t doubleCycles;   // Time per sample for the update with double sqrt(), asin() and M_PI
+	uint32_t floatCycles;    // Time per sample for fusionUpdate()
+	float maxError;          // Largest difference in pitch or roll between the two over the run (degrees)
+} FAST_MATH_STATS;
+
+FAST_MATH_STATS fastMathStats;
+
+// The complementary filter's update as it is written without fast_math.h, keeping its
+// own up vector and yaw in 'state'. The pitch, roll and yaw go in 'angles'
+void fastMathDoubleUpdate(const IMU_SAMPLE *sample, float *state, float dt, float *angles)
+{
+	float a[3], w[3], *g = state, cx, cy, cz, k, trust;
+	double n;
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		a[i] = sample->accel[i] / 16384.0;
+		w[i] = (sample->gyro[i] / 131.0) * 3.14159265358979323846 / 180;
+	}
+	n = sqrt((a[0] * a[0]) + (a[1] * a[1]) + (a[2] * a[2]));
+	if (n == 0)
+	{
+		return;
+	}
+	trust = 1 - (fabs(n - 1) / FUSION_ACCEL_WINDOW);
+	trust = trust < 0 ? 0 : trust;
+	a[0] /= n;
+	a[1] /= n;
+	a[2] /= n;
+
+	cx = (w[1] * g[2]) - (w[2] * g[1]);
+	cy = (w[2] * g[0]) - (w[0] * g[2]);
+	cz = (w[0] * g[1]) - (w[1] * g[0]);
+	g[0] -= cx * dt;
+	g[1] -= cy * dt;
+	g[2] -= cz * dt;
+	k = trust * (dt / (FUSION_TAU + dt));
+	g[0] += k * (a[0] - g[0]);
+	g[1] += k * (a[1] - g[1]);
+	g[2] += k * (a[2] - g[2]);
+	n = sqrt((g[0] * g[0]) + (g[1] * g[1]) + (g[2] * g[2]));
+	g[0] /= n;
+	g[1] /= n;
+	g[2] /= n;
+	state[3] += ((w[0] * g[0]) + (w[1] * g[1]) + (w[2] * g[2])) * dt;
+
+	angles[0] = 180 * asin(g[0]) / 3.14159265358979323846;
+	angles[1] = -180 * asin(g[1]) / 3.14159265358979323846;
+	angles[2] = 180 * state[3] / 3.14159265358979323846;
+}
+
+// Runs a lean from side to side through the complementary filter, once with the double
+// maths and once with fusionUpdate(), and times both with the DWT. Leaves the filter
+// to be started again by fusionInit()
+void fastMathBenchmark(void)
+{
+	IMU_SAMPLE sample;
+	float state[4], angles[3], lean, rate, e;
+	uint32_t start, doubleTotal = 0, floatTotal = 0;
+	int i;
+
+	memset(&fastMathStats, 0, sizeof(fastMathStats));
+	memset(&sample, 0, sizeof(sample));
+	fusionInit();
+	fusionSetFilter(FUSION_COMPLEMENTARY);
+	for (i = 0; i <= 360; i++)
+	{
+		// Up to 45 degrees each way and back over 3.6 s, rolling at up to 79 deg/s
+		lean = 45.0f * FAST_RAD_PER_DEG * sinf((float)i * FAST_RAD_PER_DEG);
+		rate = 45.0f * cosf((float)i * FAST_RAD_PER_DEG) * (FAST_RAD_PER_DEG / 0.01f);
+		sample.accel[1] = (int16_t)(16384.0f * sinf(lean));
+		sample.accel[2] = (int16_t)(16384.0f * cosf(lean));
+		sample.gyro[0] = (int16_t)(rate * 131.0f);
+		sample.micros = (uint32_t)i * 10000;
+
+		// The first sample starts the filter, which isn't what is being timed
+		if (i == 0)
+		{
+			fusionUpdate(&sample);
+			memcpy(state, fusion.g, sizeof(fusion.g));
+			state[3] = 0.0f;
+			continue;
+		}
+
+		start = DWT->CYCCNT;
+		fastMathDoubleUpdate(&sample, state, 0.01f, angles);
+		doubleTotal += DWT->CYCCNT - start;
+
+		start = DWT->CYCCNT;
+		fusionUpdate(&sample);
+		floatTotal += DWT->CYCCNT - start;
+
+		e = fabsf(fusionOutput.pitch - angles[0]);
+		fastMathStats.maxError = e > fastMathStats.maxError ? e : fastMathStats.maxError;
+		e = fabsf(fusionOutput.roll - angles[1]);
+		fastMathStats.maxError = e > fastMathStats.maxError ? e : fastMathStats.maxError;
+	}
+	fastMathStats.calls = 360;
+	fastMathStats.doubleCycles = doubleTotal / fastMathStats.calls;
+	fastMathStats.floatCycles = floatTotal / fastMathStats.calls;
+	fusionInit();
+}
+
+#endif
+
+#endif
@@ -0,0 +1,663 @@
+/*
+
+ File        		: imu.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for reading the MPU6050. All fourteen bytes
+									of accelerometer, temperature and gyro data are read in one
+									burst starting at ACCEL_XOUT_H. The read is started without
+									waiting and runs on the I2C1 interrupts, and when it is done
+									the completion callback publishes the values as one sample
+									with the time it arrived. The CPU only spends time on the
+									interrupts while the bytes come in, rather than waiting on
+									the bus. Set IMU_USE_IT to 0 to go back to the two blocking
+									reads, both ways fill in imuStats so they can be compared.
+									IMU_MODE picks when the reads happen. In data-ready mode the
+									MPU's INT pin interrupts on PI2 for each new sample at
+									500 Hz, which starts the read straight away and stamps the
+									sample with the microsecond counter on TIM2. In FIFO mode
+									the MPU keeps every reading at 500 Hz in its FIFO and each
+									frame empties it in one long read, averaged down to 125 Hz
+									so fast movements don't alias. In frame mode one sample is
+									read each frame. Either way the samples are queued for
+									imuTake().
+
+*/
+
+#ifndef __IMU_H
+#define __IMU_H
+
+#include "main.h"
+
+// Set to 0 to read the accelerometer and gyro with two blocking reads instead
+#ifndef IMU_USE_IT
+#define IMU_USE_IT 1
+#endif
+
+// When samples are read
+#define IMU_MODE_FRAME 0    // One burst each frame
+#define IMU_MODE_FIFO 1     // Everything the FIFO collected since the last frame
+#define IMU_MODE_DRDY 2     // One burst for each data-ready interrupt from the MPU
+#ifndef IMU_MODE
+#define IMU_MODE IMU_MODE_DRDY
+#endif
+
+#if IMU_MODE == IMU_MODE_DRDY && !IMU_USE_IT
+#error "The data-ready mode reads from its interrupt, so it needs IMU_USE_IT"
+#endif
+
+// Set to 1 to time the two blocking reads against one interrupt-driven burst at
+// start up, see imuBenchmark()
+#ifndef IMU_BENCH
+#define IMU_BENCH 0
+#endif
+
+#if IMU_BENCH && !IMU_USE_IT
+#error "The benchmark times the interrupt-driven burst, so it needs IMU_USE_IT"
+#endif
+
+//--------MPU Registers--------------------
+//
+#define MPU6050_ADDR (0x68 << 1) // 0xD0
+
+
+#define SMPLRT_DIV_REG 0x19
+#define GYRO_CONFIG_REG 0x1B
+#define ACCEL_CONFIG_REG 0x1C
+#define FIFO_EN_REG 0x23
+#define INT_PIN_CFG_REG 0x37
+#define INT_ENABLE_REG 0x38
+#define ACCEL_XOUT_H_REG 0x3B
+#define TEMP_OUT_H_REG 0x41
+#define GYRO_XOUT_H_REG 0x43
+#define USER_CTRL_REG 0x6A
+#define PWR_MGMT_1_REG 0x6B
+#define FIFO_COUNT_H_REG 0x72
+#define FIFO_R_W_REG 0x74
+#define WHO_AM_I_REG 0x75
+
+//-----------------------------------------
+
+// Raw readings to g and degrees a second, for FS_SEL = 0 on both. Multiplying by
+// these is a single float multiply where dividing by 16384.0 was done in double
+#define IMU_ACCEL_SCALE (1.0f / 16384.0f)
+#define IMU_GYRO_SCALE (1.0f / 131.0f)
+
+// ACCEL_XOUT_H up to GYRO_ZOUT_L
+#define IMU_BURST_BYTES 14
+// Rate the MPU samples at, set through SMPLRT_DIV from its 8 kHz gyro rate. I2C1 runs
+// at 100 kHz, about 11 kB/s with the ACKs. Each burst takes about 1.4 ms on the bus,
+// so reading every sample needs a slower rate, and the FIFO's 12 byte records at
+// 500 Hz are 6 kB/s, a little over half the bus, so it drains faster than it fills
+#define IMU_RATE_HZ 500
+// INT_PIN_CFG: active high push-pull pulse, cleared by any read. INT_ENABLE: DATA_RDY_EN
+#define IMU_INT_PIN_CFG 0x10
+#define IMU_INT_DATA_READY 0x01
+// MPU INT pin, on the Arduino D8 header pin
+#define IMU_INT_PORT GPIOI
+#define IMU_INT_PIN GPIO_PIN_2
+#define IMU_INT_IRQn EXTI2_IRQn
+// FIFO_EN bits for the three gyro axes and the accelerometer, each record is
+// the accelerometer then the gyro with no temperature
+#define IMU_FIFO_SOURCES 0x78
+#define IMU_FIFO_RECORD 12
+// USER_CTRL bits
+#define IMU_USER_FIFO_EN 0x40
+#define IMU_USER_FIFO_RESET 0x04
+#define IMU_FIFO_SIZE 1024
+// Most records taken from the FIFO in one read, anything left waits for the next
+#define IMU_FIFO_MAX_RECORDS 64
+// Records averaged into each sample that is published, 500 Hz down to 125 Hz
+#define IMU_DECIMATION 4
+// Published samples waiting to be taken, enough for a frame at 30 Hz of data-ready samples
+#define IMU_QUEUE_SIZE 32
+// Buckets of the jitter histogram. Bucket 0 counts changes in the time between
+// samples of 0-1 us, and each one after that covers twice the range of the one
+// before, with the last taking everything above
+#define IMU_JITTER_BUCKETS 12
+
+typedef struct
+{
+	int16_t accel[3];
+	int16_t temp;
+	int16_t gyro[3];
+	uint32_t tick;          // HAL_GetTick() when the read finished
+	uint32_t cycle;         // DWT cycle count when the sample was taken
+	uint32_t micros;        // imuMicros() when the sample was taken
+	uint32_t sequence;      // Counts up by one for every sample
+} IMU_SAMPLE;
+
+typedef struct
+{
+	uint32_t started;       // Reads put on the bus
+	uint32_t completed;     // Samples published
+	uint32_t errors;        // Reads the HAL gave up on
+	uint32_t busy;          // Reads not started because the last one was still going
+	uint32_t dropped;       // Samples lost because nothing took them from the queue
+	uint32_t busCycles;     // Time from starting the last read to its samples being published
+	uint32_t maxBusCycles;
+	uint32_t cpuCycles;     // CPU time of the last read, starting it and its interrupts up to the callback
+	uint32_t maxCpuCycles;
+	uint32_t fifoDrains;    // Times the FIFO was read
+	uint32_t fifoRecords;   // Records taken out of it
+	uint32_t fifoFill;      // Bytes in the FIFO at the last drain
+	uint32_t maxFifoFill;
+	uint32_t fifoOverflows; // Times it filled up and had to be reset, losing samples
+	uint32_t dataReady;     // Data-ready interrupts from the MPU
+	uint32_t lastInterval;  // Time between the last two samples (us)
+	uint32_t minInterval;
+	uint32_t maxInterval;
+	uint32_t jitter[IMU_JITTER_BUCKETS]; // How much each interval differed from the one before
+} IMU_STATS;
+
+// What the I2C transfer in progress is for
+typedef enum
+{
+	IMU_IDLE,
+	IMU_READ_BURST,
+	IMU_READ_COUNT,
+	IMU_READ_FIFO,
+	IMU_RESET_FIFO
+} IMU_STATE;
+
+I2C_HandleTypeDef hi2c1;
+IMU_STATS imuStats;
+volatile IMU_STATE imuState = IMU_IDLE;
+uint8_t imuBuffer[IMU_FIFO_MAX_RECORDS * IMU_FIFO_RECORD];
+uint8_t imuWriteData;
+// Samples published and not yet taken, oldest at imuQueueTail
+IMU_SAMPLE imuQueue[IMU_QUEUE_SIZE];
+volatile uint32_t imuQueueHead = 0, imuQueueTail = 0;
+uint32_t imuSequence = 0;
+// Records added up towards the next decimated sample
+int32_t imuSum[6];
+uint32_t imuSummed = 0;
+// Reads made each way by imuBenchmark(), few enough that the FIFO doesn't fill meanwhile
+#define IMU_BENCH_READS 32
+
+// Records being read out of the FIFO
+int imuFifoRecords = 0;
+// Records the FIFO held when its count was read, and when that was. The newest of
+// them was sampled no later than this, however long reading them out takes
+int imuCountRecords = 0;
+uint32_t imuCountCycle, imuCountMicros;
+// When the read in progress was started, and the CPU time it has taken so far
+uint32_t imuStartCycle;
+volatile uint32_t imuCpuCycles;
+// When the I2C interrupt running now started, the read can finish in it before it returns
+uint32_t imuIsrStart;
+// When the MPU said the sample being read was ready
+uint32_t imuReadyMicros;
+uint32_t imuLastMicros;
+uint32_t imuLastInterval = 0;
+
+// Microseconds from the free-running 32-bit TIM2 counter
+uint32_t imuMicros(void)
+{
+	return TIM2->CNT;
+}
+
+void imuReadDone(void);
+
+// Reads 'length' bytes from 'reg' into imuBuffer. With IMU_USE_IT the read runs on
+// the interrupts and imuReadDone() is called when it finishes, otherwise it blocks
+// and calls it straight away
+bool imuRead(IMU_STATE state, uint8_t reg, uint16_t length)
+{
+	imuState = state;
+#if IMU_USE_IT
+	if (HAL_I2C_Mem_Read_IT(&hi2c1, MPU6050_ADDR, reg, I2C_MEMADD_SIZE_8BIT, imuBuffer, length) != HAL_OK)
+	{
+		imuState = IMU_IDLE;
+		imuStats.errors++;
+		return false;
+	}
+#else
+	if (HAL_I2C_Mem_Read(&hi2c1, MPU6050_ADDR, reg, I2C_MEMADD_SIZE_8BIT, imuBuffer, length, 1000) != HAL_OK)
+	{
+		imuState = IMU_IDLE;
+		imuStats.errors++;
+		return false;
+	}
+	imuCpuCycles = DWT->CYCCNT - imuStartCycle;
+	imuReadDone();
+#endif
+	return true;
+}
+
+// Writes one register, in the same way as imuRead()
+bool imuWrite(IMU_STATE state, uint8_t reg, uint8_t data)
+{
+	imuState = state;
+	imuWriteData = data;
+#if IMU_USE_IT
+	if (HAL_I2C_Mem_Write_IT(&hi2c1, MPU6050_ADDR, reg, I2C_MEMADD_SIZE_8BIT, &imuWriteData, 1) != HAL_OK)
+	{
+		imuState = IMU_IDLE;
+		imuStats.errors++;
+		return false;
+	}
+#else
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, reg, I2C_MEMADD_SIZE_8BIT, &imuWriteData, 1, 1000);
+	imuState = IMU_IDLE;
+#endif
+	return true;
+}
+
+// Sets the MPU's sample rate for IMU_MODE and turns on the interrupts the reads
+// run on. In FIFO mode it starts the MPU collecting the accelerometer and gyro,
+// in data-ready mode it turns on the INT pin. Call after MPU6050_Init()
+void imuInit(void)
+{
+	uint8_t data;
+
+	memset(&imuStats, 0, sizeof(imuStats));
+	imuStats.minInterval = 0xFFFFFFFF;
+	imuQueueHead = 0;
+	imuQueueTail = 0;
+	imuSummed = 0;
+	imuSequence = 0;
+	data = (8000 / IMU_RATE_HZ) - 1;
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, SMPLRT_DIV_REG, I2C_MEMADD_SIZE_8BIT, &data, 1, 1000);
+#if IMU_MODE == IMU_MODE_FIFO
+	data = IMU_USER_FIFO_RESET;
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, USER_CTRL_REG, I2C_MEMADD_SIZE_8BIT, &data, 1, 1000);
+	data = IMU_FIFO_SOURCES;
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, FIFO_EN_REG, I2C_MEMADD_SIZE_8BIT, &data, 1, 1000);
+	data = IMU_USER_FIFO_EN;
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, USER_CTRL_REG, I2C_MEMADD_SIZE_8BIT, &data, 1, 1000);
+#endif
+#if IMU_MODE == IMU_MODE_DRDY
+	data = IMU_INT_PIN_CFG;
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, INT_PIN_CFG_REG, I2C_MEMADD_SIZE_8BIT, &data, 1, 1000);
+	data = IMU_INT_DATA_READY;
+	HAL_I2C_Mem_Write(&hi2c1, MPU6050_ADDR, INT_ENABLE_REG, I2C_MEMADD_SIZE_8BIT, &data, 1, 1000);
+	imuLastMicros = imuMicros();
+	HAL_NVIC_SetPriority(IMU_INT_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(IMU_INT_IRQn);
+#endif
+#if IMU_USE_IT
+	HAL_NVIC_SetPriority(I2C1_EV_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+	HAL_NVIC_SetPriority(I2C1_ER_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+#endif
+}
+
+// Adds how much the time between samples changed to the jitter histogram
+void imuRecordInterval(uint32_t micros)
+{
+	uint32_t interval = micros - imuLastMicros, change;
+	int bucket = 0;
+
+	imuLastMicros = micros;
+	if (imuStats.completed == 0)
+	{
+		return;
+	}
+	imuStats.lastInterval = interval;
+	if (interval < imuStats.minInterval)
+	{
+		imuStats.minInterval = interval;
+	}
+	if (interval > imuStats.maxInterval)
+	{
+		imuStats.maxInterval = interval;
+	}
+	if (imuStats.completed > 1)
+	{
+		change = interval > imuLastInterval ? interval - imuLastInterval : imuLastInterval - interval;
+		while (change > 1 && bucket < IMU_JITTER_BUCKETS - 1)
+		{
+			change >>= 1;
+			bucket++;
+		}
+		imuStats.jitter[bucket]++;
+	}
+	imuLastInterval = interval;
+}
+
+// Adds a sample to the queue, throwing away the oldest if nobody has taken it
+void imuPush(const IMU_SAMPLE *sample)
+{
+	imuRecordInterval(sample->micros);
+	if (imuQueueHead - imuQueueTail == IMU_QUEUE_SIZE)
+	{
+		imuQueueTail++;
+		imuStats.dropped++;
+	}
+	imuQueue[imuQueueHead % IMU_QUEUE_SIZE] = *sample;
+	imuQueue[imuQueueHead % IMU_QUEUE_SIZE].sequence = imuSequence++;
+	imuQueueHead++;
+	imuStats.completed++;
+}
+
+// Reads a big-endian value out of imuBuffer
+int16_t imuValue(int offset)
+{
+	return (int16_t)(imuBuffer[offset] << 8 | imuBuffer[offset + 1]);
+}
+
+// Records how long the read that just finished took
+void imuTimeRead(void)
+{
+	imuStats.busCycles = DWT->CYCCNT - imuStartCycle;
+	if (imuStats.busCycles > imuStats.maxBusCycles)
+	{
+		imuStats.maxBusCycles = imuStats.busCycles;
+	}
+	imuStats.cpuCycles = imuCpuCycles;
+#if IMU_USE_IT
+	// Called from the read's last interrupt, which only adds itself to imuCpuCycles once it returns
+	imuStats.cpuCycles += DWT->CYCCNT - imuIsrStart;
+#endif
+	if (imuStats.cpuCycles > imuStats.maxCpuCycles)
+	{
+		imuStats.maxCpuCycles = imuStats.cpuCycles;
+	}
+}
+
+// Unpacks a 14-byte burst from imuBuffer into a sample
+void imuPublishBurst(void)
+{
+	IMU_SAMPLE sample;
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		sample.accel[i] = imuValue(i * 2);
+		sample.gyro[i] = imuValue(8 + (i * 2));
+	}
+	sample.temp = imuValue(6);
+	sample.tick = HAL_GetTick();
+	sample.cycle = DWT->CYCCNT;
+#if IMU_MODE == IMU_MODE_DRDY
+	// Timed from the interrupt rather than when the bytes arrived, which depends on the bus
+	sample.cycle -= (imuMicros() - imuReadyMicros) * (SystemCoreClock / 1000000);
+	sample.micros = imuReadyMicros;
+#else
+	sample.micros = imuMicros();
+#endif
+	imuPush(&sample);
+}
+
+// Runs the records in imuBuffer through the decimator. Every IMU_DECIMATION records
+// are averaged into one sample, which filters out anything faster than the rate
+// the samples are published at before it can alias. The MPU doesn't time its
+// records, so each is placed one sample period before the one after it, counting
+// back from when FIFO_COUNT was read rather than from the end of the long read
+// that follows it
+void imuPublishFifo(int records)
+{
+	IMU_SAMPLE sample;
+	uint32_t period = SystemCoreClock / IMU_RATE_HZ, age;
+	int r, i;
+
+	for (r = 0; r < records; r++)
+	{
+		for (i = 0; i < 6; i++)
+		{
+			imuSum[i] += imuValue((r * IMU_FIFO_RECORD) + (i * 2));
+		}
+		if (++imuSummed < IMU_DECIMATION)
+		{
+			continue;
+		}
+		for (i = 0; i < 3; i++)
+		{
+			sample.accel[i] = (int16_t)(imuSum[i] / IMU_DECIMATION);
+			sample.gyro[i] = (int16_t)(imuSum[i + 3] / IMU_DECIMATION);
+		}
+		sample.temp = 0;
+		sample.tick = HAL_GetTick();
+		// Records past the ones read, when the read was capped, came after this one too
+		age = (uint32_t)(imuCountRecords - 1 - r);
+		sample.cycle = imuCountCycle - (age * period);
+		sample.micros = imuCountMicros - (age * (1000000 / IMU_RATE_HZ));
+		imuPush(&sample);
+		memset(imuSum, 0, sizeof(imuSum));
+		imuSummed = 0;
+	}
+	imuStats.fifoRecords += records;
+}
+
+// Carries on with the read that just finished
+void imuReadDone(void)
+{
+	uint32_t count;
+	int records;
+
+	switch (imuState)
+	{
+		case IMU_READ_BURST:
+			imuPublishBurst();
+			imuTimeRead();
+			imuState = IMU_IDLE;
+			break;
+		case IMU_READ_COUNT:
+			imuCountCycle = DWT->CYCCNT;
+			imuCountMicros = imuMicros();
+			count = ((uint32_t)imuBuffer[0] << 8) | imuBuffer[1];
+			imuStats.fifoDrains++;
+			imuStats.fifoFill = count;
+			if (count > imuStats.maxFifoFill)
+			{
+				imuStats.maxFifoFill = count;
+			}
+			// Once it is full, new samples are lost and the records stop lining up
+			if (count >= IMU_FIFO_SIZE || count % IMU_FIFO_RECORD != 0)
+			{
+				imuStats.fifoOverflows++;
+				imuSummed = 0;
+				memset(imuSum, 0, sizeof(imuSum));
+				imuWrite(IMU_RESET_FIFO, USER_CTRL_REG, IMU_USER_FIFO_EN | IMU_USER_FIFO_RESET);
+				break;
+			}
+			records = count / IMU_FIFO_RECORD;
+			imuCountRecords = records;
+			if (records > IMU_FIFO_MAX_RECORDS)
+			{
+				records = IMU_FIFO_MAX_RECORDS;
+			}
+			if (records == 0)
+			{
+				imuState = IMU_IDLE;
+				break;
+			}
+			imuFifoRecords = records;
+			imuRead(IMU_READ_FIFO, FIFO_R_W_REG, records * IMU_FIFO_RECORD);
+			break;
+		case IMU_READ_FIFO:
+			imuPublishFifo(imuFifoRecords);
+			imuTimeRead();
+			imuState = IMU_IDLE;
+			break;
+		default:
+			imuState = IMU_IDLE;
+			break;
+	}
+}
+
+// Starts reading whatever the MPU has. In FIFO mode that is the fill level and
+// then every whole record, otherwise it is one sample. Returns false if the last
+// read is still going. In data-ready mode the MPU starts its own reads and this
+// does nothing
+bool imuStart(void)
+{
+	uint32_t start = DWT->CYCCNT;
+
+	if (IMU_MODE == IMU_MODE_DRDY)
+	{
+		return true;
+	}
+	if (imuState != IMU_IDLE)
+	{
+		imuStats.busy++;
+		return false;
+	}
+	imuStartCycle = start;
+	imuCpuCycles = 0;
+	imuStats.started++;
+#if IMU_MODE == IMU_MODE_FIFO
+	imuRead(IMU_READ_COUNT, FIFO_COUNT_H_REG, 2);
+#elif IMU_USE_IT
+	imuRead(IMU_READ_BURST, ACCEL_XOUT_H_REG, IMU_BURST_BYTES);
+#else
+	// The old way, two blocking transactions that skip the temperature in between
+	HAL_I2C_Mem_Read(&hi2c1, MPU6050_ADDR, ACCEL_XOUT_H_REG, I2C_MEMADD_SIZE_8BIT, imuBuffer, 6, 1000);
+	HAL_I2C_Mem_Read(&hi2c1, MPU6050_ADDR, GYRO_XOUT_H_REG, I2C_MEMADD_SIZE_8BIT, imuBuffer + 8, 6, 1000);
+	imuCpuCycles = DWT->CYCCNT - start;
+	imuPublishBurst();
+	imuTimeRead();
+	return true;
+#endif
+	imuCpuCycles += DWT->CYCCNT - start;
+	return true;
+}
+
+// Takes the oldest published sample. Returns false if there isn't one
+bool imuTake(IMU_SAMPLE *sample)
+{
+	bool ready;
+
+	__disable_irq();
+	ready = imuQueueHead != imuQueueTail;
+	if (ready)
+	{
+		*sample = imuQueue[imuQueueTail % IMU_QUEUE_SIZE];
+		imuQueueTail++;
+	}
+	__enable_irq();
+	return ready;
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &hi2c1)
+	{
+		imuReadDone();
+	}
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &hi2c1)
+	{
+		imuState = IMU_IDLE;
+	}
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &hi2c1)
+	{
+		imuStats.errors++;
+		imuState = IMU_IDLE;
+	}
+}
+
+// The MPU has a new sample, start reading it straight away
+void HAL_GPIO_EXTI_Callback(uint16_t pin)
+{
+	uint32_t micros = imuMicros();
+
+	if (pin != IMU_INT_PIN)
+	{
+		return;
+	}
+	imuStats.dataReady++;
+	if (imuState != IMU_IDLE)
+	{
+		// Still reading the last one, this sample is missed
+		imuStats.busy++;
+		return;
+	}
+	imuReadyMicros = micros;
+	imuStartCycle = DWT->CYCCNT;
+	imuCpuCycles = 0;
+	imuStats.started++;
+	imuRead(IMU_READ_BURST, ACCEL_XOUT_H_REG, IMU_BURST_BYTES);
+	imuCpuCycles += DWT->CYCCNT - imuStartCycle;
+}
+
+void EXTI2_IRQHandler(void)
+{
+	HAL_GPIO_EXTI_IRQHandler(IMU_INT_PIN);
+}
+
+void I2C1_EV_IRQHandler(void)
+{
+	imuIsrStart = DWT->CYCCNT;
+	HAL_I2C_EV_IRQHandler(&hi2c1);
+	imuCpuCycles += DWT->CYCCNT - imuIsrStart;
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+	imuIsrStart = DWT->CYCCNT;
+	HAL_I2C_ER_IRQHandler(&hi2c1);
+	imuCpuCycles += DWT->CYCCNT - imuIsrStart;
+}
+
+#if IMU_BENCH
+
+typedef struct
+{
+	uint32_t reads;
+	uint32_t blockingCycles;  // Time per sample of the two blocking reads, the CPU waits out all of it
+	uint32_t burstBusCycles;  // Time per sample of the interrupt-driven burst on the bus
+	uint32_t burstCpuCycles;  // CPU time of the same burst, starting it and its interrupts
+} IMU_BENCH_STATS;
+
+IMU_BENCH_STATS imuBenchStats;
+
+// Reads one sample IMU_BENCH_READS times each way and averages the times from the
+// DWT. The data-ready interrupt is held off meanwhile, and the stats and queue are
+// cleared afterwards so none of it shows. Call after imuInit()
+void imuBenchmark(void)
+{
+	uint32_t start, blocking = 0, bus = 0, cpu = 0;
+	int i;
+
+	memset(&imuBenchStats, 0, sizeof(imuBenchStats));
+#if IMU_MODE == IMU_MODE_DRDY
+	HAL_NVIC_DisableIRQ(IMU_INT_IRQn);
+#endif
+	for (i = 0; i < IMU_BENCH_READS; i++)
+	{
+		start = DWT->CYCCNT;
+		HAL_I2C_Mem_Read(&hi2c1, MPU6050_ADDR, ACCEL_XOUT_H_REG, I2C_MEMADD_SIZE_8BIT, imuBuffer, 6, 1000);
+		HAL_I2C_Mem_Read(&hi2c1, MPU6050_ADDR, GYRO_XOUT_H_REG, I2C_MEMADD_SIZE_8BIT, imuBuffer + 8, 6, 1000);
+		blocking += DWT->CYCCNT - start;
+
+		imuStartCycle = DWT->CYCCNT;
+		imuCpuCycles = 0;
+		imuRead(IMU_READ_BURST, ACCEL_XOUT_H_REG, IMU_BURST_BYTES);
+		imuCpuCycles += DWT->CYCCNT - imuStartCycle;
+		start = HAL_GetTick();
+		while (imuState != IMU_IDLE && HAL_GetTick() - start < 10)
+		{
+		}
+		bus += imuStats.busCycles;
+		cpu += imuStats.cpuCycles;
+		imuBenchStats.reads++;
+	}
+	imuBenchStats.blockingCycles = blocking / imuBenchStats.reads;
+	imuBenchStats.burstBusCycles = bus / imuBenchStats.reads;
+	imuBenchStats.burstCpuCycles = cpu / imuBenchStats.reads;
+
+	__disable_irq();
+	memset(&imuStats, 0, sizeof(imuStats));
+	imuStats.minInterval = 0xFFFFFFFF;
+	imuQueueTail = imuQueueHead;
+	__enable_irq();
+#if IMU_MODE == IMU_MODE_DRDY
+	imuLastMicros = imuMicros();
+	HAL_NVIC_EnableIRQ(IMU_INT_IRQn);
+#endif
+}
+
+#endif
+
+#endif
@@ -14,22 +14,6 @@
 
 #define wait_delay HAL_Delay
 
-//--------MPU Registers--------------------
-//
-#define MPU6050_ADDR (0x68 << 1) // 0xD0
-
-
-#define SMPLRT_DIV_REG 0x19
-#define GYRO_CONFIG_REG 0x1B
-#define ACCEL_CONFIG_REG 0x1C
-#define ACCEL_XOUT_H_REG 0x3B
-#define TEMP_OUT_H_REG 0x41
-#define GYRO_XOUT_H_REG 0x43
-#define PWR_MGMT_1_REG 0x6B
-#define WHO_AM_I_REG 0x75
-
-//-----------------------------------------
-
 #ifdef __RTX
 extern uint32_t os_time;
 uint32_t HAL_GetTick(void) {
@@ -41,18 +25,12 @@ uint32_t HAL_GetTick(void) {
 * Global Variables
 */
 TIM_HandleTypeDef htim2;
-I2C_HandleTypeDef hi2c1;
 
 uint16_t colourScheme, temperature, tempUnit, distUnit; // Variables to change UI related units/colours
-int currentDistLeft = 0; // For remembering how many chevrons are currently appearing
-int currentDistRight = 0;
 uint16_t distLeft = 0; //Actual distance mesurement
 uint16_t distRight = 0;
 
 
-// Pi to 21 significant figures
-const float M_PI = 3.14159265358979323846;
-
 // Accelleromerter Raw Values
 int16_t Accel_X_RAW = 0;
 int16_t Accel_Y_RAW = 0;
@@ -63,17 +41,20 @@ int16_t Gyro_Y_RAW = 0;
 int16_t Gyro_Z_RAW = 0;
 //Values after raw to real converstion
 float Ax, Ay, Az, Gx, Gy, Gz;
-float pitch = 0;
-float roll = 0;
-float yaw = 0;
 // Init position of lean pointer head
-int circX = 240;
-int circY = 142;
-
 uint32_t colour1;//Background usually
 uint32_t colour2;//Foreground usually
 uint32_t colour3;//Spare
 
+DISPLAY_LIST settingsList; // The settings screen, recorded the first time it is shown
+
+// Widgets on the main screen, they remember what they show and only redraw when it changes
+WIDGET *settingsButton;
+WIDGET *tempDial, *degreeSymbol, *tempReading, *tempUnitLabel;
+WIDGET *leanGauge, *leanNeedle;
+WIDGET *chevronsLeft, *distLeftReading, *distLeftUnitLabel;
+WIDGET *chevronsRight, *distRightReading, *distRightUnitLabel;
+
 
 /**
 * Prototype Functions
@@ -128,80 +109,43 @@ void MPU6050_Init (void)
 	}
 }
 
-void MPU6050_Read_Accel (void)
+// Takes the raw values from a sample read by imu.h and converts them into real units
+void MPU6050_Convert (const IMU_SAMPLE *sample)
 {
-	uint8_t Rec_Data[6];
-
-	// Read 6 BYTES of data starting from ACCEL_XOUT_H register
-
-	HAL_I2C_Mem_Read (&hi2c1, MPU6050_ADDR, ACCEL_XOUT_H_REG, 1, Rec_Data, 6, 1000);
-
-	Accel_X_RAW = (int16_t)(Rec_Data[0] << 8 | Rec_Data [1]);
-	Accel_Y_RAW = (int16_t)(Rec_Data[2] << 8 | Rec_Data [3]);
-	Accel_Z_RAW = (int16_t)(Rec_Data[4] << 8 | Rec_Data [5]);
+	Accel_X_RAW = sample->accel[0];
+	Accel_Y_RAW = sample->accel[1];
+	Accel_Z_RAW = sample->accel[2];
+	Gyro_X_RAW = sample->gyro[0];
+	Gyro_Y_RAW = sample->gyro[1];
+	Gyro_Z_RAW = sample->gyro[2];
 
 	/*** convert the RAW values into acceleration in 'g'
 	     we have to divide according to the Full scale value set in FS_SEL
-	     I have configured FS_SEL = 0. So I am dividing by 16384.0
+	     I have configured FS_SEL = 0. So I am scaling by 1/16384, IMU_ACCEL_SCALE
 	     for more details check ACCEL_CONFIG Register              ****/
 
-	Ax = Accel_X_RAW/16384.0;
-	Ay = Accel_Y_RAW/16384.0;
-	Az = Accel_Z_RAW/16384.0;
-}
-
-
-void MPU6050_Read_Gyro (void)
-{
-	uint8_t Rec_Data[6];
-
-	// Read 6 BYTES of data starting from GYRO_XOUT_H register
-
-	HAL_I2C_Mem_Read (&hi2c1, MPU6050_ADDR, GYRO_XOUT_H_REG, 1, Rec_Data, 6, 1000);
-
-	Gyro_X_RAW = (int16_t)(Rec_Data[0] << 8 | Rec_Data [1]);
-	Gyro_Y_RAW = (int16_t)(Rec_Data[2] << 8 | Rec_Data [3]);
-	Gyro_Z_RAW = (int16_t)(Rec_Data[4] << 8 | Rec_Data [5]);
+	Ax = Accel_X_RAW * IMU_ACCEL_SCALE;
+	Ay = Accel_Y_RAW * IMU_ACCEL_SCALE;
+	Az = Accel_Z_RAW * IMU_ACCEL_SCALE;
 
 	/*** convert the RAW values into dps (/s)
 	     we have to divide according to the Full scale value set in FS_SEL
-	     I have configured FS_SEL = 0. So I am dividing by 131.0
+	     I have configured FS_SEL = 0. So I am scaling by 1/131, IMU_GYRO_SCALE
 	     for more details check GYRO_CONFIG Register              ****/
 
-	Gx = Gyro_X_RAW/131.0;
-	Gy = Gyro_Y_RAW/131.0;
-	Gz = Gyro_Z_RAW/131.0;
-}
-
-// Calculating the pitch, roll, and yaw values using the accelerometer input data
-// Reference: https://engineering.stackexchange.com/questions/3348/calculating-pitch-yaw-and-roll-from-mag-acc-and-gyro-data
-void convertAcc (void){  
-	
-	pitch = 180 * atan (Ax/sqrt(Ay*Ay + Az*Az))/M_PI;
-	roll = 180 * atan (Ay/sqrt(Ax*Ax + Az*Az))/M_PI;
-	yaw = 180 * atan (Az/sqrt(Ax*Ax + Az*Az))/M_PI;
-	roll *= -1; // The MPU is facing the opposite way to the screen and so the value is required to be flipped
+	Gx = Gyro_X_RAW * IMU_GYRO_SCALE;
+	Gy = Gyro_Y_RAW * IMU_GYRO_SCALE;
+	Gz = Gyro_Z_RAW * IMU_GYRO_SCALE;
 }
 
 //Returns the radians value of a degree angle
 float toRadians(float angle){
-	return angle * ( M_PI / 180.0 );  
+	return angle * FAST_RAD_PER_DEG;  
 }
 
-// saves the Circumference X and Y, When the MPU is held up in the same orientation as the screen, the angle will be the roll value.
-void getCircumferenceXY (int x0, int y0, int r, float angle){
-	float xPos = 0;
-	float yPos = 0;
-	// The values lie between -90 and 90 with 0 at the top/bottom middle. Radians start at 0 on the right. 
-	//Therefore can be translated by 3PI/2 to rotate 0 to be directly downwards.
-	float radAngle = toRadians(angle) + (3*M_PI)/2; 
-	// Find the x and y positions with trigonemetry functions for the circumference of a circle
-	xPos = r * (float)cos(radAngle) + x0; 
-  yPos = r * (float)sin(radAngle) + y0;
-	
-  circX = (int)xPos;
-	circY = (int)yPos;
-	
+// Sounds the buzzer while the bike is leaning over by 60 degrees or more.
+// When the MPU is held up in the same orientation as the screen, the angle will be the roll value.
+void checkLeanAlarm(float angle){
 	if(angle >= 60 || angle <= -60){
 		turnOnBuzzer();
 	}else{
@@ -210,78 +154,205 @@ void getCircumferenceXY (int x0, int y0, int r, float angle){
 }
 //------------------------END MPU CODE---------------------------------------
 
-// All no moving/changing UI elements are called in the function.
+// Sets up the widgets for everything on the main screen. Called once, after the font is set
+void hudInit(){
+	
+	// Settings Button
+	settingsButton = widgetAddButton(2, 320, 5, 60, 30, 7, 6, "SET");
+	
+	// Temperature Display, the reading keeps its digits 15 pixels apart
+	tempDial = widgetAddDial(0, 240, 71, 71);
+	degreeSymbol = widgetAddDial(0, 233, 88, 4);
+	tempReading = widgetAddNumber(2, 220, 50, 3, 15, "%03d");
+	tempUnitLabel = widgetAddLabel(2, 240, 85, 1, "C");
+	
+	// Gyrometer Display, the needle is on its own layer so moving it doesn't touch the gauge underneath
+	leanGauge = widgetAddDial(0, 240, 272, 130);
+	leanNeedle = widgetAddNeedle(3, 240, 272, 128);
+	
+	// Left Ultrasonic Display and Reading
+	chevronsLeft = widgetAddChevrons(1, 5, false);
+	distLeftReading = widgetAddNumber(2, 118, 125, 2, 0, "%2d");
+	distLeftUnitLabel = widgetAddLabel(2, 164, 125, 2, "m");
+	
+	// Right Ultrasonic Display and Reading
+	chevronsRight = widgetAddChevrons(1, 5, true);
+	distRightReading = widgetAddNumber(2, 325, 125, 2, 0, "%2d");
+	distRightUnitLabel = widgetAddLabel(2, 371, 125, 2, "m");
+	
+	// Everything that only changes with the settings is kept in the background cache
+	widgetSetCached(settingsButton);
+	widgetSetCached(tempDial);
+	widgetSetCached(degreeSymbol);
+	widgetSetCached(tempUnitLabel);
+	widgetSetCached(leanGauge);
+	widgetSetCached(distLeftUnitLabel);
+	widgetSetCached(distRightUnitLabel);
+}
+
+// Works out how many chevrons to light for a distance, the closer the more.
+// Returns -1 when the distance shouldn't change what is showing
+int chevronsForDistance(uint16_t dist){
+	if(dist > 0 && dist <= 25){
+		return 5 - ((dist - 1) / 5);
+	}else if(dist > 30){
+		return 0;
+	}
+	return -1;
+}
+
+// Paints the whole main screen in the current colour scheme and units.
 void mainScreen(){
+	uint32_t start = HAL_GetTick(), startCycle = DWT->CYCCNT, key;
+	bool cached;
 	
-	GLCD_ClearScreen();
-	//Used to ensure the correct colour scheme is setup.
+	//Used to ensure the correct colour scheme is setup. With CLUT frame buffers
+	//this only reloads the theme entries of the palette
 	if (colourScheme == 0){
-		colour1 = GLCD_COLOR_BLACK;
-		colour2 = GLCD_COLOR_WHITE;
+		paletteSetTheme(GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
 	}
 	else if (colourScheme == 1){
-		colour1 = GLCD_COLOR_BLACK;
 		// Cyan
-		colour2 = 0x07F9;
+		paletteSetTheme(GLCD_COLOR_BLACK, 0x07F9);
 	}
 	else if (colourScheme == 2){
-		colour1 = GLCD_COLOR_BLACK;
-		colour2 = GLCD_COLOR_MAGENTA;
+		paletteSetTheme(GLCD_COLOR_BLACK, GLCD_COLOR_MAGENTA);
 	}
 	else if (colourScheme == 3){
-		colour1 = GLCD_COLOR_BLACK;
 		// Red
-		colour2 = 0xFA20;
+		paletteSetTheme(GLCD_COLOR_BLACK, 0xFA20);
 	}
-	//Fill the background colour
-	fillBackground(colour1);
-	// Settings Button
-	drawRectangle(320, 5, 60, 30, colour2);
-	// Settings Annotation
-	drawString(327, 11, "SET", colour2, colour1);
-	
-	// Temperature Display
-	drawCircle(240, 71, 71, colour2);
-	
-	// Temperature Reading		
-	if(tempUnit == 0){
-		// F Annotation 
-		drawCircle(233, 88, 4, colour2);
-		drawString(240, 85, "F", colour2, colour1);
+	colour1 = HUD_THEME_BACK;
+	colour2 = HUD_THEME_FORE;
+	// The units and colours decide what the background looks like
+	widgetInvalidateAll();
+	widgetSetColours(colour2, colour1);
+	widgetSetText(tempUnitLabel, tempUnit == 0 ? "F" : "C");
+	widgetSetText(distLeftUnitLabel, distUnit == 0 ? "yd" : "m");
+	widgetSetText(distRightUnitLabel, distUnit == 0 ? "yd" : "m");
+	
+	// The background is only drawn the first time these settings are seen, after
+	// that it is copied back from the cache
+	// CLUT frame buffers hold the same indexes whatever the scheme
+	key = bgCacheKey(HUD_USE_CLUT ? 0 : colourScheme, tempUnit, distUnit);
+	cached = bgCacheRestore(key);
+	if (!cached){
+		fillBackground(colour1);
+		widgetsRenderCached(false);
+		bgCacheStore(key);
 	}else{
-		// C Annotation 
-		drawCircle(233, 88, 4, colour2);
-		drawString(240, 85, "C", colour2, colour1);
+		widgetsRenderCached(true);
+	}
+	
+	// Temperature Reading, then whatever else moves is drawn over the background
+	widgetSetValue(tempReading, temperature);
+	widgetsRender();
+	bgCacheTime(start, startCycle, cached);
+	fbPresent();
+}
+
+#if BG_BENCH
+
+typedef struct
+{
+	uint32_t switches;       // Switches timed each way
+	uint32_t missCycles;     // Time per switch that drew the background
+	uint32_t hitCycles;      // Time per switch that copied it from the cache
+	uint32_t missPixels;     // Pixel writes per switch that drew the background
+	uint32_t hitPixels;      // Pixel writes per switch that copied it from the cache
+} BG_BENCH_STATS;
+
+BG_BENCH_STATS bgBenchStats;
+
+// Switches to every colour scheme twice, the first time drawing each background and the
+// second copying it back from the cache, and leaves the cache empty again afterwards
+void bgCacheBenchmark(void){
+	uint16_t scheme = colourScheme;
+	uint32_t pixels;
+	int pass, i;
+	
+	memset(&bgBenchStats, 0, sizeof(bgBenchStats));
+	bgCacheInit();
+	for (pass = 0; pass < 2; pass++){
+		for (i = 0; i < BG_CACHE_SLOTS; i++){
+			colourScheme = (uint16_t)i;
+			pixels = fbPixelWrites;
+			mainScreen();
+			if (pass == 0){
+				bgBenchStats.missCycles += bgStats.lastCycles;
+				bgBenchStats.missPixels += fbPixelWrites - pixels;
+			}else{
+				bgBenchStats.hitCycles += bgStats.lastCycles;
+				bgBenchStats.hitPixels += fbPixelWrites - pixels;
+			}
+		}
 	}
+	bgBenchStats.switches = BG_CACHE_SLOTS;
+	bgBenchStats.missCycles /= bgBenchStats.switches;
+	bgBenchStats.hitCycles /= bgBenchStats.switches;
+	bgBenchStats.missPixels /= bgBenchStats.switches;
+	bgBenchStats.hitPixels /= bgBenchStats.switches;
+	colourScheme = scheme;
+	bgCacheInit();
+}
+
+#endif
+
+// Everything on the settings screen that doesn't change
+void drawSettingsScreen(){
 	
-	// Gyrometer Display		
-	drawCircle(240, 272, 130, colour2);
+	fillBackground(HUD_WHITE);
 	
-	// Left Ultrasonic Display
-	displayDisChevronsLeft(0, colour1, colour2);
+	// Settings Title
+	drawRectangle(160, 0, 160, 35, HUD_BLACK);
+	drawString(177, 8, "SETTINGS", HUD_BLACK, HUD_WHITE);
 	
-	if(distUnit == 0){
-		// Left Ultrasonic Reading
-		drawString(118, 125, ".", colour2, colour1);
-		drawString(164, 125, "yd", colour2, colour1);
-	}else{
-		// Left Ultrasonic Reading
-		drawString(118, 125, ".", colour2, colour1);
-		drawString(164, 125, "m", colour2, colour1);
-	}
+	// Back Button
+	drawRectangle(403, 5, 70, 30, HUD_BLACK);
+	// Back Annotation
+	drawString(406, 11, "BACK", HUD_BLACK, HUD_WHITE);
 	
-	// Right Ultrasonic Display
-	displayDisChevronsRight(0, colour1, colour2);
+	// Unit Measurement Select Display
+	drawRectangle(5, 61, 213, 204, HUD_BLACK);
+	drawString(72, 65, "Units", HUD_BLACK, HUD_WHITE);
 	
-	if(distUnit == 0){
-		// Right Ultrasonic Reading
-	drawString(325, 125, ".", colour2, colour1);
-	drawString(371, 125, "yd", colour2, colour1);
-	}else{
-		// Right Ultrasonic Reading
-	drawString(325, 125, ".", colour2, colour1);
-	drawString(371, 125, "m", colour2, colour1);
-	}	
+	// Temperature Measurement Select
+	drawString(24, 101, "Temperature", HUD_BLACK, HUD_WHITE);
+	// C Button
+	drawRectangle(25, 135, 70, 30, HUD_BLACK);
+	drawCircle(50, 143, 4, HUD_BLACK);
+	drawString(57, 140, "C", HUD_BLACK, HUD_WHITE);
+	// F Button
+	drawRectangle(131, 135, 70, 30, HUD_BLACK);
+	drawCircle(156, 143, 4, HUD_BLACK);
+	drawString(163, 140, "F", HUD_BLACK, HUD_WHITE);
+	
+	// Distance Measurement Select
+	drawString(52, 180, "Distance", HUD_BLACK, HUD_WHITE);
+	// m button
+	drawRectangle(25, 215, 70, 30, HUD_BLACK);
+	drawString(53, 220, "m", HUD_BLACK, HUD_WHITE);
+	// yd button
+	drawRectangle(131, 215, 70, 30, HUD_BLACK);
+	drawString(150, 218, "yd", HUD_BLACK, HUD_WHITE);
+	
+	// Colour Palette Select
+	drawRectangle(260, 61, 213, 204, HUD_BLACK);
+	drawString(322, 65, "Colour", HUD_BLACK, HUD_WHITE);
+	
+	// Palette Displays
+	drawPalette(295, 120, 45);
+	fillPalette(295, 120, 45, HUD_WHITE);
+	drawString(293, 88, "Day", HUD_BLACK, HUD_WHITE);
+	drawPalette(396, 120, 45);
+	fillPalette(396, 120, 45, HUD_CYAN);
+	drawString(381, 88, "Night", HUD_BLACK, HUD_WHITE);
+	drawPalette(295, 208, 45);
+	fillPalette(295, 208, 45, HUD_MAGENTA);
+	drawString(280, 175, "Funky", HUD_BLACK, HUD_WHITE);
+	drawPalette(396, 208, 45);
+	fillPalette(396, 208, 45, HUD_RED);
+	drawString(389, 175, "Evil", HUD_BLACK, HUD_WHITE);
 }
 
 void settingsScreen(){
@@ -290,7 +361,7 @@ void settingsScreen(){
 	
 	TOUCH_STATE tsc_state;
 
-	GLCD_ClearScreen();
+	overlayHideNeedle();
 
 	// Setting up colour schemes
 	if (colourScheme == 0){
@@ -310,61 +381,24 @@ void settingsScreen(){
 		colour2 = 0xFA20;
 	}
 	
-	// Settings Title
-	drawRectangle(160, 0, 160, 35, GLCD_COLOR_BLACK);
-	drawString(177, 8, "SETTINGS", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	
-	// Back Button
-	drawRectangle(403, 5, 70, 30, GLCD_COLOR_BLACK);
-	// Back Annotation
-	drawString(406, 11, "BACK", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	
-	// Unit Measurement Select Display
-	drawRectangle(5, 61, 213, 204, GLCD_COLOR_BLACK);
-	drawString(72, 65, "Units", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	
-	// Temperature Measurement Select
-	drawString(24, 101, "Temperature", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	// C Button
-	drawRectangle(25, 135, 70, 30, GLCD_COLOR_BLACK);
-	drawCircle(50, 143, 4, GLCD_COLOR_BLACK);
-	drawString(57, 140, "C", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	// F Button
-	drawRectangle(131, 135, 70, 30, GLCD_COLOR_BLACK);
-	drawCircle(156, 143, 4, GLCD_COLOR_BLACK);
-	drawString(163, 140, "F", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	
-	// Distance Measurement Select
-	drawString(52, 180, "Distance", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	// m button
-	drawRectangle(25, 215, 70, 30, GLCD_COLOR_BLACK);
-	drawString(53, 220, "m", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	// yd button
-	drawRectangle(131, 215, 70, 30, GLCD_COLOR_BLACK);
-	drawString(150, 218, "yd", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	
-	// Colour Palette Select
-	drawRectangle(260, 61, 213, 204, GLCD_COLOR_BLACK);
-	drawString(322, 65, "Colour", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	
-	// Palette Displays
-	drawPalette(295, 120, 45);
-	fillPalette(295, 120, 45, GLCD_COLOR_WHITE);
-	drawString(293, 88, "Day", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	drawPalette(396, 120, 45);
-	fillPalette(396, 120, 45, 0x07F9);
-	drawString(381, 88, "Night", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	drawPalette(295, 208, 45);
-	fillPalette(295, 208, 45, GLCD_COLOR_MAGENTA);
-	drawString(280, 175, "Funky", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
-	drawPalette(396, 208, 45);
-	fillPalette(396, 208, 45, 0xFA20);
-	drawString(389, 175, "Evil", GLCD_COLOR_BLACK, GLCD_COLOR_WHITE);
+	// The screen itself never changes, so it is recorded the first time it is shown
+	// and replayed after that
+	if (!settingsList.recorded){
+		dlBegin(&settingsList);
+		drawSettingsScreen();
+		dlEnd();
+	}
+#if HUD_USE_TILES
+	tileRender(&settingsList);
+#else
+	dlReplay(&settingsList);
+#endif
 
 	// Highlight the bounds of the current setting box
 	highlightTempUnit(tempUnit);
 	highlightDistUnit(distUnit);
 	highlightColour(colourScheme);
+	fbPresent();
 
 	// Required to stay on this screen until the back button is pressed.
 	for(;;)
@@ -373,6 +407,8 @@ void settingsScreen(){
 		if (tsc_state.pressed)
 		{		
 			touchValue = checkCoordsSettings(tsc_state.x, tsc_state.y);
+			// Show any highlight that was moved
+			fbPresent();
 			if (touchValue == -1)
 			{
 				mainScreen();
@@ -399,12 +435,10 @@ void settingsScreen(){
 }
 
 int main(void){
-	int touchValue;
-	char buf[3];	
-	int* digits;
-	char tempBuffer[3][128], lUltBuffer[4][128], rUltBuffer[4][128];
-	int prev = 0;
-	int loop = 0;
+	int touchValue, lit;
+	uint32_t stageStart, fusionCycles;
+	bool wasPressed = false;
+	IMU_SAMPLE sample;
 	
 	TOUCH_STATE tsc_state;
 	
@@ -413,15 +447,48 @@ int main(void){
 	SystemClock_Config(); //Config Clocks
 	GPIO_Init();
 	I2C1_Init();
-	TIM2_Init();	
-	__HAL_RCC_TIM2_CLK_ENABLE();
+	TIM2_Init(); //Free-running microsecond counter the IMU samples are stamped with
 	
 	Touch_Initialize();
 	GLCD_Initialize(); //Init GLCD	
 	GLCD_ClearScreen();
-	GLCD_SetFont(&GLCD_Font_16x24);
+	fbInit(); //Draw into a second frame buffer and swap them on the vertical blank
+	overlayInit(); //The lean needle goes on the second LTDC layer
+	bgCacheInit(); //Main screen backgrounds are saved after the overlay
+	fbSetFont(&GLCD_Font_16x24);
+	hudInit();
+	perfInit();
+#if FB_FILL_BENCH
+	fbFillBenchmark(); //Results are left in fbFillBenchStats, the main screen is drawn over them
+#endif
+#if FAST_MATH_BENCH
+	fastMathBenchmark(); //Results are left in fastMathStats for the debugger
+#endif
+#if OVERLAY_BENCH
+	overlayBenchmark(leanNeedle->cx, leanNeedle->cy, leanNeedle->radius); //Results are left in overlayBenchStats
+#endif
+#if SINE_BENCH
+	sineBenchmark(); //Results are left in sineBenchStats for the debugger
+#endif
+#if CHEVRON_BENCH
+	chevronBenchmark(); //Results are left in chevronBenchStats, the main screen is drawn over them
+#endif
+#if BG_BENCH
+	bgCacheBenchmark(); //Results are left in bgBenchStats, the main screen is drawn over them
+#endif
+#if TILE_BENCH
+	dlBegin(&settingsList);
+	drawSettingsScreen();
+	dlEnd();
+	tileBenchmark(&settingsList); //Results are left in tileBenchStats for the debugger
+#endif
 	
 	MPU6050_Init();
+	imuInit(); //The MPU is read in the background, on its data-ready and the I2C1 interrupts
+#if IMU_BENCH
+	imuBenchmark(); //Results are left in imuBenchStats for the debugger
+#endif
+	fusionInit(); //Gyro and accelerometer are fused into the lean angle as each sample comes in
 	//-------------INIT END----------------------
 	
 	temperature = 0;
@@ -434,77 +501,84 @@ int main(void){
 
 	mainScreen();
 	HAL_Delay(1000);	
+	frameResync();
 	for(;;)
 	{
-		//call MPU read functions
-		MPU6050_Read_Accel();
-		MPU6050_Read_Gyro();
+		// Sleep until the next frame is due on the LTDC vertical blank
+		frameWait();
+		
+		//-------------Sample phase--------------
+		// Use the samples read during the last frame and start reading the next ones,
+		// which come in on the I2C interrupts while this frame is drawn
+		// Every sample goes through the fusion, which is counted as working out the angles
+		stageStart = DWT->CYCCNT;
+		fusionCycles = fusionStats.totalCycles;
+		while (imuTake(&sample))
+		{
+			MPU6050_Convert(&sample);
+			fusionUpdate(&sample);
+		}
+		imuStart();
+		fusionCycles = fusionStats.totalCycles - fusionCycles;
+		perfRecord(PERF_IMU_READ, stageStart + fusionCycles);
+		perfAdd(PERF_CONVERT, fusionCycles);
 		
 		//Check if the user want to go to the settings menu
 		Touch_GetState(&tsc_state);
 		if (tsc_state.pressed)
 		{
 			touchValue = checkCoordsMain(tsc_state.x, tsc_state.y);
-			if (touchValue)
+			if (touchValue == 1)
 			{
 				settingsScreen();
+				// The settings screen holds up the loop, that isn't an overrun
+				frameResync();
+			}
+			// The performance overlay flips once per tap, not every frame it is held
+			else if (touchValue == 2 && !wasPressed)
+			{
+				perfToggle();
 			}
 		}
+		wasPressed = tsc_state.pressed;
 		
 		//------------Start MPU Calculations---------
-		convertAcc();
-	
-		drawDiagonalLine(240, 272, circX, circY, colour1);
-		getCircumferenceXY(240, 272, 128, roll);
-		drawDiagonalLine(240, 272, circX, circY,colour2);
+		// The angles were worked out by fusionUpdate() as each sample was taken, which
+		// is all PERF_CONVERT holds. The needle only moves once the angle changes by a
+		// whole sine table step
+		stageStart = DWT->CYCCNT;
+		// The needle follows the fused lean, the accelerometer alone is thrown off in corners
+		checkLeanAlarm(fusionOutput.roll);
+		widgetSetValue(leanNeedle, sineStep(fusionOutput.roll));
+		perfRecord(PERF_NEEDLE, stageStart);
 		
 		//-----------------END MPU Calcs--------------
 		
 		//-------------Distance------------------
-		// Determine how many chevrons to place on the left or right
-		if(distLeft > 0 && distLeft <= 5 && currentDistLeft != 5){
-			displayDisChevronsLeft(5, colour1, colour2);
-			currentDistLeft = 5;
-		}else if(distLeft > 5 && distLeft <= 10 && currentDistLeft != 4){
-			displayDisChevronsLeft(4, colour1, colour2);
-			currentDistLeft = 4;
-		}else if(distLeft > 10 && distLeft <= 15 && currentDistLeft != 3){
-			displayDisChevronsLeft(3, colour1, colour2);
-			currentDistLeft = 3;
-		}else if(distLeft > 15 && distLeft <= 20 && currentDistLeft != 2){
-			displayDisChevronsLeft(2, colour1, colour2);
-			currentDistLeft = 2;
-		}else if(distLeft > 20 && distLeft <= 25 && currentDistLeft != 1){
-			displayDisChevronsLeft(1, colour1, colour2);
-			currentDistLeft = 1;
-		}else if(distLeft > 30){
-			displayDisChevronsLeft(0, colour1, colour2);
+		// Determine how many chevrons to place on the left or right, the widgets
+		// only repaint the chevrons that change
+		stageStart = DWT->CYCCNT;
+		lit = chevronsForDistance(distLeft);
+		if(lit >= 0){
+			widgetSetValue(chevronsLeft, lit);
+		}
+		if(distLeft > 30){
 			distLeft = 0;
 		}
 		
-		if(distRight > 0 && distRight <= 5 && currentDistRight != 5){
-			displayDisChevronsRight(5, colour1, colour2);
-			currentDistRight = 5;
-		}else if(distRight > 5 && distRight <= 10 && currentDistRight != 4){
-			displayDisChevronsRight(4, colour1, colour2);
-			currentDistRight = 4;
-		}else if(distRight > 10 && distRight <= 15 && currentDistRight != 3){
-			displayDisChevronsRight(3, colour1, colour2);
-			currentDistRight = 3;
-		}else if(distRight > 15 && distRight <= 20 && currentDistRight != 2){
-			displayDisChevronsRight(2, colour1, colour2);
-			currentDistRight = 2;
-		}else if(distRight > 20 && distRight <= 25 && currentDistRight != 1){
-			displayDisChevronsRight(1, colour1, colour2);
-			currentDistRight = 1;
-		}else if(distRight > 30){
-			displayDisChevronsRight(0, colour1, colour2);
+		lit = chevronsForDistance(distRight);
+		if(lit >= 0){
+			widgetSetValue(chevronsRight, lit);
+		}
+		if(distRight > 30){
 			distRight = 0;
 		}
+		perfRecord(PERF_CHEVRONS, stageStart);
 		
 		
 		// If the rotary encoders button is pressed down then allow for the rotating function to be checked
 		// otherwise pass straight through
+		stageStart = DWT->CYCCNT;
 		for(;;)	//right side
 		{
 			//Read the button pin
@@ -512,19 +586,10 @@ int main(void){
 			{
 				//run check function and return 1 higher or lower dependent on direction spun	
 				distLeft = checkEncoderLeft(distLeft);		
-				sprintf(buf, "%2d", distLeft);
-				if(distUnit == 0)
-				{
-					// Left Ultrasonic Reading
-					drawString(118, 125, buf, colour2, colour1);
-					drawString(164, 125, "yd", colour2, colour1);
-				}
-				else
-				{
-					// Left Ultrasonic Reading
-					drawString(118, 125, buf, colour2, colour1);
-					drawString(164, 125, "m", colour2, colour1);
-				}
+				// Left Ultrasonic Reading
+				widgetSetValue(distLeftReading, distLeft);
+				widgetsRender();
+				fbPresent();
 			}
 			else
 			{
@@ -535,32 +600,22 @@ int main(void){
 		for(;;){//left side
 			if(HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_4) == GPIO_PIN_RESET){
 			distRight = checkEncoderRight(distRight);		
-			
-			sprintf(buf, "%2d", distRight);
-			if(distUnit == 0){
 			// Right Ultrasonic Reading
-			drawString(325, 125, buf, colour2, colour1);
-			drawString(371, 125, "yd", colour2, colour1);
-			}else{
-				// Right Ultrasonic Reading
-			drawString(325, 125, buf, colour2, colour1);
-			drawString(371, 125, "m", colour2, colour1);
-			}
+			widgetSetValue(distRightReading, distRight);
+			widgetsRender();
+			fbPresent();
 			
 			}else{break;}
 		}
+		perfRecord(PERF_ENCODERS, stageStart);
 		//----------------end--------------------
 		
 		//-------------Temperature---------------
 		
-				digits = getDigits(temperature);
-				sprintf(tempBuffer[0], "%d", digits[0]);
-				sprintf(tempBuffer[1], "%d", digits[1]);
-				sprintf(tempBuffer[2], "%d", digits[2]);
-				
-				drawString(220, 50, tempBuffer[2], colour2, colour1);
-				drawString(235, 50, tempBuffer[1], colour2, colour1);
-				drawString(250, 50, tempBuffer[0], colour2, colour1);
+				// Only the digits that changed since the last loop are drawn
+				stageStart = DWT->CYCCNT;
+				widgetSetValue(tempReading, temperature);
+				perfRecord(PERF_TEMPERATURE, stageStart);
 				
 		//-----------------End-------------------
 		
@@ -569,7 +624,18 @@ int main(void){
 		if (temperature == 1000)
 			temperature = 0;
 		
-		HAL_Delay(200);
+		//-------------Render phase--------------
+		frameSampled();
+		
+		// Draw whatever changed and swap the finished frame onto the screen
+		widgetsRender();
+		// The needle widget only asks for a redraw, the vertical blank interrupt does it
+		perfAdd(PERF_NEEDLE, leanNeedle->cycles + overlayCollect());
+		perfAdd(PERF_CHEVRONS, chevronsLeft->cycles + chevronsRight->cycles);
+		perfAdd(PERF_TEMPERATURE, tempReading->cycles);
+		perfFrame();
+		fbPresent();
+		frameDone();
 	}
 }
 
@@ -663,12 +729,14 @@ static void TIM2_Init(void)
   TIM_MasterConfigTypeDef sMasterConfig = {0};
 
   /* USER CODE BEGIN TIM2_Init 1 */
-
+	// The registers can only be set up once the timer has a clock
+	__HAL_RCC_TIM2_CLK_ENABLE();
   /* USER CODE END TIM2_Init 1 */
   htim2.Instance = TIM2;
-  htim2.Init.Prescaler = 32000;
+  // 84 MHz timer clock divided down to 1 MHz, counting the whole 32 bits before wrapping
+  htim2.Init.Prescaler = 83;
   htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim2.Init.Period = 1;
+  htim2.Init.Period = 0xFFFFFFFF;
   htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
   if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
   {
@@ -681,7 +749,7 @@ static void TIM2_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN TIM2_Init 2 */
-
+	HAL_TIM_Base_Start(&htim2);
   /* USER CODE END TIM2_Init 2 */
 
 }
@@ -729,6 +797,15 @@ static void GPIO_Init(void)
 	
 	HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 	HAL_GPIO_Init(GPIOG, &GPIO_InitStruct);
+	
+	// MPU INT GPIO, interrupts on the rising edge when a sample is ready
+	GPIO_InitStruct.Pin = IMU_INT_PIN;
+	GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+	GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	GPIO_InitStruct.Alternate = NULL;
+	
+	HAL_GPIO_Init(IMU_INT_PORT, &GPIO_InitStruct);
 }
 
 void Error_Handler(void)
@@ -20,11 +20,34 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#include <limits.h>
 
-#include "rotary_encoder.h"
-#include "sensor_ui.h"
-
+// Fonts from the board support, declared before the headers that draw text
 extern GLCD_FONT GLCD_Font_6x8;
 extern GLCD_FONT GLCD_Font_16x24;
 
+#include "rotary_encoder.h"
+#include "fast_math.h"
+#include "imu.h"
+#include "fusion.h"
+#include "sine_table.h"
+#include "dma2d.h"
+#include "damage.h"
+#include "palette.h"
+#include "framebuffer.h"
+#include "needle_atlas.h"
+#include "overlay.h"
+#include "text.h"
+#include "raster.h"
+#include "circle.h"
+#include "chevron_mask.h"
+#include "chevron_bar.h"
+#include "displaylist.h"
+#include "tile.h"
+#include "bgcache.h"
+#include "perf.h"
+#include "sensor_ui.h"
+#include "widget.h"
+#include "scheduler.h"
+
 #endif /* __MAIN_H */
\ No newline at end of file
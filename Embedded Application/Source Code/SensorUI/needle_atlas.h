@@ -0,0 +1,110 @@
+/*
+
+ File        		: needle_atlas.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the needle atlas, an anti-aliased image
+									of the lean needle for every whole degree from -90 to 90.
+									They are rendered on the host by tests/test_needle_atlas.c
+									and kept in flash as one run of 4-bit alpha values per row,
+									leaving out the empty pixels around the needle. Showing the
+									needle is then a copy of one bounded run per row into the
+									overlay, with no line to walk. Moving it erases the old
+									image and writes the new one, about 614 pixels against 226
+									for the line it replaces, but every one of them is a plain
+									store in the vertical blank.
+
+*/
+
+#ifndef __NEEDLE_ATLAS_H
+#define __NEEDLE_ATLAS_H
+
+#include "main.h"
+
+// Set to 0 to go back to drawing the needle as a one pixel Bresenham line
+#ifndef NEEDLE_USE_SPRITES
+#define NEEDLE_USE_SPRITES 1
+#endif
+
+// Images either side of upright, one per degree
+#define NEEDLE_MAX_ANGLE 90
+#define NEEDLE_SPRITES ((2 * NEEDLE_MAX_ANGLE) + 1)
+// Length of the needle the images are made for, the lean needle set up in hudInit()
+#define NEEDLE_LENGTH 128
+
+// One image. The box is given relative to the pivot, and each of its rows is
+// stored as a start column, a length and then that many alpha values
+typedef struct
+{
+	int16_t x, y;
+	uint16_t w, h;
+	uint32_t offset;        // Where the rows start in needleAtlas
+} NEEDLE_SPRITE;
+
+// needleSprites and needleAtlas, const so they stay in flash
+#include "needle_atlas_data.h"
+
+// Image for an angle given in sine table steps, to the nearest degree
+int needleSpriteIndex(int step)
+{
+	int degrees = step >= 0 ? (step + (SINE_STEPS_PER_DEGREE / 2)) / SINE_STEPS_PER_DEGREE :
+		-((-step + (SINE_STEPS_PER_DEGREE / 2)) / SINE_STEPS_PER_DEGREE);
+
+	degrees = degrees < -NEEDLE_MAX_ANGLE ? -NEEDLE_MAX_ANGLE : (degrees > NEEDLE_MAX_ANGLE ? NEEDLE_MAX_ANGLE : degrees);
+	return degrees + NEEDLE_MAX_ANGLE;
+}
+
+// Whether there is an image for 'index'
+bool needleSpriteReady(int index)
+{
+	return index >= 0 && index < NEEDLE_SPRITES;
+}
+
+// Writes image 'index' into an ARGB4444 buffer 'pitch' pixels wide, with the pivot
+// at 'px', 'py' in the buffer. Alpha is taken from the image and the colour from
+// 'colour', which is ARGB4444 with its alpha left at 0. With 'erase' set every
+// pixel of the image is cleared instead. Rows and columns outside the 'w' by 'h'
+// buffer are left out. Returns the pixels written
+uint32_t needleSpriteWrite(int index, uint16_t *dst, int pitch, int w, int h, int px, int py, uint16_t colour,
+	bool erase)
+{
+	const NEEDLE_SPRITE *sprite = &needleSprites[index];
+	const uint8_t *row = needleAtlas + sprite->offset;
+	uint16_t *out;
+	uint32_t written = 0;
+	int j, i, x, y, len;
+
+	for (j = 0; j < sprite->h; j++, row += 2 + len)
+	{
+		len = row[1];
+		y = py + sprite->y + j;
+		x = px + sprite->x + row[0];
+		if (y < 0 || y >= h)
+		{
+			continue;
+		}
+		out = dst + (y * pitch) + x;
+		for (i = 0; i < len; i++)
+		{
+			if (x + i >= 0 && x + i < w)
+			{
+				out[i] = !erase && row[2 + i] != 0 ? (uint16_t)(colour | ((uint16_t)row[2 + i] << 12)) : 0;
+				written++;
+			}
+		}
+	}
+	return written;
+}
+
+uint32_t needleSpriteBlit(int index, uint16_t *dst, int pitch, int w, int h, int px, int py, uint16_t colour)
+{
+	return needleSpriteWrite(index, dst, pitch, w, h, px, py, colour, false);
+}
+
+uint32_t needleSpriteErase(int index, uint16_t *dst, int pitch, int w, int h, int px, int py)
+{
+	return needleSpriteWrite(index, dst, pitch, w, h, px, py, 0, true);
+}
+
+#endif
@@ -0,0 +1,3902 @@
+/*
+
+ File        		: needle_atlas_data.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The needle images for needle_atlas.h, made by
+									tests/test_needle_atlas.c. Don't edit by hand, run it with
+									'generate' to make them again. 88641 bytes holding 57427 alpha
+									values for a needle 128 pixels long.
+
+*/
+
+#ifndef __NEEDLE_ATLAS_DATA_H
+#define __NEEDLE_ATLAS_DATA_H
+
+// Box relative to the pivot and where its rows start, for -90 to 90 degrees
+const NEEDLE_SPRITE needleSprites[NEEDLE_SPRITES] =
+{
+	{-129, -2, 131, 5, 0},
+	{-129, -4, 131, 7, 399},
+	{-129, -7, 131, 10, 736},
+	{-129, -9, 131, 12, 1073},
+	{-128, -11, 130, 14, 1412},
+	{-128, -13, 130, 16, 1756},
+	{-128, -16, 130, 19, 2104},
+	{-128, -18, 130, 21, 2460},
+	{-127, -20, 129, 23, 2817},
+	{-127, -22, 129, 25, 3179},
+	{-127, -24, 129, 27, 3547},
+	{-126, -27, 128, 30, 3918},
+	{-126, -29, 128, 32, 4293},
+	{-125, -31, 127, 34, 4673},
+	{-125, -33, 127, 36, 5061},
+	{-124, -35, 126, 38, 5449},
+	{-124, -38, 126, 41, 5842},
+	{-123, -40, 125, 43, 6243},
+	{-122, -42, 124, 45, 6645},
+	{-122, -44, 124, 47, 7050},
+	{-121, -46, 123, 49, 7461},
+	{-120, -48, 122, 51, 7876},
+	{-119, -50, 121, 53, 8294},
+	{-119, -52, 121, 55, 8715},
+	{-118, -54, 120, 57, 9142},
+	{-117, -56, 119, 59, 9573},
+	{-116, -58, 118, 61, 10008},
+	{-115, -60, 117, 63, 10448},
+	{-114, -62, 116, 65, 10888},
+	{-113, -64, 115, 67, 11334},
+	{-112, -66, 114, 69, 11784},
+	{-110, -68, 112, 71, 12239},
+	{-109, -70, 111, 73, 12697},
+	{-108, -72, 110, 75, 13159},
+	{-107, -74, 109, 77, 13625},
+	{-105, -76, 107, 79, 14096},
+	{-104, -77, 106, 80, 14565},
+	{-103, -79, 105, 82, 15041},
+	{-102, -81, 104, 84, 15521},
+	{-100, -83, 102, 86, 16006},
+	{-99, -85, 101, 88, 16495},
+	{-97, -86, 99, 89, 16989},
+	{-96, -88, 98, 91, 17484},
+	{-94, -90, 96, 93, 17984},
+	{-93, -91, 95, 94, 18485},
+	{-91, -93, 93, 96, 18988},
+	{-90, -94, 92, 97, 19456},
+	{-88, -96, 90, 99, 19965},
+	{-86, -97, 88, 100, 20478},
+	{-85, -99, 87, 102, 20996},
+	{-83, -100, 85, 103, 21517},
+	{-81, -102, 83, 105, 22041},
+	{-80, -103, 82, 106, 22568},
+	{-78, -104, 80, 107, 23097},
+	{-76, -106, 78, 109, 23627},
+	{-74, -107, 76, 110, 24161},
+	{-72, -108, 74, 111, 24692},
+	{-70, -110, 72, 113, 25231},
+	{-68, -111, 70, 114, 25773},
+	{-67, -112, 69, 115, 26317},
+	{-65, -113, 67, 116, 26863},
+	{-63, -114, 65, 117, 27412},
+	{-61, -115, 63, 118, 27962},
+	{-59, -116, 61, 119, 28514},
+	{-57, -117, 59, 120, 29066},
+	{-55, -118, 57, 121, 29624},
+	{-53, -119, 55, 122, 30183},
+	{-51, -120, 53, 123, 30744},
+	{-49, -121, 51, 124, 31307},
+	{-46, -122, 48, 125, 31870},
+	{-44, -123, 46, 126, 32436},
+	{-42, -123, 44, 126, 33005},
+	{-40, -124, 42, 127, 33574},
+	{-38, -125, 40, 128, 34143},
+	{-36, -125, 38, 128, 34715},
+	{-34, -126, 36, 129, 35290},
+	{-32, -126, 34, 129, 35865},
+	{-29, -127, 31, 130, 36439},
+	{-27, -127, 29, 130, 37019},
+	{-25, -128, 27, 131, 37595},
+	{-23, -128, 25, 131, 38172},
+	{-21, -129, 23, 132, 38751},
+	{-19, -129, 21, 132, 39333},
+	{-16, -129, 18, 132, 39913},
+	{-14, -130, 16, 133, 40492},
+	{-12, -130, 14, 133, 41076},
+	{-10, -130, 12, 133, 41658},
+	{-7, -130, 9, 133, 42240},
+	{-5, -130, 7, 133, 42821},
+	{-3, -130, 5, 133, 43404},
+	{-1, -130, 3, 133, 43993},
+	{-1, -130, 5, 133, 44648},
+	{-1, -130, 7, 133, 45237},
+	{-1, -130, 9, 133, 45820},
+	{-1, -130, 12, 133, 46401},
+	{-1, -130, 14, 133, 46983},
+	{-1, -130, 16, 133, 47565},
+	{-1, -129, 18, 132, 48149},
+	{-1, -129, 21, 132, 48728},
+	{-1, -129, 23, 132, 49308},
+	{-1, -128, 25, 131, 49890},
+	{-1, -128, 27, 131, 50469},
+	{-1, -127, 29, 130, 51046},
+	{-1, -127, 31, 130, 51622},
+	{-1, -126, 34, 129, 52202},
+	{-1, -126, 36, 129, 52776},
+	{-1, -125, 38, 128, 53351},
+	{-1, -125, 40, 128, 53926},
+	{-1, -124, 42, 127, 54498},
+	{-1, -123, 44, 126, 55067},
+	{-1, -123, 46, 126, 55636},
+	{-1, -122, 48, 125, 56205},
+	{-1, -121, 51, 124, 56771},
+	{-1, -120, 53, 123, 57334},
+	{-1, -119, 55, 122, 57897},
+	{-1, -118, 57, 121, 58458},
+	{-1, -117, 59, 120, 59017},
+	{-1, -116, 61, 119, 59575},
+	{-1, -115, 63, 118, 60127},
+	{-1, -114, 65, 117, 60679},
+	{-1, -113, 67, 116, 61229},
+	{-1, -112, 69, 115, 61778},
+	{-1, -111, 70, 114, 62324},
+	{-1, -110, 72, 113, 62868},
+	{-1, -108, 74, 111, 63410},
+	{-1, -107, 76, 110, 63949},
+	{-1, -106, 78, 109, 64480},
+	{-1, -104, 80, 107, 65014},
+	{-1, -103, 82, 106, 65544},
+	{-1, -102, 83, 105, 66073},
+	{-1, -100, 85, 103, 66600},
+	{-1, -99, 87, 102, 67124},
+	{-1, -97, 88, 100, 67645},
+	{-1, -96, 90, 99, 68163},
+	{-1, -94, 92, 97, 68676},
+	{-1, -93, 93, 96, 69185},
+	{-1, -91, 95, 94, 69653},
+	{-1, -90, 96, 93, 70156},
+	{-1, -88, 98, 91, 70657},
+	{-1, -86, 99, 89, 71157},
+	{-1, -85, 101, 88, 71652},
+	{-1, -83, 102, 86, 72146},
+	{-1, -81, 104, 84, 72635},
+	{-1, -79, 105, 82, 73120},
+	{-1, -77, 106, 80, 73600},
+	{-1, -76, 107, 79, 74076},
+	{-1, -74, 109, 77, 74545},
+	{-1, -72, 110, 75, 75016},
+	{-1, -70, 111, 73, 75482},
+	{-1, -68, 112, 71, 75944},
+	{-1, -66, 114, 69, 76402},
+	{-1, -64, 115, 67, 76857},
+	{-1, -62, 116, 65, 77307},
+	{-1, -60, 117, 63, 77753},
+	{-1, -58, 118, 61, 78193},
+	{-1, -56, 119, 59, 78633},
+	{-1, -54, 120, 57, 79068},
+	{-1, -52, 121, 55, 79499},
+	{-1, -50, 121, 53, 79926},
+	{-1, -48, 122, 51, 80347},
+	{-1, -46, 123, 49, 80765},
+	{-1, -44, 124, 47, 81180},
+	{-1, -42, 124, 45, 81591},
+	{-1, -40, 125, 43, 81996},
+	{-1, -38, 126, 41, 82398},
+	{-1, -35, 126, 38, 82799},
+	{-1, -33, 127, 36, 83192},
+	{-1, -31, 127, 34, 83580},
+	{-1, -29, 128, 32, 83968},
+	{-1, -27, 128, 30, 84348},
+	{-1, -24, 129, 27, 84723},
+	{-1, -22, 129, 25, 85094},
+	{-1, -20, 129, 23, 85462},
+	{-1, -18, 130, 21, 85824},
+	{-1, -16, 130, 19, 86181},
+	{-1, -13, 130, 16, 86537},
+	{-1, -11, 130, 14, 86885},
+	{-1, -9, 131, 12, 87229},
+	{-1, -7, 131, 10, 87568},
+	{-1, -4, 131, 7, 87905},
+	{-1, -2, 131, 5, 88242}
+};
+
+// Every row of every image, a start column, a length and then that many alpha values
+const uint8_t needleAtlas[88641] =
+{
+	0, 0, 1, 129, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 131, 4, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 4, 1, 129, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 1, 26, 7, 7, 7, 6, 6,
+	6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 0, 85, 3,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 14, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 12, 11, 11, 11, 10, 10, 10,
+	10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 4, 4, 4, 4,
+	3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 2, 128, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3,
+	3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9,
+	9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 14, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10, 10,
+	9, 9, 9, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 60, 71,
+	1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7,
+	7, 7, 7, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13,
+	13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 4, 117,
+	13, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 0, 0, 0, 0, 0, 0, 0, 21, 1, 11,
+	10, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 3, 3, 2, 2, 1, 1, 0, 50, 1, 12, 12,
+	13, 13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13,
+	12, 12, 11, 11, 10, 10, 9, 9, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 9,
+	69, 1, 1, 2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12,
+	13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13,
+	12, 11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 37, 70,
+	1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 11, 11, 12, 12, 13,
+	13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13, 12,
+	12, 11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 4, 4, 3, 3, 2, 2, 1, 1, 66, 64,
+	1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13,
+	13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13, 12,
+	12, 11, 11, 10, 10, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 95, 36, 1, 1, 2, 3, 3, 4,
+	4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 14, 14, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 4, 123, 7, 1, 1, 2, 2, 3, 3, 4, 0, 0, 0, 0, 0, 0, 0, 19, 1,
+	14, 14, 13, 12, 11, 10, 10, 9, 8, 7, 7, 6, 5, 4, 3, 3, 2, 1, 1, 37, 8, 9, 10, 10,
+	11, 12, 13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 12, 11, 11, 10, 9, 8,
+	7, 7, 6, 5, 4, 3, 3, 2, 1, 11, 46, 1, 2, 3, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10,
+	11, 12, 13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 11, 10, 9, 8,
+	7, 7, 6, 5, 4, 4, 3, 2, 1, 30, 46, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 9, 10, 10,
+	11, 12, 13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 11, 10, 9, 8,
+	8, 7, 6, 5, 4, 4, 3, 2, 1, 49, 47, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 9, 10, 10,
+	11, 12, 13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 11, 10, 9, 8,
+	8, 7, 6, 5, 4, 4, 3, 2, 1, 1, 68, 47, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 9, 9,
+	10, 11, 12, 13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 12, 11, 10, 9,
+	8, 8, 7, 6, 5, 4, 4, 3, 2, 1, 1, 87, 43, 1, 2, 2, 3, 4, 5, 5, 6, 7, 8, 9,
+	9, 10, 11, 12, 13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 12, 11, 10,
+	9, 8, 8, 7, 6, 5, 5, 4, 106, 25, 1, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 9, 10, 11,
+	12, 12, 13, 14, 15, 15, 15, 15, 15, 15, 4, 125, 5, 1, 1, 2, 3, 4, 0, 0, 0, 0, 0, 3,
+	2, 2, 1, 0, 17, 14, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 5, 4, 3, 2, 1, 0, 32,
+	4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9,
+	8, 7, 6, 5, 4, 3, 2, 1, 11, 35, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15,
+	15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 25, 35, 1,
+	2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12,
+	11, 10, 8, 7, 6, 5, 4, 3, 2, 1, 40, 34, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+	14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 1, 54, 35,
+	1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12,
+	11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 68, 35, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+	82, 35, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15,
+	14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 3, 2, 1, 97, 32, 1, 2, 3, 4, 5, 7, 8, 9, 10,
+	11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 111,
+	19, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 15, 15, 15, 15, 4, 125, 4, 1, 2,
+	3, 4, 0, 0, 0, 0, 0, 5, 4, 5, 4, 3, 2, 0, 17, 11, 15, 15, 15, 15, 15, 14, 13, 11,
+	10, 9, 7, 6, 5, 3, 2, 1, 1, 27, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15, 15, 15, 15,
+	15, 15, 14, 13, 12, 11, 9, 8, 7, 5, 4, 3, 1, 12, 28, 2, 3, 4, 6, 7, 8, 9, 11, 12,
+	13, 15, 15, 15, 15, 15, 15, 15, 14, 12, 11, 10, 8, 7, 6, 5, 3, 2, 1, 23, 28, 1, 2, 4,
+	5, 6, 8, 9, 10, 11, 13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2,
+	1, 35, 27, 2, 3, 4, 6, 7, 8, 10, 11, 12, 14, 15, 15, 15, 15, 15, 15, 15, 14, 12, 11, 10,
+	8, 7, 6, 4, 3, 2, 46, 28, 1, 3, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15, 15,
+	15, 14, 13, 11, 10, 9, 8, 6, 5, 4, 2, 1, 57, 28, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12,
+	14, 15, 15, 15, 15, 15, 15, 15, 13, 12, 11, 9, 8, 7, 5, 4, 3, 2, 69, 28, 1, 3, 4, 5,
+	7, 8, 9, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 11, 10, 9, 7, 6, 5, 3, 2, 1,
+	80, 28, 1, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 9,
+	8, 7, 5, 4, 3, 1, 92, 28, 2, 3, 4, 5, 7, 8, 9, 11, 12, 13, 15, 15, 15, 15, 15, 15,
+	15, 14, 12, 11, 10, 8, 7, 6, 5, 3, 2, 1, 103, 26, 1, 2, 4, 5, 6, 8, 9, 10, 11, 13,
+	14, 15, 15, 15, 15, 15, 15, 14, 13, 12, 10, 9, 8, 6, 5, 4, 115, 15, 2, 3, 4, 6, 7, 8,
+	10, 11, 12, 14, 15, 15, 15, 15, 4, 126, 3, 1, 2, 4, 0, 0, 0, 0, 0, 0, 0, 7, 5, 9,
+	7, 6, 4, 3, 1, 0, 16, 7, 14, 15, 15, 15, 15, 15, 15, 13, 11, 10, 8, 7, 5, 4, 2, 3,
+	23, 2, 3, 5, 6, 8, 10, 11, 13, 14, 15, 15, 15, 15, 15, 14, 12, 11, 9, 8, 6, 4, 3, 1,
+	12, 23, 1, 3, 4, 6, 7, 9, 10, 12, 14, 15, 15, 15, 15, 15, 15, 13, 11, 10, 8, 7, 5, 4,
+	2, 22, 23, 2, 3, 5, 6, 8, 10, 11, 13, 14, 15, 15, 15, 15, 15, 14, 12, 11, 9, 8, 6, 4,
+	3, 1, 31, 24, 1, 2, 4, 6, 7, 9, 10, 12, 13, 15, 15, 15, 15, 15, 15, 13, 11, 10, 8, 7,
+	5, 4, 2, 1, 41, 23, 2, 3, 5, 6, 8, 10, 11, 13, 14, 15, 15, 15, 15, 15, 14, 12, 11, 9,
+	8, 6, 4, 3, 1, 50, 24, 1, 2, 4, 6, 7, 9, 10, 12, 13, 15, 15, 15, 15, 15, 15, 13, 12,
+	10, 8, 7, 5, 4, 2, 1, 60, 23, 2, 3, 5, 6, 8, 9, 11, 13, 14, 15, 15, 15, 15, 15, 14,
+	12, 11, 9, 8, 6, 5, 3, 1, 69, 24, 1, 2, 4, 6, 7, 9, 10, 12, 13, 15, 15, 15, 15, 15,
+	15, 13, 12, 10, 8, 7, 5, 4, 2, 1, 79, 23, 2, 3, 5, 6, 8, 9, 11, 13, 14, 15, 15, 15,
+	15, 15, 14, 12, 11, 9, 8, 6, 5, 3, 1, 88, 24, 1, 2, 4, 5, 7, 9, 10, 12, 13, 15, 15,
+	15, 15, 15, 15, 13, 12, 10, 8, 7, 5, 4, 2, 1, 98, 23, 2, 3, 5, 6, 8, 9, 11, 13, 14,
+	15, 15, 15, 15, 15, 14, 12, 11, 9, 8, 6, 5, 3, 1, 107, 22, 1, 2, 4, 5, 7, 9, 10, 12,
+	13, 15, 15, 15, 15, 15, 15, 13, 12, 10, 9, 7, 5, 4, 117, 13, 2, 3, 5, 6, 8, 9, 11, 12,
+	14, 15, 15, 15, 4, 126, 3, 1, 2, 4, 0, 0, 0, 0, 0, 0, 0, 8, 3, 13, 11, 9, 7, 5,
+	4, 2, 0, 16, 2, 10, 12, 14, 15, 15, 15, 15, 15, 13, 11, 9, 7, 6, 4, 2, 4, 20, 1, 2,
+	4, 6, 8, 10, 11, 13, 15, 15, 15, 15, 15, 13, 11, 10, 8, 6, 4, 2, 13, 20, 2, 4, 6, 8,
+	9, 11, 13, 15, 15, 15, 15, 15, 13, 12, 10, 8, 6, 4, 3, 1, 21, 20, 2, 4, 5, 7, 9, 11,
+	13, 15, 15, 15, 15, 15, 14, 12, 10, 8, 6, 5, 3, 1, 29, 20, 2, 3, 5, 7, 9, 11, 13, 14,
+	15, 15, 15, 15, 14, 12, 10, 9, 7, 5, 3, 1, 37, 20, 1, 3, 5, 7, 9, 10, 12, 14, 15, 15,
+	15, 15, 14, 12, 11, 9, 7, 5, 3, 1, 45, 20, 1, 3, 5, 7, 8, 10, 12, 14, 15, 15, 15, 15,
+	15, 13, 11, 9, 7, 5, 4, 2, 53, 20, 1, 3, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15, 15, 13,
+	11, 9, 7, 6, 4, 2, 62, 19, 2, 4, 6, 8, 10, 11, 13, 15, 15, 15, 15, 15, 13, 11, 10, 8,
+	6, 4, 2, 70, 20, 2, 4, 6, 8, 9, 11, 13, 15, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 3,
+	1, 78, 20, 2, 4, 5, 7, 9, 11, 13, 15, 15, 15, 15, 15, 14, 12, 10, 8, 6, 5, 3, 1, 86,
+	20, 2, 3, 5, 7, 9, 11, 12, 14, 15, 15, 15, 15, 14, 12, 10, 9, 7, 5, 3, 1, 94, 20, 1,
+	3, 5, 7, 9, 10, 12, 14, 15, 15, 15, 15, 14, 12, 11, 9, 7, 5, 3, 2, 102, 20, 1, 3, 5,
+	6, 8, 10, 12, 14, 15, 15, 15, 15, 15, 13, 11, 9, 7, 5, 4, 2, 110, 19, 1, 3, 4, 6, 8,
+	10, 12, 14, 15, 15, 15, 15, 15, 13, 11, 9, 8, 6, 4, 119, 11, 2, 4, 6, 8, 10, 11, 13, 15,
+	15, 15, 4, 127, 2, 2, 4, 0, 0, 0, 0, 0, 1, 1, 0, 8, 14, 14, 12, 10, 8, 6, 4, 2,
+	0, 15, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 10, 8, 6, 4, 2, 5, 17, 2, 4, 6, 8, 10,
+	12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 4, 2, 12, 18, 1, 4, 6, 8, 10, 12, 14, 15, 15, 15,
+	15, 13, 11, 9, 7, 5, 3, 1, 19, 18, 1, 3, 5, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11, 9,
+	7, 5, 3, 1, 26, 18, 1, 3, 5, 7, 9, 11, 14, 15, 15, 15, 15, 14, 11, 9, 7, 5, 3, 1,
+	33, 18, 1, 3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 5, 3, 1, 40, 18, 1, 3,
+	5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 1, 48, 17, 2, 4, 7, 9, 11, 13,
+	15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 2, 55, 17, 2, 4, 6, 8, 10, 13, 15, 15, 15, 15, 14,
+	12, 10, 8, 6, 4, 2, 62, 17, 2, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11, 8, 6, 4,
+	2, 69, 17, 2, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 5, 2, 76, 18, 1, 3,
+	6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 5, 3, 1, 83, 18, 1, 3, 5, 7, 10, 12,
+	14, 15, 15, 15, 15, 13, 11, 9, 7, 5, 3, 1, 90, 18, 1, 3, 5, 7, 9, 11, 13, 15, 15, 15,
+	15, 14, 12, 9, 7, 5, 3, 1, 97, 18, 1, 3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10,
+	8, 6, 3, 1, 105, 17, 3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 2, 112,
+	16, 2, 4, 6, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 119, 10, 2, 4, 6, 8, 10,
+	12, 15, 15, 15, 4, 126, 2, 2, 4, 0, 0, 0, 0, 0, 3, 2, 3, 1, 0, 9, 10, 15, 15, 13,
+	11, 9, 6, 4, 2, 0, 15, 1, 5, 7, 9, 12, 14, 15, 15, 15, 14, 12, 9, 7, 5, 2, 6, 16,
+	1, 4, 6, 9, 11, 13, 15, 15, 15, 15, 13, 10, 8, 5, 3, 1, 12, 16, 1, 3, 5, 8, 10, 12,
+	15, 15, 15, 15, 13, 11, 9, 6, 4, 2, 19, 15, 2, 5, 7, 9, 12, 14, 15, 15, 15, 14, 12, 9,
+	7, 5, 2, 25, 16, 2, 4, 6, 9, 11, 13, 15, 15, 15, 15, 12, 10, 8, 5, 3, 1, 31, 16, 1,
+	3, 6, 8, 10, 13, 15, 15, 15, 15, 13, 11, 8, 6, 4, 1, 38, 15, 3, 5, 7, 10, 12, 14, 15,
+	15, 15, 14, 12, 9, 7, 4, 2, 44, 16, 2, 4, 6, 9, 11, 14, 15, 15, 15, 15, 12, 10, 8, 5,
+	3, 1, 50, 16, 1, 3, 6, 8, 10, 13, 15, 15, 15, 15, 13, 11, 8, 6, 4, 1, 57, 15, 3, 5,
+	7, 10, 12, 14, 15, 15, 15, 14, 11, 9, 7, 4, 2, 63, 15, 2, 4, 7, 9, 11, 14, 15, 15, 15,
+	14, 12, 10, 7, 5, 3, 69, 16, 1, 4, 6, 8, 11, 13, 15, 15, 15, 15, 13, 11, 8, 6, 3, 1,
+	76, 15, 3, 5, 7, 10, 12, 15, 15, 15, 15, 14, 11, 9, 7, 4, 2, 82, 15, 2, 4, 7, 9, 11,
+	14, 15, 15, 15, 14, 12, 10, 7, 5, 3, 88, 16, 1, 4, 6, 8, 11, 13, 15, 15, 15, 15, 13, 10,
+	8, 6, 3, 1, 94, 16, 1, 3, 5, 8, 10, 12, 15, 15, 15, 15, 13, 11, 9, 6, 4, 2, 101, 15,
+	2, 5, 7, 9, 12, 14, 15, 15, 15, 14, 12, 10, 7, 5, 2, 107, 16, 1, 4, 6, 8, 11, 13, 15,
+	15, 15, 15, 13, 10, 8, 6, 3, 1, 113, 15, 1, 3, 5, 8, 10, 12, 15, 15, 15, 15, 13, 11, 9,
+	6, 4, 120, 9, 2, 5, 7, 9, 12, 14, 15, 15, 4, 126, 2, 2, 4, 0, 0, 0, 0, 1, 3, 7,
+	5, 2, 0, 10, 4, 15, 15, 15, 14, 12, 9, 6, 4, 1, 1, 14, 1, 3, 6, 9, 11, 14, 15, 15,
+	15, 13, 11, 8, 5, 3, 7, 14, 2, 4, 7, 9, 12, 15, 15, 15, 15, 12, 10, 7, 5, 2, 13, 14,
+	2, 5, 8, 10, 13, 15, 15, 15, 14, 12, 9, 6, 4, 1, 18, 14, 1, 3, 6, 9, 11, 14, 15, 15,
+	15, 13, 11, 8, 6, 3, 24, 14, 2, 4, 7, 9, 12, 15, 15, 15, 15, 12, 10, 7, 5, 2, 30, 14,
+	2, 5, 8, 10, 13, 15, 15, 15, 14, 12, 9, 6, 4, 1, 35, 14, 1, 3, 6, 9, 11, 14, 15, 15,
+	15, 13, 11, 8, 6, 3, 41, 14, 2, 4, 7, 9, 12, 15, 15, 15, 15, 13, 10, 7, 5, 2, 47, 14,
+	2, 5, 8, 10, 13, 15, 15, 15, 14, 12, 9, 6, 4, 1, 52, 14, 1, 3, 6, 8, 11, 14, 15, 15,
+	15, 13, 11, 8, 6, 3, 58, 14, 2, 4, 7, 9, 12, 15, 15, 15, 15, 13, 10, 7, 5, 2, 64, 14,
+	2, 5, 8, 10, 13, 15, 15, 15, 14, 12, 9, 6, 4, 1, 69, 14, 1, 3, 6, 8, 11, 14, 15, 15,
+	15, 13, 11, 8, 6, 3, 75, 14, 1, 4, 7, 9, 12, 15, 15, 15, 15, 13, 10, 7, 5, 2, 81, 14,
+	2, 5, 8, 10, 13, 15, 15, 15, 14, 12, 9, 7, 4, 1, 86, 14, 1, 3, 6, 8, 11, 14, 15, 15,
+	15, 13, 11, 8, 6, 3, 92, 14, 1, 4, 7, 9, 12, 14, 15, 15, 15, 13, 10, 7, 5, 2, 98, 14,
+	2, 5, 8, 10, 13, 15, 15, 15, 14, 12, 9, 7, 4, 1, 103, 14, 1, 3, 6, 8, 11, 14, 15, 15,
+	15, 14, 11, 8, 6, 3, 109, 14, 1, 4, 7, 9, 12, 14, 15, 15, 15, 13, 10, 7, 5, 2, 115, 13,
+	2, 5, 7, 10, 13, 15, 15, 15, 14, 12, 9, 7, 4, 120, 9, 1, 3, 6, 8, 11, 14, 15, 15, 4,
+	126, 2, 1, 4, 0, 0, 0, 0, 0, 0, 0, 4, 9, 8, 6, 3, 0, 9, 10, 14, 15, 15, 15, 12,
+	9, 6, 3, 2, 13, 3, 5, 8, 11, 14, 15, 15, 15, 12, 9, 6, 4, 1, 7, 13, 2, 5, 8, 11,
+	14, 15, 15, 15, 13, 10, 7, 4, 1, 12, 13, 2, 5, 7, 10, 13, 15, 15, 15, 13, 10, 7, 4, 1,
+	17, 13, 1, 4, 7, 10, 13, 15, 15, 15, 13, 10, 8, 5, 2, 22, 13, 1, 4, 7, 9, 12, 15, 15,
+	15, 14, 11, 8, 5, 2, 28, 12, 3, 6, 9, 12, 15, 15, 15, 14, 11, 8, 6, 3, 33, 12, 3, 6,
+	9, 11, 14, 15, 15, 15, 12, 9, 6, 3, 38, 13, 2, 5, 8, 11, 14, 15, 15, 15, 12, 9, 6, 4,
+	1, 43, 13, 2, 5, 8, 11, 14, 15, 15, 15, 13, 10, 7, 4, 1, 48, 13, 2, 5, 7, 10, 13, 15,
+	15, 15, 13, 10, 7, 4, 2, 53, 13, 1, 4, 7, 10, 13, 15, 15, 15, 13, 11, 8, 5, 2, 58, 13,
+	1, 4, 7, 9, 12, 15, 15, 15, 14, 11, 8, 5, 2, 64, 12, 3, 6, 9, 12, 15, 15, 15, 14, 11,
+	8, 6, 3, 69, 12, 3, 6, 9, 11, 14, 15, 15, 15, 12, 9, 6, 3, 74, 13, 2, 5, 8, 11, 14,
+	15, 15, 15, 12, 9, 6, 4, 1, 79, 13, 2, 5, 8, 11, 13, 15, 15, 15, 13, 10, 7, 4, 1, 84,
+	13, 2, 4, 7, 10, 13, 15, 15, 15, 13, 10, 7, 4, 2, 89, 13, 1, 4, 7, 10, 13, 15, 15, 15,
+	13, 11, 8, 5, 2, 94, 13, 1, 4, 7, 9, 12, 15, 15, 15, 14, 11, 8, 5, 2, 100, 12, 3, 6,
+	9, 12, 15, 15, 15, 14, 11, 9, 6, 3, 105, 12, 3, 6, 9, 11, 14, 15, 15, 15, 12, 9, 6, 3,
+	110, 13, 2, 5, 8, 11, 14, 15, 15, 15, 12, 9, 6, 4, 1, 115, 12, 2, 5, 8, 11, 13, 15, 15,
+	15, 13, 10, 7, 4, 120, 8, 2, 4, 7, 10, 13, 15, 15, 4, 125, 2, 1, 4, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 12, 9, 6, 3, 0, 10, 4, 10, 14, 15, 15, 15, 12, 8, 5, 2, 3, 12, 2, 5,
+	8, 11, 14, 15, 15, 14, 11, 7, 4, 1, 8, 11, 3, 6, 9, 12, 15, 15, 15, 13, 10, 7, 3, 12,
+	12, 1, 4, 7, 10, 13, 15, 15, 15, 12, 9, 6, 3, 17, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11,
+	8, 5, 2, 22, 12, 3, 6, 9, 12, 15, 15, 15, 13, 10, 7, 4, 1, 27, 11, 3, 7, 10, 13, 15,
+	15, 15, 12, 9, 6, 3, 31, 12, 1, 4, 7, 11, 14, 15, 15, 14, 11, 8, 5, 2, 36, 12, 2, 5,
+	8, 12, 15, 15, 15, 14, 10, 7, 4, 1, 41, 11, 3, 6, 9, 12, 15, 15, 15, 13, 9, 6, 3, 45,
+	12, 1, 4, 7, 10, 13, 15, 15, 15, 12, 9, 5, 2, 50, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11,
+	8, 4, 1, 55, 11, 3, 6, 9, 12, 15, 15, 15, 13, 10, 7, 4, 59, 12, 1, 4, 7, 10, 13, 15,
+	15, 15, 12, 9, 6, 3, 64, 12, 1, 5, 8, 11, 14, 15, 15, 14, 11, 8, 5, 2, 69, 12, 2, 5,
+	9, 12, 15, 15, 15, 13, 10, 7, 4, 1, 74, 11, 3, 6, 10, 13, 15, 15, 15, 12, 9, 6, 3, 78,
+	12, 1, 4, 7, 10, 14, 15, 15, 15, 11, 8, 5, 2, 83, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11,
+	7, 4, 1, 88, 11, 3, 6, 9, 12, 15, 15, 15, 13, 10, 6, 3, 92, 12, 1, 4, 7, 10, 13, 15,
+	15, 15, 12, 9, 6, 2, 97, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11, 8, 5, 2, 102, 12, 3, 6,
+	9, 12, 15, 15, 15, 13, 10, 7, 4, 1, 107, 11, 4, 7, 10, 13, 15, 15, 15, 12, 9, 6, 3, 111,
+	12, 1, 4, 8, 11, 14, 15, 15, 14, 11, 8, 5, 2, 116, 11, 2, 5, 8, 12, 15, 15, 15, 13, 10,
+	7, 4, 121, 7, 3, 6, 9, 13, 15, 15, 4, 125, 2, 1, 4, 0, 0, 0, 0, 0, 0, 0, 5, 14,
+	13, 10, 7, 3, 0, 10, 6, 10, 13, 15, 15, 14, 11, 8, 4, 1, 3, 11, 2, 5, 8, 12, 15, 15,
+	15, 12, 9, 5, 2, 7, 11, 1, 4, 7, 11, 14, 15, 15, 13, 10, 7, 3, 12, 11, 3, 6, 10, 13,
+	15, 15, 14, 11, 8, 4, 1, 16, 11, 2, 5, 8, 12, 15, 15, 15, 12, 9, 5, 2, 20, 11, 1, 4,
+	7, 11, 14, 15, 15, 13, 10, 7, 3, 25, 11, 3, 6, 10, 13, 15, 15, 14, 11, 8, 4, 1, 29, 11,
+	2, 5, 8, 12, 15, 15, 15, 12, 9, 5, 2, 33, 11, 1, 4, 7, 11, 14, 15, 15, 13, 10, 7, 3,
+	38, 11, 3, 6, 10, 13, 15, 15, 14, 11, 8, 4, 1, 42, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9,
+	5, 2, 46, 11, 1, 4, 7, 11, 14, 15, 15, 13, 10, 6, 3, 51, 11, 3, 6, 10, 13, 15, 15, 14,
+	11, 8, 4, 1, 55, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2, 59, 11, 1, 4, 7, 11, 14,
+	15, 15, 13, 10, 6, 3, 64, 11, 3, 6, 10, 13, 15, 15, 14, 11, 8, 4, 1, 68, 11, 2, 5, 9,
+	12, 15, 15, 15, 12, 9, 5, 2, 72, 11, 1, 4, 7, 11, 14, 15, 15, 13, 10, 6, 3, 77, 11, 3,
+	6, 10, 13, 15, 15, 14, 11, 8, 4, 1, 81, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2, 85,
+	11, 1, 4, 7, 11, 14, 15, 15, 13, 10, 6, 3, 90, 11, 3, 6, 10, 13, 15, 15, 14, 11, 8, 4,
+	1, 94, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2, 98, 11, 1, 4, 7, 11, 14, 15, 15, 13,
+	10, 6, 3, 103, 11, 3, 6, 10, 13, 15, 15, 14, 11, 8, 4, 1, 107, 11, 2, 5, 9, 12, 15, 15,
+	15, 12, 9, 5, 2, 111, 11, 1, 4, 7, 11, 14, 15, 15, 13, 10, 6, 3, 116, 10, 3, 6, 10, 13,
+	15, 15, 14, 11, 8, 4, 120, 7, 2, 5, 9, 12, 15, 15, 4, 124, 2, 1, 4, 0, 0, 0, 0, 1,
+	1, 3, 0, 6, 7, 15, 14, 10, 7, 3, 1, 9, 5, 9, 13, 15, 15, 14, 10, 7, 3, 4, 10, 2,
+	5, 9, 13, 15, 15, 14, 10, 7, 3, 8, 10, 2, 5, 9, 13, 15, 15, 14, 10, 7, 3, 12, 10, 2,
+	5, 9, 13, 15, 15, 14, 10, 7, 3, 16, 10, 2, 5, 9, 13, 15, 15, 14, 10, 7, 3, 20, 10, 2,
+	5, 9, 12, 15, 15, 14, 11, 7, 3, 24, 10, 2, 5, 9, 12, 15, 15, 14, 11, 7, 3, 28, 10, 2,
+	5, 9, 12, 15, 15, 14, 11, 7, 3, 32, 10, 1, 5, 9, 12, 15, 15, 14, 11, 7, 3, 36, 10, 1,
+	5, 9, 12, 15, 15, 14, 11, 7, 3, 40, 10, 1, 5, 9, 12, 15, 15, 14, 11, 7, 3, 44, 10, 1,
+	5, 9, 12, 15, 15, 14, 11, 7, 3, 48, 10, 1, 5, 9, 12, 15, 15, 14, 11, 7, 4, 52, 10, 1,
+	5, 9, 12, 15, 15, 14, 11, 7, 4, 56, 10, 1, 5, 8, 12, 15, 15, 14, 11, 7, 4, 60, 10, 1,
+	5, 8, 12, 15, 15, 15, 11, 7, 4, 64, 10, 1, 5, 8, 12, 15, 15, 15, 11, 7, 4, 68, 10, 1,
+	5, 8, 12, 15, 15, 15, 11, 7, 4, 72, 10, 1, 5, 8, 12, 15, 15, 15, 11, 7, 4, 76, 10, 1,
+	5, 8, 12, 15, 15, 15, 11, 7, 4, 80, 10, 1, 5, 8, 12, 15, 15, 15, 11, 7, 4, 84, 10, 1,
+	5, 8, 12, 15, 15, 15, 11, 8, 4, 88, 10, 1, 5, 8, 12, 15, 15, 15, 11, 8, 4, 92, 10, 1,
+	5, 8, 12, 15, 15, 15, 11, 8, 4, 96, 10, 1, 4, 8, 12, 15, 15, 15, 11, 8, 4, 100, 10, 1,
+	4, 8, 12, 15, 15, 15, 11, 8, 4, 104, 10, 1, 4, 8, 12, 15, 15, 15, 11, 8, 4, 108, 10, 1,
+	4, 8, 12, 15, 15, 15, 11, 8, 4, 112, 11, 1, 4, 8, 12, 15, 15, 15, 11, 8, 4, 1, 116, 10,
+	1, 4, 8, 12, 15, 15, 15, 11, 8, 4, 120, 7, 1, 4, 8, 11, 15, 15, 4, 124, 2, 1, 4, 0,
+	0, 0, 0, 0, 2, 5, 4, 0, 6, 13, 15, 14, 10, 6, 3, 0, 10, 1, 5, 9, 13, 15, 15, 13,
+	9, 5, 2, 4, 10, 2, 6, 10, 14, 15, 15, 12, 8, 4, 1, 8, 9, 3, 7, 11, 15, 15, 15, 11,
+	7, 3, 12, 9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 15, 10, 1, 5, 9, 13, 15, 15, 13, 9, 5,
+	1, 19, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 23, 9, 3, 7, 11, 15, 15, 15, 11, 7, 3, 26,
+	10, 1, 4, 8, 12, 15, 15, 14, 10, 6, 2, 30, 10, 2, 5, 9, 13, 15, 15, 13, 9, 5, 1, 34,
+	9, 3, 6, 10, 14, 15, 15, 12, 8, 4, 38, 9, 4, 8, 11, 15, 15, 14, 11, 7, 3, 41, 10, 1,
+	5, 9, 12, 15, 15, 13, 10, 6, 2, 45, 10, 2, 6, 10, 13, 15, 15, 12, 8, 5, 1, 49, 9, 3,
+	7, 11, 15, 15, 15, 11, 7, 4, 53, 9, 4, 8, 12, 15, 15, 14, 10, 6, 3, 56, 10, 1, 5, 9,
+	13, 15, 15, 13, 9, 5, 1, 60, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 64, 9, 3, 7, 11, 15,
+	15, 15, 11, 7, 3, 68, 9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 71, 10, 1, 5, 9, 13, 15, 15,
+	13, 9, 5, 1, 75, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 79, 9, 3, 7, 11, 15, 15, 15, 11,
+	7, 3, 82, 10, 1, 4, 8, 12, 15, 15, 14, 10, 6, 2, 86, 10, 2, 6, 9, 13, 15, 15, 13, 9,
+	5, 1, 90, 9, 3, 7, 10, 14, 15, 15, 12, 8, 4, 94, 9, 4, 8, 11, 15, 15, 14, 11, 7, 3,
+	97, 10, 1, 5, 9, 13, 15, 15, 13, 9, 6, 2, 101, 10, 2, 6, 10, 14, 15, 15, 12, 8, 5, 1,
+	105, 9, 3, 7, 11, 15, 15, 15, 11, 7, 3, 109, 9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 112, 10,
+	1, 5, 9, 13, 15, 15, 13, 9, 5, 1, 116, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 120, 6, 3,
+	7, 11, 15, 15, 4, 124, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 1, 8, 4, 0, 7, 4, 15, 15,
+	14, 10, 6, 2, 2, 8, 5, 9, 13, 15, 15, 12, 8, 4, 5, 9, 3, 7, 11, 15, 15, 14, 10, 6,
+	2, 8, 9, 1, 5, 9, 13, 15, 15, 12, 8, 4, 12, 9, 3, 7, 11, 15, 15, 14, 10, 6, 2, 15,
+	9, 1, 5, 9, 13, 15, 15, 12, 8, 4, 19, 9, 3, 7, 11, 15, 15, 14, 10, 6, 2, 22, 9, 1,
+	5, 9, 13, 15, 15, 12, 8, 4, 26, 9, 3, 7, 11, 15, 15, 14, 10, 6, 2, 29, 9, 1, 5, 9,
+	13, 15, 15, 12, 8, 4, 33, 9, 3, 7, 11, 15, 15, 14, 10, 6, 1, 36, 9, 1, 5, 9, 13, 15,
+	15, 12, 8, 3, 40, 9, 3, 7, 11, 15, 15, 14, 10, 5, 1, 43, 9, 1, 5, 9, 13, 15, 15, 12,
+	7, 3, 47, 9, 3, 7, 11, 15, 15, 14, 10, 5, 1, 50, 9, 1, 5, 9, 14, 15, 15, 12, 7, 3,
+	54, 9, 3, 7, 12, 15, 15, 14, 9, 5, 1, 57, 9, 1, 5, 10, 14, 15, 15, 11, 7, 3, 61, 9,
+	3, 8, 12, 15, 15, 13, 9, 5, 1, 64, 9, 1, 6, 10, 14, 15, 15, 11, 7, 3, 68, 9, 3, 8,
+	12, 15, 15, 13, 9, 5, 1, 71, 9, 1, 6, 10, 14, 15, 15, 11, 7, 3, 75, 9, 4, 8, 12, 15,
+	15, 13, 9, 5, 1, 78, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 82, 9, 4, 8, 12, 15, 15, 13,
+	9, 5, 1, 85, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 89, 9, 4, 8, 12, 15, 15, 13, 9, 5,
+	1, 92, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 96, 9, 4, 8, 12, 15, 15, 13, 9, 5, 1, 99,
+	9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 103, 8, 4, 8, 12, 15, 15, 13, 9, 5, 106, 9, 2, 6,
+	10, 14, 15, 15, 11, 7, 2, 110, 8, 4, 8, 12, 15, 15, 13, 9, 4, 113, 9, 2, 6, 10, 15, 15,
+	15, 11, 6, 2, 117, 8, 4, 8, 12, 15, 15, 13, 8, 4, 120, 6, 2, 6, 10, 15, 15, 4, 124, 1,
+	4, 0, 0, 0, 0, 0, 0, 0, 3, 6, 9, 4, 0, 7, 8, 14, 15, 14, 10, 5, 1, 2, 8, 4,
+	9, 13, 15, 15, 11, 7, 2, 5, 8, 3, 8, 12, 15, 15, 12, 8, 3, 8, 8, 2, 7, 11, 15, 15,
+	13, 9, 5, 11, 9, 1, 5, 10, 14, 15, 15, 10, 6, 1, 15, 8, 4, 9, 13, 15, 15, 11, 7, 3,
+	18, 8, 3, 7, 12, 15, 15, 13, 8, 4, 21, 9, 2, 6, 11, 15, 15, 14, 9, 5, 1, 24, 9, 1,
+	5, 9, 14, 15, 15, 11, 6, 2, 28, 8, 4, 8, 13, 15, 15, 12, 7, 3, 31, 8, 3, 7, 11, 15,
+	15, 13, 9, 4, 34, 9, 1, 6, 10, 15, 15, 14, 10, 5, 1, 38, 8, 5, 9, 13, 15, 15, 11, 7,
+	2, 41, 8, 3, 8, 12, 15, 15, 12, 8, 3, 44, 8, 2, 7, 11, 15, 15, 13, 9, 5, 47, 9, 1,
+	5, 10, 14, 15, 15, 10, 6, 1, 51, 8, 4, 9, 13, 15, 15, 11, 7, 3, 54, 8, 3, 7, 12, 15,
+	15, 13, 8, 4, 57, 9, 2, 6, 11, 15, 15, 14, 9, 5, 1, 60, 9, 1, 5, 9, 14, 15, 15, 11,
+	6, 2, 64, 8, 4, 8, 13, 15, 15, 12, 7, 3, 67, 8, 3, 7, 11, 15, 15, 13, 9, 4, 70, 9,
+	1, 6, 10, 15, 15, 14, 10, 5, 1, 74, 8, 5, 9, 13, 15, 15, 11, 7, 2, 77, 8, 3, 8, 12,
+	15, 15, 12, 8, 3, 80, 8, 2, 7, 11, 15, 15, 13, 9, 4, 83, 9, 1, 6, 10, 14, 15, 14, 10,
+	6, 1, 87, 8, 4, 9, 13, 15, 15, 11, 7, 2, 90, 8, 3, 8, 12, 15, 15, 12, 8, 4, 93, 8,
+	2, 6, 11, 15, 15, 14, 9, 5, 96, 9, 1, 5, 10, 14, 15, 15, 10, 6, 2, 100, 8, 4, 8, 13,
+	15, 15, 12, 7, 3, 103, 8, 3, 7, 12, 15, 15, 13, 8, 4, 106, 9, 2, 6, 10, 15, 15, 14, 10,
+	5, 1, 110, 8, 5, 9, 14, 15, 15, 11, 6, 2, 113, 8, 4, 8, 12, 15, 15, 12, 8, 3, 116, 8,
+	2, 7, 11, 15, 15, 13, 9, 4, 119, 6, 1, 6, 10, 14, 15, 4, 123, 1, 4, 0, 0, 0, 0, 0,
+	0, 0, 3, 11, 9, 4, 0, 6, 10, 14, 15, 14, 9, 5, 2, 7, 5, 9, 14, 15, 14, 10, 5, 5,
+	8, 4, 9, 14, 15, 15, 10, 5, 1, 8, 8, 4, 9, 13, 15, 15, 10, 6, 1, 11, 8, 4, 8, 13,
+	15, 15, 11, 6, 2, 14, 8, 3, 8, 12, 15, 15, 11, 7, 2, 17, 8, 3, 7, 12, 15, 15, 12, 7,
+	2, 20, 8, 2, 7, 12, 15, 15, 12, 7, 3, 23, 8, 2, 7, 11, 15, 15, 12, 8, 3, 26, 8, 2,
+	6, 11, 15, 15, 13, 8, 3, 29, 8, 1, 6, 11, 15, 15, 13, 8, 4, 32, 8, 1, 6, 10, 15, 15,
+	13, 9, 4, 35, 8, 1, 5, 10, 15, 15, 14, 9, 4, 39, 7, 5, 10, 14, 15, 14, 9, 5, 42, 7,
+	5, 9, 14, 15, 14, 10, 5, 45, 8, 4, 9, 13, 15, 15, 10, 5, 1, 48, 8, 4, 8, 13, 15, 15,
+	10, 6, 1, 51, 8, 3, 8, 13, 15, 15, 11, 6, 2, 54, 8, 3, 8, 12, 15, 15, 11, 7, 2, 57,
+	8, 3, 7, 12, 15, 15, 12, 7, 2, 60, 8, 2, 7, 12, 15, 15, 12, 7, 3, 63, 8, 2, 7, 11,
+	15, 15, 12, 8, 3, 66, 8, 2, 6, 11, 15, 15, 13, 8, 3, 69, 8, 1, 6, 11, 15, 15, 13, 8,
+	4, 72, 8, 1, 6, 10, 15, 15, 13, 9, 4, 75, 8, 1, 5, 10, 15, 15, 14, 9, 4, 79, 7, 5,
+	10, 14, 15, 14, 9, 5, 82, 8, 5, 9, 14, 15, 14, 10, 5, 1, 85, 8, 4, 9, 13, 15, 15, 10,
+	6, 1, 88, 8, 4, 8, 13, 15, 15, 11, 6, 1, 91, 8, 3, 8, 13, 15, 15, 11, 6, 2, 94, 8,
+	3, 8, 12, 15, 15, 11, 7, 2, 97, 8, 3, 7, 12, 15, 15, 12, 7, 2, 100, 8, 2, 7, 12, 15,
+	15, 12, 7, 3, 103, 8, 2, 7, 11, 15, 15, 12, 8, 3, 106, 8, 2, 6, 11, 15, 15, 13, 8, 3,
+	109, 8, 1, 6, 11, 15, 15, 13, 8, 4, 112, 8, 1, 6, 10, 15, 15, 13, 9, 4, 115, 8, 1, 5,
+	10, 14, 15, 14, 9, 4, 119, 5, 5, 9, 14, 15, 4, 122, 1, 4, 0, 0, 0, 0, 0, 0, 0, 4,
+	3, 14, 9, 4, 0, 7, 1, 9, 14, 15, 14, 9, 4, 3, 7, 5, 10, 15, 15, 13, 8, 3, 5, 8,
+	1, 5, 10, 15, 15, 13, 8, 3, 8, 8, 1, 6, 11, 15, 15, 12, 7, 2, 11, 8, 1, 6, 11, 15,
+	15, 12, 7, 2, 14, 8, 2, 7, 12, 15, 15, 11, 6, 1, 17, 8, 2, 7, 12, 15, 15, 11, 6, 1,
+	20, 7, 3, 8, 13, 15, 15, 10, 5, 23, 7, 3, 8, 13, 15, 15, 10, 5, 26, 7, 4, 9, 14, 15,
+	14, 9, 4, 29, 7, 4, 9, 14, 15, 14, 9, 4, 32, 7, 5, 10, 14, 15, 13, 8, 3, 35, 7, 5,
+	10, 15, 15, 13, 8, 3, 37, 8, 1, 6, 11, 15, 15, 12, 7, 3, 40, 8, 1, 6, 11, 15, 15, 12,
+	7, 2, 43, 8, 2, 7, 11, 15, 15, 11, 6, 2, 46, 8, 2, 7, 12, 15, 15, 11, 6, 1, 49, 8,
+	3, 8, 12, 15, 15, 10, 6, 1, 52, 7, 3, 8, 13, 15, 15, 10, 5, 55, 7, 4, 8, 13, 15, 14,
+	10, 5, 58, 7, 4, 9, 14, 15, 14, 9, 4, 61, 7, 5, 9, 14, 15, 13, 9, 4, 64, 7, 5, 10,
+	15, 15, 13, 8, 3, 66, 8, 1, 5, 10, 15, 15, 13, 8, 3, 69, 8, 1, 6, 11, 15, 15, 12, 7,
+	2, 72, 8, 1, 6, 11, 15, 15, 12, 7, 2, 75, 8, 2, 7, 12, 15, 15, 11, 6, 1, 78, 8, 2,
+	7, 12, 15, 15, 11, 6, 1, 81, 7, 3, 8, 13, 15, 15, 10, 5, 84, 7, 3, 8, 13, 15, 15, 10,
+	5, 87, 7, 4, 9, 14, 15, 14, 9, 4, 90, 7, 4, 9, 14, 15, 14, 9, 4, 93, 7, 5, 10, 15,
+	15, 13, 8, 3, 96, 7, 5, 10, 15, 15, 13, 8, 3, 98, 8, 1, 6, 11, 15, 15, 12, 7, 2, 101,
+	8, 1, 6, 11, 15, 15, 12, 7, 2, 104, 8, 2, 7, 12, 15, 15, 11, 6, 2, 107, 8, 2, 7, 12,
+	15, 15, 11, 6, 1, 110, 8, 3, 8, 12, 15, 15, 10, 6, 1, 113, 7, 3, 8, 13, 15, 15, 10, 5,
+	116, 7, 4, 9, 13, 15, 14, 9, 5, 119, 5, 4, 9, 14, 15, 4, 122, 1, 4, 0, 0, 0, 0, 0,
+	0, 0, 4, 7, 14, 9, 4, 0, 7, 3, 9, 14, 15, 13, 8, 3, 3, 7, 5, 11, 15, 15, 12, 6,
+	1, 5, 7, 2, 7, 12, 15, 15, 10, 5, 8, 7, 3, 8, 13, 15, 14, 9, 4, 11, 7, 4, 9, 14,
+	15, 13, 8, 3, 14, 7, 5, 11, 15, 15, 12, 6, 1, 16, 7, 2, 7, 12, 15, 15, 10, 5, 19, 7,
+	3, 8, 13, 15, 14, 9, 4, 22, 7, 4, 9, 14, 15, 13, 8, 3, 25, 7, 5, 11, 15, 15, 11, 6,
+	1, 27, 7, 2, 7, 12, 15, 15, 10, 5, 30, 7, 3, 8, 13, 15, 14, 9, 4, 33, 7, 4, 9, 15,
+	15, 13, 8, 2, 36, 7, 6, 11, 15, 15, 11, 6, 1, 38, 7, 2, 7, 12, 15, 15, 10, 5, 41, 7,
+	3, 8, 13, 15, 14, 9, 4, 44, 7, 4, 9, 15, 15, 13, 8, 2, 47, 7, 6, 11, 15, 15, 11, 6,
+	1, 49, 7, 2, 7, 12, 15, 15, 10, 5, 52, 7, 3, 8, 13, 15, 14, 9, 4, 55, 7, 4, 9, 15,
+	15, 13, 8, 2, 57, 8, 1, 6, 11, 15, 15, 11, 6, 1, 60, 7, 2, 7, 12, 15, 15, 10, 5, 63,
+	7, 3, 8, 13, 15, 14, 9, 4, 66, 7, 4, 10, 15, 15, 13, 7, 2, 68, 8, 1, 6, 11, 15, 15,
+	11, 6, 1, 71, 7, 2, 7, 12, 15, 15, 10, 5, 74, 7, 3, 8, 13, 15, 14, 9, 4, 77, 7, 4,
+	10, 15, 15, 13, 7, 2, 79, 8, 1, 6, 11, 15, 15, 11, 6, 1, 82, 7, 2, 7, 12, 15, 15, 10,
+	5, 85, 7, 3, 8, 13, 15, 14, 9, 4, 88, 7, 4, 10, 15, 15, 12, 7, 2, 90, 8, 1, 6, 11,
+	15, 15, 11, 6, 1, 93, 7, 2, 7, 12, 15, 15, 10, 5, 96, 7, 3, 8, 14, 15, 14, 9, 3, 99,
+	7, 5, 10, 15, 15, 12, 7, 2, 101, 8, 1, 6, 11, 15, 15, 11, 6, 1, 104, 7, 2, 7, 12, 15,
+	15, 10, 5, 107, 7, 3, 8, 14, 15, 14, 9, 3, 110, 7, 5, 10, 15, 15, 12, 7, 2, 112, 8, 1,
+	6, 11, 15, 15, 11, 6, 1, 115, 7, 2, 7, 12, 15, 15, 10, 5, 118, 5, 3, 8, 14, 15, 4, 121,
+	1, 4, 0, 0, 0, 0, 0, 0, 0, 4, 11, 14, 9, 4, 0, 7, 4, 9, 15, 15, 12, 7, 1, 2,
+	7, 1, 6, 11, 15, 15, 10, 5, 5, 7, 3, 8, 13, 15, 13, 8, 3, 8, 6, 5, 10, 15, 15, 11,
+	6, 10, 7, 2, 7, 12, 15, 14, 9, 4, 13, 7, 4, 9, 14, 15, 12, 7, 2, 16, 6, 6, 11, 15,
+	15, 10, 5, 18, 7, 3, 8, 13, 15, 13, 8, 3, 21, 7, 5, 10, 15, 15, 11, 6, 1, 23, 7, 1,
+	7, 12, 15, 15, 9, 4, 26, 7, 4, 9, 14, 15, 12, 7, 2, 29, 6, 6, 11, 15, 15, 10, 5, 31,
+	7, 2, 8, 13, 15, 14, 8, 3, 34, 7, 5, 10, 15, 15, 11, 6, 1, 36, 7, 1, 7, 12, 15, 15,
+	9, 4, 39, 7, 3, 9, 14, 15, 13, 7, 2, 42, 6, 6, 11, 15, 15, 10, 5, 44, 7, 2, 8, 13,
+	15, 14, 8, 3, 47, 7, 4, 10, 15, 15, 12, 6, 1, 49, 7, 1, 7, 12, 15, 15, 9, 4, 52, 7,
+	3, 9, 14, 15, 13, 7, 2, 55, 6, 5, 11, 15, 15, 11, 5, 57, 7, 2, 8, 13, 15, 14, 8, 3,
+	60, 7, 4, 10, 15, 15, 12, 6, 1, 62, 7, 1, 6, 12, 15, 15, 10, 4, 65, 7, 3, 9, 14, 15,
+	13, 7, 2, 68, 6, 5, 11, 15, 15, 11, 5, 70, 7, 2, 7, 13, 15, 14, 9, 3, 73, 7, 4, 10,
+	15, 15, 12, 6, 1, 75, 7, 1, 6, 12, 15, 15, 10, 4, 78, 7, 3, 8, 14, 15, 13, 8, 2, 81,
+	6, 5, 11, 15, 15, 11, 5, 83, 7, 2, 7, 13, 15, 14, 9, 3, 86, 7, 4, 9, 15, 15, 12, 7,
+	1, 88, 7, 1, 6, 12, 15, 15, 10, 4, 91, 7, 3, 8, 14, 15, 13, 8, 2, 94, 6, 5, 10, 15,
+	15, 11, 6, 96, 7, 2, 7, 13, 15, 14, 9, 3, 99, 7, 4, 9, 15, 15, 12, 7, 1, 101, 7, 1,
+	6, 11, 15, 15, 10, 5, 104, 7, 3, 8, 14, 15, 13, 8, 2, 107, 6, 5, 10, 15, 15, 11, 6, 109,
+	7, 2, 7, 12, 15, 14, 9, 4, 112, 7, 4, 9, 15, 15, 12, 7, 1, 114, 7, 1, 6, 11, 15, 15,
+	10, 5, 117, 5, 3, 8, 13, 15, 4, 120, 1, 4, 0, 0, 0, 0, 0, 1, 2, 0, 4, 14, 14, 9,
+	3, 0, 6, 4, 9, 15, 15, 11, 6, 2, 7, 1, 7, 12, 15, 14, 8, 3, 5, 6, 4, 10, 15, 15,
+	11, 5, 7, 7, 1, 7, 13, 15, 14, 8, 2, 10, 6, 4, 10, 15, 15, 11, 5, 12, 7, 2, 7, 13,
+	15, 13, 8, 2, 15, 6, 5, 10, 15, 15, 10, 5, 17, 7, 2, 8, 13, 15, 13, 7, 2, 20, 6, 5,
+	10, 15, 15, 10, 5, 22, 7, 2, 8, 13, 15, 13, 7, 2, 25, 6, 5, 11, 15, 15, 10, 4, 27, 7,
+	2, 8, 14, 15, 13, 7, 1, 30, 6, 5, 11, 15, 15, 10, 4, 32, 7, 3, 8, 14, 15, 12, 7, 1,
+	35, 6, 6, 11, 15, 15, 9, 4, 37, 7, 3, 9, 14, 15, 12, 6, 1, 40, 6, 6, 12, 15, 15, 9,
+	3, 42, 6, 3, 9, 15, 15, 12, 6, 44, 7, 1, 6, 12, 15, 14, 9, 3, 47, 6, 4, 9, 15, 15,
+	11, 6, 49, 7, 1, 7, 12, 15, 14, 8, 3, 52, 6, 4, 9, 15, 15, 11, 6, 54, 7, 1, 7, 12,
+	15, 14, 8, 3, 57, 6, 4, 10, 15, 15, 11, 5, 59, 7, 1, 7, 13, 15, 14, 8, 2, 62, 6, 4,
+	10, 15, 15, 11, 5, 64, 7, 2, 7, 13, 15, 13, 8, 2, 67, 6, 5, 10, 15, 15, 10, 5, 69, 7,
+	2, 8, 13, 15, 13, 7, 2, 72, 6, 5, 11, 15, 15, 10, 4, 74, 7, 2, 8, 14, 15, 13, 7, 1,
+	77, 6, 5, 11, 15, 15, 10, 4, 79, 7, 3, 8, 14, 15, 12, 7, 1, 82, 6, 6, 11, 15, 15, 9,
+	4, 84, 7, 3, 9, 14, 15, 12, 7, 1, 87, 6, 6, 11, 15, 15, 9, 4, 89, 7, 3, 9, 14, 15,
+	12, 6, 1, 92, 6, 6, 12, 15, 15, 9, 3, 94, 6, 3, 9, 15, 15, 12, 6, 96, 7, 1, 6, 12,
+	15, 14, 9, 3, 99, 6, 4, 9, 15, 15, 11, 6, 101, 7, 1, 7, 12, 15, 14, 8, 3, 104, 6, 4,
+	10, 15, 15, 11, 5, 106, 7, 1, 7, 13, 15, 14, 8, 2, 109, 6, 4, 10, 15, 15, 11, 5, 111, 7,
+	2, 7, 13, 15, 13, 8, 2, 114, 6, 5, 10, 15, 15, 10, 5, 116, 5, 2, 8, 13, 15, 4, 119, 1,
+	4, 0, 0, 0, 0, 1, 1, 4, 0, 5, 1, 15, 14, 8, 2, 1, 6, 4, 10, 15, 15, 10, 4, 3,
+	7, 2, 8, 13, 15, 12, 7, 1, 6, 6, 5, 11, 15, 15, 9, 3, 8, 6, 3, 9, 15, 15, 11, 5,
+	10, 7, 1, 7, 13, 15, 13, 7, 1, 13, 6, 5, 11, 15, 15, 9, 3, 15, 6, 3, 9, 15, 15, 11,
+	5, 17, 7, 1, 7, 13, 15, 13, 7, 1, 20, 6, 5, 10, 15, 15, 9, 4, 22, 6, 3, 8, 14, 15,
+	12, 6, 25, 6, 6, 12, 15, 14, 8, 2, 27, 6, 4, 10, 15, 15, 10, 4, 29, 6, 2, 8, 14, 15,
+	12, 6, 32, 6, 6, 12, 15, 14, 8, 2, 34, 6, 4, 10, 15, 15, 10, 4, 36, 7, 2, 8, 13, 15,
+	12, 6, 1, 39, 6, 6, 11, 15, 14, 9, 3, 41, 6, 3, 9, 15, 15, 11, 5, 43, 7, 1, 7, 13,
+	15, 13, 7, 1, 46, 6, 5, 11, 15, 15, 9, 3, 48, 6, 3, 9, 15, 15, 11, 5, 50, 7, 1, 7,
+	13, 15, 13, 7, 1, 53, 6, 5, 11, 15, 15, 9, 3, 55, 6, 3, 9, 14, 15, 11, 6, 57, 7, 1,
+	6, 12, 15, 13, 8, 2, 60, 6, 4, 10, 15, 15, 10, 4, 62, 6, 2, 8, 14, 15, 12, 6, 65, 6,
+	6, 12, 15, 14, 8, 2, 67, 6, 4, 10, 15, 15, 10, 4, 69, 6, 2, 8, 14, 15, 12, 6, 72, 6,
+	6, 11, 15, 14, 8, 3, 74, 6, 4, 9, 15, 15, 11, 5, 76, 7, 1, 7, 13, 15, 13, 7, 1, 79,
+	6, 5, 11, 15, 15, 9, 3, 81, 6, 3, 9, 15, 15, 11, 5, 83, 7, 1, 7, 13, 15, 13, 7, 1,
+	86, 6, 5, 11, 15, 15, 9, 3, 88, 6, 3, 9, 14, 15, 11, 5, 90, 7, 1, 7, 12, 15, 13, 8,
+	2, 93, 6, 4, 10, 15, 15, 10, 4, 95, 6, 2, 8, 14, 15, 12, 6, 98, 6, 6, 12, 15, 14, 8,
+	2, 100, 6, 4, 10, 15, 15, 10, 4, 102, 6, 2, 8, 14, 15, 12, 6, 105, 6, 6, 12, 15, 14, 8,
+	2, 107, 6, 4, 10, 15, 15, 10, 5, 109, 7, 2, 7, 13, 15, 12, 7, 1, 112, 6, 5, 11, 15, 15,
+	9, 3, 114, 6, 3, 9, 15, 15, 11, 5, 116, 5, 1, 7, 13, 15, 4, 119, 1, 4, 0, 0, 0, 0,
+	1, 1, 5, 0, 5, 3, 15, 14, 8, 2, 1, 6, 4, 10, 15, 15, 9, 3, 3, 6, 2, 8, 14, 15,
+	11, 5, 5, 6, 1, 7, 13, 15, 12, 6, 8, 6, 5, 11, 15, 14, 8, 2, 10, 6, 4, 10, 15, 15,
+	9, 3, 12, 6, 2, 8, 15, 15, 11, 5, 14, 6, 1, 7, 13, 15, 12, 6, 17, 6, 5, 12, 15, 14,
+	8, 2, 19, 6, 4, 10, 15, 15, 9, 3, 21, 6, 2, 9, 15, 15, 11, 5, 23, 6, 1, 7, 13, 15,
+	12, 6, 26, 6, 6, 12, 15, 14, 8, 1, 28, 6, 4, 10, 15, 15, 9, 3, 30, 6, 3, 9, 15, 15,
+	11, 4, 32, 6, 1, 7, 13, 15, 12, 6, 35, 6, 6, 12, 15, 14, 7, 1, 37, 6, 4, 10, 15, 15,
+	9, 3, 39, 6, 3, 9, 15, 15, 10, 4, 41, 6, 1, 7, 13, 15, 12, 6, 44, 6, 6, 12, 15, 13,
+	7, 1, 46, 6, 4, 10, 15, 15, 9, 3, 48, 6, 3, 9, 15, 15, 10, 4, 50, 6, 1, 7, 13, 15,
+	12, 6, 53, 6, 6, 12, 15, 13, 7, 1, 55, 6, 4, 10, 15, 15, 9, 3, 57, 6, 3, 9, 15, 15,
+	10, 4, 59, 6, 1, 7, 14, 15, 12, 6, 62, 6, 6, 12, 15, 13, 7, 1, 64, 6, 4, 11, 15, 15,
+	9, 3, 66, 6, 3, 9, 15, 15, 10, 4, 68, 6, 1, 8, 14, 15, 12, 6, 71, 6, 6, 12, 15, 13,
+	7, 1, 73, 6, 5, 11, 15, 15, 9, 2, 75, 6, 3, 9, 15, 15, 10, 4, 77, 6, 2, 8, 14, 15,
+	12, 5, 80, 6, 6, 12, 15, 13, 7, 1, 82, 6, 5, 11, 15, 15, 8, 2, 84, 6, 3, 9, 15, 15,
+	10, 4, 86, 6, 2, 8, 14, 15, 11, 5, 89, 6, 6, 12, 15, 13, 7, 1, 91, 6, 5, 11, 15, 14,
+	8, 2, 93, 6, 3, 9, 15, 15, 10, 4, 95, 6, 2, 8, 14, 15, 11, 5, 98, 6, 6, 12, 15, 13,
+	7, 1, 100, 6, 5, 11, 15, 14, 8, 2, 102, 6, 3, 9, 15, 15, 10, 4, 104, 6, 2, 8, 14, 15,
+	11, 5, 107, 6, 6, 13, 15, 13, 7, 1, 109, 6, 5, 11, 15, 14, 8, 2, 111, 6, 3, 10, 15, 15,
+	10, 4, 113, 6, 2, 8, 14, 15, 11, 5, 116, 4, 7, 13, 15, 4, 118, 1, 4, 0, 0, 0, 0, 1,
+	1, 5, 0, 5, 4, 15, 14, 7, 1, 1, 6, 4, 10, 15, 15, 8, 2, 3, 6, 3, 9, 15, 15, 9,
+	3, 5, 6, 2, 8, 15, 15, 10, 4, 7, 6, 1, 8, 14, 15, 11, 5, 10, 5, 7, 13, 15, 12, 6,
+	12, 5, 6, 12, 15, 13, 6, 14, 6, 5, 11, 15, 14, 7, 1, 16, 6, 4, 10, 15, 15, 8, 2, 18,
+	6, 3, 9, 15, 15, 9, 3, 20, 6, 2, 8, 15, 15, 10, 4, 22, 6, 1, 7, 14, 15, 11, 5, 25,
+	5, 7, 13, 15, 12, 6, 27, 5, 6, 12, 15, 13, 7, 29, 6, 5, 11, 15, 14, 7, 1, 31, 6, 4,
+	10, 15, 15, 8, 2, 33, 6, 3, 9, 15, 15, 9, 3, 35, 6, 2, 8, 15, 15, 10, 4, 37, 6, 1,
+	7, 14, 15, 11, 5, 40, 5, 6, 13, 15, 12, 6, 42, 5, 6, 12, 15, 13, 7, 44, 6, 5, 11, 15,
+	14, 8, 1, 46, 6, 4, 10, 15, 15, 8, 2, 48, 6, 3, 9, 15, 15, 9, 3, 50, 6, 2, 8, 15,
+	15, 10, 4, 52, 6, 1, 7, 14, 15, 11, 5, 55, 5, 6, 13, 15, 12, 6, 57, 5, 5, 12, 15, 13,
+	7, 59, 6, 5, 11, 15, 14, 8, 1, 61, 6, 4, 10, 15, 15, 9, 2, 63, 6, 3, 9, 15, 15, 9,
+	3, 65, 6, 2, 8, 14, 15, 10, 4, 67, 6, 1, 7, 14, 15, 11, 5, 70, 5, 6, 13, 15, 12, 6,
+	72, 5, 5, 12, 15, 13, 7, 74, 6, 4, 11, 15, 14, 8, 1, 76, 6, 4, 10, 15, 15, 9, 2, 78,
+	6, 3, 9, 15, 15, 10, 3, 80, 6, 2, 8, 14, 15, 10, 4, 82, 6, 1, 7, 13, 15, 11, 5, 85,
+	5, 6, 13, 15, 12, 6, 87, 6, 5, 12, 15, 13, 7, 1, 89, 6, 4, 11, 15, 14, 8, 1, 91, 6,
+	3, 10, 15, 15, 9, 2, 93, 6, 3, 9, 15, 15, 10, 3, 95, 6, 2, 8, 14, 15, 11, 4, 97, 6,
+	1, 7, 13, 15, 11, 5, 100, 5, 6, 12, 15, 12, 6, 102, 6, 5, 12, 15, 13, 7, 1, 104, 6, 4,
+	11, 15, 14, 8, 1, 106, 6, 3, 10, 15, 15, 9, 2, 108, 6, 2, 9, 15, 15, 10, 3, 110, 6, 2,
+	8, 14, 15, 11, 4, 112, 6, 1, 7, 13, 15, 11, 5, 115, 4, 6, 12, 15, 4, 117, 1, 4, 0, 0,
+	0, 0, 1, 1, 5, 0, 4, 4, 15, 13, 7, 1, 6, 4, 11, 15, 14, 7, 1, 3, 6, 4, 10, 15,
+	14, 7, 1, 5, 6, 3, 10, 15, 14, 8, 1, 7, 6, 3, 10, 15, 15, 8, 2, 9, 6, 3, 9, 15,
+	15, 8, 2, 11, 6, 2, 9, 15, 15, 9, 2, 13, 6, 2, 9, 15, 15, 9, 3, 15, 6, 2, 8, 15,
+	15, 9, 3, 17, 6, 1, 8, 15, 15, 10, 3, 19, 6, 1, 8, 14, 15, 10, 4, 21, 6, 1, 7, 14,
+	15, 10, 4, 24, 5, 7, 14, 15, 11, 4, 26, 5, 7, 13, 15, 11, 5, 28, 5, 6, 13, 15, 11, 5,
+	30, 5, 6, 13, 15, 12, 5, 32, 5, 6, 12, 15, 12, 6, 34, 5, 5, 12, 15, 12, 6, 36, 5, 5,
+	12, 15, 13, 6, 38, 5, 5, 11, 15, 13, 7, 40, 5, 4, 11, 15, 13, 7, 42, 6, 4, 11, 15, 14,
+	7, 1, 44, 6, 4, 10, 15, 14, 8, 1, 46, 6, 3, 10, 15, 14, 8, 1, 48, 6, 3, 10, 15, 15,
+	8, 2, 50, 6, 3, 9, 15, 15, 8, 2, 52, 6, 2, 9, 15, 15, 9, 2, 54, 6, 2, 9, 15, 15,
+	9, 3, 56, 6, 2, 8, 15, 15, 9, 3, 58, 6, 1, 8, 15, 15, 10, 3, 60, 6, 1, 8, 14, 15,
+	10, 4, 62, 6, 1, 7, 14, 15, 10, 4, 65, 5, 7, 14, 15, 11, 4, 67, 5, 7, 13, 15, 11, 5,
+	69, 5, 6, 13, 15, 11, 5, 71, 5, 6, 13, 15, 12, 5, 73, 5, 6, 12, 15, 12, 6, 75, 5, 5,
+	12, 15, 12, 6, 77, 5, 5, 12, 15, 13, 6, 79, 5, 5, 11, 15, 13, 7, 81, 5, 4, 11, 15, 13,
+	7, 83, 6, 4, 11, 15, 14, 7, 1, 85, 6, 4, 10, 15, 14, 8, 1, 87, 6, 3, 10, 15, 14, 8,
+	1, 89, 6, 3, 10, 15, 15, 8, 2, 91, 6, 3, 9, 15, 15, 9, 2, 93, 6, 2, 9, 15, 15, 9,
+	2, 95, 6, 2, 9, 15, 15, 9, 3, 97, 6, 2, 8, 15, 15, 10, 3, 99, 6, 1, 8, 14, 15, 10,
+	3, 101, 6, 1, 8, 14, 15, 10, 4, 103, 6, 1, 7, 14, 15, 11, 4, 106, 5, 7, 13, 15, 11, 4,
+	108, 5, 7, 13, 15, 11, 5, 110, 5, 6, 13, 15, 12, 5, 112, 5, 6, 13, 15, 12, 5, 114, 4, 6,
+	12, 15, 4, 116, 1, 4, 0, 0, 0, 0, 1, 1, 5, 0, 4, 4, 15, 13, 6, 1, 5, 4, 11, 15,
+	13, 6, 3, 5, 4, 11, 15, 13, 6, 5, 5, 5, 12, 15, 12, 6, 7, 5, 5, 12, 15, 12, 5, 9,
+	5, 5, 12, 15, 12, 5, 11, 5, 6, 12, 15, 12, 5, 13, 5, 6, 13, 15, 11, 4, 15, 5, 6, 13,
+	15, 11, 4, 17, 5, 6, 13, 15, 11, 4, 19, 5, 7, 13, 15, 11, 4, 21, 5, 7, 14, 15, 10, 3,
+	23, 5, 7, 14, 15, 10, 3, 25, 5, 7, 14, 15, 10, 3, 26, 6, 1, 8, 14, 15, 10, 3, 28, 6,
+	1, 8, 15, 15, 9, 2, 30, 6, 1, 8, 15, 15, 9, 2, 32, 6, 2, 8, 15, 15, 9, 2, 34, 6,
+	2, 9, 15, 15, 9, 2, 36, 6, 2, 9, 15, 15, 8, 1, 38, 6, 2, 9, 15, 15, 8, 1, 40, 6,
+	3, 9, 15, 15, 8, 1, 42, 6, 3, 10, 15, 14, 7, 1, 44, 5, 3, 10, 15, 14, 7, 46, 5, 3,
+	10, 15, 14, 7, 48, 5, 4, 10, 15, 14, 7, 50, 5, 4, 11, 15, 13, 6, 52, 5, 4, 11, 15, 13,
+	6, 54, 5, 4, 11, 15, 13, 6, 56, 5, 5, 11, 15, 13, 6, 58, 5, 5, 12, 15, 12, 5, 60, 5,
+	5, 12, 15, 12, 5, 62, 5, 5, 12, 15, 12, 5, 64, 5, 6, 12, 15, 11, 5, 66, 5, 6, 13, 15,
+	11, 4, 68, 5, 6, 13, 15, 11, 4, 70, 5, 6, 13, 15, 11, 4, 72, 5, 7, 13, 15, 10, 4, 74,
+	5, 7, 14, 15, 10, 3, 76, 5, 7, 14, 15, 10, 3, 77, 6, 1, 7, 14, 15, 10, 3, 79, 6, 1,
+	8, 14, 15, 9, 3, 81, 6, 1, 8, 15, 15, 9, 2, 83, 6, 1, 8, 15, 15, 9, 2, 85, 6, 2,
+	8, 15, 15, 9, 2, 87, 6, 2, 9, 15, 15, 8, 2, 89, 6, 2, 9, 15, 15, 8, 1, 91, 6, 2,
+	9, 15, 15, 8, 1, 93, 6, 3, 9, 15, 14, 8, 1, 95, 6, 3, 10, 15, 14, 7, 1, 97, 5, 3,
+	10, 15, 14, 7, 99, 5, 3, 10, 15, 14, 7, 101, 5, 4, 10, 15, 13, 7, 103, 5, 4, 11, 15, 13,
+	6, 105, 5, 4, 11, 15, 13, 6, 107, 5, 4, 11, 15, 13, 6, 109, 5, 5, 11, 15, 12, 6, 111, 5,
+	5, 12, 15, 12, 5, 113, 4, 5, 12, 15, 4, 115, 1, 4, 0, 0, 0, 0, 1, 1, 5, 0, 4, 4,
+	15, 13, 6, 1, 5, 4, 11, 15, 12, 5, 3, 5, 5, 12, 15, 11, 4, 5, 5, 6, 13, 15, 10, 3,
+	7, 5, 7, 14, 15, 9, 2, 8, 6, 1, 8, 15, 15, 9, 2, 10, 6, 2, 9, 15, 15, 8, 1, 12,
+	5, 2, 9, 15, 14, 7, 14, 5, 3, 10, 15, 13, 6, 16, 5, 4, 11, 15, 12, 5, 18, 5, 5, 12,
+	15, 11, 4, 20, 5, 6, 13, 15, 11, 4, 22, 5, 7, 14, 15, 10, 3, 24, 5, 7, 14, 15, 9, 2,
+	25, 6, 1, 8, 15, 15, 8, 1, 27, 5, 2, 9, 15, 14, 7, 29, 5, 3, 10, 15, 13, 6, 31, 5,
+	4, 11, 15, 13, 6, 33, 5, 5, 12, 15, 12, 5, 35, 5, 5, 12, 15, 11, 4, 37, 5, 6, 13, 15,
+	10, 3, 39, 5, 7, 14, 15, 9, 2, 40, 6, 1, 8, 15, 15, 8, 1, 42, 6, 2, 9, 15, 15, 8,
+	1, 44, 5, 3, 10, 15, 14, 7, 46, 5, 3, 10, 15, 13, 6, 48, 5, 4, 11, 15, 12, 5, 50, 5,
+	5, 12, 15, 11, 4, 52, 5, 6, 13, 15, 10, 3, 54, 5, 7, 14, 15, 10, 3, 55, 6, 1, 8, 15,
+	15, 9, 2, 57, 6, 1, 8, 15, 15, 8, 1, 59, 5, 2, 9, 15, 14, 7, 61, 5, 3, 10, 15, 13,
+	6, 63, 5, 4, 11, 15, 12, 5, 65, 5, 5, 12, 15, 12, 5, 67, 5, 6, 13, 15, 11, 4, 69, 5,
+	6, 14, 15, 10, 3, 71, 5, 7, 14, 15, 9, 2, 72, 6, 1, 8, 15, 15, 8, 1, 74, 5, 2, 9,
+	15, 14, 7, 76, 5, 3, 10, 15, 14, 7, 78, 5, 4, 11, 15, 13, 6, 80, 5, 4, 12, 15, 12, 5,
+	82, 5, 5, 12, 15, 11, 4, 84, 5, 6, 13, 15, 10, 3, 86, 5, 7, 14, 15, 9, 2, 87, 6, 1,
+	8, 15, 15, 9, 2, 89, 6, 2, 9, 15, 15, 8, 1, 91, 5, 2, 10, 15, 14, 7, 93, 5, 3, 10,
+	15, 13, 6, 95, 5, 4, 11, 15, 12, 5, 97, 5, 5, 12, 15, 11, 4, 99, 5, 6, 13, 15, 11, 4,
+	101, 5, 7, 14, 15, 10, 3, 103, 5, 8, 15, 15, 9, 2, 104, 6, 1, 8, 15, 15, 8, 1, 106, 5,
+	2, 9, 15, 14, 7, 108, 5, 3, 10, 15, 13, 6, 110, 5, 4, 11, 15, 13, 6, 112, 4, 5, 12, 15,
+	4, 114, 1, 4, 0, 0, 0, 0, 1, 1, 5, 0, 4, 3, 15, 13, 5, 1, 5, 5, 12, 15, 11, 4,
+	3, 5, 6, 13, 15, 10, 2, 5, 5, 7, 15, 15, 8, 1, 6, 5, 2, 9, 15, 14, 7, 8, 5, 3,
+	10, 15, 13, 5, 10, 5, 4, 12, 15, 11, 4, 12, 5, 6, 13, 15, 10, 3, 14, 5, 7, 15, 15, 8,
+	1, 15, 5, 1, 9, 15, 14, 7, 17, 5, 3, 10, 15, 13, 6, 19, 5, 4, 12, 15, 11, 4, 21, 5,
+	6, 13, 15, 10, 3, 23, 5, 7, 14, 15, 9, 1, 24, 5, 1, 9, 15, 14, 7, 26, 5, 3, 10, 15,
+	13, 6, 28, 5, 4, 11, 15, 12, 4, 30, 5, 6, 13, 15, 10, 3, 32, 5, 7, 14, 15, 9, 1, 33,
+	5, 1, 8, 15, 15, 7, 35, 5, 3, 10, 15, 13, 6, 37, 5, 4, 11, 15, 12, 4, 39, 5, 5, 13,
+	15, 10, 3, 41, 5, 7, 14, 15, 9, 2, 42, 5, 1, 8, 15, 15, 7, 44, 5, 2, 10, 15, 13, 6,
+	46, 5, 4, 11, 15, 12, 5, 48, 5, 5, 13, 15, 10, 3, 50, 5, 7, 14, 15, 9, 2, 51, 5, 1,
+	8, 15, 15, 8, 53, 5, 2, 10, 15, 13, 6, 55, 5, 4, 11, 15, 12, 5, 57, 5, 5, 12, 15, 11,
+	3, 59, 5, 7, 14, 15, 9, 2, 60, 5, 1, 8, 15, 15, 8, 62, 5, 2, 9, 15, 14, 6, 64, 5,
+	4, 11, 15, 12, 5, 66, 5, 5, 12, 15, 11, 3, 68, 5, 6, 14, 15, 9, 2, 69, 6, 1, 8, 15,
+	15, 8, 1, 71, 5, 2, 9, 15, 14, 6, 73, 5, 3, 11, 15, 12, 5, 75, 5, 5, 12, 15, 11, 4,
+	77, 5, 6, 13, 15, 9, 2, 79, 5, 8, 15, 15, 8, 1, 80, 5, 2, 9, 15, 14, 7, 82, 5, 3,
+	10, 15, 12, 5, 84, 5, 5, 12, 15, 11, 4, 86, 5, 6, 13, 15, 10, 2, 88, 5, 7, 15, 15, 8,
+	1, 89, 5, 2, 9, 15, 14, 7, 91, 5, 3, 10, 15, 13, 5, 93, 5, 5, 12, 15, 11, 4, 95, 5,
+	6, 13, 15, 10, 2, 97, 5, 7, 15, 15, 8, 1, 98, 5, 2, 9, 15, 14, 7, 100, 5, 3, 10, 15,
+	13, 5, 102, 5, 4, 12, 15, 11, 4, 104, 5, 6, 13, 15, 10, 3, 106, 5, 7, 14, 15, 8, 1, 107,
+	5, 1, 9, 15, 14, 7, 109, 5, 3, 10, 15, 13, 6, 111, 4, 4, 11, 15, 4, 113, 1, 4, 0, 0,
+	0, 0, 1, 1, 4, 0, 4, 2, 15, 12, 5, 1, 5, 5, 12, 15, 10, 3, 3, 5, 7, 14, 15, 8,
+	1, 4, 5, 1, 9, 15, 14, 6, 6, 5, 3, 11, 15, 12, 4, 8, 5, 5, 13, 15, 10, 2, 10, 4,
+	7, 15, 15, 8, 11, 5, 2, 9, 15, 13, 6, 13, 5, 4, 11, 15, 11, 4, 15, 5, 6, 13, 15, 9,
+	2, 17, 4, 8, 15, 15, 7, 18, 5, 2, 10, 15, 13, 5, 20, 5, 4, 12, 15, 11, 3, 22, 5, 6,
+	14, 15, 9, 1, 23, 5, 1, 8, 15, 14, 7, 25, 5, 3, 10, 15, 12, 5, 27, 5, 5, 12, 15, 10,
+	3, 29, 5, 7, 14, 15, 8, 1, 30, 5, 1, 9, 15, 14, 6, 32, 5, 3, 11, 15, 12, 4, 34, 5,
+	5, 13, 15, 10, 2, 36, 4, 7, 15, 15, 8, 37, 5, 2, 9, 15, 13, 6, 39, 5, 4, 11, 15, 11,
+	4, 41, 5, 6, 13, 15, 9, 2, 43, 4, 8, 15, 15, 7, 44, 5, 2, 10, 15, 13, 5, 46, 5, 4,
+	12, 15, 11, 3, 48, 5, 6, 14, 15, 9, 1, 49, 5, 1, 8, 15, 14, 7, 51, 5, 3, 10, 15, 12,
+	5, 53, 5, 5, 12, 15, 10, 3, 55, 5, 7, 14, 15, 8, 1, 56, 5, 1, 9, 15, 14, 6, 58, 5,
+	3, 11, 15, 12, 4, 60, 5, 5, 13, 15, 10, 2, 62, 4, 7, 15, 15, 8, 63, 5, 2, 9, 15, 13,
+	6, 65, 5, 4, 11, 15, 11, 4, 67, 5, 6, 14, 15, 9, 1, 68, 5, 1, 8, 15, 14, 7, 70, 5,
+	3, 10, 15, 12, 5, 72, 5, 5, 12, 15, 10, 3, 74, 5, 7, 14, 15, 8, 1, 75, 5, 1, 9, 15,
+	14, 6, 77, 5, 3, 11, 15, 12, 4, 79, 5, 5, 13, 15, 10, 2, 81, 4, 7, 15, 15, 8, 82, 5,
+	2, 9, 15, 13, 6, 84, 5, 4, 11, 15, 11, 4, 86, 5, 6, 13, 15, 9, 2, 88, 4, 8, 15, 15,
+	7, 89, 5, 2, 10, 15, 13, 5, 91, 5, 4, 12, 15, 11, 3, 93, 5, 6, 14, 15, 9, 1, 94, 5,
+	1, 8, 15, 14, 7, 96, 5, 3, 10, 15, 12, 5, 98, 5, 5, 12, 15, 10, 3, 100, 5, 7, 14, 15,
+	8, 1, 101, 5, 1, 9, 15, 14, 6, 103, 5, 3, 11, 15, 12, 4, 105, 5, 5, 13, 15, 10, 2, 107,
+	4, 7, 15, 15, 8, 108, 5, 2, 9, 15, 13, 6, 110, 4, 4, 11, 15, 4, 112, 1, 4, 0, 0, 0,
+	0, 0, 1, 2, 0, 3, 14, 12, 5, 0, 5, 5, 12, 15, 10, 2, 2, 4, 7, 15, 15, 7, 3, 5,
+	2, 10, 15, 12, 4, 5, 5, 5, 12, 15, 10, 2, 7, 4, 7, 15, 15, 7, 8, 5, 2, 10, 15, 12,
+	4, 10, 5, 5, 13, 15, 10, 2, 12, 4, 7, 15, 15, 7, 13, 5, 2, 10, 15, 12, 4, 15, 5, 5,
+	13, 15, 9, 2, 17, 4, 7, 15, 15, 7, 18, 5, 2, 10, 15, 12, 4, 20, 5, 5, 13, 15, 9, 2,
+	22, 4, 7, 15, 15, 7, 23, 5, 2, 10, 15, 12, 4, 25, 5, 5, 13, 15, 9, 2, 27, 4, 8, 15,
+	15, 7, 28, 5, 2, 10, 15, 12, 4, 30, 5, 5, 13, 15, 9, 2, 32, 4, 8, 15, 14, 7, 33, 5,
+	2, 10, 15, 12, 4, 35, 5, 5, 13, 15, 9, 2, 37, 4, 8, 15, 14, 7, 38, 5, 3, 10, 15, 12,
+	4, 40, 5, 5, 13, 15, 9, 1, 42, 4, 8, 15, 14, 7, 43, 5, 3, 10, 15, 12, 4, 45, 5, 5,
+	13, 15, 9, 1, 47, 4, 8, 15, 14, 7, 48, 5, 3, 10, 15, 12, 4, 50, 5, 5, 13, 15, 9, 1,
+	52, 4, 8, 15, 14, 7, 53, 5, 3, 10, 15, 12, 4, 55, 5, 5, 13, 15, 9, 1, 57, 4, 8, 15,
+	14, 6, 58, 5, 3, 10, 15, 12, 4, 60, 5, 5, 13, 15, 9, 1, 62, 4, 8, 15, 14, 6, 63, 5,
+	3, 11, 15, 12, 4, 65, 5, 5, 13, 15, 9, 1, 67, 4, 8, 15, 14, 6, 68, 5, 3, 11, 15, 11,
+	4, 70, 5, 5, 13, 15, 9, 1, 72, 4, 8, 15, 14, 6, 73, 5, 3, 11, 15, 11, 4, 75, 5, 6,
+	13, 15, 9, 1, 77, 4, 8, 15, 14, 6, 78, 5, 3, 11, 15, 11, 4, 80, 5, 6, 13, 15, 9, 1,
+	82, 4, 8, 15, 14, 6, 83, 5, 3, 11, 15, 11, 4, 85, 5, 6, 13, 15, 9, 1, 87, 4, 8, 15,
+	14, 6, 88, 5, 3, 11, 15, 11, 4, 90, 5, 6, 13, 15, 9, 1, 91, 5, 1, 8, 15, 14, 6, 93,
+	5, 3, 11, 15, 11, 3, 95, 5, 6, 13, 15, 9, 1, 96, 5, 1, 8, 15, 14, 6, 98, 5, 3, 11,
+	15, 11, 3, 100, 5, 6, 14, 15, 9, 1, 101, 5, 1, 8, 15, 14, 6, 103, 5, 3, 11, 15, 11, 3,
+	105, 5, 6, 14, 15, 8, 1, 106, 5, 1, 8, 15, 14, 6, 108, 4, 3, 11, 15, 4, 110, 1, 4, 0,
+	0, 0, 0, 0, 0, 0, 3, 12, 12, 4, 0, 5, 5, 13, 15, 9, 1, 2, 4, 8, 15, 14, 6, 3,
+	5, 3, 11, 15, 11, 3, 5, 4, 6, 14, 15, 7, 6, 5, 1, 9, 15, 12, 4, 8, 5, 5, 13, 15,
+	9, 1, 10, 4, 8, 15, 14, 6, 11, 5, 3, 11, 15, 11, 3, 13, 4, 6, 14, 15, 7, 14, 5, 1,
+	9, 15, 12, 4, 16, 5, 5, 13, 15, 9, 1, 18, 4, 8, 15, 14, 6, 19, 5, 3, 11, 15, 11, 3,
+	21, 4, 6, 14, 15, 7, 22, 5, 1, 9, 15, 12, 4, 24, 5, 5, 13, 15, 9, 1, 26, 4, 8, 15,
+	14, 6, 27, 5, 3, 11, 15, 11, 3, 29, 4, 6, 14, 15, 7, 30, 5, 1, 9, 15, 12, 4, 32, 5,
+	5, 13, 15, 9, 1, 34, 4, 8, 15, 14, 6, 35, 5, 3, 11, 15, 11, 3, 37, 4, 6, 14, 15, 8,
+	38, 5, 1, 9, 15, 12, 4, 40, 5, 5, 13, 15, 9, 1, 42, 4, 8, 15, 14, 6, 43, 5, 3, 11,
+	15, 11, 3, 45, 4, 6, 14, 15, 8, 46, 5, 1, 9, 15, 12, 4, 48, 5, 5, 12, 15, 9, 1, 50,
+	4, 8, 15, 14, 6, 51, 5, 3, 11, 15, 11, 3, 53, 4, 6, 14, 15, 8, 54, 5, 1, 9, 15, 12,
+	4, 56, 5, 5, 12, 15, 9, 1, 58, 4, 8, 15, 14, 6, 59, 5, 3, 11, 15, 11, 3, 61, 4, 6,
+	14, 15, 8, 62, 5, 1, 9, 15, 12, 4, 64, 5, 5, 12, 15, 9, 1, 66, 4, 8, 15, 14, 6, 67,
+	5, 3, 11, 15, 11, 3, 69, 4, 6, 14, 15, 8, 70, 5, 1, 9, 15, 12, 4, 72, 5, 5, 12, 15,
+	9, 1, 74, 4, 8, 15, 14, 6, 75, 5, 3, 11, 15, 11, 3, 77, 4, 6, 14, 15, 8, 78, 5, 1,
+	9, 15, 12, 4, 80, 5, 4, 12, 15, 9, 1, 82, 4, 8, 15, 14, 6, 83, 5, 3, 11, 15, 11, 3,
+	85, 4, 6, 14, 15, 8, 86, 5, 1, 9, 15, 12, 4, 88, 5, 4, 12, 15, 9, 1, 90, 4, 8, 15,
+	14, 6, 91, 5, 3, 11, 15, 11, 3, 93, 4, 6, 14, 15, 8, 94, 5, 1, 9, 15, 12, 4, 96, 5,
+	4, 12, 15, 9, 1, 98, 4, 8, 15, 14, 6, 99, 5, 3, 11, 15, 11, 3, 101, 4, 6, 14, 15, 8,
+	102, 5, 1, 9, 15, 12, 4, 104, 5, 4, 12, 15, 9, 1, 106, 4, 8, 15, 14, 6, 107, 4, 3, 11,
+	15, 4, 109, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 8, 12, 4, 0, 4, 4, 13, 15, 9, 2, 4,
+	8, 15, 13, 5, 3, 5, 4, 12, 15, 9, 1, 5, 4, 8, 15, 14, 5, 6, 5, 3, 11, 15, 10, 2,
+	8, 4, 7, 15, 14, 6, 9, 5, 3, 11, 15, 10, 2, 11, 4, 6, 14, 15, 7, 12, 5, 2, 10, 15,
+	11, 3, 14, 4, 6, 14, 15, 7, 15, 5, 1, 9, 15, 12, 4, 17, 4, 5, 13, 15, 8, 18, 5, 1,
+	9, 15, 12, 4, 20, 5, 4, 12, 15, 9, 1, 22, 4, 8, 15, 13, 5, 23, 5, 4, 12, 15, 9, 1,
+	25, 4, 7, 15, 14, 6, 26, 5, 3, 11, 15, 10, 2, 28, 4, 7, 15, 14, 6, 29, 5, 2, 11, 15,
+	11, 2, 31, 4, 6, 14, 15, 7, 32, 5, 2, 10, 15, 11, 3, 34, 4, 5, 14, 15, 8, 35, 5, 1,
+	9, 15, 12, 4, 37, 4, 5, 13, 15, 8, 39, 4, 9, 15, 13, 4, 40, 5, 4, 12, 15, 9, 1, 42,
+	4, 8, 15, 13, 5, 43, 5, 4, 12, 15, 9, 1, 45, 4, 7, 15, 14, 6, 46, 5, 3, 11, 15, 10,
+	2, 48, 4, 7, 15, 15, 6, 49, 5, 2, 10, 15, 11, 3, 51, 4, 6, 14, 15, 7, 52, 5, 2, 10,
+	15, 11, 3, 54, 4, 5, 13, 15, 8, 55, 5, 1, 9, 15, 12, 4, 57, 4, 5, 13, 15, 8, 59, 4,
+	8, 15, 13, 5, 60, 5, 4, 12, 15, 9, 1, 62, 4, 8, 15, 13, 5, 63, 5, 3, 12, 15, 10, 1,
+	65, 4, 7, 15, 14, 6, 66, 5, 3, 11, 15, 10, 2, 68, 4, 6, 15, 15, 7, 69, 5, 2, 10, 15,
+	11, 3, 71, 4, 6, 14, 15, 7, 72, 5, 1, 10, 15, 12, 3, 74, 4, 5, 13, 15, 8, 75, 5, 1,
+	9, 15, 12, 4, 77, 4, 5, 13, 15, 8, 79, 4, 8, 15, 13, 5, 80, 5, 4, 12, 15, 9, 1, 82,
+	4, 8, 15, 14, 5, 83, 5, 3, 11, 15, 10, 2, 85, 4, 7, 15, 14, 6, 86, 5, 3, 11, 15, 10,
+	2, 88, 4, 6, 14, 15, 7, 89, 5, 2, 10, 15, 11, 3, 91, 4, 6, 14, 15, 7, 92, 5, 1, 9,
+	15, 12, 4, 94, 4, 5, 13, 15, 8, 95, 5, 1, 9, 15, 12, 4, 97, 4, 4, 13, 15, 9, 99, 4,
+	8, 15, 13, 5, 100, 5, 4, 12, 15, 9, 1, 102, 4, 7, 15, 14, 6, 103, 5, 3, 11, 15, 10, 2,
+	105, 4, 7, 15, 14, 6, 106, 4, 2, 11, 15, 4, 108, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 4,
+	12, 4, 0, 4, 3, 13, 15, 8, 2, 4, 9, 15, 12, 4, 3, 4, 4, 13, 15, 8, 5, 4, 9, 15,
+	12, 4, 6, 4, 5, 13, 15, 8, 7, 5, 1, 9, 15, 12, 3, 9, 4, 5, 13, 15, 7, 10, 5, 1,
+	9, 15, 11, 3, 12, 4, 5, 14, 15, 7, 13, 5, 1, 10, 15, 11, 3, 15, 4, 6, 14, 15, 7, 16,
+	5, 2, 10, 15, 11, 2, 18, 4, 6, 14, 15, 6, 19, 5, 2, 10, 15, 10, 2, 21, 4, 6, 15, 15,
+	6, 22, 5, 2, 11, 15, 10, 2, 24, 4, 7, 15, 14, 6, 25, 5, 2, 11, 15, 10, 1, 27, 4, 7,
+	15, 14, 6, 28, 5, 3, 11, 15, 10, 1, 30, 4, 7, 15, 14, 5, 31, 5, 3, 11, 15, 9, 1, 33,
+	4, 7, 15, 13, 5, 34, 5, 3, 12, 15, 9, 1, 36, 4, 8, 15, 13, 5, 37, 4, 4, 12, 15, 9,
+	39, 4, 8, 15, 13, 4, 40, 4, 4, 12, 15, 8, 42, 4, 8, 15, 12, 4, 43, 4, 4, 13, 15, 8,
+	45, 4, 9, 15, 12, 4, 46, 4, 5, 13, 15, 8, 48, 4, 9, 15, 12, 3, 49, 4, 5, 13, 15, 8,
+	50, 5, 1, 9, 15, 12, 3, 52, 4, 5, 13, 15, 7, 53, 5, 1, 9, 15, 11, 3, 55, 4, 5, 14,
+	15, 7, 56, 5, 1, 10, 15, 11, 3, 58, 4, 6, 14, 15, 7, 59, 5, 2, 10, 15, 11, 2, 61, 4,
+	6, 14, 15, 6, 62, 5, 2, 10, 15, 10, 2, 64, 4, 6, 15, 14, 6, 65, 5, 2, 11, 15, 10, 2,
+	67, 4, 7, 15, 14, 6, 68, 5, 3, 11, 15, 10, 1, 70, 4, 7, 15, 14, 5, 71, 5, 3, 11, 15,
+	10, 1, 73, 4, 7, 15, 14, 5, 74, 5, 3, 11, 15, 9, 1, 76, 4, 7, 15, 13, 5, 77, 5, 3,
+	12, 15, 9, 1, 79, 4, 8, 15, 13, 5, 80, 4, 4, 12, 15, 9, 82, 4, 8, 15, 13, 4, 83, 4,
+	4, 12, 15, 8, 85, 4, 8, 15, 12, 4, 86, 4, 4, 13, 15, 8, 88, 4, 9, 15, 12, 4, 89, 4,
+	5, 13, 15, 8, 90, 5, 1, 9, 15, 12, 3, 92, 4, 5, 13, 15, 7, 93, 5, 1, 9, 15, 12, 3,
+	95, 4, 5, 14, 15, 7, 96, 5, 1, 9, 15, 11, 3, 98, 4, 5, 14, 15, 7, 99, 5, 1, 10, 15,
+	11, 3, 101, 4, 6, 14, 15, 7, 102, 5, 2, 10, 15, 11, 2, 104, 4, 6, 14, 15, 6, 105, 4, 2,
+	10, 15, 4, 107, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 10, 4, 0, 3, 12, 15, 8, 1, 4, 9,
+	15, 12, 3, 2, 4, 5, 14, 15, 7, 3, 5, 1, 10, 15, 10, 2, 5, 4, 6, 15, 14, 5, 6, 5,
+	3, 11, 15, 9, 1, 8, 4, 7, 15, 13, 4, 9, 4, 4, 12, 15, 8, 11, 4, 9, 15, 12, 3, 12,
+	4, 5, 14, 15, 7, 13, 5, 1, 10, 15, 10, 2, 15, 4, 6, 15, 14, 5, 16, 5, 3, 11, 15, 9,
+	1, 18, 4, 7, 15, 13, 4, 19, 4, 4, 12, 15, 8, 21, 4, 9, 15, 12, 3, 22, 4, 5, 14, 15,
+	7, 23, 5, 1, 10, 15, 10, 2, 25, 4, 6, 15, 14, 5, 26, 5, 3, 11, 15, 9, 1, 28, 4, 7,
+	15, 13, 4, 29, 4, 4, 12, 15, 8, 31, 4, 9, 15, 12, 3, 32, 4, 5, 14, 15, 7, 33, 5, 1,
+	10, 15, 10, 2, 35, 4, 6, 15, 14, 5, 36, 4, 3, 11, 15, 9, 38, 4, 8, 15, 13, 4, 39, 4,
+	4, 12, 15, 8, 41, 4, 9, 15, 12, 3, 42, 4, 5, 14, 15, 7, 43, 5, 1, 10, 15, 10, 2, 45,
+	4, 6, 15, 14, 5, 46, 4, 3, 11, 15, 9, 48, 4, 8, 15, 13, 4, 49, 4, 4, 12, 15, 8, 51,
+	4, 9, 15, 12, 3, 52, 4, 5, 14, 15, 7, 53, 5, 1, 10, 15, 10, 2, 55, 4, 6, 15, 14, 5,
+	56, 4, 3, 11, 15, 9, 58, 4, 8, 15, 13, 4, 59, 4, 4, 12, 15, 8, 61, 4, 9, 15, 11, 3,
+	62, 4, 5, 14, 15, 7, 63, 5, 1, 10, 15, 10, 2, 65, 4, 6, 15, 14, 5, 66, 4, 3, 11, 15,
+	9, 68, 4, 8, 15, 13, 4, 69, 4, 4, 13, 15, 8, 71, 4, 9, 15, 11, 3, 72, 4, 5, 14, 15,
+	7, 73, 5, 1, 10, 15, 10, 2, 75, 4, 6, 15, 14, 5, 76, 4, 3, 11, 15, 9, 78, 4, 8, 15,
+	13, 4, 79, 4, 4, 13, 15, 8, 81, 4, 9, 15, 11, 3, 82, 4, 5, 14, 15, 7, 83, 5, 1, 10,
+	15, 10, 2, 85, 4, 6, 15, 14, 5, 86, 4, 3, 11, 15, 9, 88, 4, 8, 15, 13, 4, 89, 4, 4,
+	13, 15, 8, 91, 4, 9, 15, 11, 3, 92, 4, 5, 14, 15, 6, 93, 5, 2, 10, 15, 10, 2, 95, 4,
+	6, 15, 14, 5, 96, 4, 3, 11, 15, 9, 98, 4, 8, 15, 13, 4, 99, 4, 4, 13, 15, 8, 101, 4,
+	9, 15, 11, 3, 102, 4, 5, 14, 15, 6, 103, 4, 2, 10, 15, 4, 105, 1, 4, 0, 0, 0, 0, 0,
+	2, 5, 5, 0, 3, 11, 15, 8, 1, 4, 9, 15, 11, 2, 2, 4, 5, 14, 15, 6, 3, 4, 2, 11,
+	15, 9, 5, 4, 7, 15, 12, 4, 6, 4, 4, 13, 15, 7, 7, 5, 1, 10, 15, 10, 1, 9, 4, 6,
+	15, 14, 5, 10, 4, 3, 12, 15, 8, 12, 4, 9, 15, 11, 3, 13, 4, 5, 14, 15, 6, 14, 4, 2,
+	11, 15, 9, 16, 4, 7, 15, 12, 4, 17, 4, 4, 13, 15, 7, 18, 5, 1, 10, 15, 10, 1, 20, 4,
+	6, 15, 14, 5, 21, 4, 3, 12, 15, 8, 23, 4, 8, 15, 11, 3, 24, 4, 5, 14, 15, 6, 25, 4,
+	2, 11, 15, 9, 27, 4, 7, 15, 13, 4, 28, 4, 4, 13, 15, 7, 29, 5, 1, 9, 15, 10, 2, 31,
+	4, 6, 15, 14, 5, 32, 4, 3, 12, 15, 8, 34, 4, 8, 15, 12, 3, 35, 4, 5, 14, 15, 6, 36,
+	5, 2, 11, 15, 9, 1, 38, 4, 7, 15, 13, 4, 39, 4, 4, 13, 15, 7, 40, 5, 1, 9, 15, 10,
+	2, 42, 4, 6, 15, 14, 5, 43, 4, 3, 12, 15, 8, 45, 4, 8, 15, 12, 3, 46, 4, 5, 14, 15,
+	6, 47, 5, 2, 10, 15, 9, 1, 49, 4, 7, 15, 13, 4, 50, 4, 4, 13, 15, 7, 52, 4, 9, 15,
+	11, 2, 53, 4, 6, 15, 14, 5, 54, 4, 3, 11, 15, 8, 56, 4, 8, 15, 12, 3, 57, 4, 5, 14,
+	15, 6, 58, 5, 2, 10, 15, 10, 1, 60, 4, 7, 15, 13, 4, 61, 4, 4, 13, 15, 7, 63, 4, 9,
+	15, 11, 2, 64, 4, 6, 15, 14, 5, 65, 4, 3, 11, 15, 9, 67, 4, 8, 15, 12, 3, 68, 4, 5,
+	14, 15, 6, 69, 5, 1, 10, 15, 10, 1, 71, 4, 7, 15, 13, 4, 72, 4, 4, 12, 15, 7, 74, 4,
+	9, 15, 11, 2, 75, 4, 6, 15, 14, 5, 76, 4, 2, 11, 15, 9, 78, 4, 8, 15, 12, 3, 79, 4,
+	5, 13, 15, 6, 80, 5, 1, 10, 15, 10, 1, 82, 4, 7, 15, 13, 4, 83, 4, 3, 12, 15, 8, 85,
+	4, 9, 15, 11, 2, 86, 4, 6, 14, 14, 5, 87, 4, 2, 11, 15, 9, 89, 4, 8, 15, 12, 3, 90,
+	4, 5, 13, 15, 7, 91, 5, 1, 10, 15, 10, 1, 93, 4, 7, 15, 13, 4, 94, 4, 3, 12, 15, 8,
+	96, 4, 9, 15, 11, 2, 97, 4, 6, 14, 14, 5, 98, 4, 2, 11, 15, 9, 100, 4, 8, 15, 12, 3,
+	101, 4, 4, 13, 15, 7, 102, 4, 1, 10, 15, 4, 104, 1, 4, 0, 0, 0, 0, 1, 1, 4, 0, 3,
+	7, 15, 8, 1, 4, 8, 15, 11, 2, 2, 4, 5, 14, 14, 5, 3, 4, 3, 12, 15, 8, 5, 4, 9,
+	15, 11, 2, 6, 4, 6, 15, 14, 5, 7, 4, 3, 12, 15, 8, 9, 4, 9, 15, 11, 2, 10, 4, 6,
+	15, 14, 5, 11, 4, 3, 12, 15, 8, 13, 4, 9, 15, 11, 1, 14, 4, 6, 15, 13, 4, 15, 4, 3,
+	12, 15, 7, 17, 4, 9, 15, 10, 1, 18, 4, 6, 15, 13, 4, 19, 4, 3, 12, 15, 7, 21, 4, 9,
+	15, 10, 1, 22, 4, 6, 15, 13, 4, 23, 4, 3, 12, 15, 7, 25, 4, 9, 15, 10, 1, 26, 4, 6,
+	15, 13, 4, 27, 4, 4, 13, 15, 7, 28, 5, 1, 10, 15, 10, 1, 30, 4, 7, 15, 13, 4, 31, 4,
+	4, 13, 15, 7, 32, 5, 1, 10, 15, 10, 1, 34, 4, 7, 15, 13, 4, 35, 4, 4, 13, 15, 7, 36,
+	4, 1, 10, 15, 9, 38, 4, 7, 15, 12, 3, 39, 4, 4, 13, 15, 6, 40, 4, 1, 10, 15, 9, 42,
+	4, 7, 15, 12, 3, 43, 4, 4, 13, 15, 6, 44, 4, 1, 10, 15, 9, 46, 4, 7, 15, 12, 3, 47,
+	4, 4, 13, 15, 6, 48, 4, 1, 10, 15, 9, 50, 4, 8, 15, 12, 3, 51, 4, 5, 14, 15, 6, 52,
+	4, 2, 11, 15, 9, 54, 4, 8, 15, 12, 3, 55, 4, 5, 14, 15, 6, 56, 4, 2, 11, 15, 9, 58,
+	4, 8, 15, 12, 3, 59, 4, 5, 14, 15, 6, 60, 4, 2, 11, 15, 8, 62, 4, 8, 15, 11, 2, 63,
+	4, 5, 14, 14, 5, 64, 4, 2, 11, 15, 8, 66, 4, 8, 15, 11, 2, 67, 4, 5, 14, 14, 5, 68,
+	4, 2, 11, 15, 8, 70, 4, 8, 15, 11, 2, 71, 4, 5, 14, 14, 5, 72, 4, 2, 11, 15, 8, 74,
+	4, 9, 15, 11, 2, 75, 4, 6, 15, 14, 5, 76, 4, 3, 12, 15, 8, 78, 4, 9, 15, 11, 2, 79,
+	4, 6, 15, 14, 5, 80, 4, 3, 12, 15, 8, 82, 4, 9, 15, 11, 2, 83, 4, 6, 15, 14, 4, 84,
+	4, 3, 12, 15, 7, 86, 4, 9, 15, 10, 1, 87, 4, 6, 15, 13, 4, 88, 4, 3, 12, 15, 7, 90,
+	4, 9, 15, 10, 1, 91, 4, 6, 15, 13, 4, 92, 4, 3, 12, 15, 7, 94, 4, 9, 15, 10, 1, 95,
+	4, 6, 15, 13, 4, 96, 4, 3, 13, 15, 7, 97, 5, 1, 10, 15, 10, 1, 99, 4, 7, 15, 13, 4,
+	100, 4, 4, 13, 15, 7, 101, 4, 1, 10, 15, 4, 103, 1, 4, 0, 0, 0, 0, 1, 1, 1, 0, 3,
+	1, 15, 8, 1, 4, 8, 15, 11, 2, 2, 4, 5, 15, 14, 4, 3, 4, 3, 12, 15, 7, 5, 3, 9,
+	15, 10, 6, 4, 7, 15, 12, 3, 7, 4, 4, 14, 15, 5, 8, 4, 2, 11, 15, 8, 10, 4, 8, 15,
+	11, 1, 11, 4, 6, 15, 13, 4, 12, 4, 3, 12, 15, 7, 13, 4, 1, 10, 15, 9, 15, 4, 7, 15,
+	12, 3, 16, 4, 5, 14, 14, 5, 17, 4, 2, 11, 15, 8, 19, 4, 9, 15, 10, 1, 20, 4, 6, 15,
+	13, 4, 21, 4, 4, 13, 15, 6, 22, 4, 1, 10, 15, 9, 24, 4, 8, 15, 11, 2, 25, 4, 5, 14,
+	14, 5, 26, 4, 2, 12, 15, 7, 28, 4, 9, 15, 10, 1, 29, 4, 7, 15, 13, 3, 30, 4, 4, 13,
+	15, 6, 31, 4, 1, 11, 15, 8, 33, 4, 8, 15, 11, 2, 34, 4, 5, 15, 14, 4, 35, 4, 3, 12,
+	15, 7, 37, 3, 9, 15, 10, 38, 4, 7, 15, 12, 3, 39, 4, 4, 14, 15, 5, 40, 4, 2, 11, 15,
+	8, 42, 4, 8, 15, 11, 1, 43, 4, 6, 15, 13, 4, 44, 4, 3, 12, 15, 7, 45, 4, 1, 10, 15,
+	9, 47, 4, 7, 15, 12, 3, 48, 4, 5, 14, 14, 5, 49, 4, 2, 11, 15, 8, 51, 4, 9, 15, 10,
+	1, 52, 4, 6, 15, 13, 4, 53, 4, 4, 13, 15, 6, 54, 4, 1, 10, 15, 9, 56, 4, 8, 15, 11,
+	2, 57, 4, 5, 14, 14, 5, 58, 4, 2, 12, 15, 7, 60, 4, 9, 15, 10, 1, 61, 4, 7, 15, 12,
+	3, 62, 4, 4, 13, 15, 6, 63, 4, 1, 11, 15, 8, 65, 4, 8, 15, 11, 2, 66, 4, 5, 15, 14,
+	4, 67, 4, 3, 12, 15, 7, 69, 3, 10, 15, 10, 70, 4, 7, 15, 12, 3, 71, 4, 4, 14, 15, 5,
+	72, 4, 2, 11, 15, 8, 74, 4, 8, 15, 11, 1, 75, 4, 6, 15, 13, 4, 76, 4, 3, 12, 15, 7,
+	77, 4, 1, 10, 15, 9, 79, 4, 7, 15, 12, 3, 80, 4, 5, 14, 14, 5, 81, 4, 2, 11, 15, 8,
+	83, 4, 9, 15, 10, 1, 84, 4, 6, 15, 13, 4, 85, 4, 4, 13, 15, 6, 86, 4, 1, 10, 15, 9,
+	88, 4, 8, 15, 11, 2, 89, 4, 5, 14, 14, 5, 90, 4, 2, 12, 15, 7, 92, 4, 9, 15, 10, 1,
+	93, 4, 7, 15, 12, 3, 94, 4, 4, 13, 15, 6, 95, 4, 1, 11, 15, 8, 97, 4, 8, 15, 11, 2,
+	98, 4, 5, 15, 14, 4, 99, 4, 3, 12, 15, 7, 101, 3, 10, 15, 4, 102, 1, 4, 0, 0, 0, 0,
+	0, 0, 0, 2, 8, 9, 0, 4, 7, 15, 11, 2, 1, 4, 5, 15, 13, 4, 2, 4, 3, 12, 15, 6,
+	3, 4, 1, 10, 15, 8, 5, 4, 8, 15, 11, 1, 6, 4, 6, 15, 13, 3, 7, 4, 3, 13, 15, 6,
+	8, 4, 1, 11, 15, 8, 10, 4, 8, 15, 10, 1, 11, 4, 6, 15, 12, 3, 12, 4, 4, 13, 15, 5,
+	13, 4, 2, 11, 15, 7, 15, 3, 9, 15, 10, 16, 4, 7, 15, 12, 2, 17, 4, 5, 14, 14, 5, 18,
+	4, 2, 12, 15, 7, 20, 3, 10, 15, 9, 21, 4, 7, 15, 11, 2, 22, 4, 5, 15, 13, 4, 23, 4,
+	3, 12, 15, 6, 24, 4, 1, 10, 15, 8, 26, 4, 8, 15, 11, 1, 27, 4, 6, 15, 13, 3, 28, 4,
+	4, 13, 15, 6, 29, 4, 1, 11, 15, 8, 31, 4, 9, 15, 10, 1, 32, 4, 6, 15, 12, 3, 33, 4,
+	4, 14, 15, 5, 34, 4, 2, 11, 15, 7, 36, 3, 9, 15, 10, 37, 4, 7, 15, 12, 2, 38, 4, 5,
+	14, 14, 4, 39, 4, 2, 12, 15, 7, 41, 3, 10, 15, 9, 42, 4, 7, 15, 11, 2, 43, 4, 5, 15,
+	13, 4, 44, 4, 3, 12, 15, 6, 45, 4, 1, 10, 15, 8, 47, 4, 8, 15, 11, 1, 48, 4, 6, 15,
+	13, 3, 49, 4, 4, 13, 15, 6, 50, 4, 1, 11, 15, 8, 52, 4, 9, 15, 10, 1, 53, 4, 6, 15,
+	12, 3, 54, 4, 4, 14, 14, 5, 55, 4, 2, 11, 15, 7, 57, 3, 9, 15, 9, 58, 4, 7, 15, 12,
+	2, 59, 4, 5, 14, 14, 4, 60, 4, 3, 12, 15, 7, 62, 3, 10, 15, 9, 63, 4, 8, 15, 11, 2,
+	64, 4, 5, 15, 13, 4, 65, 4, 3, 13, 15, 6, 66, 4, 1, 10, 15, 8, 68, 4, 8, 15, 11, 1,
+	69, 4, 6, 15, 13, 3, 70, 4, 4, 13, 15, 6, 71, 4, 1, 11, 15, 8, 73, 4, 9, 15, 10, 1,
+	74, 4, 6, 15, 12, 3, 75, 4, 4, 14, 14, 5, 76, 4, 2, 11, 15, 7, 78, 3, 9, 15, 9, 79,
+	4, 7, 15, 12, 2, 80, 4, 5, 14, 14, 4, 81, 4, 3, 12, 15, 7, 83, 3, 10, 15, 9, 84, 4,
+	8, 15, 11, 2, 85, 4, 5, 15, 13, 4, 86, 4, 3, 13, 15, 6, 87, 4, 1, 10, 15, 8, 89, 4,
+	8, 15, 10, 1, 90, 4, 6, 15, 13, 3, 91, 4, 4, 13, 15, 5, 92, 4, 2, 11, 15, 8, 94, 3,
+	9, 15, 10, 95, 4, 7, 15, 12, 3, 96, 4, 4, 14, 14, 5, 97, 4, 2, 12, 15, 7, 99, 3, 9,
+	15, 4, 100, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 1, 8, 0, 4, 4, 15, 12, 2, 1, 4, 5,
+	14, 14, 4, 2, 4, 3, 12, 15, 6, 3, 4, 1, 11, 15, 8, 5, 3, 9, 15, 10, 6, 4, 7, 15,
+	11, 2, 7, 4, 5, 15, 13, 4, 8, 4, 3, 13, 15, 5, 9, 4, 1, 11, 15, 7, 11, 3, 9, 15,
+	9, 12, 4, 7, 15, 11, 1, 13, 4, 5, 15, 13, 3, 14, 4, 4, 13, 15, 5, 15, 4, 2, 11, 15,
+	7, 17, 3, 9, 15, 9, 18, 4, 8, 15, 11, 1, 19, 4, 6, 15, 12, 3, 20, 4, 4, 14, 14, 5,
+	21, 4, 2, 12, 15, 6, 23, 3, 10, 15, 8, 24, 4, 8, 15, 10, 1, 25, 4, 6, 15, 12, 2, 26,
+	4, 4, 14, 14, 4, 27, 4, 2, 12, 15, 6, 28, 4, 1, 10, 15, 8, 30, 3, 8, 15, 10, 31, 4,
+	7, 15, 12, 2, 32, 4, 5, 14, 13, 4, 33, 4, 3, 13, 15, 6, 34, 4, 1, 11, 15, 8, 36, 3,
+	9, 15, 9, 37, 4, 7, 15, 11, 2, 38, 4, 5, 15, 13, 3, 39, 4, 3, 13, 15, 5, 40, 4, 1,
+	11, 15, 7, 42, 3, 9, 15, 9, 43, 4, 7, 15, 11, 1, 44, 4, 6, 15, 13, 3, 45, 4, 4, 13,
+	15, 5, 46, 4, 2, 11, 15, 7, 48, 3, 10, 15, 9, 49, 4, 8, 15, 10, 1, 50, 4, 6, 15, 12,
+	3, 51, 4, 4, 14, 14, 4, 52, 4, 2, 12, 15, 6, 54, 3, 10, 15, 8, 55, 3, 8, 15, 10, 56,
+	4, 6, 15, 12, 2, 57, 4, 4, 14, 14, 4, 58, 4, 3, 12, 15, 6, 59, 4, 1, 10, 15, 8, 61,
+	3, 9, 15, 10, 62, 4, 7, 15, 11, 2, 63, 4, 5, 15, 13, 4, 64, 4, 3, 13, 15, 6, 65, 4,
+	1, 11, 15, 7, 67, 3, 9, 15, 9, 68, 4, 7, 15, 11, 1, 69, 4, 5, 15, 13, 3, 70, 4, 3,
+	13, 15, 5, 71, 4, 2, 11, 15, 7, 73, 3, 9, 15, 9, 74, 4, 8, 15, 11, 1, 75, 4, 6, 15,
+	13, 3, 76, 4, 4, 13, 14, 5, 77, 4, 2, 12, 15, 7, 79, 3, 10, 15, 8, 80, 4, 8, 15, 10,
+	1, 81, 4, 6, 15, 12, 3, 82, 4, 4, 14, 14, 4, 83, 4, 2, 12, 15, 6, 84, 4, 1, 10, 15,
+	8, 86, 3, 8, 15, 10, 87, 4, 6, 15, 12, 2, 88, 4, 5, 14, 14, 4, 89, 4, 3, 12, 15, 6,
+	90, 4, 1, 11, 15, 8, 92, 3, 9, 15, 10, 93, 4, 7, 15, 11, 2, 94, 4, 5, 15, 13, 4, 95,
+	4, 3, 13, 15, 5, 96, 4, 1, 11, 15, 7, 98, 3, 9, 15, 4, 99, 1, 4, 0, 0, 0, 0, 0,
+	2, 2, 1, 0, 3, 13, 13, 3, 0, 4, 4, 14, 14, 4, 1, 4, 2, 12, 15, 6, 2, 4, 1, 11,
+	15, 7, 4, 3, 9, 15, 9, 5, 3, 8, 15, 10, 6, 4, 6, 15, 12, 2, 7, 4, 5, 15, 13, 3,
+	8, 4, 3, 13, 15, 5, 9, 4, 2, 12, 15, 6, 11, 3, 10, 15, 8, 12, 3, 9, 15, 9, 13, 4,
+	7, 15, 11, 1, 14, 4, 6, 15, 12, 2, 15, 4, 4, 14, 14, 4, 16, 4, 3, 13, 15, 5, 17, 4,
+	1, 11, 15, 7, 19, 3, 10, 15, 8, 20, 3, 8, 15, 10, 21, 4, 7, 15, 11, 1, 22, 4, 5, 15,
+	13, 3, 23, 4, 4, 14, 14, 4, 24, 4, 2, 12, 15, 6, 25, 4, 1, 11, 15, 7, 27, 3, 9, 15,
+	9, 28, 3, 8, 15, 10, 29, 4, 6, 15, 12, 2, 30, 4, 5, 15, 13, 3, 31, 4, 3, 13, 15, 5,
+	32, 4, 2, 12, 15, 6, 34, 3, 10, 15, 8, 35, 3, 9, 15, 9, 36, 4, 7, 15, 11, 1, 37, 4,
+	6, 15, 12, 2, 38, 4, 4, 14, 14, 4, 39, 4, 3, 13, 15, 5, 40, 4, 1, 11, 15, 7, 42, 3,
+	10, 15, 8, 43, 3, 8, 15, 10, 44, 4, 7, 15, 11, 1, 45, 4, 5, 15, 13, 3, 46, 4, 4, 13,
+	14, 4, 47, 4, 2, 12, 15, 6, 48, 4, 1, 11, 15, 7, 50, 3, 9, 15, 9, 51, 3, 8, 15, 10,
+	52, 4, 6, 15, 12, 2, 53, 4, 5, 14, 13, 3, 54, 4, 3, 13, 15, 5, 55, 4, 2, 11, 15, 6,
+	57, 3, 10, 15, 8, 58, 3, 9, 15, 9, 59, 4, 7, 15, 11, 1, 60, 4, 6, 15, 12, 2, 61, 4,
+	4, 14, 14, 4, 62, 4, 3, 12, 15, 5, 63, 4, 1, 11, 15, 7, 65, 3, 9, 15, 8, 66, 3, 8,
+	15, 10, 67, 4, 7, 15, 11, 1, 68, 4, 5, 15, 13, 3, 69, 4, 4, 13, 14, 4, 70, 4, 2, 12,
+	15, 6, 71, 4, 1, 10, 15, 7, 73, 3, 9, 15, 9, 74, 3, 8, 15, 10, 75, 4, 6, 15, 12, 2,
+	76, 4, 5, 14, 13, 3, 77, 4, 3, 13, 15, 5, 78, 4, 2, 11, 15, 6, 80, 3, 10, 15, 8, 81,
+	3, 8, 15, 9, 82, 4, 7, 15, 11, 1, 83, 4, 6, 15, 12, 2, 84, 4, 4, 14, 14, 4, 85, 4,
+	3, 12, 15, 5, 86, 4, 1, 11, 15, 7, 88, 3, 9, 15, 8, 89, 3, 8, 15, 10, 90, 4, 6, 15,
+	11, 2, 91, 4, 5, 15, 13, 3, 92, 4, 4, 13, 14, 4, 93, 4, 2, 12, 15, 6, 94, 4, 1, 10,
+	15, 7, 96, 3, 9, 15, 4, 97, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 5, 13, 4, 0, 4, 2,
+	13, 15, 5, 1, 4, 2, 12, 15, 6, 3, 3, 11, 15, 7, 4, 3, 9, 15, 8, 5, 3, 8, 15, 9,
+	6, 3, 7, 15, 10, 7, 4, 6, 15, 11, 1, 8, 4, 5, 15, 12, 2, 9, 4, 4, 14, 14, 4, 10,
+	4, 3, 13, 15, 5, 11, 4, 2, 12, 15, 6, 12, 4, 1, 11, 15, 7, 14, 3, 9, 15, 8, 15, 3,
+	8, 15, 9, 16, 3, 7, 15, 10, 17, 4, 6, 15, 11, 1, 18, 4, 5, 15, 12, 2, 19, 4, 4, 14,
+	14, 3, 20, 4, 3, 13, 15, 5, 21, 4, 2, 12, 15, 6, 22, 4, 1, 11, 15, 7, 24, 3, 10, 15,
+	8, 25, 3, 8, 15, 9, 26, 3, 7, 15, 10, 27, 4, 6, 15, 11, 1, 28, 4, 5, 15, 12, 2, 29,
+	4, 4, 14, 13, 3, 30, 4, 3, 13, 15, 5, 31, 4, 2, 12, 15, 6, 32, 4, 1, 11, 15, 7, 34,
+	3, 10, 15, 8, 35, 3, 8, 15, 9, 36, 3, 7, 15, 10, 37, 4, 6, 15, 11, 1, 38, 4, 5, 15,
+	12, 2, 39, 4, 4, 14, 13, 3, 40, 4, 3, 13, 15, 4, 41, 4, 2, 12, 15, 6, 42, 4, 1, 11,
+	15, 7, 44, 3, 10, 15, 8, 45, 3, 8, 15, 9, 46, 3, 7, 15, 10, 47, 4, 6, 15, 11, 1, 48,
+	4, 5, 15, 12, 2, 49, 4, 4, 14, 13, 3, 50, 4, 3, 13, 14, 4, 51, 4, 2, 12, 15, 6, 52,
+	4, 1, 11, 15, 7, 54, 3, 10, 15, 8, 55, 3, 9, 15, 9, 56, 3, 7, 15, 10, 57, 4, 6, 15,
+	11, 1, 58, 4, 5, 15, 12, 2, 59, 4, 4, 14, 13, 3, 60, 4, 3, 13, 14, 4, 61, 4, 2, 12,
+	15, 6, 62, 4, 1, 11, 15, 7, 64, 3, 10, 15, 8, 65, 3, 9, 15, 9, 66, 3, 7, 15, 10, 67,
+	4, 6, 15, 11, 1, 68, 4, 5, 15, 12, 2, 69, 4, 4, 14, 13, 3, 70, 4, 3, 13, 14, 4, 71,
+	4, 2, 12, 15, 5, 72, 4, 1, 11, 15, 7, 74, 3, 10, 15, 8, 75, 3, 9, 15, 9, 76, 3, 8,
+	15, 10, 77, 4, 6, 15, 11, 1, 78, 4, 5, 15, 12, 2, 79, 4, 4, 14, 13, 3, 80, 4, 3, 13,
+	14, 4, 81, 4, 2, 12, 15, 5, 82, 4, 1, 11, 15, 7, 84, 3, 10, 15, 8, 85, 3, 9, 15, 9,
+	86, 3, 8, 15, 10, 87, 4, 6, 15, 11, 1, 88, 4, 5, 15, 12, 2, 89, 4, 4, 14, 13, 3, 90,
+	4, 3, 13, 14, 4, 91, 4, 2, 12, 15, 5, 92, 4, 1, 11, 15, 6, 94, 3, 10, 15, 8, 95, 3,
+	9, 15, 4, 96, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 7, 5, 0, 3, 11, 15, 5, 0, 4, 1,
+	11, 15, 6, 2, 3, 10, 15, 7, 3, 3, 9, 15, 8, 4, 3, 9, 15, 8, 5, 3, 8, 15, 9, 6,
+	3, 7, 15, 10, 7, 3, 6, 15, 11, 8, 4, 6, 15, 11, 1, 9, 4, 5, 15, 12, 2, 10, 4, 4,
+	14, 13, 3, 11, 4, 3, 14, 14, 3, 12, 4, 3, 13, 14, 4, 13, 4, 2, 12, 15, 5, 14, 4, 1,
+	11, 15, 6, 16, 3, 11, 15, 6, 17, 3, 10, 15, 7, 18, 3, 9, 15, 8, 19, 3, 8, 15, 9, 20,
+	3, 8, 15, 9, 21, 3, 7, 15, 10, 22, 4, 6, 15, 11, 1, 23, 4, 5, 15, 12, 1, 24, 4, 5,
+	15, 12, 2, 25, 4, 4, 14, 13, 3, 26, 4, 3, 14, 14, 4, 27, 4, 3, 13, 15, 4, 28, 4, 2,
+	12, 15, 5, 29, 4, 1, 11, 15, 6, 31, 3, 11, 15, 7, 32, 3, 10, 15, 7, 33, 3, 9, 15, 8,
+	34, 3, 8, 15, 9, 35, 3, 8, 15, 9, 36, 3, 7, 15, 10, 37, 4, 6, 15, 11, 1, 38, 4, 5,
+	15, 12, 1, 39, 4, 5, 15, 12, 2, 40, 4, 4, 14, 13, 3, 41, 4, 3, 13, 14, 4, 42, 4, 2,
+	13, 15, 4, 43, 4, 2, 12, 15, 5, 44, 4, 1, 11, 15, 6, 46, 3, 10, 15, 7, 47, 3, 10, 15,
+	7, 48, 3, 9, 15, 8, 49, 3, 8, 15, 9, 50, 3, 7, 15, 10, 51, 3, 7, 15, 10, 52, 4, 6,
+	15, 11, 1, 53, 4, 5, 15, 12, 2, 54, 4, 4, 15, 13, 2, 55, 4, 4, 14, 13, 3, 56, 4, 3,
+	13, 14, 4, 57, 4, 2, 12, 15, 5, 58, 4, 2, 12, 15, 5, 59, 4, 1, 11, 15, 6, 61, 3, 10,
+	15, 7, 62, 3, 10, 15, 8, 63, 3, 9, 15, 8, 64, 3, 8, 15, 9, 65, 3, 7, 15, 10, 66, 3,
+	7, 15, 10, 67, 4, 6, 15, 11, 1, 68, 4, 5, 15, 12, 2, 69, 4, 4, 15, 13, 2, 70, 4, 4,
+	14, 13, 3, 71, 4, 3, 13, 14, 4, 72, 4, 2, 12, 15, 5, 73, 4, 1, 12, 15, 5, 74, 4, 1,
+	11, 15, 6, 76, 3, 10, 15, 7, 77, 3, 9, 15, 8, 78, 3, 9, 15, 8, 79, 3, 8, 15, 9, 80,
+	3, 7, 15, 10, 81, 3, 6, 15, 11, 82, 4, 6, 15, 11, 1, 83, 4, 5, 15, 12, 2, 84, 4, 4,
+	14, 13, 3, 85, 4, 3, 14, 14, 3, 86, 4, 3, 13, 14, 4, 87, 4, 2, 12, 15, 5, 88, 4, 1,
+	11, 15, 6, 89, 4, 1, 11, 15, 6, 91, 3, 10, 15, 7, 92, 3, 9, 15, 8, 93, 3, 9, 15, 4,
+	94, 1, 4, 0, 0, 0, 0, 1, 1, 2, 0, 3, 5, 15, 7, 1, 3, 10, 15, 7, 2, 3, 9, 15,
+	7, 3, 3, 9, 15, 8, 4, 3, 9, 15, 8, 5, 3, 8, 15, 8, 6, 3, 8, 15, 9, 7, 3, 7,
+	15, 9, 8, 3, 7, 15, 10, 9, 3, 7, 15, 10, 10, 3, 6, 15, 10, 11, 3, 6, 15, 11, 12, 4,
+	6, 15, 11, 1, 13, 4, 5, 15, 11, 1, 14, 4, 5, 15, 12, 1, 15, 4, 4, 15, 12, 2, 16, 4,
+	4, 15, 13, 2, 17, 4, 4, 14, 13, 3, 18, 4, 3, 14, 13, 3, 19, 4, 3, 13, 14, 3, 20, 4,
+	3, 13, 14, 4, 21, 4, 2, 13, 14, 4, 22, 4, 2, 12, 15, 4, 23, 4, 2, 12, 15, 5, 24, 4,
+	1, 12, 15, 5, 25, 4, 1, 11, 15, 5, 27, 3, 11, 15, 6, 28, 3, 10, 15, 6, 29, 3, 10, 15,
+	7, 30, 3, 10, 15, 7, 31, 3, 9, 15, 7, 32, 3, 9, 15, 8, 33, 3, 9, 15, 8, 34, 3, 8,
+	15, 8, 35, 3, 8, 15, 9, 36, 3, 7, 15, 9, 37, 3, 7, 15, 10, 38, 3, 7, 15, 10, 39, 3,
+	6, 15, 10, 40, 3, 6, 15, 11, 41, 4, 6, 15, 11, 1, 42, 4, 5, 15, 11, 1, 43, 4, 5, 15,
+	12, 1, 44, 4, 5, 15, 12, 2, 45, 4, 4, 15, 13, 2, 46, 4, 4, 14, 13, 2, 47, 4, 3, 14,
+	13, 3, 48, 4, 3, 13, 14, 3, 49, 4, 3, 13, 14, 4, 50, 4, 2, 13, 14, 4, 51, 4, 2, 12,
+	15, 4, 52, 4, 2, 12, 15, 5, 53, 4, 1, 12, 15, 5, 54, 4, 1, 11, 15, 5, 56, 3, 11, 15,
+	6, 57, 3, 10, 15, 6, 58, 3, 10, 15, 7, 59, 3, 10, 15, 7, 60, 3, 9, 15, 7, 61, 3, 9,
+	15, 8, 62, 3, 9, 15, 8, 63, 3, 8, 15, 8, 64, 3, 8, 15, 9, 65, 3, 8, 15, 9, 66, 3,
+	7, 15, 9, 67, 3, 7, 15, 10, 68, 3, 6, 15, 10, 69, 3, 6, 15, 11, 70, 4, 6, 15, 11, 1,
+	71, 4, 5, 15, 11, 1, 72, 4, 5, 15, 12, 1, 73, 4, 5, 15, 12, 2, 74, 4, 4, 15, 12, 2,
+	75, 4, 4, 14, 13, 2, 76, 4, 3, 14, 13, 3, 77, 4, 3, 14, 14, 3, 78, 4, 3, 13, 14, 4,
+	79, 4, 2, 13, 14, 4, 80, 4, 2, 12, 15, 4, 81, 4, 2, 12, 15, 5, 82, 4, 1, 12, 15, 5,
+	83, 4, 1, 11, 15, 5, 84, 4, 1, 11, 15, 6, 86, 3, 11, 15, 6, 87, 3, 10, 15, 6, 88, 3,
+	10, 15, 7, 89, 3, 9, 15, 7, 90, 3, 9, 15, 8, 91, 3, 9, 15, 8, 92, 3, 8, 15, 4, 93,
+	1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 8, 8, 0, 3, 8, 15, 8, 1, 3, 8, 15, 8, 2, 3,
+	8, 15, 8, 3, 3, 8, 15, 8, 4, 3, 8, 15, 8, 5, 3, 8, 15, 8, 6, 3, 8, 15, 8, 7,
+	3, 8, 15, 8, 8, 3, 8, 15, 8, 9, 3, 8, 15, 8, 10, 3, 8, 15, 8, 11, 3, 8, 15, 8,
+	12, 3, 8, 15, 8, 13, 3, 8, 15, 8, 14, 3, 8, 15, 8, 15, 3, 8, 15, 8, 16, 3, 8, 15,
+	8, 17, 3, 8, 15, 8, 18, 3, 8, 15, 8, 19, 3, 8, 15, 8, 20, 3, 8, 15, 8, 21, 3, 8,
+	15, 8, 22, 3, 8, 15, 8, 23, 3, 8, 15, 8, 24, 3, 8, 15, 8, 25, 3, 8, 15, 8, 26, 3,
+	8, 15, 8, 27, 3, 8, 15, 8, 28, 3, 8, 15, 8, 29, 3, 8, 15, 8, 30, 3, 8, 15, 8, 31,
+	3, 8, 15, 8, 32, 3, 8, 15, 8, 33, 3, 8, 15, 8, 34, 3, 8, 15, 8, 35, 3, 8, 15, 8,
+	36, 3, 8, 15, 8, 37, 3, 8, 15, 8, 38, 3, 8, 15, 8, 39, 3, 8, 15, 8, 40, 3, 8, 15,
+	8, 41, 3, 8, 15, 8, 42, 3, 8, 15, 8, 43, 3, 8, 15, 8, 44, 3, 8, 15, 8, 45, 3, 8,
+	15, 8, 46, 3, 8, 15, 8, 47, 3, 8, 15, 8, 48, 3, 8, 15, 8, 49, 3, 8, 15, 8, 50, 3,
+	8, 15, 8, 51, 3, 8, 15, 8, 52, 3, 8, 15, 8, 53, 3, 8, 15, 8, 54, 3, 8, 15, 8, 55,
+	3, 8, 15, 8, 56, 3, 8, 15, 8, 57, 3, 8, 15, 8, 58, 3, 8, 15, 8, 59, 3, 8, 15, 8,
+	60, 3, 8, 15, 8, 61, 3, 8, 15, 8, 62, 3, 8, 15, 8, 63, 3, 8, 15, 8, 64, 3, 8, 15,
+	8, 65, 3, 8, 15, 8, 66, 3, 8, 15, 8, 67, 3, 8, 15, 8, 68, 3, 8, 15, 8, 69, 3, 8,
+	15, 8, 70, 3, 8, 15, 8, 71, 3, 8, 15, 8, 72, 3, 8, 15, 8, 73, 3, 8, 15, 8, 74, 3,
+	8, 15, 8, 75, 3, 8, 15, 8, 76, 3, 8, 15, 8, 77, 3, 8, 15, 8, 78, 3, 8, 15, 8, 79,
+	3, 8, 15, 8, 80, 3, 8, 15, 8, 81, 3, 8, 15, 8, 82, 3, 8, 15, 8, 83, 3, 8, 15, 8,
+	84, 3, 8, 15, 8, 85, 3, 8, 15, 8, 86, 3, 8, 15, 8, 87, 3, 8, 15, 8, 88, 3, 8, 15,
+	8, 89, 3, 8, 15, 8, 90, 3, 8, 15, 4, 91, 1, 4, 0, 0, 0, 0, 1, 1, 5, 0, 3, 2,
+	15, 10, 1, 3, 7, 15, 9, 2, 3, 7, 15, 9, 3, 3, 7, 15, 9, 4, 3, 8, 15, 8, 5, 3,
+	8, 15, 8, 6, 3, 8, 15, 7, 7, 3, 9, 15, 7, 8, 3, 9, 15, 7, 9, 3, 10, 15, 6, 10,
+	3, 10, 15, 6, 11, 3, 10, 15, 6, 12, 3, 11, 15, 5, 13, 3, 11, 15, 5, 13, 4, 1, 11, 15,
+	4, 14, 4, 1, 12, 15, 4, 15, 4, 1, 12, 15, 4, 16, 4, 2, 13, 14, 3, 17, 4, 2, 13, 14,
+	3, 18, 4, 3, 13, 13, 3, 19, 4, 3, 14, 13, 2, 20, 4, 3, 14, 13, 2, 21, 4, 4, 14, 12,
+	2, 22, 4, 4, 15, 12, 1, 23, 4, 4, 15, 12, 1, 24, 3, 5, 15, 11, 25, 3, 5, 15, 11, 26,
+	3, 5, 15, 10, 27, 3, 6, 15, 10, 28, 3, 6, 15, 10, 29, 3, 7, 15, 9, 30, 3, 7, 15, 9,
+	31, 3, 7, 15, 9, 32, 3, 8, 15, 8, 33, 3, 8, 15, 8, 34, 3, 8, 15, 7, 35, 3, 9, 15,
+	7, 36, 3, 9, 15, 7, 37, 3, 10, 15, 6, 38, 3, 10, 15, 6, 39, 3, 10, 15, 6, 40, 3, 11,
+	15, 5, 41, 3, 11, 15, 5, 41, 4, 1, 11, 15, 5, 42, 4, 1, 12, 15, 4, 43, 4, 1, 12, 15,
+	4, 44, 4, 2, 13, 14, 3, 45, 4, 2, 13, 14, 3, 46, 4, 2, 13, 13, 3, 47, 4, 3, 14, 13,
+	2, 48, 4, 3, 14, 13, 2, 49, 4, 4, 14, 12, 2, 50, 4, 4, 15, 12, 1, 51, 4, 4, 15, 12,
+	1, 52, 3, 5, 15, 11, 53, 3, 5, 15, 11, 54, 3, 5, 15, 10, 55, 3, 6, 15, 10, 56, 3, 6,
+	15, 10, 57, 3, 7, 15, 9, 58, 3, 7, 15, 9, 59, 3, 7, 15, 9, 60, 3, 8, 15, 8, 61, 3,
+	8, 15, 8, 62, 3, 8, 15, 8, 63, 3, 9, 15, 7, 64, 3, 9, 15, 7, 65, 3, 9, 15, 6, 66,
+	3, 10, 15, 6, 67, 3, 10, 15, 6, 68, 3, 11, 15, 5, 69, 3, 11, 15, 5, 69, 4, 1, 11, 15,
+	5, 70, 4, 1, 12, 15, 4, 71, 4, 1, 12, 15, 4, 72, 4, 2, 12, 14, 3, 73, 4, 2, 13, 14,
+	3, 74, 4, 2, 13, 14, 3, 75, 4, 3, 14, 13, 2, 76, 4, 3, 14, 13, 2, 77, 4, 4, 14, 12,
+	2, 78, 4, 4, 15, 12, 1, 79, 4, 4, 15, 12, 1, 80, 4, 5, 15, 11, 1, 81, 3, 5, 15, 11,
+	82, 3, 5, 15, 11, 83, 3, 6, 15, 10, 84, 3, 6, 15, 10, 85, 3, 6, 15, 9, 86, 3, 7, 15,
+	9, 87, 3, 7, 15, 9, 88, 3, 8, 15, 8, 89, 3, 8, 15, 4, 90, 1, 4, 0, 0, 0, 0, 0,
+	0, 0, 3, 7, 11, 1, 0, 3, 5, 15, 11, 1, 3, 5, 15, 10, 2, 3, 6, 15, 9, 3, 3, 7,
+	15, 9, 4, 3, 8, 15, 8, 5, 3, 8, 15, 7, 6, 3, 9, 15, 6, 7, 3, 10, 15, 6, 8, 3,
+	11, 15, 5, 9, 3, 11, 15, 4, 9, 4, 1, 12, 14, 3, 10, 4, 2, 13, 14, 3, 11, 4, 3, 14,
+	13, 2, 12, 4, 3, 14, 12, 1, 13, 3, 4, 15, 11, 14, 3, 5, 15, 11, 15, 3, 6, 15, 10, 16,
+	3, 6, 15, 9, 17, 3, 7, 15, 8, 18, 3, 8, 15, 8, 19, 3, 9, 15, 7, 20, 3, 9, 15, 6,
+	21, 3, 10, 15, 5, 22, 3, 11, 15, 5, 22, 4, 1, 12, 15, 4, 23, 4, 1, 12, 14, 3, 24, 4,
+	2, 13, 14, 3, 25, 4, 3, 14, 13, 2, 26, 4, 4, 15, 12, 1, 27, 3, 4, 15, 11, 28, 3, 5,
+	15, 11, 29, 3, 6, 15, 10, 30, 3, 7, 15, 9, 31, 3, 7, 15, 8, 32, 3, 8, 15, 8, 33, 3,
+	9, 15, 7, 34, 3, 9, 15, 6, 35, 3, 10, 15, 5, 36, 3, 11, 15, 5, 36, 4, 1, 12, 15, 4,
+	37, 4, 1, 12, 14, 3, 38, 4, 2, 13, 13, 2, 39, 4, 3, 14, 13, 2, 40, 4, 4, 15, 12, 1,
+	41, 3, 4, 15, 11, 42, 3, 5, 15, 10, 43, 3, 6, 15, 10, 44, 3, 7, 15, 9, 45, 3, 7, 15,
+	8, 46, 3, 8, 15, 7, 47, 3, 9, 15, 7, 48, 3, 10, 15, 6, 49, 3, 10, 15, 5, 50, 3, 11,
+	15, 4, 50, 4, 1, 12, 15, 4, 51, 4, 2, 13, 14, 3, 52, 4, 2, 13, 13, 2, 53, 4, 3, 14,
+	12, 2, 54, 4, 4, 15, 12, 1, 55, 3, 5, 15, 11, 56, 3, 5, 15, 10, 57, 3, 6, 15, 10, 58,
+	3, 7, 15, 9, 59, 3, 8, 15, 8, 60, 3, 8, 15, 7, 61, 3, 9, 15, 7, 62, 3, 10, 15, 6,
+	63, 3, 10, 15, 5, 64, 3, 11, 15, 4, 64, 4, 1, 12, 15, 4, 65, 4, 2, 13, 14, 3, 66, 4,
+	2, 13, 13, 2, 67, 4, 3, 14, 12, 1, 68, 4, 4, 15, 12, 1, 69, 3, 5, 15, 11, 70, 3, 5,
+	15, 10, 71, 3, 6, 15, 9, 72, 3, 7, 15, 9, 73, 3, 8, 15, 8, 74, 3, 8, 15, 7, 75, 3,
+	9, 15, 6, 76, 3, 10, 15, 6, 77, 3, 11, 15, 5, 78, 3, 11, 15, 4, 78, 4, 1, 12, 14, 3,
+	79, 4, 2, 13, 14, 3, 80, 4, 3, 14, 13, 2, 81, 4, 3, 14, 12, 1, 82, 4, 4, 15, 11, 1,
+	83, 3, 5, 15, 11, 84, 3, 6, 15, 10, 85, 3, 6, 15, 9, 86, 3, 7, 15, 9, 87, 3, 8, 15,
+	4, 88, 1, 4, 0, 0, 0, 0, 0, 2, 5, 2, 0, 3, 13, 13, 2, 0, 3, 4, 15, 12, 1, 3,
+	5, 15, 11, 2, 3, 6, 15, 9, 3, 3, 7, 15, 8, 4, 3, 8, 15, 7, 5, 3, 9, 15, 6, 6,
+	3, 10, 15, 5, 7, 3, 11, 15, 4, 7, 4, 1, 12, 14, 3, 8, 4, 2, 14, 13, 2, 9, 4, 4,
+	15, 12, 1, 10, 3, 5, 15, 11, 11, 3, 6, 15, 9, 12, 3, 7, 15, 8, 13, 3, 8, 15, 7, 14,
+	3, 9, 15, 6, 15, 3, 10, 15, 5, 16, 3, 11, 15, 4, 16, 4, 1, 12, 14, 3, 17, 4, 2, 14,
+	13, 2, 18, 4, 3, 15, 12, 1, 19, 3, 5, 15, 11, 20, 3, 6, 15, 10, 21, 3, 7, 15, 8, 22,
+	3, 8, 15, 7, 23, 3, 9, 15, 6, 24, 3, 10, 15, 5, 25, 3, 11, 15, 4, 25, 4, 1, 12, 14,
+	3, 26, 4, 2, 13, 13, 2, 27, 4, 3, 15, 12, 1, 28, 3, 5, 15, 11, 29, 3, 6, 15, 10, 30,
+	3, 7, 15, 8, 31, 3, 8, 15, 7, 32, 3, 9, 15, 6, 33, 3, 10, 15, 5, 34, 3, 11, 15, 4,
+	34, 4, 1, 12, 14, 3, 35, 4, 2, 13, 13, 2, 36, 4, 3, 15, 12, 1, 37, 3, 4, 15, 11, 38,
+	3, 6, 15, 10, 39, 3, 7, 15, 8, 40, 3, 8, 15, 7, 41, 3, 9, 15, 6, 42, 3, 10, 15, 5,
+	43, 3, 11, 15, 4, 43, 4, 1, 12, 14, 3, 44, 4, 2, 13, 13, 2, 45, 4, 3, 14, 12, 1, 46,
+	3, 4, 15, 11, 47, 3, 6, 15, 10, 48, 3, 7, 15, 9, 49, 3, 8, 15, 7, 50, 3, 9, 15, 6,
+	51, 3, 10, 15, 5, 52, 3, 11, 15, 4, 52, 4, 1, 12, 14, 3, 53, 4, 2, 13, 13, 2, 54, 4,
+	3, 14, 12, 1, 55, 3, 4, 15, 11, 56, 3, 6, 15, 10, 57, 3, 7, 15, 9, 58, 3, 8, 15, 7,
+	59, 3, 9, 15, 6, 60, 3, 10, 15, 5, 61, 3, 11, 15, 4, 61, 4, 1, 12, 14, 3, 62, 4, 2,
+	13, 13, 2, 63, 4, 3, 14, 12, 1, 64, 3, 4, 15, 11, 65, 3, 5, 15, 10, 66, 3, 7, 15, 9,
+	67, 3, 8, 15, 8, 68, 3, 9, 15, 6, 69, 3, 10, 15, 5, 70, 3, 11, 15, 4, 70, 4, 1, 12,
+	14, 3, 71, 4, 2, 13, 13, 2, 72, 4, 3, 14, 12, 1, 73, 3, 4, 15, 11, 74, 3, 5, 15, 10,
+	75, 3, 7, 15, 9, 76, 3, 8, 15, 8, 77, 3, 9, 15, 6, 78, 3, 10, 15, 5, 79, 3, 11, 15,
+	4, 79, 4, 1, 12, 14, 3, 80, 4, 2, 13, 13, 2, 81, 4, 3, 14, 12, 1, 82, 3, 4, 15, 11,
+	83, 3, 5, 15, 10, 84, 3, 6, 15, 9, 85, 3, 8, 15, 4, 86, 1, 4, 0, 0, 0, 0, 0, 0,
+	0, 3, 2, 13, 4, 0, 4, 1, 13, 14, 2, 1, 4, 3, 14, 12, 1, 2, 3, 4, 15, 11, 3, 3,
+	6, 15, 9, 4, 3, 7, 15, 8, 5, 3, 9, 15, 6, 6, 3, 10, 15, 5, 7, 3, 12, 15, 3, 7,
+	4, 2, 13, 13, 2, 8, 3, 3, 15, 12, 9, 3, 5, 15, 10, 10, 3, 6, 15, 9, 11, 3, 8, 15,
+	7, 12, 3, 9, 15, 6, 13, 3, 11, 15, 4, 13, 4, 1, 12, 14, 3, 14, 4, 2, 14, 13, 1, 15,
+	3, 4, 15, 11, 16, 3, 5, 15, 10, 17, 3, 7, 15, 8, 18, 3, 8, 15, 7, 19, 3, 10, 15, 5,
+	20, 3, 11, 15, 4, 20, 4, 1, 13, 14, 2, 21, 4, 3, 14, 12, 1, 22, 3, 4, 15, 11, 23, 3,
+	6, 15, 9, 24, 3, 7, 15, 8, 25, 3, 9, 15, 6, 26, 3, 10, 15, 5, 27, 3, 12, 15, 3, 27,
+	4, 2, 13, 13, 2, 28, 3, 3, 15, 12, 29, 3, 5, 15, 10, 30, 3, 6, 15, 9, 31, 3, 8, 15,
+	7, 32, 3, 9, 15, 6, 33, 3, 11, 15, 4, 33, 4, 1, 12, 14, 3, 34, 4, 2, 14, 13, 1, 35,
+	3, 4, 15, 11, 36, 3, 5, 15, 10, 37, 3, 7, 15, 8, 38, 3, 8, 15, 7, 39, 3, 10, 15, 5,
+	40, 3, 11, 15, 4, 40, 4, 1, 13, 13, 2, 41, 4, 3, 14, 12, 1, 42, 3, 4, 15, 11, 43, 3,
+	6, 15, 9, 44, 3, 7, 15, 8, 45, 3, 9, 15, 6, 46, 3, 10, 15, 5, 47, 3, 12, 14, 3, 47,
+	4, 2, 13, 13, 2, 48, 3, 3, 15, 11, 49, 3, 5, 15, 10, 50, 3, 6, 15, 9, 51, 3, 8, 15,
+	7, 52, 3, 9, 15, 6, 53, 3, 11, 15, 4, 53, 4, 1, 12, 14, 3, 54, 4, 2, 14, 12, 1, 55,
+	3, 4, 15, 11, 56, 3, 5, 15, 9, 57, 3, 7, 15, 8, 58, 3, 8, 15, 7, 59, 3, 10, 15, 5,
+	60, 3, 11, 15, 4, 60, 4, 1, 13, 13, 2, 61, 4, 3, 14, 12, 1, 62, 3, 4, 15, 10, 63, 3,
+	6, 15, 9, 64, 3, 7, 15, 8, 65, 3, 9, 15, 6, 66, 3, 10, 15, 5, 67, 3, 12, 14, 3, 67,
+	4, 2, 13, 13, 2, 68, 3, 3, 15, 11, 69, 3, 5, 15, 10, 70, 3, 6, 15, 8, 71, 3, 8, 15,
+	7, 72, 3, 9, 15, 6, 73, 3, 11, 15, 4, 73, 4, 1, 12, 14, 3, 74, 4, 2, 14, 12, 1, 75,
+	3, 4, 15, 11, 76, 3, 5, 15, 9, 77, 3, 7, 15, 8, 78, 3, 8, 15, 6, 79, 3, 10, 15, 5,
+	80, 3, 11, 15, 4, 80, 4, 2, 13, 13, 2, 81, 4, 3, 14, 12, 1, 82, 3, 4, 15, 10, 83, 3,
+	6, 15, 9, 84, 3, 7, 15, 4, 85, 1, 4, 0, 0, 0, 0, 0, 2, 1, 4, 0, 3, 8, 15, 5,
+	1, 3, 12, 14, 3, 1, 4, 2, 14, 12, 1, 2, 3, 4, 15, 11, 3, 3, 6, 15, 9, 4, 3, 8,
+	15, 7, 5, 3, 10, 15, 5, 6, 3, 11, 15, 3, 6, 4, 2, 13, 13, 1, 7, 3, 4, 15, 11, 8,
+	3, 5, 15, 9, 9, 3, 7, 15, 7, 10, 3, 9, 15, 5, 11, 3, 11, 15, 4, 11, 4, 1, 13, 13,
+	2, 12, 3, 3, 15, 11, 13, 3, 5, 15, 9, 14, 3, 7, 15, 8, 15, 3, 9, 15, 6, 16, 3, 11,
+	15, 4, 16, 4, 1, 12, 14, 2, 17, 3, 3, 14, 12, 18, 3, 5, 15, 10, 19, 3, 6, 15, 8, 20,
+	3, 8, 15, 6, 21, 3, 10, 15, 4, 21, 4, 1, 12, 14, 2, 22, 4, 2, 14, 12, 1, 23, 3, 4,
+	15, 10, 24, 3, 6, 15, 8, 25, 3, 8, 15, 7, 26, 3, 10, 15, 5, 27, 3, 12, 14, 3, 27, 4,
+	2, 13, 13, 1, 28, 3, 4, 15, 11, 29, 3, 6, 15, 9, 30, 3, 8, 15, 7, 31, 3, 9, 15, 5,
+	32, 3, 11, 15, 3, 32, 4, 2, 13, 13, 1, 33, 3, 3, 15, 11, 34, 3, 5, 15, 9, 35, 3, 7,
+	15, 7, 36, 3, 9, 15, 6, 37, 3, 11, 15, 4, 37, 4, 1, 13, 13, 2, 38, 3, 3, 15, 11, 39,
+	3, 5, 15, 10, 40, 3, 7, 15, 8, 41, 3, 9, 15, 6, 42, 3, 10, 15, 4, 42, 4, 1, 12, 14,
+	2, 43, 3, 3, 14, 12, 44, 3, 4, 15, 10, 45, 3, 6, 15, 8, 46, 3, 8, 15, 6, 47, 3, 10,
+	15, 4, 48, 3, 12, 14, 3, 48, 4, 2, 14, 12, 1, 49, 3, 4, 15, 10, 50, 3, 6, 15, 9, 51,
+	3, 8, 15, 7, 52, 3, 10, 15, 5, 53, 3, 11, 15, 3, 53, 4, 2, 13, 13, 1, 54, 3, 4, 15,
+	11, 55, 3, 6, 15, 9, 56, 3, 7, 15, 7, 57, 3, 9, 15, 5, 58, 3, 11, 15, 3, 58, 4, 1,
+	13, 13, 2, 59, 3, 3, 15, 11, 60, 3, 5, 15, 9, 61, 3, 7, 15, 8, 62, 3, 9, 15, 6, 63,
+	3, 11, 15, 4, 63, 4, 1, 13, 13, 2, 64, 3, 3, 14, 12, 65, 3, 5, 15, 10, 66, 3, 7, 15,
+	8, 67, 3, 8, 15, 6, 68, 3, 10, 15, 4, 68, 4, 1, 12, 14, 2, 69, 4, 3, 14, 12, 1, 70,
+	3, 4, 15, 10, 71, 3, 6, 15, 8, 72, 3, 8, 15, 6, 73, 3, 10, 15, 5, 74, 3, 12, 14, 3,
+	74, 4, 2, 14, 12, 1, 75, 3, 4, 15, 11, 76, 3, 6, 15, 9, 77, 3, 8, 15, 7, 78, 3, 10,
+	15, 5, 79, 3, 11, 15, 3, 79, 4, 2, 13, 13, 1, 80, 3, 4, 15, 11, 81, 3, 5, 15, 9, 82,
+	3, 7, 15, 4, 83, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 8, 7, 0, 3, 9, 15, 5, 1, 3,
+	11, 15, 3, 1, 4, 2, 13, 12, 1, 2, 3, 4, 15, 10, 3, 3, 6, 15, 8, 4, 3, 8, 15, 6,
+	5, 3, 11, 15, 3, 5, 4, 1, 13, 13, 1, 6, 3, 3, 15, 11, 7, 3, 6, 15, 8, 8, 3, 8,
+	15, 6, 9, 3, 10, 15, 4, 9, 4, 1, 12, 13, 2, 10, 3, 3, 15, 11, 11, 3, 5, 15, 9, 12,
+	3, 7, 15, 7, 13, 3, 10, 15, 5, 14, 3, 12, 14, 2, 14, 3, 2, 14, 12, 15, 3, 5, 15, 10,
+	16, 3, 7, 15, 7, 17, 3, 9, 15, 5, 18, 3, 11, 15, 3, 18, 4, 2, 13, 12, 1, 19, 3, 4,
+	15, 10, 20, 3, 6, 15, 8, 21, 3, 8, 15, 6, 22, 3, 11, 15, 4, 22, 4, 1, 13, 13, 1, 23,
+	3, 3, 15, 11, 24, 3, 6, 15, 9, 25, 3, 8, 15, 6, 26, 3, 10, 15, 4, 26, 4, 1, 12, 14,
+	2, 27, 3, 3, 15, 11, 28, 3, 5, 15, 9, 29, 3, 7, 15, 7, 30, 3, 10, 15, 5, 31, 3, 12,
+	14, 2, 31, 3, 2, 14, 12, 32, 3, 4, 15, 10, 33, 3, 7, 15, 7, 34, 3, 9, 15, 5, 35, 3,
+	11, 15, 3, 35, 4, 2, 13, 12, 1, 36, 3, 4, 15, 10, 37, 3, 6, 15, 8, 38, 3, 8, 15, 6,
+	39, 3, 11, 15, 4, 39, 4, 1, 13, 13, 1, 40, 3, 3, 15, 11, 41, 3, 6, 15, 9, 42, 3, 8,
+	15, 6, 43, 3, 10, 15, 4, 43, 4, 1, 12, 14, 2, 44, 3, 3, 14, 11, 45, 3, 5, 15, 9, 46,
+	3, 7, 15, 7, 47, 3, 9, 15, 5, 48, 3, 12, 14, 3, 48, 3, 2, 14, 12, 49, 3, 4, 15, 10,
+	50, 3, 7, 15, 8, 51, 3, 9, 15, 5, 52, 3, 11, 15, 3, 52, 4, 2, 13, 13, 1, 53, 3, 4,
+	15, 10, 54, 3, 6, 15, 8, 55, 3, 8, 15, 6, 56, 3, 11, 15, 4, 56, 4, 1, 13, 13, 1, 57,
+	3, 3, 15, 11, 58, 3, 6, 15, 9, 59, 3, 8, 15, 6, 60, 3, 10, 15, 4, 60, 4, 1, 12, 14,
+	2, 61, 3, 3, 14, 11, 62, 3, 5, 15, 9, 63, 3, 7, 15, 7, 64, 3, 9, 15, 5, 65, 3, 12,
+	14, 3, 65, 3, 2, 14, 12, 66, 3, 4, 15, 10, 67, 3, 7, 15, 8, 68, 3, 9, 15, 5, 69, 3,
+	11, 15, 3, 69, 4, 2, 13, 13, 1, 70, 3, 4, 15, 10, 71, 3, 6, 15, 8, 72, 3, 8, 15, 6,
+	73, 3, 10, 15, 4, 73, 4, 1, 13, 13, 2, 74, 3, 3, 15, 11, 75, 3, 5, 15, 9, 76, 3, 8,
+	15, 7, 77, 3, 10, 15, 4, 78, 3, 12, 14, 2, 78, 3, 3, 14, 12, 79, 3, 5, 15, 9, 80, 3,
+	7, 15, 4, 81, 1, 4, 0, 0, 0, 0, 1, 1, 1, 0, 3, 1, 15, 8, 1, 3, 8, 15, 5, 2,
+	3, 11, 15, 3, 2, 3, 2, 14, 12, 3, 3, 4, 15, 9, 4, 3, 7, 15, 7, 5, 3, 10, 15, 4,
+	6, 3, 12, 14, 2, 6, 3, 3, 15, 11, 7, 3, 5, 15, 8, 8, 3, 8, 15, 6, 9, 3, 11, 15,
+	3, 9, 4, 1, 13, 12, 1, 10, 3, 4, 15, 10, 11, 3, 7, 15, 7, 12, 3, 9, 15, 5, 13, 3,
+	12, 14, 2, 13, 3, 3, 14, 11, 14, 3, 5, 15, 9, 15, 3, 8, 15, 6, 16, 3, 10, 15, 4, 16,
+	4, 1, 13, 13, 1, 17, 3, 4, 15, 10, 18, 3, 6, 15, 8, 19, 3, 9, 15, 5, 20, 3, 11, 14,
+	2, 20, 3, 2, 14, 12, 21, 3, 5, 15, 9, 22, 3, 7, 15, 7, 23, 3, 10, 15, 4, 23, 4, 1,
+	13, 13, 1, 24, 3, 3, 15, 11, 25, 3, 6, 15, 8, 26, 3, 8, 15, 5, 27, 3, 11, 15, 3, 27,
+	3, 2, 14, 12, 28, 3, 4, 15, 9, 29, 3, 7, 15, 7, 30, 3, 10, 15, 4, 31, 3, 12, 14, 2,
+	31, 3, 3, 15, 11, 32, 3, 5, 15, 8, 33, 3, 8, 15, 6, 34, 3, 11, 15, 3, 34, 4, 1, 13,
+	12, 1, 35, 3, 4, 15, 10, 36, 3, 7, 15, 7, 37, 3, 9, 15, 5, 38, 3, 12, 14, 2, 38, 3,
+	3, 14, 11, 39, 3, 5, 15, 9, 40, 3, 8, 15, 6, 41, 3, 10, 15, 4, 41, 4, 1, 13, 13, 1,
+	42, 3, 4, 15, 10, 43, 3, 6, 15, 8, 44, 3, 9, 15, 5, 45, 3, 11, 14, 2, 45, 3, 2, 14,
+	12, 46, 3, 5, 15, 9, 47, 3, 7, 15, 7, 48, 3, 10, 15, 4, 48, 4, 1, 12, 13, 1, 49, 3,
+	3, 15, 11, 50, 3, 6, 15, 8, 51, 3, 8, 15, 5, 52, 3, 11, 15, 3, 52, 3, 2, 14, 12, 53,
+	3, 4, 15, 10, 54, 3, 7, 15, 7, 55, 3, 10, 15, 4, 56, 3, 12, 14, 2, 56, 3, 3, 15, 11,
+	57, 3, 5, 15, 8, 58, 3, 8, 15, 6, 59, 3, 11, 15, 3, 59, 4, 1, 13, 12, 1, 60, 3, 4,
+	15, 10, 61, 3, 7, 15, 7, 62, 3, 9, 15, 5, 63, 3, 12, 14, 2, 63, 3, 3, 14, 11, 64, 3,
+	5, 15, 9, 65, 3, 8, 15, 6, 66, 3, 10, 15, 4, 66, 4, 1, 13, 13, 1, 67, 3, 4, 15, 10,
+	68, 3, 6, 15, 8, 69, 3, 9, 15, 5, 70, 3, 11, 14, 2, 70, 3, 2, 14, 12, 71, 3, 5, 15,
+	9, 72, 3, 7, 15, 7, 73, 3, 10, 15, 4, 73, 4, 1, 12, 13, 1, 74, 3, 3, 15, 11, 75, 3,
+	6, 15, 8, 76, 3, 8, 15, 5, 77, 3, 11, 15, 3, 77, 3, 2, 14, 12, 78, 3, 4, 15, 10, 79,
+	3, 7, 15, 4, 80, 1, 4, 0, 0, 0, 0, 1, 1, 7, 0, 3, 4, 15, 8, 1, 3, 8, 15, 5,
+	2, 3, 11, 14, 3, 2, 3, 2, 14, 12, 3, 3, 5, 15, 9, 4, 3, 8, 15, 6, 5, 3, 11, 15,
+	3, 5, 3, 2, 14, 12, 6, 3, 5, 15, 9, 7, 3, 8, 15, 6, 8, 3, 11, 15, 3, 8, 3, 2,
+	14, 12, 9, 3, 5, 15, 9, 10, 3, 8, 15, 6, 11, 3, 11, 15, 3, 11, 3, 1, 13, 12, 12, 3,
+	4, 15, 9, 13, 3, 7, 15, 6, 14, 3, 10, 15, 3, 14, 3, 1, 13, 12, 15, 3, 4, 15, 9, 16,
+	3, 7, 15, 6, 17, 3, 10, 15, 3, 17, 3, 1, 13, 12, 18, 3, 4, 15, 9, 19, 3, 7, 15, 6,
+	20, 3, 10, 15, 4, 20, 4, 1, 13, 13, 1, 21, 3, 4, 15, 10, 22, 3, 7, 15, 7, 23, 3, 10,
+	15, 4, 23, 4, 1, 13, 13, 1, 24, 3, 4, 15, 10, 25, 3, 7, 15, 7, 26, 3, 10, 15, 4, 26,
+	4, 1, 13, 13, 1, 27, 3, 4, 15, 10, 28, 3, 7, 15, 7, 29, 3, 9, 15, 4, 30, 3, 12, 13,
+	1, 30, 3, 3, 15, 10, 31, 3, 6, 15, 7, 32, 3, 9, 15, 4, 33, 3, 12, 13, 1, 33, 3, 3,
+	15, 10, 34, 3, 6, 15, 7, 35, 3, 9, 15, 4, 36, 3, 12, 13, 1, 36, 3, 3, 15, 10, 37, 3,
+	6, 15, 8, 38, 3, 9, 15, 5, 39, 3, 12, 14, 2, 39, 3, 3, 15, 11, 40, 3, 6, 15, 8, 41,
+	3, 9, 15, 5, 42, 3, 12, 14, 2, 42, 3, 3, 15, 11, 43, 3, 6, 15, 8, 44, 3, 9, 15, 5,
+	45, 3, 12, 14, 2, 45, 3, 3, 15, 11, 46, 3, 6, 15, 8, 47, 3, 8, 15, 5, 48, 3, 11, 14,
+	2, 48, 3, 2, 14, 11, 49, 3, 5, 15, 8, 50, 3, 8, 15, 5, 51, 3, 11, 14, 2, 51, 3, 2,
+	14, 11, 52, 3, 5, 15, 8, 53, 3, 8, 15, 5, 54, 3, 11, 14, 2, 54, 3, 2, 14, 11, 55, 3,
+	5, 15, 9, 56, 3, 8, 15, 6, 57, 3, 11, 15, 3, 57, 3, 2, 14, 12, 58, 3, 5, 15, 9, 59,
+	3, 8, 15, 6, 60, 3, 11, 15, 3, 60, 3, 2, 14, 12, 61, 3, 5, 15, 9, 62, 3, 8, 15, 6,
+	63, 3, 11, 15, 3, 63, 3, 2, 14, 12, 64, 3, 4, 15, 9, 65, 3, 7, 15, 6, 66, 3, 10, 15,
+	3, 66, 3, 1, 13, 12, 67, 3, 4, 15, 9, 68, 3, 7, 15, 6, 69, 3, 10, 15, 3, 69, 3, 1,
+	13, 12, 70, 3, 4, 15, 9, 71, 3, 7, 15, 6, 72, 3, 10, 15, 3, 72, 4, 1, 13, 13, 1, 73,
+	3, 4, 15, 10, 74, 3, 7, 15, 7, 75, 3, 10, 15, 4, 75, 4, 1, 13, 13, 1, 76, 3, 4, 15,
+	10, 77, 3, 7, 15, 4, 78, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 5, 11, 0, 3, 5, 15, 9,
+	1, 3, 8, 15, 5, 2, 3, 11, 14, 2, 2, 3, 2, 15, 11, 3, 3, 6, 15, 7, 4, 3, 9, 15,
+	4, 5, 3, 12, 13, 1, 5, 3, 4, 15, 10, 6, 3, 7, 15, 6, 7, 3, 10, 15, 3, 7, 3, 1,
+	14, 12, 8, 3, 5, 15, 9, 9, 3, 8, 15, 5, 10, 3, 11, 14, 2, 10, 3, 3, 15, 11, 11, 3,
+	6, 15, 7, 12, 3, 9, 15, 4, 13, 3, 12, 13, 1, 13, 3, 4, 15, 10, 14, 3, 7, 15, 6, 15,
+	3, 10, 15, 3, 15, 3, 1, 14, 12, 16, 3, 5, 15, 8, 17, 3, 8, 15, 5, 18, 3, 11, 14, 2,
+	18, 3, 3, 15, 11, 19, 3, 6, 15, 7, 20, 3, 9, 15, 4, 21, 3, 13, 13, 1, 21, 3, 4, 15,
+	9, 22, 3, 7, 15, 6, 23, 3, 10, 15, 3, 23, 3, 2, 14, 12, 24, 3, 5, 15, 8, 25, 3, 8,
+	15, 5, 26, 3, 12, 14, 2, 26, 3, 3, 15, 11, 27, 3, 6, 15, 7, 28, 3, 9, 15, 4, 28, 4,
+	1, 13, 13, 1, 29, 3, 4, 15, 9, 30, 3, 7, 15, 6, 31, 3, 10, 15, 3, 31, 3, 2, 14, 12,
+	32, 3, 5, 15, 8, 33, 3, 8, 15, 5, 34, 3, 12, 14, 2, 34, 3, 3, 15, 10, 35, 3, 6, 15,
+	7, 36, 3, 9, 15, 4, 36, 3, 1, 13, 13, 37, 3, 4, 15, 9, 38, 3, 7, 15, 6, 39, 3, 11,
+	15, 3, 39, 3, 2, 14, 11, 40, 3, 5, 15, 8, 41, 3, 8, 15, 5, 42, 3, 12, 14, 2, 42, 3,
+	3, 15, 10, 43, 3, 6, 15, 7, 44, 3, 10, 15, 4, 44, 3, 1, 13, 13, 45, 3, 4, 15, 9, 46,
+	3, 7, 15, 6, 47, 3, 11, 15, 3, 47, 3, 2, 14, 11, 48, 3, 5, 15, 8, 49, 3, 9, 15, 5,
+	50, 3, 12, 14, 1, 50, 3, 3, 15, 10, 51, 3, 6, 15, 7, 52, 3, 10, 15, 4, 52, 3, 1, 13,
+	12, 53, 3, 4, 15, 9, 54, 3, 7, 15, 6, 55, 3, 11, 15, 2, 55, 3, 2, 14, 11, 56, 3, 5,
+	15, 8, 57, 3, 9, 15, 5, 58, 3, 12, 13, 1, 58, 3, 3, 15, 10, 59, 3, 6, 15, 7, 60, 3,
+	10, 15, 3, 60, 3, 1, 13, 12, 61, 3, 4, 15, 9, 62, 3, 8, 15, 6, 63, 3, 11, 14, 2, 63,
+	3, 2, 14, 11, 64, 3, 5, 15, 8, 65, 3, 9, 15, 5, 66, 3, 12, 13, 1, 66, 3, 3, 15, 10,
+	67, 3, 7, 15, 7, 68, 3, 10, 15, 3, 68, 3, 1, 13, 12, 69, 3, 4, 15, 9, 70, 3, 8, 15,
+	6, 71, 3, 11, 14, 2, 71, 3, 2, 14, 11, 72, 3, 5, 15, 8, 73, 3, 9, 15, 4, 74, 3, 12,
+	13, 1, 74, 3, 3, 15, 10, 75, 3, 7, 15, 4, 76, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 10,
+	12, 0, 3, 4, 15, 9, 1, 3, 8, 15, 5, 2, 3, 12, 14, 1, 2, 3, 3, 15, 10, 3, 3, 7,
+	15, 6, 4, 3, 10, 15, 3, 4, 3, 2, 14, 11, 5, 3, 5, 15, 7, 6, 3, 9, 15, 4, 6, 3,
+	1, 13, 12, 7, 3, 4, 15, 9, 8, 3, 8, 15, 5, 9, 3, 12, 14, 1, 9, 3, 3, 15, 10, 10,
+	3, 7, 15, 6, 11, 3, 10, 15, 3, 11, 3, 2, 14, 11, 12, 3, 5, 15, 7, 13, 3, 9, 15, 4,
+	13, 3, 1, 13, 12, 14, 3, 4, 15, 9, 15, 3, 8, 15, 5, 16, 3, 12, 14, 1, 16, 3, 3, 15,
+	10, 17, 3, 7, 15, 6, 18, 3, 10, 15, 3, 18, 3, 2, 14, 11, 19, 3, 5, 15, 7, 20, 3, 9,
+	15, 4, 20, 3, 1, 13, 12, 21, 3, 4, 15, 9, 22, 3, 8, 15, 5, 23, 3, 12, 14, 1, 23, 3,
+	3, 15, 10, 24, 3, 7, 15, 6, 25, 3, 10, 15, 3, 25, 3, 2, 14, 11, 26, 3, 5, 15, 8, 27,
+	3, 9, 15, 4, 28, 2, 13, 12, 28, 3, 4, 15, 9, 29, 3, 8, 15, 5, 30, 3, 12, 14, 1, 30,
+	3, 3, 15, 10, 31, 3, 7, 15, 6, 32, 3, 10, 15, 3, 32, 3, 2, 14, 11, 33, 3, 5, 15, 8,
+	34, 3, 9, 15, 4, 35, 2, 13, 12, 35, 3, 4, 15, 9, 36, 3, 8, 15, 5, 37, 3, 12, 14, 1,
+	37, 3, 3, 15, 10, 38, 3, 7, 15, 6, 39, 3, 10, 15, 3, 39, 3, 2, 14, 11, 40, 3, 5, 15,
+	8, 41, 3, 9, 15, 4, 42, 2, 13, 12, 42, 3, 4, 15, 9, 43, 3, 8, 15, 5, 44, 3, 11, 14,
+	1, 44, 3, 3, 15, 10, 45, 3, 7, 15, 6, 46, 3, 10, 15, 3, 46, 3, 2, 14, 11, 47, 3, 5,
+	15, 8, 48, 3, 9, 15, 4, 49, 2, 13, 13, 49, 3, 4, 15, 9, 50, 3, 8, 15, 5, 51, 3, 11,
+	14, 1, 51, 3, 3, 15, 10, 52, 3, 7, 15, 6, 53, 3, 10, 15, 3, 53, 3, 2, 14, 11, 54, 3,
+	5, 15, 8, 55, 3, 9, 15, 4, 56, 2, 13, 13, 56, 3, 4, 15, 9, 57, 3, 8, 15, 5, 58, 3,
+	11, 14, 1, 58, 3, 3, 15, 10, 59, 3, 7, 15, 6, 60, 3, 10, 15, 3, 60, 3, 2, 14, 11, 61,
+	3, 5, 15, 8, 62, 3, 9, 15, 4, 63, 2, 13, 13, 63, 3, 4, 15, 9, 64, 3, 8, 15, 5, 65,
+	3, 11, 14, 2, 65, 3, 3, 15, 10, 66, 3, 6, 15, 6, 67, 3, 10, 15, 3, 67, 3, 2, 14, 11,
+	68, 3, 5, 15, 8, 69, 3, 9, 15, 4, 70, 2, 13, 13, 70, 3, 4, 15, 9, 71, 3, 8, 15, 5,
+	72, 3, 11, 14, 2, 72, 3, 3, 15, 10, 73, 3, 6, 15, 4, 74, 1, 4, 0, 0, 0, 0, 0, 2,
+	4, 3, 0, 2, 12, 13, 0, 3, 4, 15, 9, 1, 3, 8, 15, 4, 2, 2, 12, 13, 2, 3, 4, 15,
+	9, 3, 3, 8, 15, 5, 4, 3, 12, 13, 1, 4, 3, 4, 15, 9, 5, 3, 8, 15, 5, 6, 3, 12,
+	13, 1, 6, 3, 3, 15, 9, 7, 3, 7, 15, 5, 8, 3, 11, 14, 1, 8, 3, 3, 15, 10, 9, 3,
+	7, 15, 6, 10, 3, 11, 14, 2, 10, 3, 3, 15, 10, 11, 3, 7, 15, 6, 12, 3, 11, 14, 2, 12,
+	3, 2, 15, 10, 13, 3, 6, 15, 6, 14, 3, 10, 15, 2, 14, 3, 2, 15, 11, 15, 3, 6, 15, 7,
+	16, 3, 10, 15, 2, 16, 3, 2, 14, 11, 17, 3, 6, 15, 7, 18, 3, 10, 15, 3, 18, 3, 1, 14,
+	11, 19, 3, 6, 15, 7, 20, 3, 10, 15, 3, 20, 3, 1, 14, 11, 21, 3, 5, 15, 7, 22, 3, 9,
+	15, 3, 22, 3, 1, 13, 12, 23, 3, 5, 15, 8, 24, 3, 9, 15, 4, 24, 3, 1, 13, 12, 25, 3,
+	5, 15, 8, 26, 3, 9, 15, 4, 27, 2, 13, 12, 27, 3, 4, 15, 8, 28, 3, 8, 15, 4, 29, 2,
+	12, 13, 29, 3, 4, 15, 9, 30, 3, 8, 15, 5, 31, 2, 12, 13, 31, 3, 4, 15, 9, 32, 3, 8,
+	15, 5, 33, 3, 12, 13, 1, 33, 3, 3, 15, 9, 34, 3, 8, 15, 5, 35, 3, 12, 13, 1, 35, 3,
+	3, 15, 9, 36, 3, 7, 15, 5, 37, 3, 11, 14, 1, 37, 3, 3, 15, 10, 38, 3, 7, 15, 6, 39,
+	3, 11, 14, 2, 39, 3, 3, 15, 10, 40, 3, 7, 15, 6, 41, 3, 11, 14, 2, 41, 3, 2, 15, 10,
+	42, 3, 6, 15, 6, 43, 3, 10, 15, 2, 43, 3, 2, 14, 11, 44, 3, 6, 15, 7, 45, 3, 10, 15,
+	3, 45, 3, 2, 14, 11, 46, 3, 6, 15, 7, 47, 3, 10, 15, 3, 47, 3, 1, 14, 11, 48, 3, 5,
+	15, 7, 49, 3, 10, 15, 3, 49, 3, 1, 14, 11, 50, 3, 5, 15, 7, 51, 3, 9, 15, 3, 51, 3,
+	1, 13, 12, 52, 3, 5, 15, 8, 53, 3, 9, 15, 4, 53, 3, 1, 13, 12, 54, 3, 5, 15, 8, 55,
+	3, 9, 15, 4, 56, 2, 13, 12, 56, 3, 4, 15, 8, 57, 3, 8, 15, 4, 58, 2, 12, 13, 58, 3,
+	4, 15, 9, 59, 3, 8, 15, 5, 60, 3, 12, 13, 1, 60, 3, 4, 15, 9, 61, 3, 8, 15, 5, 62,
+	3, 12, 13, 1, 62, 3, 3, 15, 9, 63, 3, 7, 15, 5, 64, 3, 12, 14, 1, 64, 3, 3, 15, 9,
+	65, 3, 7, 15, 5, 66, 3, 11, 14, 1, 66, 3, 3, 15, 10, 67, 3, 7, 15, 6, 68, 3, 11, 14,
+	2, 68, 3, 3, 15, 10, 69, 3, 7, 15, 6, 70, 3, 11, 14, 2, 70, 3, 2, 15, 10, 71, 3, 6,
+	15, 4, 72, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 8, 4, 0, 2, 12, 13, 0, 3, 4, 15, 8,
+	1, 3, 9, 15, 4, 2, 2, 13, 12, 2, 3, 5, 15, 8, 3, 3, 9, 15, 3, 3, 3, 1, 14, 11,
+	4, 3, 5, 15, 7, 5, 3, 10, 15, 3, 5, 3, 2, 14, 11, 6, 3, 6, 15, 6, 7, 3, 10, 14,
+	2, 7, 3, 2, 15, 10, 8, 3, 7, 15, 6, 9, 3, 11, 14, 1, 9, 3, 3, 15, 9, 10, 3, 7,
+	15, 5, 11, 3, 12, 13, 1, 11, 3, 4, 15, 9, 12, 3, 8, 15, 4, 13, 2, 12, 12, 13, 3, 4,
+	15, 8, 14, 3, 9, 15, 4, 14, 3, 1, 13, 12, 15, 3, 5, 15, 7, 16, 3, 9, 15, 3, 16, 3,
+	1, 14, 11, 17, 3, 6, 15, 7, 18, 3, 10, 15, 2, 18, 3, 2, 14, 11, 19, 3, 6, 15, 6, 20,
+	3, 11, 14, 2, 20, 3, 2, 15, 10, 21, 3, 7, 15, 5, 22, 3, 11, 14, 1, 22, 3, 3, 15, 9,
+	23, 3, 8, 15, 5, 24, 2, 12, 13, 24, 3, 4, 15, 9, 25, 3, 8, 15, 4, 26, 2, 13, 12, 26,
+	3, 4, 15, 8, 27, 3, 9, 15, 4, 27, 3, 1, 13, 12, 28, 3, 5, 15, 7, 29, 3, 9, 15, 3,
+	29, 3, 1, 14, 11, 30, 3, 6, 15, 7, 31, 3, 10, 15, 2, 31, 3, 2, 15, 10, 32, 3, 6, 15,
+	6, 33, 3, 11, 14, 2, 33, 3, 3, 15, 10, 34, 3, 7, 15, 5, 35, 3, 11, 13, 1, 35, 3, 3,
+	15, 9, 36, 3, 8, 15, 5, 37, 2, 12, 13, 37, 3, 4, 15, 8, 38, 3, 8, 15, 4, 39, 2, 13,
+	12, 39, 3, 5, 15, 8, 40, 3, 9, 15, 3, 40, 3, 1, 13, 12, 41, 3, 5, 15, 7, 42, 3, 10,
+	15, 3, 42, 3, 1, 14, 11, 43, 3, 6, 15, 6, 44, 3, 10, 15, 2, 44, 3, 2, 15, 10, 45, 3,
+	7, 15, 6, 46, 3, 11, 14, 1, 46, 3, 3, 15, 10, 47, 3, 7, 15, 5, 48, 3, 12, 13, 1, 48,
+	3, 3, 15, 9, 49, 3, 8, 15, 5, 50, 2, 12, 13, 50, 3, 4, 15, 8, 51, 3, 8, 15, 4, 52,
+	2, 13, 12, 52, 3, 5, 15, 8, 53, 3, 9, 15, 3, 53, 3, 1, 14, 11, 54, 3, 5, 15, 7, 55,
+	3, 10, 15, 3, 55, 3, 2, 14, 11, 56, 3, 6, 15, 6, 57, 3, 10, 14, 2, 57, 3, 2, 15, 10,
+	58, 3, 7, 15, 6, 59, 3, 11, 14, 1, 59, 3, 3, 15, 9, 60, 3, 7, 15, 5, 61, 3, 12, 13,
+	1, 61, 3, 4, 15, 9, 62, 3, 8, 15, 4, 63, 2, 12, 13, 63, 3, 4, 15, 8, 64, 3, 9, 15,
+	4, 65, 2, 13, 12, 65, 3, 5, 15, 7, 66, 3, 9, 15, 3, 66, 3, 1, 14, 11, 67, 3, 6, 15,
+	7, 68, 3, 10, 15, 2, 68, 3, 2, 14, 11, 69, 3, 6, 15, 4, 70, 1, 4, 0, 0, 0, 0, 0,
+	0, 0, 2, 12, 5, 0, 2, 12, 13, 0, 3, 4, 15, 8, 1, 3, 9, 15, 3, 1, 3, 1, 14, 11,
+	2, 3, 6, 15, 6, 3, 3, 11, 14, 1, 3, 3, 3, 15, 9, 4, 3, 7, 15, 5, 5, 2, 12, 13,
+	5, 3, 4, 15, 8, 6, 3, 9, 15, 3, 6, 3, 1, 14, 11, 7, 3, 6, 15, 6, 8, 3, 11, 14,
+	1, 8, 3, 3, 15, 9, 9, 3, 7, 15, 5, 10, 2, 12, 13, 10, 3, 4, 15, 8, 11, 3, 9, 15,
+	3, 11, 3, 1, 14, 11, 12, 3, 6, 15, 6, 13, 3, 11, 14, 1, 13, 3, 3, 15, 9, 14, 3, 7,
+	15, 5, 15, 2, 12, 13, 15, 3, 4, 15, 8, 16, 3, 9, 15, 3, 16, 3, 1, 14, 11, 17, 3, 6,
+	15, 6, 18, 3, 11, 14, 1, 18, 3, 3, 15, 9, 19, 3, 7, 15, 5, 20, 2, 12, 13, 20, 3, 4,
+	15, 8, 21, 3, 9, 15, 3, 21, 3, 1, 14, 11, 22, 3, 6, 15, 6, 23, 3, 11, 14, 1, 23, 3,
+	3, 15, 9, 24, 3, 8, 15, 5, 25, 2, 12, 13, 25, 3, 4, 15, 8, 26, 3, 9, 15, 3, 26, 3,
+	1, 14, 11, 27, 3, 6, 15, 6, 28, 3, 11, 14, 1, 28, 3, 3, 15, 9, 29, 3, 8, 15, 5, 30,
+	2, 12, 12, 30, 3, 4, 15, 8, 31, 3, 9, 15, 3, 31, 3, 1, 14, 11, 32, 3, 6, 15, 6, 33,
+	3, 11, 14, 1, 33, 3, 3, 15, 9, 34, 3, 8, 15, 5, 35, 2, 12, 12, 35, 3, 4, 15, 8, 36,
+	3, 9, 15, 3, 36, 3, 1, 14, 11, 37, 3, 6, 15, 6, 38, 3, 11, 14, 1, 38, 3, 3, 15, 9,
+	39, 3, 8, 15, 5, 40, 2, 12, 12, 40, 3, 4, 15, 8, 41, 3, 9, 15, 3, 41, 3, 1, 14, 11,
+	42, 3, 6, 15, 6, 43, 3, 11, 14, 1, 43, 3, 3, 15, 9, 44, 3, 8, 15, 5, 45, 2, 12, 12,
+	45, 3, 4, 15, 8, 46, 3, 9, 15, 3, 46, 3, 1, 14, 11, 47, 3, 6, 15, 6, 48, 3, 11, 14,
+	1, 48, 3, 3, 15, 9, 49, 3, 8, 15, 4, 50, 2, 12, 12, 50, 3, 4, 15, 8, 51, 3, 9, 15,
+	3, 51, 3, 1, 14, 11, 52, 3, 6, 15, 6, 53, 3, 11, 14, 1, 53, 3, 3, 15, 9, 54, 3, 8,
+	15, 4, 55, 2, 12, 12, 55, 3, 4, 15, 8, 56, 3, 9, 15, 3, 56, 3, 1, 14, 11, 57, 3, 6,
+	15, 6, 58, 3, 11, 14, 1, 58, 3, 3, 15, 9, 59, 3, 8, 15, 4, 60, 2, 12, 12, 60, 3, 4,
+	15, 8, 61, 3, 9, 15, 3, 61, 3, 1, 14, 11, 62, 3, 6, 15, 6, 63, 3, 11, 14, 1, 63, 3,
+	3, 15, 9, 64, 3, 8, 15, 4, 65, 2, 12, 12, 65, 3, 4, 15, 8, 66, 3, 9, 15, 3, 66, 3,
+	1, 14, 11, 67, 3, 6, 15, 4, 68, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 2, 14, 5, 1, 2,
+	12, 12, 1, 3, 5, 15, 7, 2, 3, 10, 15, 2, 2, 3, 2, 15, 10, 3, 3, 7, 15, 5, 4, 2,
+	12, 12, 4, 3, 4, 15, 7, 5, 3, 10, 15, 2, 5, 3, 2, 15, 10, 6, 3, 7, 15, 5, 7, 2,
+	12, 13, 7, 3, 4, 15, 7, 8, 3, 10, 15, 2, 8, 3, 2, 15, 10, 9, 3, 7, 15, 5, 10, 2,
+	12, 13, 10, 3, 4, 15, 7, 11, 3, 9, 15, 2, 11, 3, 2, 15, 10, 12, 3, 7, 15, 5, 13, 2,
+	12, 13, 13, 3, 4, 15, 7, 14, 3, 9, 15, 2, 14, 3, 2, 15, 10, 15, 3, 7, 15, 5, 16, 2,
+	12, 13, 16, 3, 4, 15, 8, 17, 3, 9, 15, 2, 17, 3, 2, 15, 10, 18, 3, 7, 15, 5, 19, 2,
+	12, 13, 19, 3, 4, 15, 8, 20, 3, 9, 15, 2, 20, 3, 2, 14, 10, 21, 3, 7, 15, 5, 22, 2,
+	12, 13, 22, 3, 4, 15, 8, 23, 3, 9, 15, 3, 23, 3, 2, 14, 10, 24, 3, 7, 15, 5, 25, 2,
+	12, 13, 25, 3, 4, 15, 8, 26, 3, 9, 15, 3, 26, 3, 1, 14, 10, 27, 3, 7, 15, 5, 28, 2,
+	12, 13, 28, 3, 4, 15, 8, 29, 3, 9, 15, 3, 29, 3, 1, 14, 10, 30, 3, 7, 15, 5, 31, 2,
+	12, 13, 31, 3, 4, 15, 8, 32, 3, 9, 15, 3, 32, 3, 1, 14, 10, 33, 3, 7, 15, 5, 34, 2,
+	12, 13, 34, 3, 4, 15, 8, 35, 3, 9, 15, 3, 35, 3, 1, 14, 10, 36, 3, 6, 15, 5, 37, 2,
+	12, 13, 37, 3, 4, 15, 8, 38, 3, 9, 15, 3, 38, 3, 1, 14, 11, 39, 3, 6, 15, 5, 40, 2,
+	12, 13, 40, 3, 4, 15, 8, 41, 3, 9, 15, 3, 41, 3, 1, 14, 11, 42, 3, 6, 15, 5, 43, 2,
+	11, 13, 43, 3, 4, 15, 8, 44, 3, 9, 15, 3, 44, 3, 1, 14, 11, 45, 3, 6, 15, 6, 46, 2,
+	11, 13, 46, 3, 4, 15, 8, 47, 3, 9, 15, 3, 47, 3, 1, 14, 11, 48, 3, 6, 15, 6, 49, 2,
+	11, 13, 49, 3, 4, 15, 8, 50, 3, 9, 15, 3, 50, 3, 1, 14, 11, 51, 3, 6, 15, 6, 52, 2,
+	11, 13, 52, 3, 4, 15, 8, 53, 3, 9, 15, 3, 53, 3, 1, 14, 11, 54, 3, 6, 15, 6, 55, 3,
+	11, 13, 1, 55, 3, 4, 15, 8, 56, 3, 9, 15, 3, 56, 3, 1, 14, 11, 57, 3, 6, 15, 6, 58,
+	3, 11, 13, 1, 58, 3, 3, 15, 8, 59, 3, 9, 15, 3, 59, 3, 1, 14, 11, 60, 3, 6, 15, 6,
+	61, 3, 11, 14, 1, 61, 3, 3, 15, 8, 62, 3, 9, 15, 3, 62, 3, 1, 14, 11, 63, 3, 6, 15,
+	6, 64, 3, 11, 14, 1, 64, 3, 3, 15, 8, 65, 3, 8, 15, 3, 65, 3, 1, 14, 11, 66, 3, 6,
+	15, 4, 67, 1, 4, 0, 0, 0, 0, 1, 1, 2, 0, 3, 4, 15, 5, 1, 2, 12, 12, 1, 3, 5,
+	15, 7, 2, 3, 10, 14, 1, 2, 3, 3, 15, 9, 3, 3, 8, 15, 3, 3, 3, 1, 14, 11, 4, 3,
+	6, 15, 5, 5, 2, 12, 13, 5, 3, 4, 15, 7, 6, 3, 10, 15, 2, 6, 3, 2, 15, 9, 7, 3,
+	8, 15, 4, 8, 2, 13, 11, 8, 3, 6, 15, 6, 9, 2, 11, 13, 9, 3, 4, 15, 8, 10, 3, 9,
+	15, 2, 10, 3, 2, 15, 10, 11, 3, 7, 15, 4, 12, 2, 13, 12, 12, 3, 5, 15, 6, 13, 3, 11,
+	14, 1, 13, 3, 3, 15, 8, 14, 3, 9, 15, 3, 14, 3, 1, 14, 10, 15, 3, 7, 15, 5, 16, 2,
+	12, 12, 16, 3, 5, 15, 7, 17, 3, 10, 14, 1, 17, 3, 3, 15, 9, 18, 3, 8, 15, 3, 18, 3,
+	1, 14, 11, 19, 3, 6, 15, 5, 20, 2, 12, 13, 20, 3, 4, 15, 7, 21, 3, 10, 15, 2, 21, 3,
+	2, 15, 9, 22, 3, 8, 15, 4, 23, 2, 13, 11, 23, 3, 6, 15, 6, 24, 2, 11, 13, 24, 3, 4,
+	15, 8, 25, 3, 9, 15, 2, 25, 3, 2, 15, 10, 26, 3, 7, 15, 4, 27, 2, 13, 12, 27, 3, 5,
+	15, 6, 28, 3, 11, 14, 1, 28, 3, 3, 15, 8, 29, 3, 9, 15, 3, 29, 3, 1, 14, 10, 30, 3,
+	7, 15, 5, 31, 2, 12, 12, 31, 3, 5, 15, 7, 32, 3, 10, 14, 1, 32, 3, 3, 15, 9, 33, 3,
+	8, 15, 3, 33, 3, 1, 14, 11, 34, 3, 6, 15, 5, 35, 2, 12, 13, 35, 3, 4, 15, 7, 36, 3,
+	10, 15, 2, 36, 3, 2, 15, 9, 37, 3, 8, 15, 4, 38, 2, 13, 11, 38, 3, 6, 15, 6, 39, 3,
+	11, 14, 1, 39, 3, 4, 15, 8, 40, 3, 9, 15, 3, 40, 3, 1, 14, 10, 41, 3, 7, 15, 5, 42,
+	2, 12, 12, 42, 3, 5, 15, 7, 43, 3, 10, 14, 1, 43, 3, 3, 15, 9, 44, 3, 8, 15, 3, 44,
+	3, 1, 14, 11, 45, 3, 6, 15, 5, 46, 2, 12, 13, 46, 3, 4, 15, 7, 47, 3, 10, 15, 2, 47,
+	3, 2, 15, 9, 48, 3, 8, 15, 4, 49, 2, 13, 11, 49, 3, 6, 15, 6, 50, 2, 11, 13, 50, 3,
+	4, 15, 8, 51, 3, 9, 15, 2, 51, 3, 2, 15, 10, 52, 3, 7, 15, 4, 53, 2, 13, 12, 53, 3,
+	5, 15, 6, 54, 3, 11, 14, 1, 54, 3, 3, 15, 8, 55, 3, 9, 15, 3, 55, 3, 1, 14, 10, 56,
+	3, 7, 15, 5, 57, 2, 12, 12, 57, 3, 5, 15, 7, 58, 3, 10, 14, 1, 58, 3, 3, 15, 9, 59,
+	3, 8, 15, 3, 59, 3, 1, 14, 11, 60, 3, 6, 15, 5, 61, 2, 12, 13, 61, 3, 4, 15, 7, 62,
+	3, 10, 15, 2, 62, 3, 2, 15, 9, 63, 3, 8, 15, 4, 64, 2, 13, 11, 64, 3, 6, 15, 4, 65,
+	1, 4, 0, 0, 0, 0, 1, 1, 3, 0, 3, 5, 15, 5, 1, 2, 13, 12, 1, 3, 5, 15, 6, 2,
+	2, 11, 13, 2, 3, 4, 15, 7, 3, 3, 10, 15, 2, 3, 3, 2, 15, 9, 4, 3, 8, 15, 3, 4,
+	3, 1, 14, 10, 5, 3, 7, 15, 4, 6, 2, 13, 12, 6, 3, 5, 15, 6, 7, 2, 11, 13, 7, 3,
+	4, 15, 7, 8, 3, 10, 15, 1, 8, 3, 3, 15, 9, 9, 3, 8, 15, 3, 9, 3, 1, 14, 10, 10,
+	3, 7, 15, 4, 11, 2, 13, 12, 11, 3, 6, 15, 6, 12, 2, 11, 13, 12, 3, 4, 15, 7, 13, 3,
+	10, 14, 1, 13, 3, 3, 15, 9, 14, 3, 9, 15, 3, 14, 3, 1, 14, 10, 15, 3, 7, 15, 4, 16,
+	2, 13, 11, 16, 3, 6, 15, 6, 17, 2, 12, 13, 17, 3, 4, 15, 7, 18, 3, 10, 14, 1, 18, 3,
+	3, 15, 8, 19, 3, 9, 15, 3, 19, 3, 1, 15, 10, 20, 3, 7, 15, 4, 21, 2, 13, 11, 21, 3,
+	6, 15, 5, 22, 2, 12, 13, 22, 3, 4, 15, 7, 23, 3, 10, 14, 1, 23, 3, 3, 15, 8, 24, 3,
+	9, 15, 2, 24, 3, 2, 15, 10, 25, 3, 7, 15, 4, 26, 2, 13, 11, 26, 3, 6, 15, 5, 27, 2,
+	12, 13, 27, 3, 5, 15, 7, 28, 3, 10, 14, 1, 28, 3, 3, 15, 8, 29, 3, 9, 15, 2, 29, 3,
+	2, 15, 10, 30, 3, 8, 15, 4, 31, 2, 13, 11, 31, 3, 6, 15, 5, 32, 2, 12, 12, 32, 3, 5,
+	15, 7, 33, 3, 11, 14, 1, 33, 3, 3, 15, 8, 34, 3, 9, 15, 2, 34, 3, 2, 15, 9, 35, 3,
+	8, 15, 4, 36, 2, 14, 11, 36, 3, 6, 15, 5, 37, 2, 12, 12, 37, 3, 5, 15, 6, 38, 3, 11,
+	14, 1, 38, 3, 3, 15, 8, 39, 3, 9, 15, 2, 39, 3, 2, 15, 9, 40, 3, 8, 15, 3, 40, 3,
+	1, 14, 11, 41, 3, 6, 15, 5, 42, 2, 12, 12, 42, 3, 5, 15, 6, 43, 2, 11, 13, 43, 3, 4,
+	15, 8, 44, 3, 9, 15, 2, 44, 3, 2, 15, 9, 45, 3, 8, 15, 3, 45, 3, 1, 14, 10, 46, 3,
+	7, 15, 5, 47, 2, 12, 12, 47, 3, 5, 15, 6, 48, 2, 11, 13, 48, 3, 4, 15, 7, 49, 3, 10,
+	15, 2, 49, 3, 2, 15, 9, 50, 3, 8, 15, 3, 50, 3, 1, 14, 10, 51, 3, 7, 15, 5, 52, 2,
+	13, 12, 52, 3, 5, 15, 6, 53, 2, 11, 13, 53, 3, 4, 15, 7, 54, 3, 10, 15, 2, 54, 3, 2,
+	15, 9, 55, 3, 8, 15, 3, 55, 3, 1, 14, 10, 56, 3, 7, 15, 4, 57, 2, 13, 12, 57, 3, 5,
+	15, 6, 58, 2, 11, 13, 58, 3, 4, 15, 7, 59, 3, 10, 14, 1, 59, 3, 3, 15, 9, 60, 3, 8,
+	15, 3, 60, 3, 1, 14, 10, 61, 3, 7, 15, 4, 62, 2, 13, 11, 62, 3, 6, 15, 4, 63, 1, 4,
+	0, 0, 0, 0, 1, 1, 4, 0, 3, 5, 15, 4, 1, 2, 13, 11, 1, 3, 6, 15, 5, 2, 2, 12,
+	12, 2, 3, 5, 15, 6, 3, 2, 11, 13, 3, 3, 4, 15, 7, 4, 3, 10, 14, 1, 4, 3, 3, 15,
+	8, 5, 3, 9, 15, 2, 5, 3, 2, 15, 9, 6, 3, 9, 15, 2, 6, 3, 2, 15, 9, 7, 3, 8,
+	15, 3, 7, 3, 1, 14, 10, 8, 3, 7, 15, 4, 9, 2, 13, 11, 9, 3, 6, 15, 5, 10, 2, 12,
+	12, 10, 3, 5, 15, 6, 11, 2, 11, 13, 11, 3, 4, 15, 7, 12, 2, 11, 14, 12, 3, 4, 15, 7,
+	13, 3, 10, 14, 1, 13, 3, 3, 15, 8, 14, 3, 9, 15, 2, 14, 3, 2, 15, 9, 15, 3, 8, 15,
+	3, 15, 3, 1, 14, 10, 16, 3, 7, 15, 4, 17, 2, 13, 11, 17, 3, 6, 15, 5, 18, 2, 13, 12,
+	18, 3, 6, 15, 5, 19, 2, 12, 12, 19, 3, 5, 15, 6, 20, 2, 11, 13, 20, 3, 4, 15, 7, 21,
+	3, 10, 14, 1, 21, 3, 3, 15, 8, 22, 3, 9, 15, 2, 22, 3, 2, 15, 9, 23, 3, 8, 15, 3,
+	23, 3, 1, 15, 10, 24, 3, 8, 15, 3, 24, 3, 1, 14, 10, 25, 3, 7, 15, 4, 26, 2, 13, 11,
+	26, 3, 6, 15, 5, 27, 2, 12, 12, 27, 3, 5, 15, 6, 28, 2, 11, 13, 28, 3, 4, 15, 7, 29,
+	3, 10, 14, 1, 29, 3, 3, 15, 8, 30, 3, 10, 15, 1, 30, 3, 3, 15, 8, 31, 3, 9, 15, 2,
+	31, 3, 2, 15, 9, 32, 3, 8, 15, 3, 32, 3, 1, 14, 10, 33, 3, 7, 15, 4, 34, 2, 13, 11,
+	34, 3, 6, 15, 5, 35, 2, 12, 12, 35, 3, 5, 15, 6, 36, 2, 12, 13, 36, 3, 5, 15, 6, 37,
+	2, 11, 14, 37, 3, 4, 15, 7, 38, 3, 10, 14, 1, 38, 3, 3, 15, 8, 39, 3, 9, 15, 2, 39,
+	3, 2, 15, 9, 40, 3, 8, 15, 3, 40, 3, 1, 14, 10, 41, 3, 7, 15, 4, 42, 2, 14, 11, 42,
+	3, 7, 15, 4, 43, 2, 13, 12, 43, 3, 6, 15, 5, 44, 2, 12, 12, 44, 3, 5, 15, 6, 45, 2,
+	11, 13, 45, 3, 4, 15, 7, 46, 3, 10, 14, 1, 46, 3, 3, 15, 8, 47, 3, 9, 15, 2, 47, 3,
+	2, 15, 9, 48, 3, 9, 15, 2, 48, 3, 2, 15, 10, 49, 3, 8, 15, 3, 49, 3, 1, 14, 10, 50,
+	3, 7, 15, 4, 51, 2, 13, 11, 51, 3, 6, 15, 5, 52, 2, 12, 12, 52, 3, 5, 15, 6, 53, 2,
+	11, 13, 53, 3, 4, 15, 7, 54, 2, 11, 14, 54, 3, 4, 15, 8, 55, 3, 10, 15, 1, 55, 3, 3,
+	15, 8, 56, 3, 9, 15, 2, 56, 3, 2, 15, 9, 57, 3, 8, 15, 3, 57, 3, 1, 14, 10, 58, 3,
+	7, 15, 4, 59, 2, 13, 11, 59, 3, 6, 15, 5, 60, 2, 13, 12, 60, 3, 6, 15, 4, 61, 1, 4,
+	0, 0, 0, 0, 1, 1, 4, 0, 3, 5, 15, 4, 1, 2, 13, 11, 1, 3, 6, 15, 4, 2, 2, 13,
+	11, 2, 3, 6, 15, 5, 3, 2, 13, 12, 3, 3, 6, 15, 5, 4, 2, 12, 12, 4, 3, 6, 15, 5,
+	5, 2, 12, 12, 5, 3, 5, 15, 6, 6, 2, 12, 12, 6, 3, 5, 15, 6, 7, 2, 12, 13, 7, 3,
+	5, 15, 6, 8, 2, 11, 13, 8, 3, 4, 15, 6, 9, 2, 11, 13, 9, 3, 4, 15, 7, 10, 2, 11,
+	13, 10, 3, 4, 15, 7, 11, 2, 11, 14, 11, 3, 4, 15, 7, 12, 2, 10, 14, 12, 3, 3, 15, 7,
+	13, 3, 10, 14, 1, 13, 3, 3, 15, 8, 14, 3, 10, 14, 1, 14, 3, 3, 15, 8, 15, 3, 10, 15,
+	1, 15, 3, 3, 15, 8, 16, 3, 9, 15, 2, 16, 3, 2, 15, 8, 17, 3, 9, 15, 2, 17, 3, 2,
+	15, 9, 18, 3, 9, 15, 2, 18, 3, 2, 15, 9, 19, 3, 9, 15, 2, 19, 3, 2, 15, 9, 20, 3,
+	8, 15, 3, 20, 3, 1, 15, 9, 21, 3, 8, 15, 3, 21, 3, 1, 15, 10, 22, 3, 8, 15, 3, 22,
+	3, 1, 14, 10, 23, 3, 7, 15, 3, 23, 3, 1, 14, 10, 24, 3, 7, 15, 4, 25, 2, 14, 10, 25,
+	3, 7, 15, 4, 26, 2, 14, 11, 26, 3, 7, 15, 4, 27, 2, 13, 11, 27, 3, 6, 15, 4, 28, 2,
+	13, 11, 28, 3, 6, 15, 5, 29, 2, 13, 11, 29, 3, 6, 15, 5, 30, 2, 13, 12, 30, 3, 6, 15,
+	5, 31, 2, 12, 12, 31, 3, 5, 15, 5, 32, 2, 12, 12, 32, 3, 5, 15, 6, 33, 2, 12, 12, 33,
+	3, 5, 15, 6, 34, 2, 11, 13, 34, 3, 5, 15, 6, 35, 2, 11, 13, 35, 3, 4, 15, 6, 36, 2,
+	11, 13, 36, 3, 4, 15, 7, 37, 2, 11, 13, 37, 3, 4, 15, 7, 38, 2, 10, 14, 38, 3, 4, 15,
+	7, 39, 3, 10, 14, 1, 39, 3, 3, 15, 7, 40, 3, 10, 14, 1, 40, 3, 3, 15, 8, 41, 3, 10,
+	14, 1, 41, 3, 3, 15, 8, 42, 3, 9, 15, 1, 42, 3, 3, 15, 8, 43, 3, 9, 15, 2, 43, 3,
+	2, 15, 8, 44, 3, 9, 15, 2, 44, 3, 2, 15, 9, 45, 3, 9, 15, 2, 45, 3, 2, 15, 9, 46,
+	3, 8, 15, 2, 46, 3, 2, 15, 9, 47, 3, 8, 15, 3, 47, 3, 1, 15, 9, 48, 3, 8, 15, 3,
+	48, 3, 1, 14, 10, 49, 3, 8, 15, 3, 49, 3, 1, 14, 10, 50, 3, 7, 15, 3, 50, 3, 1, 14,
+	10, 51, 3, 7, 15, 4, 52, 2, 14, 10, 52, 3, 7, 15, 4, 53, 2, 13, 11, 53, 3, 7, 15, 4,
+	54, 2, 13, 11, 54, 3, 6, 15, 4, 55, 2, 13, 11, 55, 3, 6, 15, 5, 56, 2, 13, 11, 56, 3,
+	6, 15, 5, 57, 2, 12, 12, 57, 3, 6, 15, 5, 58, 2, 12, 12, 58, 3, 5, 15, 4, 59, 1, 4,
+	0, 0, 0, 0, 1, 1, 4, 0, 3, 5, 15, 4, 1, 2, 13, 11, 1, 3, 7, 15, 4, 2, 2, 14,
+	10, 2, 3, 7, 15, 3, 2, 3, 1, 14, 10, 3, 3, 7, 15, 3, 3, 3, 1, 14, 10, 4, 3, 8,
+	15, 3, 4, 3, 1, 15, 9, 5, 3, 8, 15, 2, 5, 3, 2, 15, 9, 6, 3, 8, 15, 2, 6, 3,
+	2, 15, 9, 7, 3, 9, 15, 2, 7, 3, 2, 15, 8, 8, 3, 9, 15, 1, 8, 3, 3, 15, 8, 9,
+	3, 9, 15, 1, 9, 3, 3, 15, 8, 10, 3, 10, 14, 1, 10, 3, 3, 15, 7, 11, 2, 10, 14, 11,
+	3, 4, 15, 7, 12, 2, 10, 14, 12, 3, 4, 15, 7, 13, 2, 11, 13, 13, 3, 4, 15, 6, 14, 2,
+	11, 13, 14, 3, 5, 15, 6, 15, 2, 11, 13, 15, 3, 5, 15, 6, 16, 2, 12, 12, 16, 3, 5, 15,
+	5, 17, 2, 12, 12, 17, 3, 6, 15, 5, 18, 2, 12, 12, 18, 3, 6, 15, 5, 19, 2, 13, 11, 19,
+	3, 6, 15, 4, 20, 2, 13, 11, 20, 3, 7, 15, 4, 21, 2, 13, 11, 21, 3, 7, 15, 4, 22, 2,
+	14, 10, 22, 3, 7, 15, 3, 22, 3, 1, 14, 10, 23, 3, 8, 15, 3, 23, 3, 1, 14, 10, 24, 3,
+	8, 15, 3, 24, 3, 1, 15, 9, 25, 3, 8, 15, 2, 25, 3, 2, 15, 9, 26, 3, 8, 15, 2, 26,
+	3, 2, 15, 9, 27, 3, 9, 15, 2, 27, 3, 2, 15, 8, 28, 3, 9, 15, 1, 28, 3, 3, 15, 8,
+	29, 3, 9, 15, 1, 29, 3, 3, 15, 8, 30, 3, 10, 14, 1, 30, 3, 3, 15, 7, 31, 2, 10, 14,
+	31, 3, 4, 15, 7, 32, 2, 10, 14, 32, 3, 4, 15, 7, 33, 2, 11, 13, 33, 3, 4, 15, 6, 34,
+	2, 11, 13, 34, 3, 5, 15, 6, 35, 2, 11, 13, 35, 3, 5, 15, 6, 36, 2, 12, 12, 36, 3, 5,
+	15, 5, 37, 2, 12, 12, 37, 3, 6, 15, 5, 38, 2, 12, 12, 38, 3, 6, 15, 5, 39, 2, 13, 11,
+	39, 3, 6, 15, 4, 40, 2, 13, 11, 40, 3, 7, 15, 4, 41, 2, 13, 11, 41, 3, 7, 15, 4, 42,
+	2, 14, 10, 42, 3, 7, 15, 3, 42, 3, 1, 14, 10, 43, 3, 8, 15, 3, 43, 3, 1, 14, 10, 44,
+	3, 8, 15, 3, 44, 3, 1, 15, 9, 45, 3, 8, 15, 2, 45, 3, 2, 15, 9, 46, 3, 9, 15, 2,
+	46, 3, 2, 15, 9, 47, 3, 9, 15, 2, 47, 3, 2, 15, 8, 48, 3, 9, 15, 1, 48, 3, 3, 15,
+	8, 49, 3, 10, 14, 1, 49, 3, 3, 15, 8, 50, 3, 10, 14, 1, 50, 3, 3, 15, 7, 51, 2, 10,
+	14, 51, 3, 4, 15, 7, 52, 2, 11, 13, 52, 3, 4, 15, 7, 53, 2, 11, 13, 53, 3, 4, 15, 6,
+	54, 2, 11, 13, 54, 3, 5, 15, 6, 55, 2, 12, 13, 55, 3, 5, 15, 6, 56, 2, 12, 12, 56, 3,
+	5, 15, 4, 57, 1, 4, 0, 0, 0, 0, 1, 1, 4, 0, 3, 5, 15, 4, 1, 2, 14, 10, 1, 3,
+	7, 15, 3, 1, 3, 1, 15, 9, 2, 3, 8, 15, 2, 2, 3, 2, 15, 8, 3, 3, 9, 15, 1, 3,
+	3, 3, 15, 7, 4, 2, 10, 14, 4, 3, 4, 15, 7, 5, 2, 11, 13, 5, 3, 5, 15, 6, 6, 2,
+	12, 12, 6, 3, 6, 15, 5, 7, 2, 13, 11, 7, 3, 6, 15, 4, 8, 2, 14, 10, 8, 3, 7, 15,
+	3, 8, 3, 1, 15, 9, 9, 3, 8, 15, 2, 9, 3, 2, 15, 8, 10, 3, 9, 15, 1, 10, 3, 3,
+	15, 7, 11, 2, 10, 14, 11, 3, 4, 15, 7, 12, 2, 11, 13, 12, 3, 5, 15, 6, 13, 2, 12, 12,
+	13, 3, 6, 15, 5, 14, 2, 13, 11, 14, 3, 7, 15, 4, 15, 2, 14, 10, 15, 3, 7, 15, 3, 15,
+	3, 1, 15, 9, 16, 3, 8, 15, 2, 16, 3, 2, 15, 8, 17, 3, 9, 15, 1, 17, 3, 3, 15, 7,
+	18, 2, 10, 14, 18, 3, 4, 15, 6, 19, 2, 11, 13, 19, 3, 5, 15, 6, 20, 2, 12, 12, 20, 3,
+	6, 15, 5, 21, 2, 13, 11, 21, 3, 7, 15, 4, 22, 2, 14, 10, 22, 3, 8, 15, 3, 22, 3, 1,
+	15, 9, 23, 3, 8, 15, 2, 23, 3, 2, 15, 8, 24, 3, 9, 15, 1, 24, 3, 3, 15, 7, 25, 2,
+	10, 14, 25, 3, 4, 15, 6, 26, 2, 11, 13, 26, 3, 5, 15, 5, 27, 2, 12, 12, 27, 3, 6, 15,
+	5, 28, 2, 13, 11, 28, 3, 7, 15, 4, 29, 2, 14, 10, 29, 3, 8, 15, 3, 29, 3, 1, 15, 9,
+	30, 3, 9, 15, 2, 30, 3, 2, 15, 8, 31, 3, 9, 14, 1, 31, 3, 3, 15, 7, 32, 2, 10, 14,
+	32, 3, 4, 15, 6, 33, 2, 11, 13, 33, 3, 5, 15, 5, 34, 2, 12, 12, 34, 3, 6, 15, 4, 35,
+	2, 13, 11, 35, 3, 7, 15, 4, 36, 2, 14, 10, 36, 3, 8, 15, 3, 36, 3, 1, 15, 9, 37, 3,
+	9, 15, 2, 37, 3, 2, 15, 8, 38, 3, 10, 14, 1, 38, 3, 3, 15, 7, 39, 2, 10, 13, 39, 3,
+	4, 15, 6, 40, 2, 11, 13, 40, 3, 5, 15, 5, 41, 2, 12, 12, 41, 3, 6, 15, 4, 42, 2, 13,
+	11, 42, 3, 7, 15, 3, 42, 3, 1, 14, 10, 43, 3, 8, 15, 3, 43, 3, 1, 15, 9, 44, 3, 9,
+	15, 2, 44, 3, 2, 15, 8, 45, 3, 10, 14, 1, 45, 3, 3, 15, 7, 46, 2, 11, 13, 46, 3, 4,
+	15, 6, 47, 2, 11, 12, 47, 3, 5, 15, 5, 48, 2, 12, 12, 48, 3, 6, 15, 4, 49, 2, 13, 11,
+	49, 3, 7, 15, 3, 49, 3, 1, 14, 10, 50, 3, 8, 15, 2, 50, 3, 1, 15, 9, 51, 3, 9, 15,
+	2, 51, 3, 2, 15, 8, 52, 3, 10, 14, 1, 52, 3, 3, 15, 7, 53, 2, 11, 13, 53, 3, 4, 15,
+	6, 54, 2, 11, 12, 54, 3, 5, 15, 4, 55, 1, 4, 0, 0, 0, 0, 1, 1, 3, 0, 3, 5, 15,
+	4, 1, 2, 14, 10, 1, 3, 8, 15, 2, 1, 3, 2, 15, 8, 2, 3, 9, 14, 1, 2, 3, 3, 15,
+	7, 3, 2, 11, 13, 3, 3, 5, 15, 5, 4, 2, 12, 11, 4, 3, 6, 15, 4, 5, 2, 14, 10, 5,
+	3, 8, 15, 2, 5, 3, 2, 15, 8, 6, 3, 9, 15, 1, 6, 3, 3, 15, 7, 7, 2, 11, 13, 7,
+	3, 5, 15, 5, 8, 2, 12, 12, 8, 3, 6, 15, 4, 9, 2, 14, 10, 9, 3, 8, 15, 2, 9, 3,
+	2, 15, 9, 10, 3, 9, 15, 1, 10, 3, 3, 15, 7, 11, 2, 11, 13, 11, 3, 5, 15, 6, 12, 2,
+	12, 12, 12, 3, 6, 15, 4, 13, 2, 14, 10, 13, 3, 8, 15, 3, 13, 3, 1, 15, 9, 14, 3, 9,
+	15, 1, 14, 3, 3, 15, 7, 15, 2, 11, 13, 15, 3, 4, 15, 6, 16, 2, 12, 12, 16, 3, 6, 15,
+	4, 17, 2, 14, 10, 17, 3, 7, 15, 3, 17, 3, 1, 15, 9, 18, 3, 9, 15, 1, 18, 3, 3, 15,
+	7, 19, 2, 10, 13, 19, 3, 4, 15, 6, 20, 2, 12, 12, 20, 3, 6, 15, 4, 21, 2, 13, 10, 21,
+	3, 7, 15, 3, 21, 3, 1, 15, 9, 22, 3, 9, 15, 1, 22, 3, 3, 15, 7, 23, 2, 10, 13, 23,
+	3, 4, 15, 6, 24, 2, 12, 12, 24, 3, 6, 15, 4, 25, 2, 13, 10, 25, 3, 7, 15, 3, 25, 3,
+	1, 15, 9, 26, 3, 9, 15, 1, 26, 3, 3, 15, 7, 27, 2, 10, 14, 27, 3, 4, 15, 6, 28, 2,
+	12, 12, 28, 3, 6, 15, 4, 29, 2, 13, 11, 29, 3, 7, 15, 3, 29, 3, 1, 15, 9, 30, 3, 9,
+	15, 1, 30, 3, 3, 15, 8, 31, 2, 10, 14, 31, 3, 4, 15, 6, 32, 2, 12, 12, 32, 3, 6, 15,
+	5, 33, 2, 13, 11, 33, 3, 7, 15, 3, 33, 3, 1, 15, 9, 34, 3, 9, 15, 2, 34, 3, 2, 15,
+	8, 35, 2, 10, 14, 35, 3, 4, 15, 6, 36, 2, 12, 12, 36, 3, 5, 15, 5, 37, 2, 13, 11, 37,
+	3, 7, 15, 3, 37, 3, 1, 15, 9, 38, 3, 8, 15, 2, 38, 3, 2, 15, 8, 39, 2, 10, 14, 39,
+	3, 4, 15, 6, 40, 2, 11, 12, 40, 3, 5, 15, 5, 41, 2, 13, 11, 41, 3, 7, 15, 3, 41, 3,
+	1, 14, 9, 42, 3, 8, 15, 2, 42, 3, 2, 15, 8, 43, 2, 10, 14, 43, 3, 4, 15, 6, 44, 2,
+	11, 12, 44, 3, 5, 15, 5, 45, 2, 13, 11, 45, 3, 7, 15, 3, 45, 3, 1, 14, 9, 46, 3, 8,
+	15, 2, 46, 3, 2, 15, 8, 47, 2, 10, 14, 47, 3, 4, 15, 6, 48, 2, 11, 13, 48, 3, 5, 15,
+	5, 49, 2, 13, 11, 49, 3, 7, 15, 3, 49, 3, 1, 14, 10, 50, 3, 8, 15, 2, 50, 3, 2, 15,
+	8, 51, 2, 10, 14, 51, 3, 4, 15, 7, 52, 2, 11, 13, 52, 3, 5, 15, 4, 53, 1, 4, 0, 0,
+	0, 0, 1, 1, 1, 0, 3, 4, 15, 4, 1, 2, 14, 10, 1, 3, 8, 15, 2, 1, 3, 2, 15, 8,
+	2, 2, 10, 13, 2, 3, 4, 15, 5, 3, 2, 12, 11, 3, 3, 7, 15, 3, 3, 3, 1, 15, 9, 4,
+	3, 9, 15, 1, 4, 3, 3, 15, 7, 5, 2, 11, 13, 5, 3, 5, 15, 5, 6, 2, 13, 11, 6, 3,
+	7, 15, 3, 6, 3, 1, 15, 9, 7, 3, 9, 15, 1, 7, 3, 3, 15, 7, 8, 2, 11, 13, 8, 3,
+	5, 15, 5, 9, 2, 13, 10, 9, 3, 7, 15, 3, 9, 3, 1, 15, 8, 10, 2, 9, 14, 10, 3, 4,
+	15, 6, 11, 2, 12, 12, 11, 3, 6, 15, 4, 12, 2, 14, 10, 12, 3, 8, 15, 2, 12, 3, 2, 15,
+	8, 13, 2, 10, 14, 13, 3, 4, 15, 6, 14, 2, 12, 12, 14, 3, 6, 15, 4, 15, 2, 14, 10, 15,
+	3, 8, 15, 2, 15, 3, 2, 15, 8, 16, 2, 10, 13, 16, 3, 4, 15, 6, 17, 2, 12, 11, 17, 3,
+	6, 15, 3, 17, 3, 1, 14, 9, 18, 3, 9, 15, 1, 18, 3, 3, 15, 7, 19, 2, 11, 13, 19, 3,
+	5, 15, 5, 20, 2, 13, 11, 20, 3, 7, 15, 3, 20, 3, 1, 15, 9, 21, 3, 9, 15, 1, 21, 3,
+	3, 15, 7, 22, 2, 11, 13, 22, 3, 5, 15, 5, 23, 2, 13, 11, 23, 3, 7, 15, 3, 23, 3, 1,
+	15, 9, 24, 3, 9, 14, 1, 24, 3, 3, 15, 6, 25, 2, 11, 12, 25, 3, 6, 15, 4, 26, 2, 13,
+	10, 26, 3, 8, 15, 2, 26, 3, 2, 15, 8, 27, 2, 10, 14, 27, 3, 4, 15, 6, 28, 2, 12, 12,
+	28, 3, 6, 15, 4, 29, 2, 14, 10, 29, 3, 8, 15, 2, 29, 3, 2, 15, 8, 30, 2, 10, 14, 30,
+	3, 4, 15, 6, 31, 2, 12, 11, 31, 3, 6, 15, 4, 32, 2, 14, 9, 32, 3, 8, 15, 1, 32, 3,
+	3, 15, 7, 33, 2, 11, 13, 33, 3, 5, 15, 5, 34, 2, 13, 11, 34, 3, 7, 15, 3, 34, 3, 1,
+	15, 9, 35, 3, 9, 15, 1, 35, 3, 3, 15, 7, 36, 2, 11, 13, 36, 3, 5, 15, 5, 37, 2, 13,
+	11, 37, 3, 7, 15, 3, 37, 3, 1, 15, 9, 38, 3, 9, 14, 1, 38, 3, 3, 15, 7, 39, 2, 11,
+	12, 39, 3, 5, 15, 4, 40, 2, 13, 10, 40, 3, 8, 15, 2, 40, 3, 2, 15, 8, 41, 2, 10, 14,
+	41, 3, 4, 15, 6, 42, 2, 12, 12, 42, 3, 6, 15, 4, 43, 2, 14, 10, 43, 3, 8, 15, 2, 43,
+	3, 2, 15, 8, 44, 2, 10, 14, 44, 3, 4, 15, 6, 45, 2, 12, 12, 45, 3, 6, 15, 4, 46, 2,
+	14, 10, 46, 3, 8, 15, 2, 46, 3, 2, 15, 7, 47, 2, 10, 13, 47, 3, 5, 15, 5, 48, 2, 12,
+	11, 48, 3, 7, 15, 3, 48, 3, 1, 15, 9, 49, 3, 9, 15, 1, 49, 3, 3, 15, 7, 50, 2, 11,
+	13, 50, 3, 5, 15, 4, 51, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 2, 14, 4, 1, 2, 14, 9,
+	1, 3, 9, 15, 1, 1, 3, 3, 15, 7, 2, 2, 11, 12, 2, 3, 6, 15, 4, 3, 2, 14, 10, 3,
+	3, 8, 15, 1, 3, 3, 3, 15, 7, 4, 2, 11, 13, 4, 3, 5, 15, 4, 5, 2, 14, 10, 5, 3,
+	8, 15, 2, 5, 3, 2, 15, 7, 6, 2, 11, 13, 6, 3, 5, 15, 5, 7, 2, 13, 10, 7, 3, 8,
+	15, 2, 7, 3, 2, 15, 8, 8, 2, 10, 13, 8, 3, 5, 15, 5, 9, 2, 13, 10, 9, 3, 7, 15,
+	2, 9, 3, 2, 15, 8, 10, 2, 10, 13, 10, 3, 5, 15, 5, 11, 2, 13, 11, 11, 3, 7, 15, 2,
+	11, 3, 2, 15, 8, 12, 2, 10, 14, 12, 3, 4, 15, 5, 13, 2, 13, 11, 13, 3, 7, 15, 3, 13,
+	3, 1, 15, 8, 14, 2, 10, 14, 14, 3, 4, 15, 6, 15, 2, 12, 11, 15, 3, 7, 15, 3, 15, 3,
+	1, 15, 9, 16, 2, 9, 14, 16, 3, 4, 15, 6, 17, 2, 12, 12, 17, 3, 6, 15, 3, 17, 3, 1,
+	15, 9, 18, 3, 9, 15, 1, 18, 3, 3, 15, 6, 19, 2, 12, 12, 19, 3, 6, 15, 4, 20, 2, 14,
+	9, 20, 3, 9, 15, 1, 20, 3, 3, 15, 7, 21, 2, 11, 12, 21, 3, 6, 15, 4, 22, 2, 14, 9,
+	22, 3, 8, 15, 1, 22, 3, 3, 15, 7, 23, 2, 11, 12, 23, 3, 6, 15, 4, 24, 2, 14, 10, 24,
+	3, 8, 15, 1, 24, 3, 3, 15, 7, 25, 2, 11, 13, 25, 3, 5, 15, 4, 26, 2, 14, 10, 26, 3,
+	8, 15, 2, 26, 3, 2, 15, 7, 27, 2, 11, 13, 27, 3, 5, 15, 5, 28, 2, 13, 10, 28, 3, 8,
+	15, 2, 28, 3, 2, 15, 8, 29, 2, 10, 13, 29, 3, 5, 15, 5, 30, 2, 13, 11, 30, 3, 7, 15,
+	2, 30, 3, 2, 15, 8, 31, 2, 10, 14, 31, 3, 4, 15, 5, 32, 2, 13, 11, 32, 3, 7, 15, 3,
+	32, 3, 1, 15, 8, 33, 2, 10, 14, 33, 3, 4, 15, 6, 34, 2, 12, 11, 34, 3, 7, 15, 3, 34,
+	3, 1, 15, 9, 35, 2, 9, 14, 35, 3, 4, 15, 6, 36, 2, 12, 11, 36, 3, 7, 15, 3, 36, 3,
+	1, 15, 9, 37, 2, 9, 14, 37, 3, 4, 15, 6, 38, 2, 12, 12, 38, 3, 6, 15, 3, 38, 3, 1,
+	15, 9, 39, 3, 9, 15, 1, 39, 3, 3, 15, 6, 40, 2, 12, 12, 40, 3, 6, 15, 4, 41, 2, 14,
+	9, 41, 3, 9, 15, 1, 41, 3, 3, 15, 7, 42, 2, 11, 12, 42, 3, 6, 15, 4, 43, 2, 14, 10,
+	43, 3, 8, 15, 1, 43, 3, 3, 15, 7, 44, 2, 11, 13, 44, 3, 5, 15, 4, 45, 2, 14, 10, 45,
+	3, 8, 15, 2, 45, 3, 2, 15, 7, 46, 2, 11, 13, 46, 3, 5, 15, 5, 47, 2, 13, 10, 47, 3,
+	8, 15, 2, 47, 3, 2, 15, 8, 48, 2, 10, 13, 48, 3, 5, 15, 4, 49, 1, 4, 0, 0, 0, 0,
+	0, 0, 0, 2, 11, 4, 0, 2, 14, 9, 0, 3, 9, 15, 1, 0, 3, 4, 15, 6, 1, 2, 12, 11,
+	1, 3, 7, 15, 3, 1, 3, 1, 15, 8, 2, 2, 10, 13, 2, 3, 5, 15, 5, 3, 2, 13, 10, 3,
+	3, 8, 15, 2, 3, 3, 3, 15, 7, 4, 2, 11, 12, 4, 3, 6, 15, 4, 5, 2, 14, 9, 5, 2,
+	9, 14, 5, 3, 4, 15, 6, 6, 2, 12, 11, 6, 3, 7, 15, 3, 6, 3, 2, 15, 8, 7, 2, 10,
+	13, 7, 3, 5, 15, 5, 8, 2, 13, 10, 8, 3, 8, 15, 1, 8, 3, 3, 15, 7, 9, 2, 11, 12,
+	9, 3, 6, 15, 4, 9, 3, 1, 15, 9, 10, 2, 9, 14, 10, 3, 4, 15, 6, 11, 2, 12, 11, 11,
+	3, 7, 15, 2, 11, 3, 2, 15, 8, 12, 2, 10, 13, 12, 3, 5, 15, 5, 13, 2, 14, 10, 13, 3,
+	8, 15, 1, 13, 3, 3, 15, 7, 14, 2, 11, 12, 14, 3, 6, 15, 3, 14, 3, 1, 15, 9, 15, 2,
+	9, 14, 15, 3, 4, 15, 6, 16, 2, 13, 11, 16, 3, 7, 15, 2, 16, 3, 2, 15, 8, 17, 2, 10,
+	13, 17, 3, 5, 15, 4, 18, 2, 14, 10, 18, 3, 8, 15, 1, 18, 3, 3, 15, 7, 19, 2, 12, 12,
+	19, 3, 6, 15, 3, 19, 3, 1, 15, 9, 20, 2, 9, 14, 20, 3, 4, 15, 5, 21, 2, 13, 11, 21,
+	3, 7, 15, 2, 21, 3, 2, 15, 8, 22, 2, 11, 13, 22, 3, 5, 15, 4, 23, 2, 14, 10, 23, 3,
+	8, 15, 1, 23, 3, 3, 15, 6, 24, 2, 12, 12, 24, 3, 6, 15, 3, 24, 3, 1, 15, 9, 25, 2,
+	10, 14, 25, 3, 4, 15, 5, 26, 2, 13, 11, 26, 3, 7, 15, 2, 26, 3, 2, 15, 7, 27, 2, 11,
+	13, 27, 3, 5, 15, 4, 28, 2, 14, 10, 28, 3, 9, 15, 1, 28, 3, 3, 15, 6, 29, 2, 12, 12,
+	29, 3, 6, 15, 3, 29, 3, 1, 15, 8, 30, 2, 10, 14, 30, 3, 4, 15, 5, 31, 2, 13, 11, 31,
+	3, 8, 15, 2, 31, 3, 2, 15, 7, 32, 2, 11, 13, 32, 3, 5, 15, 4, 33, 2, 14, 9, 33, 3,
+	9, 15, 1, 33, 3, 3, 15, 6, 34, 2, 12, 12, 34, 3, 7, 15, 3, 34, 3, 1, 15, 8, 35, 2,
+	10, 14, 35, 3, 4, 15, 5, 36, 2, 13, 10, 36, 3, 8, 15, 2, 36, 3, 2, 15, 7, 37, 2, 11,
+	13, 37, 3, 6, 15, 4, 38, 2, 14, 9, 38, 3, 9, 15, 1, 38, 3, 3, 15, 6, 39, 2, 12, 11,
+	39, 3, 7, 15, 3, 39, 3, 1, 15, 8, 40, 2, 10, 14, 40, 3, 5, 15, 5, 41, 2, 13, 10, 41,
+	3, 8, 15, 2, 41, 3, 2, 15, 7, 42, 2, 11, 12, 42, 3, 6, 15, 4, 43, 2, 14, 9, 43, 3,
+	9, 15, 1, 43, 3, 4, 15, 6, 44, 2, 12, 11, 44, 3, 7, 15, 3, 44, 3, 1, 15, 8, 45, 2,
+	10, 13, 45, 3, 5, 15, 4, 46, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 7, 3, 0, 2, 14, 9,
+	0, 2, 9, 14, 0, 3, 4, 15, 5, 1, 2, 13, 11, 1, 3, 8, 15, 2, 1, 3, 3, 15, 7, 2,
+	2, 12, 12, 2, 3, 6, 15, 3, 2, 3, 1, 15, 8, 3, 2, 10, 13, 3, 3, 5, 15, 4, 4, 2,
+	14, 9, 4, 2, 9, 14, 4, 3, 4, 15, 5, 5, 2, 13, 11, 5, 3, 8, 15, 2, 5, 3, 3, 15,
+	7, 6, 2, 12, 12, 6, 3, 6, 15, 3, 6, 3, 1, 15, 8, 7, 2, 10, 13, 7, 3, 5, 15, 4,
+	8, 2, 14, 9, 8, 2, 9, 14, 8, 3, 4, 15, 5, 9, 2, 13, 11, 9, 3, 8, 15, 2, 9, 3,
+	3, 15, 7, 10, 2, 11, 12, 10, 3, 6, 15, 3, 10, 3, 1, 15, 8, 11, 2, 10, 13, 11, 3, 5,
+	15, 4, 12, 2, 14, 9, 12, 2, 9, 15, 12, 3, 4, 15, 6, 13, 2, 13, 11, 13, 3, 8, 15, 2,
+	13, 3, 2, 15, 7, 14, 2, 11, 12, 14, 3, 6, 15, 3, 14, 3, 1, 15, 8, 15, 2, 10, 13, 15,
+	3, 5, 15, 4, 16, 2, 14, 9, 16, 2, 9, 15, 16, 3, 4, 15, 6, 17, 2, 13, 11, 17, 3, 8,
+	15, 2, 17, 3, 2, 15, 7, 18, 2, 11, 12, 18, 3, 6, 15, 3, 18, 3, 1, 15, 8, 19, 2, 10,
+	13, 19, 3, 5, 15, 4, 20, 2, 14, 9, 20, 3, 9, 15, 1, 20, 3, 4, 15, 6, 21, 2, 13, 11,
+	21, 3, 8, 15, 2, 21, 3, 2, 15, 7, 22, 2, 11, 12, 22, 3, 6, 15, 3, 22, 3, 1, 15, 8,
+	23, 2, 10, 13, 23, 3, 5, 15, 4, 24, 2, 14, 10, 24, 3, 9, 15, 1, 24, 3, 4, 15, 6, 25,
+	2, 13, 11, 25, 3, 7, 15, 2, 25, 3, 2, 15, 7, 26, 2, 11, 12, 26, 3, 6, 15, 3, 26, 3,
+	1, 15, 8, 27, 2, 10, 13, 27, 3, 5, 15, 4, 28, 2, 14, 10, 28, 3, 9, 15, 1, 28, 3, 4,
+	15, 6, 29, 2, 13, 11, 29, 3, 7, 15, 2, 29, 3, 2, 15, 7, 30, 2, 11, 12, 30, 3, 6, 15,
+	3, 30, 3, 1, 15, 8, 31, 2, 10, 13, 31, 3, 5, 15, 4, 32, 2, 14, 10, 32, 3, 9, 15, 1,
+	32, 3, 4, 15, 6, 33, 2, 12, 11, 33, 3, 7, 15, 2, 33, 3, 2, 15, 7, 34, 2, 11, 12, 34,
+	3, 6, 15, 3, 34, 3, 1, 15, 8, 35, 2, 10, 14, 35, 3, 5, 15, 5, 36, 2, 14, 10, 36, 3,
+	9, 15, 1, 36, 3, 3, 15, 6, 37, 2, 12, 11, 37, 3, 7, 15, 2, 37, 3, 2, 15, 7, 38, 2,
+	11, 12, 38, 3, 6, 15, 3, 38, 3, 1, 15, 8, 39, 2, 10, 14, 39, 3, 5, 15, 5, 40, 2, 14,
+	10, 40, 3, 9, 15, 1, 40, 3, 3, 15, 6, 41, 2, 12, 11, 41, 3, 7, 15, 2, 41, 3, 2, 15,
+	7, 42, 2, 11, 12, 42, 3, 6, 15, 3, 42, 3, 1, 15, 8, 43, 2, 10, 14, 43, 3, 5, 15, 4,
+	44, 1, 4, 0, 0, 0, 0, 0, 2, 3, 1, 0, 2, 14, 9, 0, 2, 9, 14, 0, 3, 4, 15, 5,
+	1, 2, 14, 10, 1, 3, 9, 15, 1, 1, 3, 4, 15, 5, 2, 2, 13, 10, 2, 3, 8, 15, 1, 2,
+	3, 3, 15, 6, 3, 2, 13, 11, 3, 3, 8, 15, 1, 3, 3, 3, 15, 6, 4, 2, 12, 11, 4, 3,
+	7, 15, 2, 4, 3, 2, 15, 7, 5, 2, 12, 12, 5, 3, 7, 15, 2, 5, 3, 2, 15, 7, 6, 2,
+	11, 12, 6, 3, 6, 15, 3, 6, 3, 1, 15, 8, 7, 2, 11, 13, 7, 3, 6, 15, 3, 7, 3, 1,
+	15, 8, 8, 2, 10, 13, 8, 3, 5, 15, 4, 9, 2, 15, 9, 9, 2, 10, 14, 9, 3, 5, 15, 4,
+	10, 2, 14, 9, 10, 2, 9, 14, 10, 3, 4, 15, 5, 11, 2, 14, 10, 11, 2, 9, 14, 11, 3, 4,
+	15, 5, 12, 2, 13, 10, 12, 3, 8, 15, 1, 12, 3, 3, 15, 6, 13, 2, 13, 11, 13, 3, 8, 15,
+	1, 13, 3, 3, 15, 6, 14, 2, 12, 11, 14, 3, 7, 15, 2, 14, 3, 3, 15, 7, 15, 2, 12, 11,
+	15, 3, 7, 15, 2, 15, 3, 2, 15, 7, 16, 2, 11, 12, 16, 3, 6, 15, 3, 16, 3, 2, 15, 8,
+	17, 2, 11, 12, 17, 3, 6, 15, 3, 17, 3, 1, 15, 8, 18, 2, 10, 13, 18, 3, 6, 15, 4, 18,
+	3, 1, 15, 8, 19, 2, 10, 13, 19, 3, 5, 15, 4, 20, 2, 14, 9, 20, 2, 10, 14, 20, 3, 5,
+	15, 5, 21, 2, 14, 9, 21, 2, 9, 14, 21, 3, 4, 15, 5, 22, 2, 13, 10, 22, 3, 9, 15, 1,
+	22, 3, 4, 15, 5, 23, 2, 13, 10, 23, 3, 8, 15, 1, 23, 3, 3, 15, 6, 24, 2, 13, 11, 24,
+	3, 8, 15, 1, 24, 3, 3, 15, 6, 25, 2, 12, 11, 25, 3, 7, 15, 2, 25, 3, 2, 15, 7, 26,
+	2, 12, 12, 26, 3, 7, 15, 2, 26, 3, 2, 15, 7, 27, 2, 11, 12, 27, 3, 6, 15, 3, 27, 3,
+	1, 15, 8, 28, 2, 11, 13, 28, 3, 6, 15, 3, 28, 3, 1, 15, 8, 29, 2, 10, 13, 29, 3, 5,
+	15, 4, 30, 2, 15, 9, 30, 2, 10, 14, 30, 3, 5, 15, 4, 31, 2, 14, 9, 31, 2, 9, 14, 31,
+	3, 4, 15, 5, 32, 2, 14, 10, 32, 2, 9, 15, 32, 3, 4, 15, 5, 33, 2, 13, 10, 33, 3, 8,
+	15, 1, 33, 3, 3, 15, 6, 34, 2, 13, 11, 34, 3, 8, 15, 1, 34, 3, 3, 15, 6, 35, 2, 12,
+	11, 35, 3, 7, 15, 2, 35, 3, 2, 15, 7, 36, 2, 12, 12, 36, 3, 7, 15, 2, 36, 3, 2, 15,
+	7, 37, 2, 11, 12, 37, 3, 6, 15, 3, 37, 3, 2, 15, 8, 38, 2, 11, 12, 38, 3, 6, 15, 3,
+	38, 3, 1, 15, 8, 39, 2, 10, 13, 39, 3, 6, 15, 4, 39, 3, 1, 15, 9, 40, 2, 10, 13, 40,
+	3, 5, 15, 4, 41, 2, 14, 9, 41, 2, 9, 14, 41, 3, 5, 15, 4, 42, 1, 4, 0, 0, 0, 0,
+	0, 0, 0, 2, 11, 10, 0, 2, 9, 14, 0, 3, 4, 15, 5, 1, 2, 14, 9, 1, 2, 9, 14, 1,
+	3, 5, 15, 4, 2, 2, 14, 9, 2, 2, 10, 14, 2, 3, 5, 15, 4, 3, 2, 15, 9, 3, 2, 10,
+	13, 3, 3, 5, 15, 4, 3, 3, 1, 15, 8, 4, 2, 10, 13, 4, 3, 6, 15, 3, 4, 3, 1, 15,
+	8, 5, 2, 11, 12, 5, 3, 6, 15, 3, 5, 3, 2, 15, 7, 6, 2, 11, 12, 6, 3, 7, 15, 2,
+	6, 3, 2, 15, 7, 7, 2, 12, 12, 7, 3, 7, 15, 2, 7, 3, 2, 15, 7, 8, 2, 12, 11, 8,
+	3, 7, 15, 2, 8, 3, 3, 15, 6, 9, 2, 12, 11, 9, 3, 8, 15, 1, 9, 3, 3, 15, 6, 10,
+	2, 13, 11, 10, 3, 8, 15, 1, 10, 3, 3, 15, 6, 11, 2, 13, 10, 11, 3, 8, 15, 1, 11, 3,
+	4, 15, 5, 12, 2, 13, 10, 12, 2, 9, 15, 12, 3, 4, 15, 5, 13, 2, 14, 10, 13, 2, 9, 14,
+	13, 3, 4, 15, 5, 14, 2, 14, 9, 14, 2, 9, 14, 14, 3, 5, 15, 4, 15, 2, 14, 9, 15, 2,
+	10, 13, 15, 3, 5, 15, 4, 16, 2, 15, 8, 16, 2, 10, 13, 16, 3, 5, 15, 3, 16, 3, 1, 15,
+	8, 17, 2, 10, 13, 17, 3, 6, 15, 3, 17, 3, 1, 15, 8, 18, 2, 11, 12, 18, 3, 6, 15, 3,
+	18, 3, 2, 15, 7, 19, 2, 11, 12, 19, 3, 7, 15, 2, 19, 3, 2, 15, 7, 20, 2, 12, 12, 20,
+	3, 7, 15, 2, 20, 3, 2, 15, 7, 21, 2, 12, 11, 21, 3, 7, 15, 2, 21, 3, 3, 15, 6, 22,
+	2, 12, 11, 22, 3, 8, 15, 1, 22, 3, 3, 15, 6, 23, 2, 13, 11, 23, 3, 8, 15, 1, 23, 3,
+	3, 15, 6, 24, 2, 13, 10, 24, 3, 8, 15, 1, 24, 3, 4, 15, 5, 25, 2, 13, 10, 25, 2, 9,
+	15, 25, 3, 4, 15, 5, 26, 2, 14, 10, 26, 2, 9, 14, 26, 3, 4, 15, 5, 27, 2, 14, 9, 27,
+	2, 9, 14, 27, 3, 5, 15, 4, 28, 2, 14, 9, 28, 2, 10, 13, 28, 3, 5, 15, 4, 28, 3, 1,
+	15, 8, 29, 2, 10, 13, 29, 3, 6, 15, 3, 29, 3, 1, 15, 8, 30, 2, 11, 13, 30, 3, 6, 15,
+	3, 30, 3, 1, 15, 8, 31, 2, 11, 12, 31, 3, 6, 15, 3, 31, 3, 2, 15, 7, 32, 2, 11, 12,
+	32, 3, 7, 15, 2, 32, 3, 2, 15, 7, 33, 2, 12, 12, 33, 3, 7, 15, 2, 33, 3, 2, 15, 7,
+	34, 2, 12, 11, 34, 3, 7, 15, 2, 34, 3, 3, 15, 6, 35, 2, 12, 11, 35, 3, 8, 15, 1, 35,
+	3, 3, 15, 6, 36, 2, 13, 11, 36, 3, 8, 15, 1, 36, 3, 3, 15, 6, 37, 2, 13, 10, 37, 3,
+	8, 15, 1, 37, 3, 4, 15, 5, 38, 2, 13, 10, 38, 2, 9, 14, 38, 3, 4, 15, 5, 39, 2, 14,
+	9, 39, 2, 9, 14, 39, 3, 4, 15, 4, 40, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 6, 8, 0,
+	2, 9, 14, 0, 3, 4, 15, 4, 1, 2, 14, 9, 1, 2, 10, 13, 1, 3, 5, 15, 3, 1, 3, 1,
+	15, 8, 2, 2, 11, 12, 2, 3, 7, 15, 2, 2, 3, 2, 15, 7, 3, 2, 12, 11, 3, 3, 8, 15,
+	1, 3, 3, 3, 15, 5, 4, 2, 13, 10, 4, 2, 9, 14, 4, 3, 5, 15, 4, 5, 2, 15, 9, 5,
+	2, 10, 13, 5, 3, 6, 15, 3, 5, 3, 1, 15, 7, 6, 2, 11, 12, 6, 3, 7, 15, 2, 6, 3,
+	3, 15, 6, 7, 2, 13, 11, 7, 3, 8, 15, 1, 7, 3, 4, 15, 5, 8, 2, 14, 9, 8, 2, 9,
+	14, 8, 3, 5, 15, 4, 8, 3, 1, 15, 8, 9, 2, 11, 13, 9, 3, 6, 15, 3, 9, 3, 2, 15,
+	7, 10, 2, 12, 11, 10, 3, 7, 15, 1, 10, 3, 3, 15, 6, 11, 2, 13, 10, 11, 2, 9, 15, 11,
+	3, 4, 15, 5, 12, 2, 14, 9, 12, 2, 10, 13, 12, 3, 5, 15, 3, 12, 3, 1, 15, 8, 13, 2,
+	11, 12, 13, 3, 7, 15, 2, 13, 3, 2, 15, 7, 14, 2, 12, 11, 14, 3, 8, 15, 1, 14, 3, 3,
+	15, 5, 15, 2, 13, 10, 15, 2, 9, 14, 15, 3, 5, 15, 4, 16, 2, 15, 9, 16, 2, 10, 13, 16,
+	3, 6, 15, 3, 16, 3, 1, 15, 7, 17, 2, 11, 12, 17, 3, 7, 15, 2, 17, 3, 3, 15, 6, 18,
+	2, 13, 11, 18, 3, 8, 15, 1, 18, 3, 4, 15, 5, 19, 2, 14, 9, 19, 2, 9, 14, 19, 3, 5,
+	15, 4, 19, 3, 1, 15, 8, 20, 2, 11, 13, 20, 3, 6, 15, 3, 20, 3, 2, 15, 7, 21, 2, 12,
+	11, 21, 3, 7, 15, 1, 21, 3, 3, 15, 6, 22, 2, 13, 10, 22, 2, 9, 15, 22, 3, 4, 15, 5,
+	23, 2, 14, 9, 23, 2, 10, 13, 23, 3, 5, 15, 3, 23, 3, 1, 15, 8, 24, 2, 11, 12, 24, 3,
+	7, 15, 2, 24, 3, 2, 15, 7, 25, 2, 12, 11, 25, 3, 8, 15, 1, 25, 3, 3, 15, 6, 26, 2,
+	13, 10, 26, 2, 9, 14, 26, 3, 4, 15, 4, 27, 2, 14, 9, 27, 2, 10, 13, 27, 3, 6, 15, 3,
+	27, 3, 1, 15, 8, 28, 2, 11, 12, 28, 3, 7, 15, 2, 28, 3, 2, 15, 6, 29, 2, 12, 11, 29,
+	3, 8, 15, 1, 29, 3, 4, 15, 5, 30, 2, 14, 10, 30, 2, 9, 14, 30, 3, 5, 15, 4, 31, 2,
+	15, 8, 31, 2, 10, 13, 31, 3, 6, 15, 3, 31, 3, 2, 15, 7, 32, 2, 12, 12, 32, 3, 7, 15,
+	2, 32, 3, 3, 15, 6, 33, 2, 13, 10, 33, 2, 8, 15, 33, 3, 4, 15, 5, 34, 2, 14, 9, 34,
+	2, 10, 14, 34, 3, 5, 15, 4, 34, 3, 1, 15, 8, 35, 2, 11, 12, 35, 3, 6, 15, 2, 35, 3,
+	2, 15, 7, 36, 2, 12, 11, 36, 3, 8, 15, 1, 36, 3, 3, 15, 6, 37, 2, 13, 10, 37, 2, 9,
+	14, 37, 3, 4, 15, 4, 38, 1, 4, 0, 0, 0, 0, 0, 2, 1, 4, 0, 2, 8, 15, 0, 3, 4,
+	15, 5, 1, 2, 14, 9, 1, 2, 10, 13, 1, 3, 6, 15, 3, 1, 3, 2, 15, 7, 2, 2, 12, 11,
+	2, 3, 8, 15, 1, 2, 3, 4, 15, 5, 3, 2, 14, 9, 3, 2, 10, 13, 3, 3, 6, 15, 3, 3,
+	3, 2, 15, 7, 4, 2, 12, 11, 4, 3, 8, 15, 1, 4, 3, 4, 15, 5, 5, 2, 14, 9, 5, 2,
+	10, 13, 5, 3, 6, 15, 3, 5, 3, 2, 15, 7, 6, 2, 12, 11, 6, 3, 8, 15, 1, 6, 3, 4,
+	15, 5, 7, 2, 14, 9, 7, 2, 10, 13, 7, 3, 6, 15, 3, 7, 3, 2, 15, 7, 8, 2, 12, 11,
+	8, 3, 8, 15, 1, 8, 3, 4, 15, 5, 9, 2, 14, 9, 9, 2, 10, 13, 9, 3, 6, 15, 3, 9,
+	3, 2, 15, 7, 10, 2, 12, 11, 10, 3, 8, 15, 1, 10, 3, 4, 15, 5, 11, 2, 14, 9, 11, 2,
+	10, 13, 11, 3, 6, 15, 3, 11, 3, 1, 15, 7, 12, 2, 12, 11, 12, 3, 8, 15, 1, 12, 3, 3,
+	15, 5, 13, 2, 14, 9, 13, 2, 10, 13, 13, 3, 5, 15, 3, 13, 3, 1, 15, 7, 14, 2, 12, 11,
+	14, 3, 7, 15, 1, 14, 3, 3, 15, 5, 15, 2, 14, 9, 15, 2, 10, 14, 15, 3, 5, 15, 3, 15,
+	3, 1, 15, 7, 16, 2, 12, 12, 16, 3, 7, 15, 1, 16, 3, 3, 15, 5, 17, 2, 14, 10, 17, 2,
+	9, 14, 17, 3, 5, 15, 3, 17, 3, 1, 15, 8, 18, 2, 11, 12, 18, 3, 7, 15, 1, 18, 3, 3,
+	15, 6, 19, 2, 13, 10, 19, 2, 9, 14, 19, 3, 5, 15, 3, 19, 3, 1, 15, 8, 20, 2, 11, 12,
+	20, 3, 7, 15, 1, 20, 3, 3, 15, 6, 21, 2, 13, 10, 21, 2, 9, 14, 21, 3, 5, 15, 4, 21,
+	3, 1, 15, 8, 22, 2, 11, 12, 22, 3, 7, 15, 2, 22, 3, 3, 15, 6, 23, 2, 13, 10, 23, 2,
+	9, 14, 23, 3, 5, 15, 4, 23, 3, 1, 15, 8, 24, 2, 11, 12, 24, 3, 7, 15, 2, 24, 3, 3,
+	15, 6, 25, 2, 13, 10, 25, 2, 9, 14, 25, 3, 5, 15, 4, 25, 3, 1, 15, 8, 26, 2, 11, 12,
+	26, 3, 7, 15, 2, 26, 3, 3, 15, 6, 27, 2, 13, 10, 27, 2, 9, 14, 27, 3, 5, 15, 4, 27,
+	3, 1, 15, 8, 28, 2, 11, 12, 28, 3, 7, 15, 2, 28, 3, 3, 15, 6, 29, 2, 13, 10, 29, 2,
+	9, 14, 29, 3, 5, 15, 4, 29, 3, 1, 15, 8, 30, 2, 11, 12, 30, 3, 7, 15, 2, 30, 3, 3,
+	15, 6, 31, 2, 13, 10, 31, 2, 9, 14, 31, 3, 5, 15, 4, 32, 2, 15, 8, 32, 2, 11, 12, 32,
+	3, 7, 15, 2, 32, 3, 2, 15, 6, 33, 2, 13, 10, 33, 2, 9, 15, 33, 3, 4, 15, 4, 34, 2,
+	15, 8, 34, 2, 11, 12, 34, 3, 6, 15, 2, 34, 3, 2, 15, 6, 35, 2, 13, 10, 35, 2, 8, 15,
+	35, 3, 4, 15, 4, 36, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 5, 13, 1, 0, 3, 4, 15, 5,
+	1, 2, 14, 9, 1, 2, 10, 13, 1, 3, 6, 15, 2, 1, 3, 3, 15, 6, 2, 2, 13, 10, 2, 2,
+	9, 14, 2, 3, 5, 15, 3, 2, 3, 2, 15, 7, 3, 2, 12, 11, 3, 2, 8, 15, 3, 3, 4, 15,
+	4, 3, 3, 1, 15, 8, 4, 2, 11, 12, 4, 3, 7, 15, 1, 4, 3, 3, 15, 5, 5, 2, 14, 9,
+	5, 2, 10, 13, 5, 3, 6, 15, 2, 5, 3, 2, 15, 6, 6, 2, 13, 10, 6, 2, 9, 14, 6, 3,
+	5, 15, 3, 6, 3, 1, 15, 7, 7, 2, 12, 11, 7, 3, 8, 15, 1, 7, 3, 4, 15, 4, 8, 2,
+	15, 8, 8, 2, 11, 12, 8, 3, 7, 15, 2, 8, 3, 3, 15, 5, 9, 2, 14, 9, 9, 2, 10, 13,
+	9, 3, 6, 15, 3, 9, 3, 2, 15, 6, 10, 2, 13, 10, 10, 2, 9, 14, 10, 3, 5, 15, 4, 10,
+	3, 1, 15, 8, 11, 2, 12, 11, 11, 3, 8, 15, 1, 11, 3, 4, 15, 5, 12, 2, 14, 9, 12, 2,
+	11, 12, 12, 3, 7, 15, 2, 12, 3, 3, 15, 6, 13, 2, 13, 10, 13, 2, 10, 13, 13, 3, 6, 15,
+	3, 13, 3, 2, 15, 7, 14, 2, 12, 11, 14, 2, 8, 15, 14, 3, 5, 15, 4, 14, 3, 1, 15, 8,
+	15, 2, 11, 12, 15, 3, 7, 15, 1, 15, 3, 4, 15, 5, 16, 2, 14, 9, 16, 2, 10, 13, 16, 3,
+	6, 15, 2, 16, 3, 3, 15, 6, 17, 2, 13, 10, 17, 2, 9, 14, 17, 3, 5, 15, 3, 17, 3, 1,
+	15, 7, 18, 2, 12, 11, 18, 2, 8, 15, 18, 3, 4, 15, 4, 19, 2, 15, 8, 19, 2, 11, 12, 19,
+	3, 7, 15, 1, 19, 3, 3, 15, 5, 20, 2, 14, 9, 20, 2, 10, 13, 20, 3, 6, 15, 2, 20, 3,
+	2, 15, 6, 21, 2, 13, 10, 21, 2, 9, 14, 21, 3, 5, 15, 3, 21, 3, 1, 15, 7, 22, 2, 12,
+	11, 22, 3, 8, 15, 1, 22, 3, 4, 15, 4, 23, 2, 15, 8, 23, 2, 11, 12, 23, 3, 7, 15, 2,
+	23, 3, 3, 15, 6, 24, 2, 14, 9, 24, 2, 10, 13, 24, 3, 6, 15, 3, 24, 3, 2, 15, 7, 25,
+	2, 13, 10, 25, 2, 9, 14, 25, 3, 5, 15, 4, 25, 3, 1, 15, 8, 26, 2, 12, 11, 26, 3, 8,
+	15, 1, 26, 3, 4, 15, 5, 27, 2, 14, 9, 27, 2, 11, 13, 27, 3, 7, 15, 2, 27, 3, 3, 15,
+	6, 28, 2, 13, 10, 28, 2, 9, 14, 28, 3, 6, 15, 3, 28, 3, 2, 15, 7, 29, 2, 12, 11, 29,
+	2, 8, 15, 29, 3, 5, 15, 4, 29, 3, 1, 15, 8, 30, 2, 11, 12, 30, 3, 7, 15, 1, 30, 3,
+	3, 15, 5, 31, 2, 14, 9, 31, 2, 10, 13, 31, 3, 6, 15, 2, 31, 3, 2, 15, 6, 32, 2, 13,
+	10, 32, 2, 9, 14, 32, 3, 5, 15, 3, 32, 3, 1, 15, 7, 33, 2, 12, 11, 33, 2, 8, 15, 33,
+	3, 4, 15, 4, 34, 1, 4, 0, 0, 0, 0, 1, 1, 7, 0, 3, 3, 15, 5, 1, 2, 14, 9, 1,
+	2, 10, 13, 1, 3, 7, 15, 2, 1, 3, 3, 15, 5, 2, 2, 14, 9, 2, 2, 10, 13, 2, 3, 7,
+	15, 2, 2, 3, 3, 15, 5, 3, 2, 14, 9, 3, 2, 10, 13, 3, 3, 7, 15, 2, 3, 3, 3, 15,
+	5, 4, 2, 14, 9, 4, 2, 10, 13, 4, 3, 7, 15, 2, 4, 3, 3, 15, 5, 5, 2, 14, 9, 5,
+	2, 10, 13, 5, 3, 7, 15, 2, 5, 3, 3, 15, 5, 6, 2, 14, 9, 6, 2, 10, 12, 6, 3, 7,
+	15, 2, 6, 3, 3, 15, 5, 7, 2, 14, 9, 7, 2, 11, 12, 7, 3, 7, 15, 2, 7, 3, 3, 15,
+	5, 8, 2, 14, 9, 8, 2, 11, 12, 8, 3, 7, 15, 1, 8, 3, 3, 15, 5, 9, 2, 14, 9, 9,
+	2, 11, 12, 9, 3, 7, 15, 1, 9, 3, 3, 15, 5, 10, 2, 14, 9, 10, 2, 11, 12, 10, 3, 7,
+	15, 1, 10, 3, 3, 15, 5, 11, 2, 14, 9, 11, 2, 11, 12, 11, 3, 7, 15, 1, 11, 3, 3, 15,
+	5, 12, 2, 14, 9, 12, 2, 11, 12, 12, 3, 7, 15, 1, 12, 3, 3, 15, 5, 13, 2, 14, 9, 13,
+	2, 11, 12, 13, 3, 7, 15, 1, 13, 3, 3, 15, 5, 14, 2, 14, 9, 14, 2, 11, 12, 14, 3, 7,
+	15, 1, 14, 3, 4, 15, 5, 15, 2, 14, 8, 15, 2, 11, 12, 15, 3, 7, 15, 1, 15, 3, 4, 15,
+	5, 16, 2, 14, 8, 16, 2, 11, 12, 16, 3, 7, 15, 1, 16, 3, 4, 15, 5, 17, 2, 15, 8, 17,
+	2, 11, 12, 17, 3, 7, 15, 1, 17, 3, 4, 15, 5, 18, 2, 15, 8, 18, 2, 11, 12, 18, 3, 7,
+	15, 1, 18, 3, 4, 15, 5, 19, 2, 15, 8, 19, 2, 11, 12, 19, 3, 7, 15, 1, 19, 3, 4, 15,
+	5, 20, 2, 15, 8, 20, 2, 11, 12, 20, 3, 7, 15, 1, 20, 3, 4, 15, 5, 21, 2, 15, 8, 21,
+	2, 11, 12, 21, 3, 7, 15, 1, 21, 3, 4, 15, 5, 22, 2, 15, 8, 22, 2, 11, 12, 22, 3, 7,
+	15, 1, 22, 3, 4, 15, 5, 23, 2, 15, 8, 23, 2, 11, 12, 23, 3, 8, 15, 1, 23, 3, 4, 15,
+	5, 24, 2, 15, 8, 24, 2, 11, 12, 24, 3, 8, 15, 1, 24, 3, 4, 15, 4, 25, 2, 15, 8, 25,
+	2, 11, 12, 25, 3, 8, 15, 1, 25, 3, 4, 15, 4, 26, 2, 15, 8, 26, 2, 11, 12, 26, 3, 8,
+	15, 1, 26, 3, 4, 15, 4, 27, 2, 15, 8, 27, 2, 11, 12, 27, 3, 8, 15, 1, 27, 3, 4, 15,
+	4, 28, 2, 15, 8, 28, 2, 11, 12, 28, 3, 8, 15, 1, 28, 3, 4, 15, 4, 29, 2, 15, 8, 29,
+	2, 11, 12, 29, 3, 8, 15, 1, 29, 3, 4, 15, 4, 30, 2, 15, 8, 30, 2, 11, 12, 30, 3, 8,
+	15, 1, 30, 3, 4, 15, 4, 30, 3, 1, 15, 8, 31, 2, 11, 11, 31, 3, 8, 15, 1, 31, 3, 4,
+	15, 4, 32, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 14, 6, 0, 2, 13, 10, 0, 2, 10, 13, 0,
+	3, 7, 15, 2, 0, 3, 3, 15, 5, 1, 2, 14, 8, 1, 2, 11, 12, 1, 3, 8, 15, 1, 1, 3,
+	4, 15, 4, 1, 3, 1, 15, 7, 2, 2, 12, 11, 2, 2, 9, 14, 2, 3, 5, 15, 3, 2, 3, 2,
+	15, 6, 3, 2, 13, 10, 3, 2, 10, 13, 3, 3, 7, 15, 2, 3, 3, 3, 15, 5, 4, 2, 14, 8,
+	4, 2, 11, 12, 4, 3, 8, 15, 1, 4, 3, 4, 15, 4, 4, 3, 1, 15, 7, 5, 2, 12, 11, 5,
+	2, 9, 14, 5, 3, 5, 15, 3, 5, 3, 2, 15, 6, 6, 2, 13, 10, 6, 2, 10, 13, 6, 3, 7,
+	15, 2, 6, 3, 3, 15, 5, 7, 2, 14, 8, 7, 2, 11, 12, 7, 3, 8, 15, 1, 7, 3, 4, 15,
+	4, 7, 3, 1, 15, 7, 8, 2, 12, 11, 8, 2, 9, 14, 8, 3, 5, 15, 3, 8, 3, 2, 15, 6,
+	9, 2, 13, 10, 9, 2, 10, 13, 9, 3, 7, 15, 2, 9, 3, 3, 15, 5, 10, 2, 14, 9, 10, 2,
+	11, 12, 10, 3, 8, 15, 1, 10, 3, 4, 15, 4, 10, 3, 1, 15, 7, 11, 2, 12, 11, 11, 2, 9,
+	14, 11, 3, 5, 15, 3, 11, 3, 2, 15, 6, 12, 2, 13, 10, 12, 2, 10, 13, 12, 3, 6, 15, 2,
+	12, 3, 3, 15, 5, 13, 2, 14, 9, 13, 2, 11, 12, 13, 3, 8, 15, 1, 13, 3, 4, 15, 4, 13,
+	3, 1, 15, 7, 14, 2, 12, 11, 14, 2, 9, 14, 14, 3, 5, 15, 3, 14, 3, 2, 15, 6, 15, 2,
+	13, 10, 15, 2, 10, 13, 15, 3, 6, 15, 2, 15, 3, 3, 15, 5, 16, 2, 14, 9, 16, 2, 11, 12,
+	16, 3, 8, 15, 1, 16, 3, 4, 15, 4, 16, 3, 1, 15, 7, 17, 2, 12, 11, 17, 2, 9, 14, 17,
+	3, 5, 15, 3, 17, 3, 2, 15, 6, 18, 2, 13, 10, 18, 2, 10, 13, 18, 3, 6, 15, 2, 18, 3,
+	3, 15, 5, 19, 2, 14, 9, 19, 2, 11, 12, 19, 3, 8, 15, 1, 19, 3, 4, 15, 4, 19, 3, 1,
+	15, 7, 20, 2, 12, 11, 20, 2, 9, 14, 20, 3, 5, 15, 3, 20, 3, 2, 15, 6, 21, 2, 13, 10,
+	21, 2, 10, 13, 21, 3, 6, 15, 2, 21, 3, 3, 15, 5, 22, 2, 14, 9, 22, 2, 11, 12, 22, 3,
+	8, 15, 1, 22, 3, 4, 15, 4, 22, 3, 1, 15, 7, 23, 2, 12, 11, 23, 2, 9, 14, 23, 3, 5,
+	15, 3, 23, 3, 2, 15, 6, 24, 2, 13, 10, 24, 2, 10, 13, 24, 3, 6, 15, 2, 24, 3, 3, 15,
+	5, 25, 2, 14, 9, 25, 2, 11, 12, 25, 3, 8, 15, 1, 25, 3, 4, 15, 4, 25, 3, 1, 15, 7,
+	26, 2, 12, 11, 26, 2, 9, 14, 26, 3, 5, 15, 3, 26, 3, 2, 15, 6, 27, 2, 13, 10, 27, 2,
+	10, 13, 27, 3, 6, 15, 2, 27, 3, 3, 15, 5, 28, 2, 14, 9, 28, 2, 11, 12, 28, 3, 8, 15,
+	1, 28, 3, 4, 15, 4, 29, 1, 4, 0, 0, 0, 0, 0, 2, 5, 4, 0, 2, 12, 10, 0, 2, 9,
+	14, 0, 3, 6, 15, 2, 0, 3, 3, 15, 5, 1, 2, 15, 8, 1, 2, 12, 11, 1, 2, 8, 14, 1,
+	3, 5, 15, 3, 1, 3, 2, 15, 6, 2, 2, 14, 9, 2, 2, 11, 12, 2, 3, 7, 15, 1, 2, 3,
+	4, 15, 4, 2, 3, 1, 15, 7, 3, 2, 13, 10, 3, 2, 10, 13, 3, 3, 7, 15, 2, 3, 3, 3,
+	15, 5, 4, 2, 15, 8, 4, 2, 12, 11, 4, 2, 9, 14, 4, 3, 6, 15, 3, 4, 3, 3, 15, 6,
+	5, 2, 14, 9, 5, 2, 11, 12, 5, 2, 8, 15, 5, 3, 5, 15, 3, 5, 3, 2, 15, 7, 6, 2,
+	13, 10, 6, 2, 10, 13, 6, 3, 7, 15, 1, 6, 3, 4, 15, 4, 6, 3, 1, 15, 7, 7, 2, 12,
+	11, 7, 2, 9, 14, 7, 3, 6, 15, 2, 7, 3, 3, 15, 5, 8, 2, 14, 8, 8, 2, 11, 12, 8,
+	2, 8, 15, 8, 3, 5, 15, 3, 8, 3, 2, 15, 6, 9, 2, 14, 9, 9, 2, 10, 12, 9, 3, 7,
+	15, 1, 9, 3, 4, 15, 4, 9, 3, 1, 15, 7, 10, 2, 13, 10, 10, 2, 9, 13, 10, 3, 6, 15,
+	2, 10, 3, 3, 15, 5, 11, 2, 15, 8, 11, 2, 12, 11, 11, 2, 9, 14, 11, 3, 5, 15, 3, 11,
+	3, 2, 15, 6, 12, 2, 14, 9, 12, 2, 11, 12, 12, 3, 8, 15, 1, 12, 3, 4, 15, 4, 12, 3,
+	1, 15, 7, 13, 2, 13, 10, 13, 2, 10, 13, 13, 3, 7, 15, 1, 13, 3, 4, 15, 5, 14, 2, 15,
+	8, 14, 2, 12, 11, 14, 2, 9, 14, 14, 3, 6, 15, 2, 14, 3, 3, 15, 5, 15, 2, 14, 9, 15,
+	2, 11, 12, 15, 2, 8, 15, 15, 3, 5, 15, 3, 15, 3, 2, 15, 6, 16, 2, 13, 10, 16, 2, 10,
+	13, 16, 3, 7, 15, 1, 16, 3, 4, 15, 4, 16, 3, 1, 15, 7, 17, 2, 12, 10, 17, 2, 9, 14,
+	17, 3, 6, 15, 2, 17, 3, 3, 15, 5, 18, 2, 15, 8, 18, 2, 11, 11, 18, 2, 8, 14, 18, 3,
+	5, 15, 3, 18, 3, 2, 15, 6, 19, 2, 14, 9, 19, 2, 11, 12, 19, 3, 7, 15, 1, 19, 3, 4,
+	15, 4, 19, 3, 1, 15, 7, 20, 2, 13, 10, 20, 2, 10, 13, 20, 3, 6, 15, 2, 20, 3, 3, 15,
+	5, 21, 2, 15, 8, 21, 2, 12, 11, 21, 2, 9, 14, 21, 3, 6, 15, 3, 21, 3, 2, 15, 6, 22,
+	2, 14, 9, 22, 2, 11, 12, 22, 2, 8, 15, 22, 3, 5, 15, 4, 22, 3, 2, 15, 7, 23, 2, 13,
+	10, 23, 2, 10, 13, 23, 3, 7, 15, 1, 23, 3, 4, 15, 4, 23, 3, 1, 15, 8, 24, 2, 12, 11,
+	24, 2, 9, 14, 24, 3, 6, 15, 2, 24, 3, 3, 15, 5, 25, 2, 14, 8, 25, 2, 11, 12, 25, 2,
+	8, 15, 25, 3, 5, 15, 3, 25, 3, 2, 15, 6, 26, 2, 13, 9, 26, 2, 10, 13, 26, 3, 7, 15,
+	1, 26, 3, 4, 15, 4, 27, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 9, 10, 0, 2, 8, 14, 0,
+	3, 6, 15, 3, 0, 3, 3, 15, 5, 1, 2, 15, 8, 1, 2, 12, 11, 1, 2, 9, 14, 1, 3, 6,
+	15, 2, 1, 3, 3, 15, 5, 2, 2, 15, 8, 2, 2, 12, 11, 2, 2, 9, 14, 2, 3, 6, 15, 2,
+	2, 3, 4, 15, 5, 2, 3, 1, 15, 7, 3, 2, 13, 10, 3, 2, 10, 13, 3, 3, 7, 15, 1, 3,
+	3, 4, 15, 4, 3, 3, 1, 15, 7, 4, 2, 13, 10, 4, 2, 10, 13, 4, 3, 7, 15, 1, 4, 3,
+	4, 15, 4, 4, 3, 1, 15, 7, 5, 2, 13, 9, 5, 2, 10, 12, 5, 2, 8, 15, 5, 3, 5, 15,
+	3, 5, 3, 2, 15, 6, 6, 2, 14, 9, 6, 2, 11, 12, 6, 2, 8, 15, 6, 3, 5, 15, 3, 6,
+	3, 2, 15, 6, 7, 2, 14, 9, 7, 2, 11, 11, 7, 2, 8, 14, 7, 3, 6, 15, 2, 7, 3, 3,
+	15, 5, 8, 2, 15, 8, 8, 2, 12, 11, 8, 2, 9, 14, 8, 3, 6, 15, 2, 8, 3, 3, 15, 5,
+	9, 2, 15, 8, 9, 2, 12, 11, 9, 2, 9, 14, 9, 3, 6, 15, 2, 9, 3, 4, 15, 5, 9, 3,
+	1, 15, 7, 10, 2, 13, 10, 10, 2, 10, 13, 10, 3, 7, 15, 1, 10, 3, 4, 15, 4, 10, 3, 1,
+	15, 7, 11, 2, 13, 10, 11, 2, 10, 13, 11, 3, 7, 15, 1, 11, 3, 4, 15, 4, 11, 3, 2, 15,
+	7, 12, 2, 13, 9, 12, 2, 11, 12, 12, 2, 8, 15, 12, 3, 5, 15, 3, 12, 3, 2, 15, 6, 13,
+	2, 14, 9, 13, 2, 11, 12, 13, 2, 8, 15, 13, 3, 5, 15, 3, 13, 3, 2, 15, 6, 14, 2, 14,
+	9, 14, 2, 11, 11, 14, 2, 8, 14, 14, 3, 6, 15, 2, 14, 3, 3, 15, 5, 15, 2, 15, 8, 15,
+	2, 12, 11, 15, 2, 9, 14, 15, 3, 6, 15, 2, 15, 3, 3, 15, 5, 16, 2, 15, 8, 16, 2, 12,
+	11, 16, 2, 9, 13, 16, 3, 6, 15, 2, 16, 3, 4, 15, 4, 16, 3, 1, 15, 7, 17, 2, 13, 10,
+	17, 2, 10, 13, 17, 3, 7, 15, 1, 17, 3, 4, 15, 4, 17, 3, 1, 15, 7, 18, 2, 13, 10, 18,
+	2, 10, 13, 18, 3, 7, 15, 1, 18, 3, 4, 15, 4, 18, 3, 2, 15, 7, 19, 2, 13, 9, 19, 2,
+	11, 12, 19, 2, 8, 15, 19, 3, 5, 15, 3, 19, 3, 2, 15, 6, 20, 2, 14, 9, 20, 2, 11, 12,
+	20, 2, 8, 15, 20, 3, 5, 15, 3, 20, 3, 2, 15, 6, 21, 2, 14, 9, 21, 2, 11, 11, 21, 2,
+	9, 14, 21, 3, 6, 15, 2, 21, 3, 3, 15, 5, 22, 2, 15, 8, 22, 2, 12, 11, 22, 2, 9, 14,
+	22, 3, 6, 15, 2, 22, 3, 3, 15, 5, 23, 2, 15, 8, 23, 2, 12, 11, 23, 2, 9, 13, 23, 3,
+	6, 15, 2, 23, 3, 4, 15, 4, 23, 3, 1, 15, 7, 24, 2, 13, 10, 24, 2, 10, 13, 24, 3, 7,
+	15, 1, 24, 3, 4, 15, 4, 25, 1, 4, 0, 0, 0, 0, 1, 1, 4, 0, 3, 7, 15, 1, 0, 3,
+	5, 15, 3, 0, 3, 2, 15, 6, 1, 2, 14, 9, 1, 2, 12, 11, 1, 2, 9, 14, 1, 3, 6, 15,
+	2, 1, 3, 4, 15, 4, 1, 3, 1, 15, 7, 2, 2, 13, 9, 2, 2, 11, 12, 2, 2, 8, 15, 2,
+	3, 5, 15, 2, 2, 3, 3, 15, 5, 3, 2, 15, 8, 3, 2, 12, 10, 3, 2, 10, 13, 3, 3, 7,
+	15, 1, 3, 3, 5, 15, 3, 3, 3, 2, 15, 6, 4, 2, 14, 9, 4, 2, 12, 11, 4, 2, 9, 14,
+	4, 3, 6, 15, 2, 4, 3, 4, 15, 4, 4, 3, 1, 15, 7, 5, 2, 13, 9, 5, 2, 11, 12, 5,
+	2, 8, 15, 5, 3, 6, 15, 2, 5, 3, 3, 15, 5, 6, 2, 15, 8, 6, 2, 12, 10, 6, 2, 10,
+	13, 6, 3, 7, 15, 1, 6, 3, 5, 15, 3, 6, 3, 2, 15, 6, 7, 2, 14, 9, 7, 2, 12, 11,
+	7, 2, 9, 14, 7, 3, 6, 15, 2, 7, 3, 4, 15, 4, 7, 3, 1, 15, 7, 8, 2, 13, 9, 8,
+	2, 11, 12, 8, 2, 8, 15, 8, 3, 6, 15, 2, 8, 3, 3, 15, 5, 9, 2, 15, 8, 9, 2, 13,
+	10, 9, 2, 10, 13, 9, 3, 7, 15, 1, 9, 3, 5, 15, 3, 9, 3, 2, 15, 6, 10, 2, 14, 8,
+	10, 2, 12, 11, 10, 2, 9, 14, 10, 3, 6, 15, 2, 10, 3, 4, 15, 4, 10, 3, 1, 15, 7, 11,
+	2, 13, 9, 11, 2, 11, 12, 11, 2, 8, 15, 11, 3, 6, 15, 2, 11, 3, 3, 15, 5, 12, 2, 15,
+	8, 12, 2, 13, 10, 12, 2, 10, 13, 12, 3, 7, 15, 1, 12, 3, 5, 15, 3, 12, 3, 2, 15, 6,
+	13, 2, 14, 8, 13, 2, 12, 11, 13, 2, 9, 14, 13, 3, 6, 15, 1, 13, 3, 4, 15, 4, 13, 3,
+	1, 15, 7, 14, 2, 13, 9, 14, 2, 11, 12, 14, 2, 8, 15, 14, 3, 6, 15, 2, 14, 3, 3, 15,
+	5, 15, 2, 15, 8, 15, 2, 13, 10, 15, 2, 10, 13, 15, 3, 7, 15, 1, 15, 3, 5, 15, 3, 15,
+	3, 2, 15, 6, 16, 2, 14, 8, 16, 2, 12, 11, 16, 2, 9, 14, 16, 3, 7, 15, 1, 16, 3, 4,
+	15, 4, 16, 3, 1, 15, 7, 17, 2, 13, 9, 17, 2, 11, 12, 17, 2, 8, 14, 17, 3, 6, 15, 2,
+	17, 3, 3, 15, 5, 18, 2, 15, 8, 18, 2, 13, 10, 18, 2, 10, 13, 18, 3, 7, 15, 1, 18, 3,
+	5, 15, 3, 18, 3, 2, 15, 6, 19, 2, 14, 8, 19, 2, 12, 11, 19, 2, 9, 14, 19, 3, 7, 15,
+	1, 19, 3, 4, 15, 4, 19, 3, 1, 15, 7, 20, 2, 14, 9, 20, 2, 11, 12, 20, 2, 8, 14, 20,
+	3, 6, 15, 2, 20, 3, 3, 15, 5, 21, 2, 15, 7, 21, 2, 13, 10, 21, 2, 10, 13, 21, 3, 7,
+	15, 1, 21, 3, 5, 15, 3, 21, 3, 2, 15, 6, 22, 2, 14, 8, 22, 2, 12, 11, 22, 2, 9, 14,
+	22, 3, 7, 15, 1, 22, 3, 4, 15, 4, 23, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 2, 10, 1,
+	0, 3, 3, 15, 5, 0, 3, 1, 15, 7, 1, 2, 13, 9, 1, 2, 11, 12, 1, 2, 9, 14, 1, 3,
+	6, 15, 1, 1, 3, 4, 15, 4, 1, 3, 2, 15, 6, 2, 2, 14, 9, 2, 2, 12, 11, 2, 2, 9,
+	13, 2, 3, 7, 15, 1, 2, 3, 5, 15, 3, 2, 3, 2, 15, 5, 3, 2, 15, 8, 3, 2, 13, 10,
+	3, 2, 10, 12, 3, 2, 8, 15, 3, 3, 5, 15, 2, 3, 3, 3, 15, 5, 3, 3, 1, 15, 7, 4,
+	2, 13, 9, 4, 2, 11, 12, 4, 2, 9, 14, 4, 3, 6, 15, 2, 4, 3, 4, 15, 4, 4, 3, 2,
+	15, 6, 5, 2, 14, 9, 5, 2, 12, 11, 5, 2, 9, 13, 5, 3, 7, 15, 1, 5, 3, 5, 15, 3,
+	5, 3, 2, 15, 6, 6, 2, 15, 8, 6, 2, 12, 10, 6, 2, 10, 13, 6, 2, 8, 15, 6, 3, 5,
+	15, 3, 6, 3, 3, 15, 5, 6, 3, 1, 15, 7, 7, 2, 13, 10, 7, 2, 11, 12, 7, 2, 8, 14,
+	7, 3, 6, 15, 2, 7, 3, 4, 15, 4, 7, 3, 1, 15, 6, 8, 2, 14, 9, 8, 2, 12, 11, 8,
+	2, 9, 14, 8, 3, 7, 15, 1, 8, 3, 4, 15, 3, 8, 3, 2, 15, 6, 9, 2, 15, 8, 9, 2,
+	12, 10, 9, 2, 10, 13, 9, 2, 8, 15, 9, 3, 5, 15, 3, 9, 3, 3, 15, 5, 9, 3, 1, 15,
+	7, 10, 2, 13, 10, 10, 2, 11, 12, 10, 2, 8, 14, 10, 3, 6, 15, 2, 10, 3, 4, 15, 4, 10,
+	3, 1, 15, 7, 11, 2, 14, 9, 11, 2, 11, 11, 11, 2, 9, 14, 11, 3, 7, 15, 1, 11, 3, 4,
+	15, 4, 11, 3, 2, 15, 6, 12, 2, 14, 8, 12, 2, 12, 11, 12, 2, 10, 13, 12, 2, 7, 15, 12,
+	3, 5, 15, 3, 12, 3, 3, 15, 5, 13, 2, 15, 7, 13, 2, 13, 10, 13, 2, 11, 12, 13, 2, 8,
+	15, 13, 3, 6, 15, 2, 13, 3, 3, 15, 4, 13, 3, 1, 15, 7, 14, 2, 14, 9, 14, 2, 11, 11,
+	14, 2, 9, 14, 14, 3, 7, 15, 1, 14, 3, 4, 15, 4, 14, 3, 2, 15, 6, 15, 2, 14, 8, 15,
+	2, 12, 11, 15, 2, 10, 13, 15, 3, 7, 15, 1, 15, 3, 5, 15, 3, 15, 3, 3, 15, 5, 16, 2,
+	15, 8, 16, 2, 13, 10, 16, 2, 10, 12, 16, 2, 8, 15, 16, 3, 6, 15, 2, 16, 3, 3, 15, 5,
+	16, 3, 1, 15, 7, 17, 2, 13, 9, 17, 2, 11, 12, 17, 2, 9, 14, 17, 3, 6, 15, 1, 17, 3,
+	4, 15, 4, 17, 3, 2, 15, 6, 18, 2, 14, 8, 18, 2, 12, 11, 18, 2, 10, 13, 18, 3, 7, 15,
+	1, 18, 3, 5, 15, 3, 18, 3, 2, 15, 5, 19, 2, 15, 8, 19, 2, 13, 10, 19, 2, 10, 12, 19,
+	2, 8, 15, 19, 3, 6, 15, 2, 19, 3, 3, 15, 5, 19, 3, 1, 15, 7, 20, 2, 13, 9, 20, 2,
+	11, 12, 20, 2, 9, 14, 20, 3, 6, 15, 2, 20, 3, 4, 15, 4, 21, 1, 4, 0, 0, 0, 0, 0,
+	0, 0, 3, 1, 14, 6, 1, 2, 14, 8, 1, 2, 12, 10, 1, 2, 10, 12, 1, 2, 8, 14, 1, 3,
+	6, 15, 2, 1, 3, 4, 15, 4, 1, 3, 2, 15, 6, 2, 2, 15, 8, 2, 2, 13, 10, 2, 2, 10,
+	12, 2, 2, 8, 14, 2, 3, 6, 15, 1, 2, 3, 4, 15, 4, 2, 3, 2, 15, 6, 3, 2, 15, 8,
+	3, 2, 13, 10, 3, 2, 11, 12, 3, 2, 9, 14, 3, 3, 7, 15, 1, 3, 3, 4, 15, 3, 3, 3,
+	2, 15, 5, 4, 2, 15, 8, 4, 2, 13, 10, 4, 2, 11, 12, 4, 2, 9, 14, 4, 3, 7, 15, 1,
+	4, 3, 5, 15, 3, 4, 3, 3, 15, 5, 4, 3, 1, 15, 7, 5, 2, 13, 9, 5, 2, 11, 11, 5,
+	2, 9, 14, 5, 3, 7, 15, 1, 5, 3, 5, 15, 3, 5, 3, 3, 15, 5, 5, 3, 1, 15, 7, 6,
+	2, 14, 9, 6, 2, 11, 11, 6, 2, 9, 13, 6, 3, 7, 15, 1, 6, 3, 5, 15, 3, 6, 3, 3,
+	15, 5, 6, 3, 1, 15, 7, 7, 2, 14, 9, 7, 2, 12, 11, 7, 2, 10, 13, 7, 2, 8, 15, 7,
+	3, 5, 15, 2, 7, 3, 3, 15, 4, 7, 3, 1, 15, 7, 8, 2, 14, 9, 8, 2, 12, 11, 8, 2,
+	10, 13, 8, 2, 8, 15, 8, 3, 6, 15, 2, 8, 3, 4, 15, 4, 8, 3, 1, 15, 6, 9, 2, 14,
+	8, 9, 2, 12, 10, 9, 2, 10, 13, 9, 2, 8, 15, 9, 3, 6, 15, 2, 9, 3, 4, 15, 4, 9,
+	3, 2, 15, 6, 10, 2, 14, 8, 10, 2, 12, 10, 10, 2, 10, 12, 10, 2, 8, 14, 10, 3, 6, 15,
+	2, 10, 3, 4, 15, 4, 10, 3, 2, 15, 6, 11, 2, 15, 8, 11, 2, 13, 10, 11, 2, 11, 12, 11,
+	2, 8, 14, 11, 3, 6, 15, 1, 11, 3, 4, 15, 3, 11, 3, 2, 15, 6, 12, 2, 15, 8, 12, 2,
+	13, 10, 12, 2, 11, 12, 12, 2, 9, 14, 12, 3, 7, 15, 1, 12, 3, 5, 15, 3, 12, 3, 2, 15,
+	5, 13, 2, 15, 7, 13, 2, 13, 10, 13, 2, 11, 12, 13, 2, 9, 14, 13, 3, 7, 15, 1, 13, 3,
+	5, 15, 3, 13, 3, 3, 15, 5, 13, 3, 1, 15, 7, 14, 2, 13, 9, 14, 2, 11, 11, 14, 2, 9,
+	13, 14, 3, 7, 15, 1, 14, 3, 5, 15, 3, 14, 3, 3, 15, 5, 14, 3, 1, 15, 7, 15, 2, 14,
+	9, 15, 2, 12, 11, 15, 2, 9, 13, 15, 2, 7, 15, 15, 3, 5, 15, 3, 15, 3, 3, 15, 5, 15,
+	3, 1, 15, 7, 16, 2, 14, 9, 16, 2, 12, 11, 16, 2, 10, 13, 16, 2, 8, 15, 16, 3, 6, 15,
+	2, 16, 3, 3, 15, 4, 16, 3, 1, 15, 6, 17, 2, 14, 9, 17, 2, 12, 11, 17, 2, 10, 13, 17,
+	2, 8, 15, 17, 3, 6, 15, 2, 17, 3, 4, 15, 4, 17, 3, 2, 15, 6, 18, 2, 14, 8, 18, 2,
+	12, 10, 18, 2, 10, 12, 18, 2, 8, 15, 18, 3, 6, 15, 2, 18, 3, 4, 15, 4, 19, 1, 4, 0,
+	0, 0, 0, 0, 2, 3, 2, 0, 2, 13, 10, 0, 2, 11, 12, 0, 2, 9, 14, 0, 3, 7, 15, 1,
+	0, 3, 5, 15, 2, 0, 3, 4, 15, 4, 0, 3, 2, 15, 6, 1, 2, 15, 8, 1, 2, 13, 10, 1,
+	2, 11, 11, 1, 2, 9, 13, 1, 2, 7, 15, 1, 3, 6, 15, 2, 1, 3, 4, 15, 4, 1, 3, 2,
+	15, 6, 2, 2, 15, 8, 2, 2, 13, 9, 2, 2, 11, 11, 2, 2, 10, 13, 2, 2, 8, 15, 2, 3,
+	6, 15, 2, 2, 3, 4, 15, 4, 2, 3, 2, 15, 5, 3, 2, 15, 7, 3, 2, 13, 9, 3, 2, 12,
+	11, 3, 2, 10, 13, 3, 2, 8, 15, 3, 3, 6, 15, 2, 3, 3, 4, 15, 3, 3, 3, 3, 15, 5,
+	3, 3, 1, 15, 7, 4, 2, 14, 9, 4, 2, 12, 11, 4, 2, 10, 13, 4, 2, 8, 14, 4, 3, 6,
+	15, 1, 4, 3, 5, 15, 3, 4, 3, 3, 15, 5, 4, 3, 1, 15, 7, 5, 2, 14, 9, 5, 2, 12,
+	10, 5, 2, 10, 12, 5, 2, 9, 14, 5, 3, 7, 15, 1, 5, 3, 5, 15, 3, 5, 3, 3, 15, 5,
+	5, 3, 1, 15, 7, 6, 2, 14, 8, 6, 2, 12, 10, 6, 2, 11, 12, 6, 2, 9, 14, 6, 3, 7,
+	15, 1, 6, 3, 5, 15, 3, 6, 3, 3, 15, 4, 6, 3, 1, 15, 6, 7, 2, 15, 8, 7, 2, 13,
+	10, 7, 2, 11, 12, 7, 2, 9, 14, 7, 2, 7, 15, 7, 3, 5, 15, 2, 7, 3, 4, 15, 4, 7,
+	3, 2, 15, 6, 8, 2, 15, 8, 8, 2, 13, 10, 8, 2, 11, 11, 8, 2, 9, 13, 8, 2, 7, 15,
+	8, 3, 6, 15, 2, 8, 3, 4, 15, 4, 8, 3, 2, 15, 6, 9, 2, 15, 8, 9, 2, 13, 9, 9,
+	2, 11, 11, 9, 2, 10, 13, 9, 2, 8, 15, 9, 3, 6, 15, 2, 9, 3, 4, 15, 4, 9, 3, 2,
+	15, 5, 10, 2, 15, 7, 10, 2, 14, 9, 10, 2, 12, 11, 10, 2, 10, 13, 10, 2, 8, 15, 10, 3,
+	6, 15, 2, 10, 3, 4, 15, 3, 10, 3, 3, 15, 5, 10, 3, 1, 15, 7, 11, 2, 14, 9, 11, 2,
+	12, 11, 11, 2, 10, 12, 11, 2, 8, 14, 11, 3, 6, 15, 1, 11, 3, 5, 15, 3, 11, 3, 3, 15,
+	5, 11, 3, 1, 15, 7, 12, 2, 14, 9, 12, 2, 12, 10, 12, 2, 10, 12, 12, 2, 9, 14, 12, 3,
+	7, 15, 1, 12, 3, 5, 15, 3, 12, 3, 3, 15, 5, 12, 3, 1, 15, 6, 13, 2, 14, 8, 13, 2,
+	12, 10, 13, 2, 11, 12, 13, 2, 9, 14, 13, 3, 7, 15, 1, 13, 3, 5, 15, 3, 13, 3, 3, 15,
+	4, 13, 3, 2, 15, 6, 14, 2, 15, 8, 14, 2, 13, 10, 14, 2, 11, 12, 14, 2, 9, 14, 14, 2,
+	7, 15, 14, 3, 5, 15, 2, 14, 3, 4, 15, 4, 14, 3, 2, 15, 6, 15, 2, 15, 8, 15, 2, 13,
+	10, 15, 2, 11, 11, 15, 2, 9, 13, 15, 2, 8, 15, 15, 3, 6, 15, 2, 15, 3, 4, 15, 4, 16,
+	1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 5, 7, 0, 2, 9, 14, 0, 2, 7, 15, 0, 3, 6, 15,
+	2, 0, 3, 4, 15, 3, 0, 3, 3, 15, 5, 0, 3, 1, 15, 6, 1, 2, 15, 8, 1, 2, 13, 10,
+	1, 2, 11, 11, 1, 2, 10, 13, 1, 2, 8, 14, 1, 3, 7, 15, 1, 1, 3, 5, 15, 3, 1, 3,
+	4, 15, 4, 1, 3, 2, 15, 6, 2, 2, 15, 7, 2, 2, 14, 9, 2, 2, 12, 10, 2, 2, 11, 12,
+	2, 2, 9, 14, 2, 2, 8, 15, 2, 3, 6, 15, 2, 2, 3, 4, 15, 3, 2, 3, 3, 15, 5, 2,
+	3, 1, 15, 6, 3, 2, 15, 8, 3, 2, 13, 10, 3, 2, 11, 11, 3, 2, 10, 13, 3, 2, 8, 14,
+	3, 3, 7, 15, 1, 3, 3, 5, 15, 2, 3, 3, 4, 15, 4, 3, 3, 2, 15, 6, 4, 2, 15, 7,
+	4, 2, 14, 9, 4, 2, 12, 10, 4, 2, 11, 12, 4, 2, 9, 13, 4, 2, 8, 15, 4, 3, 6, 15,
+	2, 4, 3, 4, 15, 3, 4, 3, 3, 15, 5, 4, 3, 1, 15, 6, 5, 2, 15, 8, 5, 2, 13, 10,
+	5, 2, 11, 11, 5, 2, 10, 13, 5, 2, 8, 14, 5, 3, 7, 15, 1, 5, 3, 5, 15, 2, 5, 3,
+	4, 15, 4, 5, 3, 2, 15, 6, 5, 3, 1, 15, 7, 6, 2, 14, 9, 6, 2, 12, 10, 6, 2, 11,
+	12, 6, 2, 9, 13, 6, 2, 8, 15, 6, 3, 6, 15, 2, 6, 3, 4, 15, 3, 6, 3, 3, 15, 5,
+	6, 3, 1, 15, 6, 7, 2, 15, 8, 7, 2, 13, 9, 7, 2, 12, 11, 7, 2, 10, 13, 7, 2, 8,
+	14, 7, 3, 7, 15, 1, 7, 3, 5, 15, 2, 7, 3, 4, 15, 4, 7, 3, 2, 15, 6, 7, 3, 1,
+	15, 7, 8, 2, 14, 9, 8, 2, 12, 10, 8, 2, 11, 12, 8, 2, 9, 13, 8, 2, 8, 15, 8, 3,
+	6, 15, 2, 8, 3, 5, 15, 3, 8, 3, 3, 15, 5, 8, 3, 1, 15, 6, 9, 2, 15, 8, 9, 2,
+	13, 9, 9, 2, 12, 11, 9, 2, 10, 13, 9, 2, 8, 14, 9, 3, 7, 15, 1, 9, 3, 5, 15, 2,
+	9, 3, 4, 15, 4, 9, 3, 2, 15, 5, 9, 3, 1, 15, 7, 10, 2, 14, 9, 10, 2, 12, 10, 10,
+	2, 11, 12, 10, 2, 9, 13, 10, 2, 8, 15, 10, 3, 6, 15, 2, 10, 3, 5, 15, 3, 10, 3, 3,
+	15, 5, 10, 3, 1, 15, 6, 11, 2, 15, 8, 11, 2, 13, 9, 11, 2, 12, 11, 11, 2, 10, 13, 11,
+	2, 8, 14, 11, 3, 7, 15, 1, 11, 3, 5, 15, 2, 11, 3, 4, 15, 4, 11, 3, 2, 15, 5, 11,
+	3, 1, 15, 7, 12, 2, 14, 9, 12, 2, 12, 10, 12, 2, 11, 12, 12, 2, 9, 13, 12, 2, 8, 15,
+	12, 3, 6, 15, 2, 12, 3, 5, 15, 3, 12, 3, 3, 15, 5, 12, 3, 1, 15, 6, 13, 2, 15, 8,
+	13, 2, 13, 9, 13, 2, 12, 11, 13, 2, 10, 12, 13, 2, 9, 14, 13, 3, 7, 15, 1, 13, 3, 5,
+	15, 2, 13, 3, 4, 15, 4, 14, 1, 4, 0, 0, 0, 0, 0, 0, 0, 2, 4, 11, 0, 3, 5, 15,
+	2, 0, 3, 4, 15, 3, 0, 3, 3, 15, 5, 0, 3, 2, 15, 6, 1, 2, 15, 7, 1, 2, 14, 9,
+	1, 2, 13, 10, 1, 2, 11, 11, 1, 2, 10, 13, 1, 2, 9, 14, 1, 2, 7, 15, 1, 3, 6, 15,
+	2, 1, 3, 5, 15, 3, 1, 3, 3, 15, 4, 1, 3, 2, 15, 6, 1, 3, 1, 15, 7, 2, 2, 14,
+	8, 2, 2, 13, 9, 2, 2, 12, 11, 2, 2, 11, 12, 2, 2, 9, 13, 2, 2, 8, 15, 2, 3, 7,
+	15, 1, 2, 3, 5, 15, 2, 2, 3, 4, 15, 4, 2, 3, 3, 15, 5, 2, 3, 1, 15, 6, 3, 2,
+	15, 8, 3, 2, 14, 9, 3, 2, 12, 10, 3, 2, 11, 11, 3, 2, 10, 13, 3, 2, 8, 14, 3, 2,
+	7, 15, 3, 3, 6, 15, 2, 3, 3, 5, 15, 3, 3, 3, 3, 15, 4, 3, 3, 2, 15, 6, 3, 3,
+	1, 15, 7, 4, 2, 14, 8, 4, 2, 13, 10, 4, 2, 12, 11, 4, 2, 10, 12, 4, 2, 9, 14, 4,
+	2, 8, 15, 4, 3, 6, 15, 1, 4, 3, 5, 15, 3, 4, 3, 4, 15, 4, 4, 3, 2, 15, 5, 4,
+	3, 1, 15, 6, 5, 2, 15, 8, 5, 2, 14, 9, 5, 2, 12, 10, 5, 2, 11, 12, 5, 2, 10, 13,
+	5, 2, 8, 14, 5, 3, 7, 15, 1, 5, 3, 6, 15, 2, 5, 3, 4, 15, 3, 5, 3, 3, 15, 5,
+	5, 3, 2, 15, 6, 6, 2, 15, 7, 6, 2, 14, 8, 6, 2, 13, 10, 6, 2, 11, 11, 6, 2, 10,
+	12, 6, 2, 9, 14, 6, 2, 8, 15, 6, 3, 6, 15, 1, 6, 3, 5, 15, 3, 6, 3, 4, 15, 4,
+	6, 3, 2, 15, 5, 6, 3, 1, 15, 7, 7, 2, 15, 8, 7, 2, 13, 9, 7, 2, 12, 11, 7, 2,
+	11, 12, 7, 2, 9, 13, 7, 2, 8, 14, 7, 3, 7, 15, 1, 7, 3, 5, 15, 2, 7, 3, 4, 15,
+	3, 7, 3, 3, 15, 5, 7, 3, 2, 15, 6, 8, 2, 15, 7, 8, 2, 14, 9, 8, 2, 13, 10, 8,
+	2, 11, 11, 8, 2, 10, 13, 8, 2, 9, 14, 8, 2, 7, 15, 8, 3, 6, 15, 2, 8, 3, 5, 15,
+	3, 8, 3, 3, 15, 4, 8, 3, 2, 15, 5, 8, 3, 1, 15, 7, 9, 2, 14, 8, 9, 2, 13, 9,
+	9, 2, 12, 11, 9, 2, 11, 12, 9, 2, 9, 13, 9, 2, 8, 15, 9, 3, 7, 15, 1, 9, 3, 5,
+	15, 2, 9, 3, 4, 15, 4, 9, 3, 3, 15, 5, 9, 3, 1, 15, 6, 10, 2, 15, 8, 10, 2, 14,
+	9, 10, 2, 12, 10, 10, 2, 11, 11, 10, 2, 10, 13, 10, 2, 8, 14, 10, 2, 7, 15, 10, 3, 6,
+	15, 2, 10, 3, 5, 15, 3, 10, 3, 3, 15, 4, 10, 3, 2, 15, 6, 10, 3, 1, 15, 7, 11, 2,
+	14, 8, 11, 2, 13, 10, 11, 2, 12, 11, 11, 2, 10, 12, 11, 2, 9, 14, 11, 2, 8, 15, 11, 3,
+	6, 15, 1, 11, 3, 5, 15, 2, 11, 3, 4, 15, 4, 12, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3,
+	2, 14, 4, 0, 3, 2, 15, 6, 0, 3, 1, 15, 7, 1, 2, 15, 8, 1, 2, 14, 9, 1, 2, 13,
+	10, 1, 2, 12, 11, 1, 2, 11, 12, 1, 2, 10, 13, 1, 2, 9, 14, 1, 2, 8, 15, 1, 3, 7,
+	15, 1, 1, 3, 5, 15, 2, 1, 3, 4, 15, 3, 1, 3, 3, 15, 4, 1, 3, 2, 15, 5, 1, 3,
+	1, 15, 6, 2, 2, 15, 7, 2, 2, 14, 8, 2, 2, 13, 9, 2, 2, 12, 10, 2, 2, 11, 12, 2,
+	2, 10, 13, 2, 2, 9, 14, 2, 2, 8, 15, 2, 3, 7, 15, 1, 2, 3, 6, 15, 2, 2, 3, 5,
+	15, 3, 2, 3, 4, 15, 4, 2, 3, 3, 15, 5, 2, 3, 2, 15, 6, 2, 3, 1, 15, 7, 3, 2,
+	14, 8, 3, 2, 13, 9, 3, 2, 12, 10, 3, 2, 11, 11, 3, 2, 10, 12, 3, 2, 9, 13, 3, 2,
+	8, 14, 3, 2, 7, 15, 3, 3, 6, 15, 1, 3, 3, 5, 15, 3, 3, 3, 4, 15, 4, 3, 3, 3,
+	15, 5, 3, 3, 2, 15, 6, 3, 3, 1, 15, 7, 4, 2, 15, 8, 4, 2, 14, 9, 4, 2, 13, 10,
+	4, 2, 12, 11, 4, 2, 11, 12, 4, 2, 10, 13, 4, 2, 8, 14, 4, 2, 7, 15, 4, 3, 6, 15,
+	1, 4, 3, 5, 15, 2, 4, 3, 4, 15, 3, 4, 3, 3, 15, 4, 4, 3, 2, 15, 5, 4, 3, 1,
+	15, 6, 5, 2, 15, 7, 5, 2, 14, 8, 5, 2, 13, 10, 5, 2, 12, 11, 5, 2, 11, 12, 5, 2,
+	10, 13, 5, 2, 9, 14, 5, 2, 8, 15, 5, 3, 7, 15, 1, 5, 3, 6, 15, 2, 5, 3, 5, 15,
+	3, 5, 3, 4, 15, 4, 5, 3, 3, 15, 5, 5, 3, 1, 15, 6, 6, 2, 15, 7, 6, 2, 14, 8,
+	6, 2, 13, 9, 6, 2, 12, 10, 6, 2, 11, 11, 6, 2, 10, 12, 6, 2, 9, 13, 6, 2, 8, 14,
+	6, 3, 7, 15, 1, 6, 3, 6, 15, 2, 6, 3, 5, 15, 3, 6, 3, 4, 15, 4, 6, 3, 3, 15,
+	5, 6, 3, 2, 15, 6, 6, 3, 1, 15, 7, 7, 2, 15, 8, 7, 2, 14, 9, 7, 2, 13, 10, 7,
+	2, 12, 11, 7, 2, 10, 12, 7, 2, 9, 13, 7, 2, 8, 14, 7, 2, 7, 15, 7, 3, 6, 15, 1,
+	7, 3, 5, 15, 2, 7, 3, 4, 15, 3, 7, 3, 3, 15, 4, 7, 3, 2, 15, 5, 7, 3, 1, 15,
+	7, 8, 2, 15, 8, 8, 2, 14, 9, 8, 2, 13, 10, 8, 2, 12, 11, 8, 2, 11, 12, 8, 2, 10,
+	13, 8, 2, 9, 14, 8, 2, 8, 15, 8, 3, 7, 15, 1, 8, 3, 6, 15, 2, 8, 3, 5, 15, 3,
+	8, 3, 3, 15, 4, 8, 3, 2, 15, 5, 8, 3, 1, 15, 6, 9, 2, 15, 7, 9, 2, 14, 8, 9,
+	2, 13, 9, 9, 2, 12, 10, 9, 2, 11, 11, 9, 2, 10, 12, 9, 2, 9, 14, 9, 2, 8, 15, 9,
+	3, 7, 15, 1, 9, 3, 6, 15, 2, 9, 3, 5, 15, 3, 9, 3, 4, 15, 4, 10, 1, 4, 0, 0,
+	0, 0, 0, 1, 1, 0, 2, 14, 8, 0, 2, 14, 9, 0, 2, 13, 10, 0, 2, 12, 10, 0, 2, 11,
+	11, 0, 2, 10, 12, 0, 2, 10, 13, 0, 2, 9, 14, 0, 2, 8, 14, 0, 2, 7, 15, 0, 3, 7,
+	15, 1, 0, 3, 6, 15, 2, 0, 3, 5, 15, 3, 0, 3, 4, 15, 3, 0, 3, 3, 15, 4, 0, 3,
+	3, 15, 5, 0, 3, 2, 15, 6, 0, 3, 1, 15, 7, 1, 2, 15, 7, 1, 2, 14, 8, 1, 2, 14,
+	9, 1, 2, 13, 10, 1, 2, 12, 10, 1, 2, 11, 11, 1, 2, 11, 12, 1, 2, 10, 13, 1, 2, 9,
+	14, 1, 2, 8, 14, 1, 2, 7, 15, 1, 3, 7, 15, 1, 1, 3, 6, 15, 2, 1, 3, 5, 15, 3,
+	1, 3, 4, 15, 3, 1, 3, 3, 15, 4, 1, 3, 3, 15, 5, 1, 3, 2, 15, 6, 1, 3, 1, 15,
+	6, 2, 2, 15, 7, 2, 2, 15, 8, 2, 2, 14, 9, 2, 2, 13, 10, 2, 2, 12, 10, 2, 2, 11,
+	11, 2, 2, 11, 12, 2, 2, 10, 13, 2, 2, 9, 14, 2, 2, 8, 14, 2, 2, 7, 15, 2, 3, 7,
+	15, 1, 2, 3, 6, 15, 2, 2, 3, 5, 15, 2, 2, 3, 4, 15, 3, 2, 3, 4, 15, 4, 2, 3,
+	3, 15, 5, 2, 3, 2, 15, 6, 2, 3, 1, 15, 6, 3, 2, 15, 7, 3, 2, 15, 8, 3, 2, 14,
+	9, 3, 2, 13, 10, 3, 2, 12, 10, 3, 2, 11, 11, 3, 2, 11, 12, 3, 2, 10, 13, 3, 2, 9,
+	13, 3, 2, 8, 14, 3, 2, 8, 15, 3, 3, 7, 15, 1, 3, 3, 6, 15, 2, 3, 3, 5, 15, 2,
+	3, 3, 4, 15, 3, 3, 3, 4, 15, 4, 3, 3, 3, 15, 5, 3, 3, 2, 15, 6, 3, 3, 1, 15,
+	6, 4, 2, 15, 7, 4, 2, 15, 8, 4, 2, 14, 9, 4, 2, 13, 9, 4, 2, 12, 10, 4, 2, 11,
+	11, 4, 2, 11, 12, 4, 2, 10, 13, 4, 2, 9, 13, 4, 2, 8, 14, 4, 2, 8, 15, 4, 3, 7,
+	15, 1, 4, 3, 6, 15, 2, 4, 3, 5, 15, 2, 4, 3, 4, 15, 3, 4, 3, 4, 15, 4, 4, 3,
+	3, 15, 5, 4, 3, 2, 15, 5, 4, 3, 1, 15, 6, 4, 3, 1, 15, 7, 5, 2, 15, 8, 5, 2,
+	14, 9, 5, 2, 13, 9, 5, 2, 12, 10, 5, 2, 12, 11, 5, 2, 11, 12, 5, 2, 10, 13, 5, 2,
+	9, 13, 5, 2, 8, 14, 5, 2, 8, 15, 5, 3, 7, 15, 1, 5, 3, 6, 15, 1, 5, 3, 5, 15,
+	2, 5, 3, 4, 15, 3, 5, 3, 4, 15, 4, 5, 3, 3, 15, 5, 5, 3, 2, 15, 5, 5, 3, 1,
+	15, 6, 5, 3, 1, 15, 7, 6, 2, 15, 8, 6, 2, 14, 9, 6, 2, 13, 9, 6, 2, 12, 10, 6,
+	2, 12, 11, 6, 2, 11, 12, 6, 2, 10, 12, 6, 2, 9, 13, 6, 2, 8, 14, 6, 2, 8, 15, 6,
+	3, 7, 15, 1, 6, 3, 6, 15, 1, 6, 3, 5, 15, 2, 6, 3, 5, 15, 3, 6, 3, 4, 15, 4,
+	7, 1, 4, 0, 0, 0, 0, 0, 2, 1, 1, 0, 2, 11, 12, 0, 2, 10, 12, 0, 2, 10, 13, 0,
+	2, 9, 13, 0, 2, 9, 14, 0, 2, 8, 14, 0, 2, 8, 15, 0, 2, 7, 15, 0, 3, 7, 15, 1,
+	0, 3, 6, 15, 1, 0, 3, 6, 15, 2, 0, 3, 5, 15, 2, 0, 3, 5, 15, 3, 0, 3, 4, 15,
+	4, 0, 3, 3, 15, 4, 0, 3, 3, 15, 5, 0, 3, 2, 15, 5, 0, 3, 2, 15, 6, 0, 3, 1,
+	15, 6, 0, 3, 1, 15, 7, 1, 2, 15, 7, 1, 2, 15, 8, 1, 2, 14, 8, 1, 2, 14, 9, 1,
+	2, 13, 9, 1, 2, 13, 10, 1, 2, 12, 10, 1, 2, 12, 11, 1, 2, 11, 11, 1, 2, 11, 12, 1,
+	2, 10, 12, 1, 2, 10, 13, 1, 2, 9, 13, 1, 2, 9, 14, 1, 2, 8, 15, 1, 2, 7, 15, 1,
+	3, 7, 15, 1, 1, 3, 6, 15, 1, 1, 3, 6, 15, 2, 1, 3, 5, 15, 2, 1, 3, 5, 15, 3,
+	1, 3, 4, 15, 3, 1, 3, 4, 15, 4, 1, 3, 3, 15, 4, 1, 3, 3, 15, 5, 1, 3, 2, 15,
+	5, 1, 3, 2, 15, 6, 1, 3, 1, 15, 6, 1, 3, 1, 15, 7, 2, 2, 15, 7, 2, 2, 15, 8,
+	2, 2, 14, 8, 2, 2, 14, 9, 2, 2, 13, 9, 2, 2, 13, 10, 2, 2, 12, 11, 2, 2, 11, 11,
+	2, 2, 11, 12, 2, 2, 10, 12, 2, 2, 10, 13, 2, 2, 9, 13, 2, 2, 9, 14, 2, 2, 8, 14,
+	2, 2, 8, 15, 2, 2, 7, 15, 2, 3, 7, 15, 1, 2, 3, 6, 15, 1, 2, 3, 6, 15, 2, 2,
+	3, 5, 15, 2, 2, 3, 5, 15, 3, 2, 3, 4, 15, 3, 2, 3, 4, 15, 4, 2, 3, 3, 15, 4,
+	2, 3, 3, 15, 5, 2, 3, 2, 15, 5, 2, 3, 2, 15, 6, 2, 3, 1, 15, 7, 3, 2, 15, 7,
+	3, 2, 15, 8, 3, 2, 14, 8, 3, 2, 14, 9, 3, 2, 13, 9, 3, 2, 13, 10, 3, 2, 12, 10,
+	3, 2, 12, 11, 3, 2, 11, 11, 3, 2, 11, 12, 3, 2, 10, 12, 3, 2, 10, 13, 3, 2, 9, 13,
+	3, 2, 9, 14, 3, 2, 8, 14, 3, 2, 8, 15, 3, 2, 7, 15, 3, 3, 7, 15, 1, 3, 3, 6,
+	15, 1, 3, 3, 6, 15, 2, 3, 3, 5, 15, 3, 3, 3, 4, 15, 3, 3, 3, 4, 15, 4, 3, 3,
+	3, 15, 4, 3, 3, 3, 15, 5, 3, 3, 2, 15, 5, 3, 3, 2, 15, 6, 3, 3, 1, 15, 6, 3,
+	3, 1, 15, 7, 4, 2, 15, 7, 4, 2, 15, 8, 4, 2, 14, 8, 4, 2, 14, 9, 4, 2, 13, 9,
+	4, 2, 13, 10, 4, 2, 12, 10, 4, 2, 12, 11, 4, 2, 11, 11, 4, 2, 11, 12, 4, 2, 10, 12,
+	4, 2, 10, 13, 4, 2, 9, 14, 4, 2, 8, 14, 4, 2, 8, 15, 4, 2, 7, 15, 4, 3, 7, 15,
+	1, 4, 3, 6, 15, 1, 4, 3, 6, 15, 2, 4, 3, 5, 15, 2, 4, 3, 5, 15, 3, 4, 3, 4,
+	15, 3, 4, 3, 4, 15, 4, 5, 1, 4, 0, 0, 0, 0, 1, 1, 3, 0, 2, 7, 15, 0, 3, 7,
+	15, 1, 0, 3, 7, 15, 1, 0, 3, 6, 15, 1, 0, 3, 6, 15, 1, 0, 3, 6, 15, 2, 0, 3,
+	6, 15, 2, 0, 3, 5, 15, 2, 0, 3, 5, 15, 2, 0, 3, 5, 15, 3, 0, 3, 5, 15, 3, 0,
+	3, 4, 15, 3, 0, 3, 4, 15, 3, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 3, 15, 4,
+	0, 3, 3, 15, 4, 0, 3, 3, 15, 5, 0, 3, 3, 15, 5, 0, 3, 2, 15, 5, 0, 3, 2, 15,
+	5, 0, 3, 2, 15, 6, 0, 3, 2, 15, 6, 0, 3, 1, 15, 6, 0, 3, 1, 15, 7, 0, 3, 1,
+	15, 7, 1, 2, 15, 7, 1, 2, 15, 7, 1, 2, 15, 8, 1, 2, 15, 8, 1, 2, 14, 8, 1, 2,
+	14, 8, 1, 2, 14, 9, 1, 2, 14, 9, 1, 2, 13, 9, 1, 2, 13, 9, 1, 2, 13, 10, 1, 2,
+	13, 10, 1, 2, 12, 10, 1, 2, 12, 10, 1, 2, 12, 11, 1, 2, 12, 11, 1, 2, 11, 11, 1, 2,
+	11, 11, 1, 2, 11, 12, 1, 2, 10, 12, 1, 2, 10, 12, 1, 2, 10, 13, 1, 2, 10, 13, 1, 2,
+	9, 13, 1, 2, 9, 13, 1, 2, 9, 14, 1, 2, 9, 14, 1, 2, 8, 14, 1, 2, 8, 14, 1, 2,
+	8, 15, 1, 2, 8, 15, 1, 2, 7, 15, 1, 2, 7, 15, 1, 3, 7, 15, 1, 1, 3, 7, 15, 1,
+	1, 3, 6, 15, 1, 1, 3, 6, 15, 1, 1, 3, 6, 15, 2, 1, 3, 6, 15, 2, 1, 3, 5, 15,
+	2, 1, 3, 5, 15, 3, 1, 3, 5, 15, 3, 1, 3, 4, 15, 3, 1, 3, 4, 15, 3, 1, 3, 4,
+	15, 4, 1, 3, 4, 15, 4, 1, 3, 3, 15, 4, 1, 3, 3, 15, 4, 1, 3, 3, 15, 5, 1, 3,
+	3, 15, 5, 1, 3, 2, 15, 5, 1, 3, 2, 15, 5, 1, 3, 2, 15, 6, 1, 3, 2, 15, 6, 1,
+	3, 1, 15, 6, 1, 3, 1, 15, 6, 1, 3, 1, 15, 7, 1, 3, 1, 15, 7, 2, 2, 15, 7, 2,
+	2, 15, 7, 2, 2, 15, 8, 2, 2, 14, 8, 2, 2, 14, 8, 2, 2, 14, 9, 2, 2, 14, 9, 2,
+	2, 13, 9, 2, 2, 13, 9, 2, 2, 13, 10, 2, 2, 13, 10, 2, 2, 12, 10, 2, 2, 12, 10, 2,
+	2, 12, 11, 2, 2, 12, 11, 2, 2, 11, 11, 2, 2, 11, 11, 2, 2, 11, 12, 2, 2, 11, 12, 2,
+	2, 10, 12, 2, 2, 10, 12, 2, 2, 10, 13, 2, 2, 10, 13, 2, 2, 9, 13, 2, 2, 9, 14, 2,
+	2, 9, 14, 2, 2, 8, 14, 2, 2, 8, 14, 2, 2, 8, 15, 2, 2, 8, 15, 2, 2, 7, 15, 2,
+	2, 7, 15, 2, 3, 7, 15, 1, 2, 3, 7, 15, 1, 2, 3, 6, 15, 1, 2, 3, 6, 15, 1, 2,
+	3, 6, 15, 2, 2, 3, 6, 15, 2, 2, 3, 5, 15, 2, 2, 3, 5, 15, 2, 2, 3, 5, 15, 3,
+	2, 3, 5, 15, 3, 2, 3, 4, 15, 3, 2, 3, 4, 15, 3, 2, 3, 4, 15, 4, 3, 1, 4, 0,
+	0, 0, 0, 1, 1, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4,
+	15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3,
+	4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0,
+	3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4,
+	0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15,
+	4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4,
+	15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3,
+	4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0,
+	3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4,
+	0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15,
+	4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4,
+	15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3,
+	4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0,
+	3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4,
+	0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15,
+	4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4,
+	15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3,
+	4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0,
+	3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4,
+	0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15,
+	4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4,
+	15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3,
+	4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0,
+	3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4,
+	0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15,
+	4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4,
+	15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3, 4, 15, 4, 0, 3,
+	4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 3, 1, 3, 3, 2, 15, 7, 2, 3, 1, 15, 7, 2, 3,
+	1, 15, 7, 2, 3, 1, 15, 6, 2, 3, 1, 15, 6, 2, 3, 2, 15, 6, 2, 3, 2, 15, 6, 2,
+	3, 2, 15, 5, 2, 3, 2, 15, 5, 2, 3, 3, 15, 5, 2, 3, 3, 15, 5, 2, 3, 3, 15, 4,
+	2, 3, 3, 15, 4, 2, 3, 4, 15, 4, 2, 3, 4, 15, 4, 2, 3, 4, 15, 3, 2, 3, 4, 15,
+	3, 2, 3, 5, 15, 3, 2, 3, 5, 15, 3, 2, 3, 5, 15, 2, 2, 3, 5, 15, 2, 2, 3, 6,
+	15, 2, 2, 3, 6, 15, 2, 2, 3, 6, 15, 1, 2, 3, 7, 15, 1, 2, 3, 7, 15, 1, 2, 2,
+	7, 15, 2, 2, 7, 15, 2, 2, 8, 15, 2, 2, 8, 15, 2, 2, 8, 14, 2, 2, 8, 14, 2, 2,
+	9, 14, 2, 2, 9, 14, 2, 2, 9, 13, 2, 2, 9, 13, 2, 2, 10, 13, 2, 2, 10, 13, 2, 2,
+	10, 12, 2, 2, 10, 12, 2, 2, 11, 12, 2, 2, 11, 12, 2, 2, 11, 11, 2, 2, 11, 11, 2, 2,
+	12, 11, 2, 2, 12, 10, 2, 2, 12, 10, 2, 2, 13, 10, 2, 2, 13, 10, 2, 2, 13, 9, 2, 2,
+	13, 9, 2, 2, 14, 9, 2, 2, 14, 9, 2, 2, 14, 8, 2, 2, 14, 8, 2, 2, 15, 8, 2, 2,
+	15, 8, 2, 2, 15, 7, 2, 2, 15, 7, 1, 3, 1, 15, 7, 1, 3, 1, 15, 7, 1, 3, 1, 15,
+	6, 1, 3, 1, 15, 6, 1, 3, 2, 15, 6, 1, 3, 2, 15, 6, 1, 3, 2, 15, 5, 1, 3, 3,
+	15, 5, 1, 3, 3, 15, 5, 1, 3, 3, 15, 4, 1, 3, 3, 15, 4, 1, 3, 4, 15, 4, 1, 3,
+	4, 15, 4, 1, 3, 4, 15, 3, 1, 3, 4, 15, 3, 1, 3, 5, 15, 3, 1, 3, 5, 15, 3, 1,
+	3, 5, 15, 2, 1, 3, 5, 15, 2, 1, 3, 6, 15, 2, 1, 3, 6, 15, 2, 1, 3, 6, 15, 1,
+	1, 3, 6, 15, 1, 1, 3, 7, 15, 1, 1, 3, 7, 15, 1, 1, 2, 7, 15, 1, 2, 7, 15, 1,
+	2, 8, 15, 1, 2, 8, 14, 1, 2, 8, 14, 1, 2, 9, 14, 1, 2, 9, 14, 1, 2, 9, 13, 1,
+	2, 9, 13, 1, 2, 10, 13, 1, 2, 10, 13, 1, 2, 10, 12, 1, 2, 10, 12, 1, 2, 11, 12, 1,
+	2, 11, 12, 1, 2, 11, 11, 1, 2, 11, 11, 1, 2, 12, 11, 1, 2, 12, 11, 1, 2, 12, 10, 1,
+	2, 12, 10, 1, 2, 13, 10, 1, 2, 13, 10, 1, 2, 13, 9, 1, 2, 14, 9, 1, 2, 14, 9, 1,
+	2, 14, 8, 1, 2, 14, 8, 1, 2, 15, 8, 1, 2, 15, 8, 1, 2, 15, 7, 1, 2, 15, 7, 0,
+	3, 1, 15, 7, 0, 3, 1, 15, 7, 0, 3, 1, 15, 6, 0, 3, 1, 15, 6, 0, 3, 2, 15, 6,
+	0, 3, 2, 15, 6, 0, 3, 2, 15, 5, 0, 3, 2, 15, 5, 0, 3, 3, 15, 5, 0, 3, 3, 15,
+	5, 0, 3, 3, 15, 4, 0, 3, 3, 15, 4, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 5,
+	2, 1, 1, 5, 2, 12, 11, 5, 2, 12, 10, 5, 2, 13, 10, 5, 2, 13, 9, 5, 2, 14, 9, 5,
+	2, 14, 8, 5, 2, 15, 8, 5, 2, 15, 7, 4, 3, 1, 15, 7, 4, 3, 1, 15, 6, 4, 3, 2,
+	15, 6, 4, 3, 2, 15, 5, 4, 3, 3, 15, 5, 4, 3, 4, 15, 4, 4, 3, 4, 15, 3, 4, 3,
+	5, 15, 3, 4, 3, 5, 15, 2, 4, 3, 6, 15, 2, 4, 3, 6, 15, 1, 4, 3, 7, 15, 1, 4,
+	2, 7, 15, 4, 2, 8, 15, 4, 2, 8, 14, 4, 2, 9, 14, 4, 2, 9, 13, 4, 2, 10, 13, 4,
+	2, 10, 12, 4, 2, 11, 12, 4, 2, 11, 11, 4, 2, 12, 11, 4, 2, 12, 10, 4, 2, 13, 10, 4,
+	2, 13, 9, 4, 2, 14, 9, 4, 2, 15, 8, 4, 2, 15, 7, 3, 3, 1, 15, 7, 3, 3, 1, 15,
+	6, 3, 3, 2, 15, 6, 3, 3, 2, 15, 5, 3, 3, 3, 15, 5, 3, 3, 3, 15, 4, 3, 3, 4,
+	15, 4, 3, 3, 4, 15, 3, 3, 3, 5, 15, 3, 3, 3, 5, 15, 2, 3, 3, 6, 15, 2, 3, 3,
+	6, 15, 1, 3, 3, 7, 15, 1, 3, 2, 7, 15, 3, 2, 8, 15, 3, 2, 8, 14, 3, 2, 9, 14,
+	3, 2, 9, 13, 3, 2, 10, 13, 3, 2, 11, 12, 3, 2, 11, 11, 3, 2, 12, 11, 3, 2, 12, 10,
+	3, 2, 13, 10, 3, 2, 13, 9, 3, 2, 14, 9, 3, 2, 14, 8, 3, 2, 15, 8, 3, 2, 15, 7,
+	2, 3, 1, 15, 7, 2, 3, 1, 15, 6, 2, 3, 2, 15, 6, 2, 3, 2, 15, 5, 2, 3, 3, 15,
+	5, 2, 3, 3, 15, 4, 2, 3, 4, 15, 4, 2, 3, 4, 15, 3, 2, 3, 5, 15, 3, 2, 3, 5,
+	15, 2, 2, 3, 6, 15, 2, 2, 3, 7, 15, 1, 2, 2, 7, 15, 2, 2, 8, 15, 2, 2, 8, 14,
+	2, 2, 9, 14, 2, 2, 9, 13, 2, 2, 10, 13, 2, 2, 10, 12, 2, 2, 11, 12, 2, 2, 11, 11,
+	2, 2, 12, 11, 2, 2, 12, 10, 2, 2, 13, 10, 2, 2, 13, 9, 2, 2, 14, 9, 2, 2, 14, 8,
+	2, 2, 15, 8, 2, 2, 15, 7, 1, 3, 1, 15, 7, 1, 3, 1, 15, 6, 1, 3, 2, 15, 6, 1,
+	3, 3, 15, 5, 1, 3, 3, 15, 4, 1, 3, 4, 15, 4, 1, 3, 4, 15, 3, 1, 3, 5, 15, 3,
+	1, 3, 5, 15, 2, 1, 3, 6, 15, 2, 1, 3, 6, 15, 1, 1, 3, 7, 15, 1, 1, 2, 7, 15,
+	1, 2, 8, 15, 1, 2, 8, 14, 1, 2, 9, 14, 1, 2, 9, 13, 1, 2, 10, 13, 1, 2, 10, 12,
+	1, 2, 11, 12, 1, 2, 11, 11, 1, 2, 12, 11, 1, 2, 12, 10, 1, 2, 13, 10, 1, 2, 14, 9,
+	1, 2, 14, 8, 1, 2, 15, 8, 1, 2, 15, 7, 0, 3, 1, 15, 7, 0, 3, 1, 15, 6, 0, 3,
+	2, 15, 6, 0, 3, 2, 15, 5, 0, 3, 3, 15, 5, 0, 3, 3, 15, 4, 0, 3, 4, 15, 4, 1,
+	1, 4, 0, 0, 0, 0, 8, 1, 1, 7, 2, 8, 14, 7, 2, 9, 14, 7, 2, 10, 13, 7, 2, 10,
+	12, 7, 2, 11, 11, 7, 2, 12, 10, 7, 2, 13, 10, 7, 2, 14, 9, 7, 2, 14, 8, 7, 2, 15,
+	7, 6, 3, 1, 15, 7, 6, 3, 2, 15, 6, 6, 3, 3, 15, 5, 6, 3, 3, 15, 4, 6, 3, 4,
+	15, 3, 6, 3, 5, 15, 3, 6, 3, 6, 15, 2, 6, 3, 7, 15, 1, 6, 2, 7, 15, 6, 2, 8,
+	14, 6, 2, 9, 14, 6, 2, 10, 13, 6, 2, 10, 12, 6, 2, 11, 11, 6, 2, 12, 11, 6, 2, 13,
+	10, 6, 2, 14, 9, 6, 2, 14, 8, 6, 2, 15, 7, 5, 3, 1, 15, 7, 5, 3, 2, 15, 6, 5,
+	3, 3, 15, 5, 5, 3, 3, 15, 4, 5, 3, 4, 15, 3, 5, 3, 5, 15, 3, 5, 3, 6, 15, 2,
+	5, 3, 6, 15, 1, 5, 2, 7, 15, 5, 2, 8, 15, 5, 2, 9, 14, 5, 2, 10, 13, 5, 2, 10,
+	12, 5, 2, 11, 11, 5, 2, 12, 11, 5, 2, 13, 10, 5, 2, 14, 9, 5, 2, 14, 8, 5, 2, 15,
+	7, 4, 3, 1, 15, 7, 4, 3, 2, 15, 6, 4, 3, 2, 15, 5, 4, 3, 3, 15, 4, 4, 3, 4,
+	15, 4, 4, 3, 5, 15, 3, 4, 3, 6, 15, 2, 4, 3, 6, 15, 1, 4, 2, 7, 15, 4, 2, 8,
+	15, 4, 2, 9, 14, 4, 2, 10, 13, 4, 2, 10, 12, 4, 2, 11, 11, 4, 2, 12, 11, 4, 2, 13,
+	10, 4, 2, 13, 9, 4, 2, 14, 8, 4, 2, 15, 8, 3, 3, 1, 15, 7, 3, 3, 2, 15, 6, 3,
+	3, 2, 15, 5, 3, 3, 3, 15, 4, 3, 3, 4, 15, 4, 3, 3, 5, 15, 3, 3, 3, 6, 15, 2,
+	3, 3, 6, 15, 1, 3, 2, 7, 15, 3, 2, 8, 15, 3, 2, 9, 14, 3, 2, 9, 13, 3, 2, 10,
+	12, 3, 2, 11, 11, 3, 2, 12, 11, 3, 2, 13, 10, 3, 2, 13, 9, 3, 2, 14, 8, 3, 2, 15,
+	8, 2, 3, 1, 15, 7, 2, 3, 2, 15, 6, 2, 3, 2, 15, 5, 2, 3, 3, 15, 4, 2, 3, 4,
+	15, 4, 2, 3, 5, 15, 3, 2, 3, 5, 15, 2, 2, 3, 6, 15, 1, 2, 3, 7, 15, 1, 2, 2,
+	8, 15, 2, 2, 9, 14, 2, 2, 9, 13, 2, 2, 10, 12, 2, 2, 11, 12, 2, 2, 12, 11, 2, 2,
+	13, 10, 2, 2, 13, 9, 2, 2, 14, 8, 2, 2, 15, 8, 1, 3, 1, 15, 7, 1, 3, 1, 15, 6,
+	1, 3, 2, 15, 5, 1, 3, 3, 15, 4, 1, 3, 4, 15, 4, 1, 3, 5, 15, 3, 1, 3, 5, 15,
+	2, 1, 3, 6, 15, 1, 1, 3, 7, 15, 1, 1, 2, 8, 15, 1, 2, 9, 14, 1, 2, 9, 13, 1,
+	2, 10, 12, 1, 2, 11, 12, 1, 2, 12, 11, 1, 2, 12, 10, 1, 2, 13, 9, 1, 2, 14, 8, 1,
+	2, 15, 8, 0, 3, 1, 15, 7, 0, 3, 1, 15, 6, 0, 3, 2, 15, 5, 0, 3, 3, 15, 5, 0,
+	3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0, 0, 9, 3, 4, 14, 2, 9, 3, 6, 15, 2, 9,
+	3, 7, 15, 1, 9, 2, 8, 15, 9, 2, 9, 14, 9, 2, 10, 13, 9, 2, 11, 12, 9, 2, 12, 11,
+	9, 2, 13, 10, 9, 2, 14, 9, 9, 2, 15, 8, 8, 3, 1, 15, 7, 8, 3, 2, 15, 5, 8, 3,
+	3, 15, 4, 8, 3, 4, 15, 3, 8, 3, 5, 15, 2, 8, 3, 6, 15, 1, 8, 2, 7, 15, 8, 2,
+	8, 14, 8, 2, 9, 13, 8, 2, 10, 12, 8, 2, 12, 11, 8, 2, 13, 10, 8, 2, 14, 9, 8, 2,
+	15, 8, 7, 3, 1, 15, 7, 7, 3, 2, 15, 6, 7, 3, 3, 15, 5, 7, 3, 4, 15, 4, 7, 3,
+	5, 15, 3, 7, 3, 6, 15, 2, 7, 3, 7, 15, 1, 7, 2, 8, 14, 7, 2, 9, 13, 7, 2, 10,
+	12, 7, 2, 11, 11, 7, 2, 12, 10, 7, 2, 13, 9, 7, 2, 14, 8, 7, 2, 15, 7, 6, 3, 1,
+	15, 6, 6, 3, 3, 15, 5, 6, 3, 4, 15, 4, 6, 3, 5, 15, 3, 6, 3, 6, 15, 2, 6, 3,
+	7, 15, 1, 6, 2, 8, 15, 6, 2, 9, 14, 6, 2, 10, 13, 6, 2, 11, 12, 6, 2, 12, 11, 6,
+	2, 13, 10, 6, 2, 14, 8, 6, 2, 15, 7, 5, 3, 1, 15, 6, 5, 3, 2, 15, 5, 5, 3, 3,
+	15, 4, 5, 3, 4, 15, 3, 5, 3, 5, 15, 2, 5, 3, 6, 15, 1, 5, 2, 7, 15, 5, 2, 8,
+	14, 5, 2, 10, 13, 5, 2, 11, 12, 5, 2, 12, 11, 5, 2, 13, 10, 5, 2, 14, 9, 5, 2, 15,
+	8, 4, 3, 1, 15, 7, 4, 3, 2, 15, 6, 4, 3, 3, 15, 5, 4, 3, 4, 15, 4, 4, 3, 5,
+	15, 3, 4, 3, 6, 15, 1, 4, 2, 7, 15, 4, 2, 8, 14, 4, 2, 9, 13, 4, 2, 10, 12, 4,
+	2, 11, 11, 4, 2, 12, 10, 4, 2, 13, 9, 4, 2, 14, 8, 3, 3, 1, 15, 7, 3, 3, 2, 15,
+	6, 3, 3, 3, 15, 5, 3, 3, 4, 15, 4, 3, 3, 5, 15, 3, 3, 3, 6, 15, 2, 3, 3, 7,
+	15, 1, 3, 2, 8, 15, 3, 2, 9, 14, 3, 2, 10, 13, 3, 2, 11, 12, 3, 2, 12, 10, 3, 2,
+	13, 9, 3, 2, 14, 8, 3, 2, 15, 7, 2, 3, 1, 15, 6, 2, 3, 2, 15, 5, 2, 3, 3, 15,
+	4, 2, 3, 4, 15, 3, 2, 3, 5, 15, 2, 2, 3, 7, 15, 1, 2, 2, 8, 15, 2, 2, 9, 14,
+	2, 2, 10, 13, 2, 2, 11, 12, 2, 2, 12, 11, 2, 2, 13, 10, 2, 2, 14, 9, 2, 2, 15, 8,
+	1, 3, 1, 15, 7, 1, 3, 2, 15, 6, 1, 3, 3, 15, 5, 1, 3, 4, 15, 3, 1, 3, 5, 15,
+	2, 1, 3, 6, 15, 1, 1, 2, 7, 15, 1, 2, 8, 14, 1, 2, 9, 13, 1, 2, 10, 12, 1, 2,
+	11, 11, 1, 2, 12, 10, 1, 2, 14, 9, 1, 2, 15, 8, 0, 3, 1, 15, 7, 0, 3, 2, 15, 6,
+	0, 3, 3, 15, 5, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0, 0, 12, 2, 11, 4, 11,
+	3, 2, 15, 5, 11, 3, 3, 15, 4, 11, 3, 5, 15, 3, 11, 3, 6, 15, 2, 11, 2, 7, 15, 11,
+	2, 9, 14, 11, 2, 10, 13, 11, 2, 11, 11, 11, 2, 13, 10, 11, 2, 14, 9, 11, 2, 15, 7, 10,
+	3, 2, 15, 6, 10, 3, 3, 15, 5, 10, 3, 4, 15, 3, 10, 3, 6, 15, 2, 10, 3, 7, 15, 1,
+	10, 2, 8, 14, 10, 2, 9, 13, 10, 2, 11, 12, 10, 2, 12, 11, 10, 2, 13, 9, 10, 2, 15, 8,
+	9, 3, 1, 15, 7, 9, 3, 2, 15, 5, 9, 3, 4, 15, 4, 9, 3, 5, 15, 3, 9, 3, 6, 15,
+	1, 9, 2, 8, 15, 9, 2, 9, 14, 9, 2, 10, 12, 9, 2, 11, 11, 9, 2, 13, 10, 9, 2, 14,
+	8, 9, 2, 15, 7, 8, 3, 2, 15, 6, 8, 3, 3, 15, 5, 8, 3, 4, 15, 3, 8, 3, 6, 15,
+	2, 8, 3, 7, 15, 1, 8, 2, 8, 14, 8, 2, 10, 13, 8, 2, 11, 12, 8, 2, 12, 10, 8, 2,
+	14, 9, 8, 2, 15, 8, 7, 3, 1, 15, 6, 7, 3, 3, 15, 5, 7, 3, 4, 15, 4, 7, 3, 5,
+	15, 2, 7, 3, 6, 15, 1, 7, 2, 8, 15, 7, 2, 9, 14, 7, 2, 10, 12, 7, 2, 12, 11, 7,
+	2, 13, 10, 7, 2, 14, 8, 6, 3, 1, 15, 7, 6, 3, 2, 15, 6, 6, 3, 3, 15, 4, 6, 3,
+	5, 15, 3, 6, 3, 6, 15, 2, 6, 2, 7, 15, 6, 2, 8, 14, 6, 2, 10, 13, 6, 2, 11, 11,
+	6, 2, 12, 10, 6, 2, 14, 9, 6, 2, 15, 8, 5, 3, 1, 15, 6, 5, 3, 3, 15, 5, 5, 3,
+	4, 15, 4, 5, 3, 5, 15, 2, 5, 3, 7, 15, 1, 5, 2, 8, 15, 5, 2, 9, 13, 5, 2, 11,
+	12, 5, 2, 12, 11, 5, 2, 13, 9, 5, 2, 14, 8, 4, 3, 1, 15, 7, 4, 3, 2, 15, 5, 4,
+	3, 3, 15, 4, 4, 3, 5, 15, 3, 4, 3, 6, 15, 2, 4, 2, 7, 15, 4, 2, 9, 14, 4, 2,
+	10, 13, 4, 2, 11, 11, 4, 2, 13, 10, 4, 2, 14, 9, 4, 2, 15, 7, 3, 3, 2, 15, 6, 3,
+	3, 3, 15, 5, 3, 3, 4, 15, 3, 3, 3, 5, 15, 2, 3, 3, 7, 15, 1, 3, 2, 8, 14, 3,
+	2, 9, 13, 3, 2, 11, 12, 3, 2, 12, 11, 3, 2, 13, 9, 3, 2, 15, 8, 2, 3, 1, 15, 7,
+	2, 3, 2, 15, 5, 2, 3, 4, 15, 4, 2, 3, 5, 15, 3, 2, 3, 6, 15, 1, 2, 2, 8, 15,
+	2, 2, 9, 14, 2, 2, 10, 12, 2, 2, 11, 11, 2, 2, 13, 10, 2, 2, 14, 8, 2, 2, 15, 7,
+	1, 3, 2, 15, 6, 1, 3, 3, 15, 5, 1, 3, 4, 15, 3, 1, 3, 6, 15, 2, 1, 3, 7, 15,
+	1, 1, 2, 8, 14, 1, 2, 10, 13, 1, 2, 11, 12, 1, 2, 12, 10, 1, 2, 14, 9, 1, 2, 15,
+	8, 0, 3, 1, 15, 6, 0, 3, 2, 15, 5, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0,
+	0, 14, 2, 7, 5, 14, 2, 14, 9, 14, 2, 15, 7, 13, 3, 2, 15, 6, 13, 3, 3, 15, 4, 13,
+	3, 5, 15, 3, 13, 3, 6, 15, 1, 13, 2, 8, 15, 13, 2, 10, 13, 13, 2, 11, 11, 13, 2, 13,
+	10, 13, 2, 14, 8, 12, 3, 1, 15, 7, 12, 3, 3, 15, 5, 12, 3, 4, 15, 4, 12, 3, 6, 15,
+	2, 12, 2, 7, 15, 12, 2, 9, 14, 12, 2, 10, 12, 12, 2, 12, 11, 12, 2, 14, 9, 12, 2, 15,
+	8, 11, 3, 2, 15, 6, 11, 3, 3, 15, 4, 11, 3, 5, 15, 3, 11, 3, 6, 15, 1, 11, 2, 8,
+	15, 11, 2, 10, 13, 11, 2, 11, 11, 11, 2, 13, 10, 11, 2, 14, 8, 10, 3, 1, 15, 7, 10, 3,
+	2, 15, 5, 10, 3, 4, 15, 4, 10, 3, 6, 15, 2, 10, 2, 7, 15, 10, 2, 9, 14, 10, 2, 10,
+	12, 10, 2, 12, 11, 10, 2, 13, 9, 10, 2, 15, 8, 9, 3, 2, 15, 6, 9, 3, 3, 15, 4, 9,
+	3, 5, 15, 3, 9, 3, 6, 15, 1, 9, 2, 8, 15, 9, 2, 10, 13, 9, 2, 11, 11, 9, 2, 13,
+	10, 9, 2, 14, 8, 8, 3, 1, 15, 7, 8, 3, 2, 15, 5, 8, 3, 4, 15, 4, 8, 3, 6, 15,
+	2, 8, 3, 7, 15, 1, 8, 2, 9, 14, 8, 2, 10, 12, 8, 2, 12, 11, 8, 2, 13, 9, 8, 2,
+	15, 8, 7, 3, 2, 15, 6, 7, 3, 3, 15, 4, 7, 3, 5, 15, 3, 7, 3, 6, 15, 1, 7, 2,
+	8, 15, 7, 2, 9, 13, 7, 2, 11, 12, 7, 2, 13, 10, 7, 2, 14, 8, 6, 3, 1, 15, 7, 6,
+	3, 2, 15, 5, 6, 3, 4, 15, 4, 6, 3, 6, 15, 2, 6, 3, 7, 15, 1, 6, 2, 9, 14, 6,
+	2, 10, 12, 6, 2, 12, 11, 6, 2, 13, 9, 6, 2, 15, 8, 5, 3, 2, 15, 6, 5, 3, 3, 15,
+	5, 5, 3, 5, 15, 3, 5, 3, 6, 15, 1, 5, 2, 8, 15, 5, 2, 9, 13, 5, 2, 11, 12, 5,
+	2, 13, 10, 5, 2, 14, 8, 4, 3, 1, 15, 7, 4, 3, 2, 15, 5, 4, 3, 4, 15, 4, 4, 3,
+	5, 15, 2, 4, 3, 7, 15, 1, 4, 2, 9, 14, 4, 2, 10, 12, 4, 2, 12, 11, 4, 2, 13, 9,
+	4, 2, 15, 8, 3, 3, 2, 15, 6, 3, 3, 3, 15, 5, 3, 3, 5, 15, 3, 3, 3, 6, 15, 1,
+	3, 2, 8, 15, 3, 2, 9, 13, 3, 2, 11, 12, 3, 2, 13, 10, 3, 2, 14, 8, 2, 3, 1, 15,
+	7, 2, 3, 2, 15, 5, 2, 3, 4, 15, 4, 2, 3, 5, 15, 2, 2, 3, 7, 15, 1, 2, 2, 9,
+	14, 2, 2, 10, 12, 2, 2, 12, 11, 2, 2, 13, 9, 2, 2, 15, 8, 1, 3, 2, 15, 6, 1, 3,
+	3, 15, 5, 1, 3, 5, 15, 3, 1, 3, 6, 15, 1, 1, 2, 8, 15, 1, 2, 9, 13, 1, 2, 11,
+	12, 1, 2, 12, 10, 1, 2, 14, 9, 0, 3, 1, 15, 7, 0, 3, 2, 15, 5, 0, 3, 4, 15, 4,
+	1, 1, 4, 0, 0, 0, 0, 16, 2, 2, 3, 16, 2, 10, 13, 16, 2, 12, 11, 16, 2, 14, 9, 15,
+	3, 1, 15, 7, 15, 3, 2, 15, 5, 15, 3, 4, 15, 4, 15, 3, 6, 15, 2, 15, 2, 8, 15, 15,
+	2, 10, 13, 15, 2, 11, 11, 15, 2, 13, 9, 15, 2, 15, 7, 14, 3, 2, 15, 6, 14, 3, 4, 15,
+	4, 14, 3, 6, 15, 2, 14, 2, 8, 15, 14, 2, 9, 13, 14, 2, 11, 11, 14, 2, 13, 10, 14, 2,
+	15, 8, 13, 3, 2, 15, 6, 13, 3, 4, 15, 4, 13, 3, 5, 15, 2, 13, 2, 7, 15, 13, 2, 9,
+	13, 13, 2, 11, 12, 13, 2, 13, 10, 13, 2, 15, 8, 12, 3, 2, 15, 6, 12, 3, 3, 15, 4, 12,
+	3, 5, 15, 3, 12, 3, 7, 15, 1, 12, 2, 9, 14, 12, 2, 11, 12, 12, 2, 13, 10, 12, 2, 14,
+	8, 11, 3, 1, 15, 6, 11, 3, 3, 15, 5, 11, 3, 5, 15, 3, 11, 3, 7, 15, 1, 11, 2, 9,
+	14, 11, 2, 10, 12, 11, 2, 12, 10, 11, 2, 14, 9, 10, 3, 1, 15, 7, 10, 3, 3, 15, 5, 10,
+	3, 5, 15, 3, 10, 3, 7, 15, 1, 10, 2, 8, 14, 10, 2, 10, 12, 10, 2, 12, 11, 10, 2, 14,
+	9, 9, 3, 1, 15, 7, 9, 3, 3, 15, 5, 9, 3, 4, 15, 3, 9, 3, 6, 15, 1, 9, 2, 8,
+	15, 9, 2, 10, 13, 9, 2, 12, 11, 9, 2, 14, 9, 9, 2, 15, 7, 8, 3, 2, 15, 5, 8, 3,
+	4, 15, 4, 8, 3, 6, 15, 2, 8, 2, 8, 15, 8, 2, 10, 13, 8, 2, 11, 11, 8, 2, 13, 9,
+	8, 2, 15, 7, 7, 3, 2, 15, 6, 7, 3, 4, 15, 4, 7, 3, 6, 15, 2, 7, 2, 8, 15, 7,
+	2, 9, 13, 7, 2, 11, 11, 7, 2, 13, 10, 7, 2, 15, 8, 6, 3, 2, 15, 6, 6, 3, 4, 15,
+	4, 6, 3, 5, 15, 2, 6, 2, 7, 15, 6, 2, 9, 14, 6, 2, 11, 12, 6, 2, 13, 10, 6, 2,
+	15, 8, 5, 3, 2, 15, 6, 5, 3, 3, 15, 4, 5, 3, 5, 15, 3, 5, 3, 7, 15, 1, 5, 2,
+	9, 14, 5, 2, 11, 12, 5, 2, 12, 10, 5, 2, 14, 8, 4, 3, 1, 15, 6, 4, 3, 3, 15, 5,
+	4, 3, 5, 15, 3, 4, 3, 7, 15, 1, 4, 2, 9, 14, 4, 2, 10, 12, 4, 2, 12, 10, 4, 2,
+	14, 9, 3, 3, 1, 15, 7, 3, 3, 3, 15, 5, 3, 3, 5, 15, 3, 3, 3, 6, 15, 1, 3, 2,
+	8, 14, 3, 2, 10, 12, 3, 2, 12, 11, 3, 2, 14, 9, 2, 3, 1, 15, 7, 2, 3, 3, 15, 5,
+	2, 3, 4, 15, 3, 2, 3, 6, 15, 2, 2, 2, 8, 15, 2, 2, 10, 13, 2, 2, 12, 11, 2, 2,
+	14, 9, 2, 2, 15, 7, 1, 3, 2, 15, 5, 1, 3, 4, 15, 4, 1, 3, 6, 15, 2, 1, 2, 8,
+	15, 1, 2, 10, 13, 1, 2, 11, 11, 1, 2, 13, 9, 1, 2, 15, 8, 0, 3, 2, 15, 6, 0, 3,
+	4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0, 0, 18, 3, 6, 14, 1, 18, 2, 8, 14, 18, 2, 10,
+	12, 18, 2, 12, 10, 18, 2, 14, 8, 17, 3, 2, 15, 6, 17, 3, 4, 15, 4, 17, 3, 6, 15, 2,
+	17, 2, 8, 15, 17, 2, 10, 13, 17, 2, 12, 10, 17, 2, 14, 8, 16, 3, 1, 15, 6, 16, 3, 4,
+	15, 4, 16, 3, 6, 15, 2, 16, 2, 8, 15, 16, 2, 10, 13, 16, 2, 12, 11, 16, 2, 14, 9, 15,
+	3, 1, 15, 7, 15, 3, 3, 15, 4, 15, 3, 5, 15, 2, 15, 2, 8, 15, 15, 2, 10, 13, 15, 2,
+	12, 11, 15, 2, 14, 9, 14, 3, 1, 15, 7, 14, 3, 3, 15, 5, 14, 3, 5, 15, 3, 14, 3, 7,
+	15, 1, 14, 2, 9, 13, 14, 2, 11, 11, 14, 2, 14, 9, 13, 3, 1, 15, 7, 13, 3, 3, 15, 5,
+	13, 3, 5, 15, 3, 13, 3, 7, 15, 1, 13, 2, 9, 14, 13, 2, 11, 11, 13, 2, 13, 9, 12, 3,
+	1, 15, 7, 12, 3, 3, 15, 5, 12, 3, 5, 15, 3, 12, 3, 7, 15, 1, 12, 2, 9, 14, 12, 2,
+	11, 12, 12, 2, 13, 10, 12, 2, 15, 8, 11, 3, 2, 15, 5, 11, 3, 4, 15, 3, 11, 3, 7, 15,
+	1, 11, 2, 9, 14, 11, 2, 11, 12, 11, 2, 13, 10, 11, 2, 15, 8, 10, 3, 2, 15, 6, 10, 3,
+	4, 15, 4, 10, 3, 6, 15, 1, 10, 2, 8, 14, 10, 2, 10, 12, 10, 2, 13, 10, 10, 2, 15, 8,
+	9, 3, 2, 15, 6, 9, 3, 4, 15, 4, 9, 3, 6, 15, 2, 9, 2, 8, 14, 9, 2, 10, 12, 9,
+	2, 12, 10, 9, 2, 14, 8, 8, 3, 2, 15, 6, 8, 3, 4, 15, 4, 8, 3, 6, 15, 2, 8, 2,
+	8, 15, 8, 2, 10, 13, 8, 2, 12, 11, 8, 2, 14, 8, 7, 3, 1, 15, 6, 7, 3, 3, 15, 4,
+	7, 3, 6, 15, 2, 7, 2, 8, 15, 7, 2, 10, 13, 7, 2, 12, 11, 7, 2, 14, 9, 6, 3, 1,
+	15, 7, 6, 3, 3, 15, 5, 6, 3, 5, 15, 2, 6, 2, 7, 15, 6, 2, 10, 13, 6, 2, 12, 11,
+	6, 2, 14, 9, 5, 3, 1, 15, 7, 5, 3, 3, 15, 5, 5, 3, 5, 15, 3, 5, 3, 7, 15, 1,
+	5, 2, 9, 13, 5, 2, 11, 11, 5, 2, 13, 9, 4, 3, 1, 15, 7, 4, 3, 3, 15, 5, 4, 3,
+	5, 15, 3, 4, 3, 7, 15, 1, 4, 2, 9, 14, 4, 2, 11, 12, 4, 2, 13, 9, 4, 2, 15, 7,
+	3, 3, 3, 15, 5, 3, 3, 5, 15, 3, 3, 3, 7, 15, 1, 3, 2, 9, 14, 3, 2, 11, 12, 3,
+	2, 13, 10, 3, 2, 15, 8, 2, 3, 2, 15, 6, 2, 3, 4, 15, 3, 2, 3, 6, 15, 1, 2, 2,
+	9, 14, 2, 2, 11, 12, 2, 2, 13, 10, 2, 2, 15, 8, 1, 3, 2, 15, 6, 1, 3, 4, 15, 4,
+	1, 3, 6, 15, 2, 1, 2, 8, 14, 1, 2, 10, 12, 1, 2, 12, 10, 1, 2, 15, 8, 0, 3, 2,
+	15, 6, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0, 0, 20, 3, 1, 10, 2, 20, 3, 5,
+	15, 3, 20, 3, 7, 15, 1, 20, 2, 9, 13, 20, 2, 12, 11, 20, 2, 14, 9, 19, 3, 1, 15, 6,
+	19, 3, 4, 15, 4, 19, 3, 6, 15, 2, 19, 2, 9, 14, 19, 2, 11, 12, 19, 2, 13, 9, 18, 3,
+	1, 15, 7, 18, 3, 3, 15, 5, 18, 3, 5, 15, 2, 18, 2, 8, 15, 18, 2, 10, 13, 18, 2, 12,
+	10, 18, 2, 15, 8, 17, 3, 2, 15, 5, 17, 3, 5, 15, 3, 17, 3, 7, 15, 1, 17, 2, 9, 13,
+	17, 2, 12, 11, 17, 2, 14, 9, 16, 3, 2, 15, 6, 16, 3, 4, 15, 4, 16, 3, 6, 15, 2, 16,
+	2, 9, 14, 16, 2, 11, 12, 16, 2, 13, 9, 15, 3, 1, 15, 7, 15, 3, 3, 15, 5, 15, 3, 6,
+	15, 2, 15, 2, 8, 15, 15, 2, 10, 12, 15, 2, 13, 10, 15, 2, 15, 8, 14, 3, 3, 15, 5, 14,
+	3, 5, 15, 3, 14, 3, 7, 15, 1, 14, 2, 10, 13, 14, 2, 12, 11, 14, 2, 14, 8, 13, 3, 2,
+	15, 6, 13, 3, 4, 15, 4, 13, 3, 6, 15, 1, 13, 2, 9, 14, 13, 2, 11, 12, 13, 2, 14, 9,
+	12, 3, 1, 15, 7, 12, 3, 3, 15, 4, 12, 3, 6, 15, 2, 12, 2, 8, 15, 12, 2, 10, 12, 12,
+	2, 13, 10, 12, 2, 15, 8, 11, 3, 3, 15, 5, 11, 3, 5, 15, 3, 11, 3, 7, 15, 1, 11, 2,
+	10, 13, 11, 2, 12, 11, 11, 2, 14, 8, 10, 3, 2, 15, 6, 10, 3, 4, 15, 4, 10, 3, 7, 15,
+	1, 10, 2, 9, 14, 10, 2, 11, 11, 10, 2, 14, 9, 9, 3, 1, 15, 7, 9, 3, 4, 15, 4, 9,
+	3, 6, 15, 2, 9, 2, 8, 14, 9, 2, 11, 12, 9, 2, 13, 10, 9, 2, 15, 7, 8, 3, 3, 15,
+	5, 8, 3, 5, 15, 3, 8, 2, 7, 15, 8, 2, 10, 13, 8, 2, 12, 11, 8, 2, 15, 8, 7, 3,
+	2, 15, 6, 7, 3, 4, 15, 3, 7, 3, 7, 15, 1, 7, 2, 9, 14, 7, 2, 11, 11, 7, 2, 14,
+	9, 6, 3, 1, 15, 7, 6, 3, 4, 15, 4, 6, 3, 6, 15, 2, 6, 2, 8, 14, 6, 2, 11, 12,
+	6, 2, 13, 10, 5, 3, 1, 15, 7, 5, 3, 3, 15, 5, 5, 3, 5, 15, 3, 5, 2, 8, 15, 5,
+	2, 10, 13, 5, 2, 12, 10, 5, 2, 15, 8, 4, 3, 2, 15, 6, 4, 3, 5, 15, 3, 4, 3, 7,
+	15, 1, 4, 2, 9, 13, 4, 2, 12, 11, 4, 2, 14, 9, 3, 3, 1, 15, 6, 3, 3, 4, 15, 4,
+	3, 3, 6, 15, 2, 3, 2, 8, 14, 3, 2, 11, 12, 3, 2, 13, 10, 2, 3, 1, 15, 7, 2, 3,
+	3, 15, 5, 2, 3, 5, 15, 2, 2, 2, 8, 15, 2, 2, 10, 13, 2, 2, 12, 10, 2, 2, 15, 8,
+	1, 3, 2, 15, 6, 1, 3, 5, 15, 3, 1, 3, 7, 15, 1, 1, 2, 9, 13, 1, 2, 12, 11, 1,
+	2, 14, 9, 0, 3, 2, 15, 6, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 23, 1, 4, 22,
+	3, 1, 15, 7, 22, 3, 3, 15, 5, 22, 3, 6, 15, 2, 22, 2, 9, 14, 22, 2, 11, 12, 22, 2,
+	14, 9, 21, 3, 2, 15, 6, 21, 3, 4, 15, 4, 21, 3, 7, 15, 1, 21, 2, 9, 13, 21, 2, 12,
+	11, 21, 2, 15, 8, 20, 3, 2, 15, 5, 20, 3, 5, 15, 3, 20, 2, 8, 15, 20, 2, 10, 12, 20,
+	2, 13, 10, 19, 3, 1, 15, 7, 19, 3, 3, 15, 5, 19, 3, 6, 15, 2, 19, 2, 9, 14, 19, 2,
+	11, 12, 19, 2, 14, 9, 18, 3, 2, 15, 6, 18, 3, 4, 15, 4, 18, 3, 7, 15, 1, 18, 2, 9,
+	13, 18, 2, 12, 11, 18, 2, 15, 8, 17, 3, 2, 15, 6, 17, 3, 5, 15, 3, 17, 2, 8, 15, 17,
+	2, 10, 12, 17, 2, 13, 10, 16, 3, 1, 15, 7, 16, 3, 3, 15, 5, 16, 3, 6, 15, 2, 16, 2,
+	9, 14, 16, 2, 11, 12, 16, 2, 14, 9, 15, 3, 2, 15, 6, 15, 3, 4, 15, 4, 15, 3, 7, 15,
+	1, 15, 2, 9, 13, 15, 2, 12, 11, 15, 2, 15, 8, 14, 3, 2, 15, 6, 14, 3, 5, 15, 3, 14,
+	2, 8, 15, 14, 2, 10, 13, 14, 2, 13, 10, 13, 3, 1, 15, 7, 13, 3, 3, 15, 5, 13, 3, 6,
+	15, 2, 13, 2, 8, 14, 13, 2, 11, 12, 13, 2, 14, 9, 12, 3, 2, 15, 6, 12, 3, 4, 15, 4,
+	12, 3, 7, 15, 1, 12, 2, 9, 13, 12, 2, 12, 11, 12, 2, 15, 8, 11, 3, 2, 15, 6, 11, 3,
+	5, 15, 3, 11, 2, 8, 15, 11, 2, 10, 13, 11, 2, 13, 10, 10, 3, 1, 15, 7, 10, 3, 3, 15,
+	5, 10, 3, 6, 15, 2, 10, 2, 8, 14, 10, 2, 11, 12, 10, 2, 14, 9, 9, 3, 1, 15, 6, 9,
+	3, 4, 15, 4, 9, 3, 7, 15, 1, 9, 2, 9, 13, 9, 2, 12, 11, 9, 2, 15, 8, 8, 3, 2,
+	15, 6, 8, 3, 5, 15, 3, 8, 2, 8, 15, 8, 2, 10, 13, 8, 2, 13, 10, 7, 3, 1, 15, 7,
+	7, 3, 3, 15, 5, 7, 3, 6, 15, 2, 7, 2, 8, 14, 7, 2, 11, 12, 7, 2, 14, 9, 6, 3,
+	1, 15, 7, 6, 3, 4, 15, 4, 6, 3, 7, 15, 1, 6, 2, 9, 13, 6, 2, 12, 11, 6, 2, 14,
+	8, 5, 3, 2, 15, 6, 5, 3, 5, 15, 3, 5, 2, 8, 15, 5, 2, 10, 13, 5, 2, 13, 10, 4,
+	3, 1, 15, 7, 4, 3, 3, 15, 5, 4, 3, 6, 15, 2, 4, 2, 8, 14, 4, 2, 11, 12, 4, 2,
+	14, 9, 3, 3, 1, 15, 7, 3, 3, 4, 15, 4, 3, 3, 7, 15, 1, 3, 2, 9, 14, 3, 2, 12,
+	11, 3, 2, 14, 8, 2, 3, 2, 15, 6, 2, 3, 5, 15, 3, 2, 2, 7, 15, 2, 2, 10, 13, 2,
+	2, 13, 10, 1, 3, 1, 15, 7, 1, 3, 3, 15, 5, 1, 3, 6, 15, 2, 1, 2, 8, 14, 1, 2,
+	11, 12, 1, 2, 14, 9, 0, 3, 1, 15, 7, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0,
+	0, 25, 2, 10, 9, 25, 2, 14, 8, 24, 3, 3, 15, 6, 24, 3, 5, 15, 3, 24, 2, 8, 15, 24,
+	2, 11, 12, 24, 2, 14, 9, 23, 3, 2, 15, 6, 23, 3, 5, 15, 3, 23, 2, 8, 15, 23, 2, 11,
+	12, 23, 2, 14, 9, 22, 3, 2, 15, 6, 22, 3, 5, 15, 4, 22, 3, 7, 15, 1, 22, 2, 10, 13,
+	22, 2, 13, 10, 21, 3, 1, 15, 7, 21, 3, 4, 15, 4, 21, 3, 7, 15, 1, 21, 2, 10, 13, 21,
+	2, 13, 10, 20, 3, 1, 15, 7, 20, 3, 4, 15, 4, 20, 3, 7, 15, 1, 20, 2, 9, 13, 20, 2,
+	12, 10, 20, 2, 15, 8, 19, 3, 3, 15, 5, 19, 3, 6, 15, 2, 19, 2, 9, 14, 19, 2, 12, 11,
+	19, 2, 15, 8, 18, 3, 3, 15, 5, 18, 3, 6, 15, 2, 18, 2, 9, 14, 18, 2, 11, 11, 18, 2,
+	14, 8, 17, 3, 2, 15, 6, 17, 3, 5, 15, 3, 17, 2, 8, 15, 17, 2, 11, 12, 17, 2, 14, 9,
+	16, 3, 2, 15, 6, 16, 3, 5, 15, 3, 16, 2, 8, 15, 16, 2, 11, 12, 16, 2, 14, 9, 15, 3,
+	2, 15, 6, 15, 3, 5, 15, 4, 15, 3, 7, 15, 1, 15, 2, 10, 13, 15, 2, 13, 10, 14, 3, 1,
+	15, 7, 14, 3, 4, 15, 4, 14, 3, 7, 15, 1, 14, 2, 10, 13, 14, 2, 13, 10, 13, 3, 1, 15,
+	7, 13, 3, 4, 15, 4, 13, 3, 7, 15, 2, 13, 2, 9, 13, 13, 2, 12, 11, 13, 2, 15, 8, 12,
+	3, 3, 15, 5, 12, 3, 6, 15, 2, 12, 2, 9, 14, 12, 2, 12, 11, 12, 2, 15, 8, 11, 3, 3,
+	15, 5, 11, 3, 6, 15, 2, 11, 2, 9, 14, 11, 2, 11, 11, 11, 2, 14, 8, 10, 3, 2, 15, 6,
+	10, 3, 5, 15, 3, 10, 2, 8, 15, 10, 2, 11, 12, 10, 2, 14, 9, 9, 3, 2, 15, 6, 9, 3,
+	5, 15, 3, 9, 2, 8, 15, 9, 2, 11, 12, 9, 2, 13, 9, 8, 3, 2, 15, 6, 8, 3, 4, 15,
+	4, 8, 3, 7, 15, 1, 8, 2, 10, 13, 8, 2, 13, 10, 7, 3, 1, 15, 7, 7, 3, 4, 15, 4,
+	7, 3, 7, 15, 1, 7, 2, 10, 13, 7, 2, 13, 10, 6, 3, 1, 15, 7, 6, 3, 4, 15, 4, 6,
+	3, 7, 15, 2, 6, 2, 9, 13, 6, 2, 12, 11, 6, 2, 15, 8, 5, 3, 3, 15, 5, 5, 3, 6,
+	15, 2, 5, 2, 9, 14, 5, 2, 12, 11, 5, 2, 15, 8, 4, 3, 3, 15, 5, 4, 3, 6, 15, 2,
+	4, 2, 9, 14, 4, 2, 11, 11, 4, 2, 14, 9, 3, 3, 2, 15, 6, 3, 3, 5, 15, 3, 3, 2,
+	8, 15, 3, 2, 11, 12, 3, 2, 14, 9, 2, 3, 2, 15, 6, 2, 3, 5, 15, 3, 2, 2, 8, 15,
+	2, 2, 11, 12, 2, 2, 13, 9, 1, 3, 2, 15, 6, 1, 3, 4, 15, 4, 1, 3, 7, 15, 1, 1,
+	2, 10, 13, 1, 2, 13, 10, 0, 3, 1, 15, 7, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0,
+	27, 2, 4, 5, 27, 2, 10, 12, 27, 2, 14, 9, 26, 3, 2, 15, 6, 26, 3, 5, 15, 3, 26, 2,
+	8, 15, 26, 2, 11, 12, 26, 2, 14, 8, 25, 3, 3, 15, 5, 25, 3, 6, 15, 2, 25, 2, 9, 14,
+	25, 2, 12, 11, 24, 3, 1, 15, 7, 24, 3, 4, 15, 4, 24, 3, 7, 15, 1, 24, 2, 10, 13, 24,
+	2, 13, 10, 23, 3, 2, 15, 7, 23, 3, 5, 15, 3, 23, 2, 8, 15, 23, 2, 11, 12, 23, 2, 14,
+	9, 22, 3, 3, 15, 6, 22, 3, 6, 15, 3, 22, 2, 9, 14, 22, 2, 12, 11, 22, 2, 15, 8, 21,
+	3, 3, 15, 5, 21, 3, 7, 15, 2, 21, 2, 10, 13, 21, 2, 13, 10, 20, 3, 1, 15, 7, 20, 3,
+	4, 15, 4, 20, 3, 7, 15, 1, 20, 2, 11, 12, 20, 2, 14, 9, 19, 3, 2, 15, 6, 19, 3, 5,
+	15, 3, 19, 2, 8, 14, 19, 2, 12, 11, 19, 2, 15, 8, 18, 3, 3, 15, 5, 18, 3, 6, 15, 2,
+	18, 2, 9, 14, 18, 2, 12, 10, 17, 3, 1, 15, 7, 17, 3, 4, 15, 4, 17, 3, 7, 15, 1, 17,
+	2, 10, 13, 17, 2, 13, 9, 16, 3, 2, 15, 6, 16, 3, 5, 15, 3, 16, 2, 8, 15, 16, 2, 11,
+	12, 16, 2, 14, 9, 15, 3, 3, 15, 5, 15, 3, 6, 15, 2, 15, 2, 9, 14, 15, 2, 12, 11, 14,
+	3, 1, 15, 8, 14, 3, 4, 15, 4, 14, 3, 7, 15, 1, 14, 2, 10, 13, 14, 2, 13, 10, 13, 3,
+	1, 15, 7, 13, 3, 5, 15, 4, 13, 2, 8, 15, 13, 2, 11, 12, 13, 2, 14, 9, 12, 3, 2, 15,
+	6, 12, 3, 5, 15, 3, 12, 2, 9, 14, 12, 2, 12, 11, 12, 2, 15, 8, 11, 3, 3, 15, 5, 11,
+	3, 6, 15, 2, 11, 2, 10, 13, 11, 2, 13, 10, 10, 3, 1, 15, 7, 10, 3, 4, 15, 4, 10, 3,
+	7, 15, 1, 10, 2, 10, 12, 10, 2, 14, 9, 9, 3, 2, 15, 6, 9, 3, 5, 15, 3, 9, 2, 8,
+	15, 9, 2, 11, 11, 9, 2, 14, 8, 8, 3, 3, 15, 5, 8, 3, 6, 15, 2, 8, 2, 9, 14, 8,
+	2, 12, 11, 7, 3, 1, 15, 7, 7, 3, 4, 15, 4, 7, 3, 7, 15, 1, 7, 2, 10, 13, 7, 2,
+	13, 10, 6, 3, 2, 15, 6, 6, 3, 5, 15, 3, 6, 2, 8, 15, 6, 2, 11, 12, 6, 2, 14, 9,
+	5, 3, 3, 15, 6, 5, 3, 6, 15, 2, 5, 2, 9, 14, 5, 2, 12, 11, 5, 2, 15, 8, 4, 3,
+	4, 15, 5, 4, 3, 7, 15, 2, 4, 2, 10, 13, 4, 2, 13, 10, 3, 3, 1, 15, 7, 3, 3, 4,
+	15, 4, 3, 3, 8, 15, 1, 3, 2, 11, 12, 3, 2, 14, 9, 2, 3, 2, 15, 6, 2, 3, 5, 15,
+	3, 2, 2, 8, 14, 2, 2, 12, 11, 2, 2, 15, 8, 1, 3, 3, 15, 5, 1, 3, 6, 15, 2, 1,
+	2, 9, 13, 1, 2, 13, 10, 0, 3, 1, 15, 7, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0,
+	0, 0, 29, 2, 6, 14, 29, 2, 10, 13, 29, 2, 13, 10, 28, 3, 2, 15, 7, 28, 3, 5, 15, 3,
+	28, 2, 8, 14, 28, 2, 12, 11, 27, 3, 1, 15, 8, 27, 3, 4, 15, 4, 27, 3, 7, 15, 1, 27,
+	2, 11, 12, 27, 2, 14, 9, 26, 3, 3, 15, 5, 26, 3, 6, 15, 2, 26, 2, 10, 13, 26, 2, 13,
+	10, 25, 3, 2, 15, 7, 25, 3, 5, 15, 3, 25, 2, 8, 14, 25, 2, 12, 11, 24, 3, 1, 15, 8,
+	24, 3, 4, 15, 4, 24, 3, 7, 15, 1, 24, 2, 11, 12, 24, 2, 14, 9, 23, 3, 3, 15, 5, 23,
+	3, 6, 15, 2, 23, 2, 10, 13, 23, 2, 13, 10, 22, 3, 2, 15, 7, 22, 3, 5, 15, 3, 22, 2,
+	8, 14, 22, 2, 12, 11, 21, 3, 1, 15, 8, 21, 3, 4, 15, 4, 21, 3, 7, 15, 1, 21, 2, 11,
+	12, 21, 2, 14, 9, 20, 3, 3, 15, 5, 20, 3, 6, 15, 2, 20, 2, 10, 13, 20, 2, 13, 10, 19,
+	3, 2, 15, 7, 19, 3, 5, 15, 3, 19, 2, 9, 14, 19, 2, 12, 11, 18, 3, 1, 15, 8, 18, 3,
+	4, 15, 4, 18, 3, 7, 15, 1, 18, 2, 11, 12, 18, 2, 14, 9, 17, 3, 3, 15, 5, 17, 3, 6,
+	15, 2, 17, 2, 10, 13, 17, 2, 13, 10, 16, 3, 2, 15, 6, 16, 3, 5, 15, 3, 16, 2, 9, 14,
+	16, 2, 12, 11, 15, 3, 1, 15, 8, 15, 3, 4, 15, 4, 15, 3, 7, 15, 1, 15, 2, 11, 12, 15,
+	2, 14, 9, 14, 3, 3, 15, 5, 14, 3, 6, 15, 2, 14, 2, 10, 13, 14, 2, 13, 10, 13, 3, 2,
+	15, 6, 13, 3, 5, 15, 3, 13, 2, 9, 14, 13, 2, 12, 11, 12, 3, 1, 15, 8, 12, 3, 4, 15,
+	4, 12, 3, 7, 15, 1, 12, 2, 11, 12, 12, 2, 14, 9, 11, 3, 3, 15, 5, 11, 3, 6, 15, 2,
+	11, 2, 10, 13, 11, 2, 13, 10, 10, 3, 2, 15, 6, 10, 3, 5, 15, 3, 10, 2, 9, 14, 10, 2,
+	12, 11, 9, 3, 1, 15, 8, 9, 3, 4, 15, 4, 9, 3, 7, 15, 1, 9, 2, 11, 12, 9, 2, 14,
+	9, 8, 3, 3, 15, 5, 8, 3, 6, 15, 2, 8, 2, 10, 13, 8, 2, 13, 10, 7, 3, 2, 15, 6,
+	7, 3, 5, 15, 3, 7, 2, 9, 14, 7, 2, 12, 11, 6, 3, 1, 15, 8, 6, 3, 4, 15, 4, 6,
+	3, 7, 15, 1, 6, 2, 11, 12, 6, 2, 14, 9, 5, 3, 3, 15, 5, 5, 3, 6, 15, 2, 5, 2,
+	10, 13, 5, 2, 13, 10, 4, 3, 2, 15, 6, 4, 3, 5, 15, 3, 4, 2, 9, 14, 4, 2, 12, 11,
+	3, 3, 1, 15, 8, 3, 3, 4, 15, 4, 3, 3, 7, 15, 1, 3, 2, 11, 12, 3, 2, 14, 9, 2,
+	3, 3, 15, 5, 2, 3, 6, 15, 2, 2, 2, 10, 13, 2, 2, 13, 10, 1, 3, 2, 15, 6, 1, 3,
+	5, 15, 3, 1, 2, 9, 14, 1, 2, 12, 11, 0, 3, 1, 15, 8, 0, 3, 4, 15, 4, 1, 1, 4,
+	0, 0, 0, 0, 32, 1, 7, 31, 3, 5, 15, 3, 31, 2, 9, 14, 31, 2, 13, 10, 30, 3, 2, 15,
+	7, 30, 3, 5, 15, 3, 30, 2, 9, 14, 30, 2, 13, 10, 29, 3, 2, 15, 7, 29, 3, 5, 15, 3,
+	29, 2, 9, 14, 29, 2, 13, 10, 28, 3, 2, 15, 7, 28, 3, 5, 15, 3, 28, 2, 9, 14, 28, 2,
+	13, 10, 27, 3, 2, 15, 7, 27, 3, 5, 15, 3, 27, 2, 9, 14, 27, 2, 13, 10, 26, 3, 2, 15,
+	7, 26, 3, 5, 15, 3, 26, 2, 9, 14, 26, 2, 12, 10, 25, 3, 2, 15, 7, 25, 3, 5, 15, 3,
+	25, 2, 9, 14, 25, 2, 12, 11, 24, 3, 2, 15, 7, 24, 3, 5, 15, 3, 24, 2, 9, 14, 24, 2,
+	12, 11, 23, 3, 1, 15, 7, 23, 3, 5, 15, 3, 23, 2, 9, 14, 23, 2, 12, 11, 22, 3, 1, 15,
+	7, 22, 3, 5, 15, 3, 22, 2, 9, 14, 22, 2, 12, 11, 21, 3, 1, 15, 7, 21, 3, 5, 15, 3,
+	21, 2, 9, 14, 21, 2, 12, 11, 20, 3, 1, 15, 7, 20, 3, 5, 15, 3, 20, 2, 9, 14, 20, 2,
+	12, 11, 19, 3, 1, 15, 7, 19, 3, 5, 15, 3, 19, 2, 9, 14, 19, 2, 12, 11, 18, 3, 1, 15,
+	7, 18, 3, 5, 15, 3, 18, 2, 9, 14, 18, 2, 12, 11, 17, 3, 1, 15, 7, 17, 3, 5, 15, 4,
+	17, 2, 8, 14, 17, 2, 12, 11, 16, 3, 1, 15, 7, 16, 3, 5, 15, 4, 16, 2, 8, 14, 16, 2,
+	12, 11, 15, 3, 1, 15, 7, 15, 3, 5, 15, 4, 15, 2, 8, 15, 15, 2, 12, 11, 14, 3, 1, 15,
+	7, 14, 3, 5, 15, 4, 14, 2, 8, 15, 14, 2, 12, 11, 13, 3, 1, 15, 7, 13, 3, 5, 15, 4,
+	13, 2, 8, 15, 13, 2, 12, 11, 12, 3, 1, 15, 7, 12, 3, 5, 15, 4, 12, 2, 8, 15, 12, 2,
+	12, 11, 11, 3, 1, 15, 7, 11, 3, 5, 15, 4, 11, 2, 8, 15, 11, 2, 12, 11, 10, 3, 1, 15,
+	7, 10, 3, 5, 15, 4, 10, 2, 8, 15, 10, 2, 12, 11, 9, 3, 1, 15, 7, 9, 3, 5, 15, 4,
+	9, 2, 8, 15, 9, 2, 12, 11, 8, 3, 1, 15, 8, 8, 3, 5, 15, 4, 8, 2, 8, 15, 8, 2,
+	12, 11, 7, 3, 1, 15, 8, 7, 3, 4, 15, 4, 7, 2, 8, 15, 7, 2, 12, 11, 6, 3, 1, 15,
+	8, 6, 3, 4, 15, 4, 6, 2, 8, 15, 6, 2, 12, 11, 5, 3, 1, 15, 8, 5, 3, 4, 15, 4,
+	5, 2, 8, 15, 5, 2, 12, 11, 4, 3, 1, 15, 8, 4, 3, 4, 15, 4, 4, 2, 8, 15, 4, 2,
+	12, 11, 3, 3, 1, 15, 8, 3, 3, 4, 15, 4, 3, 2, 8, 15, 3, 2, 12, 11, 2, 3, 1, 15,
+	8, 2, 3, 4, 15, 4, 2, 2, 8, 15, 2, 2, 12, 11, 1, 3, 1, 15, 8, 1, 3, 4, 15, 4,
+	1, 3, 8, 15, 1, 1, 2, 11, 11, 0, 3, 1, 15, 8, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0,
+	0, 0, 0, 0, 33, 3, 1, 13, 5, 33, 3, 5, 15, 4, 33, 2, 9, 14, 33, 2, 13, 10, 32, 3,
+	2, 15, 6, 32, 3, 6, 15, 3, 32, 2, 10, 13, 32, 2, 14, 9, 31, 3, 3, 15, 5, 31, 3, 7,
+	15, 2, 31, 2, 11, 12, 31, 2, 15, 8, 30, 3, 4, 15, 4, 30, 3, 8, 15, 1, 30, 2, 12, 11,
+	29, 3, 1, 15, 7, 29, 3, 5, 15, 3, 29, 2, 9, 14, 29, 2, 13, 10, 28, 3, 2, 15, 6, 28,
+	3, 6, 15, 2, 28, 2, 10, 13, 28, 2, 14, 9, 27, 3, 3, 15, 5, 27, 3, 7, 15, 1, 27, 2,
+	11, 12, 26, 3, 1, 15, 8, 26, 3, 4, 15, 4, 26, 2, 8, 15, 26, 2, 12, 11, 25, 3, 2, 15,
+	7, 25, 3, 5, 15, 3, 25, 2, 9, 14, 25, 2, 13, 10, 24, 3, 3, 15, 6, 24, 3, 6, 15, 2,
+	24, 2, 10, 13, 24, 2, 14, 9, 23, 3, 4, 15, 5, 23, 3, 8, 15, 1, 23, 2, 11, 12, 22, 3,
+	1, 15, 8, 22, 3, 5, 15, 4, 22, 2, 9, 14, 22, 2, 12, 11, 21, 3, 2, 15, 7, 21, 3, 6,
+	15, 3, 21, 2, 10, 13, 21, 2, 13, 10, 20, 3, 3, 15, 6, 20, 3, 7, 15, 2, 20, 2, 11, 12,
+	20, 2, 15, 8, 19, 3, 4, 15, 5, 19, 3, 8, 15, 1, 19, 2, 12, 11, 18, 3, 1, 15, 7, 18,
+	3, 5, 15, 4, 18, 2, 9, 14, 18, 2, 13, 10, 17, 3, 2, 15, 6, 17, 3, 6, 15, 3, 17, 2,
+	10, 13, 17, 2, 14, 9, 16, 3, 3, 15, 5, 16, 3, 7, 15, 1, 16, 2, 11, 12, 16, 2, 15, 8,
+	15, 3, 4, 15, 4, 15, 2, 8, 15, 15, 2, 12, 11, 14, 3, 1, 15, 7, 14, 3, 5, 15, 3, 14,
+	2, 9, 14, 14, 2, 13, 10, 13, 3, 2, 15, 6, 13, 3, 6, 15, 2, 13, 2, 10, 13, 13, 2, 14,
+	9, 12, 3, 3, 15, 5, 12, 3, 7, 15, 1, 12, 2, 11, 12, 11, 3, 1, 15, 8, 11, 3, 4, 15,
+	4, 11, 2, 8, 15, 11, 2, 12, 11, 10, 3, 2, 15, 7, 10, 3, 6, 15, 3, 10, 2, 9, 14, 10,
+	2, 13, 10, 9, 3, 3, 15, 6, 9, 3, 7, 15, 2, 9, 2, 10, 13, 9, 2, 14, 9, 8, 3, 4,
+	15, 5, 8, 3, 8, 15, 1, 8, 2, 11, 12, 7, 3, 1, 15, 8, 7, 3, 5, 15, 4, 7, 2, 9,
+	14, 7, 2, 13, 11, 6, 3, 2, 15, 7, 6, 3, 6, 15, 3, 6, 2, 10, 13, 6, 2, 14, 9, 5,
+	3, 3, 15, 6, 5, 3, 7, 15, 2, 5, 2, 11, 12, 5, 2, 15, 8, 4, 3, 4, 15, 5, 4, 3,
+	8, 15, 1, 4, 2, 12, 11, 3, 3, 1, 15, 7, 3, 3, 5, 15, 3, 3, 2, 9, 14, 3, 2, 13,
+	10, 2, 3, 2, 15, 6, 2, 3, 6, 15, 2, 2, 2, 10, 13, 2, 2, 14, 9, 1, 3, 3, 15, 5,
+	1, 3, 7, 15, 1, 1, 2, 11, 12, 1, 2, 15, 8, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0,
+	0, 36, 2, 4, 1, 36, 2, 15, 8, 35, 3, 5, 15, 4, 35, 2, 9, 14, 35, 2, 13, 10, 34, 3,
+	3, 15, 6, 34, 3, 7, 15, 2, 34, 2, 11, 12, 33, 3, 1, 15, 8, 33, 3, 5, 15, 4, 33, 2,
+	9, 14, 33, 2, 13, 10, 32, 3, 3, 15, 6, 32, 3, 7, 15, 2, 32, 2, 11, 12, 31, 3, 1, 15,
+	8, 31, 3, 5, 15, 4, 31, 2, 9, 14, 31, 2, 13, 10, 30, 3, 3, 15, 6, 30, 3, 7, 15, 2,
+	30, 2, 11, 12, 29, 3, 1, 15, 8, 29, 3, 5, 15, 4, 29, 2, 9, 14, 29, 2, 13, 10, 28, 3,
+	3, 15, 6, 28, 3, 7, 15, 2, 28, 2, 11, 12, 27, 3, 1, 15, 8, 27, 3, 5, 15, 4, 27, 2,
+	9, 14, 27, 2, 13, 10, 26, 3, 3, 15, 6, 26, 3, 7, 15, 2, 26, 2, 11, 12, 25, 3, 1, 15,
+	8, 25, 3, 5, 15, 4, 25, 2, 9, 14, 25, 2, 13, 10, 24, 3, 3, 15, 6, 24, 3, 7, 15, 1,
+	24, 2, 11, 12, 23, 3, 1, 15, 8, 23, 3, 5, 15, 3, 23, 2, 9, 14, 23, 2, 13, 10, 22, 3,
+	3, 15, 5, 22, 3, 7, 15, 1, 22, 2, 11, 12, 21, 3, 1, 15, 7, 21, 3, 5, 15, 3, 21, 2,
+	9, 14, 21, 2, 14, 10, 20, 3, 3, 15, 5, 20, 3, 7, 15, 1, 20, 2, 12, 12, 19, 3, 1, 15,
+	7, 19, 3, 5, 15, 3, 19, 2, 10, 14, 19, 2, 14, 9, 18, 3, 3, 15, 5, 18, 3, 8, 15, 1,
+	18, 2, 12, 11, 17, 3, 1, 15, 7, 17, 3, 6, 15, 3, 17, 2, 10, 13, 17, 2, 14, 9, 16, 3,
+	3, 15, 5, 16, 3, 8, 15, 1, 16, 2, 12, 11, 15, 3, 1, 15, 7, 15, 3, 6, 15, 3, 15, 2,
+	10, 13, 15, 2, 14, 9, 14, 3, 4, 15, 5, 14, 3, 8, 15, 1, 14, 2, 12, 11, 13, 3, 2, 15,
+	7, 13, 3, 6, 15, 3, 13, 2, 10, 13, 13, 2, 14, 9, 12, 3, 4, 15, 5, 12, 3, 8, 15, 1,
+	12, 2, 12, 11, 11, 3, 2, 15, 7, 11, 3, 6, 15, 3, 11, 2, 10, 13, 11, 2, 14, 9, 10, 3,
+	4, 15, 5, 10, 3, 8, 15, 1, 10, 2, 12, 11, 9, 3, 2, 15, 7, 9, 3, 6, 15, 3, 9, 2,
+	10, 13, 9, 2, 14, 9, 8, 3, 4, 15, 5, 8, 3, 8, 15, 1, 8, 2, 12, 11, 7, 3, 2, 15,
+	7, 7, 3, 6, 15, 3, 7, 2, 10, 13, 7, 2, 14, 9, 6, 3, 4, 15, 5, 6, 3, 8, 15, 1,
+	6, 2, 12, 11, 5, 3, 2, 15, 7, 5, 3, 6, 15, 3, 5, 2, 10, 13, 5, 2, 14, 9, 4, 3,
+	4, 15, 5, 4, 2, 8, 15, 4, 2, 12, 11, 3, 3, 2, 15, 7, 3, 3, 6, 15, 2, 3, 2, 10,
+	13, 3, 2, 15, 9, 2, 3, 4, 15, 4, 2, 2, 8, 15, 2, 2, 12, 11, 1, 3, 2, 15, 6, 1,
+	3, 6, 15, 2, 1, 2, 10, 13, 1, 2, 15, 8, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0,
+	0, 0, 38, 2, 8, 6, 38, 2, 14, 9, 37, 3, 4, 15, 4, 37, 2, 9, 14, 37, 2, 13, 10, 36,
+	3, 3, 15, 5, 36, 3, 8, 15, 1, 36, 2, 12, 11, 35, 3, 2, 15, 7, 35, 3, 7, 15, 2, 35,
+	2, 11, 12, 34, 3, 1, 15, 8, 34, 3, 5, 15, 3, 34, 2, 10, 13, 34, 2, 14, 9, 33, 3, 4,
+	15, 5, 33, 2, 9, 15, 33, 2, 13, 10, 32, 3, 3, 15, 6, 32, 3, 7, 15, 1, 32, 2, 12, 11,
+	31, 3, 2, 15, 7, 31, 3, 6, 15, 3, 31, 2, 11, 13, 30, 3, 1, 15, 8, 30, 3, 5, 15, 4,
+	30, 2, 9, 14, 30, 2, 14, 9, 29, 3, 4, 15, 5, 29, 3, 8, 15, 1, 29, 2, 13, 11, 28, 3,
+	3, 15, 6, 28, 3, 7, 15, 2, 28, 2, 11, 12, 27, 3, 1, 15, 7, 27, 3, 6, 15, 3, 27, 2,
+	10, 13, 27, 2, 15, 9, 26, 3, 5, 15, 4, 26, 2, 9, 14, 26, 2, 13, 10, 25, 3, 3, 15, 5,
+	25, 3, 8, 15, 1, 25, 2, 12, 11, 24, 3, 2, 15, 7, 24, 3, 7, 15, 2, 24, 2, 11, 12, 23,
+	3, 1, 15, 8, 23, 3, 5, 15, 3, 23, 2, 10, 13, 23, 2, 14, 9, 22, 3, 4, 15, 5, 22, 2,
+	9, 15, 22, 2, 13, 10, 21, 3, 3, 15, 6, 21, 3, 7, 15, 1, 21, 2, 12, 11, 20, 3, 2, 15,
+	7, 20, 3, 6, 15, 3, 20, 2, 11, 13, 19, 3, 1, 15, 8, 19, 3, 5, 15, 4, 19, 2, 9, 14,
+	19, 2, 14, 9, 18, 3, 4, 15, 5, 18, 3, 8, 15, 1, 18, 2, 13, 11, 17, 3, 3, 15, 6, 17,
+	3, 7, 15, 2, 17, 2, 11, 12, 16, 3, 1, 15, 7, 16, 3, 6, 15, 3, 16, 2, 10, 13, 16, 2,
+	15, 9, 15, 3, 5, 15, 4, 15, 2, 9, 14, 15, 2, 13, 10, 14, 3, 3, 15, 5, 14, 3, 8, 15,
+	1, 14, 2, 12, 11, 13, 3, 2, 15, 7, 13, 3, 7, 15, 2, 13, 2, 11, 12, 12, 3, 1, 15, 8,
+	12, 3, 6, 15, 3, 12, 2, 10, 13, 12, 2, 14, 9, 11, 3, 4, 15, 4, 11, 2, 9, 14, 11, 2,
+	13, 10, 10, 3, 3, 15, 6, 10, 3, 8, 15, 1, 10, 2, 12, 11, 9, 3, 2, 15, 7, 9, 3, 6,
+	15, 2, 9, 2, 11, 12, 8, 3, 1, 15, 8, 8, 3, 5, 15, 4, 8, 2, 10, 14, 8, 2, 14, 9,
+	7, 3, 4, 15, 5, 7, 2, 8, 15, 7, 2, 13, 10, 6, 3, 3, 15, 6, 6, 3, 7, 15, 2, 6,
+	2, 12, 12, 5, 3, 2, 15, 7, 5, 3, 6, 15, 3, 5, 2, 10, 13, 5, 2, 15, 8, 4, 3, 5,
+	15, 4, 4, 2, 9, 14, 4, 2, 14, 10, 3, 3, 4, 15, 5, 3, 3, 8, 15, 1, 3, 2, 12, 11,
+	2, 3, 2, 15, 6, 2, 3, 7, 15, 2, 2, 2, 11, 12, 1, 3, 1, 15, 8, 1, 3, 6, 15, 3,
+	1, 2, 10, 13, 1, 2, 14, 9, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 0, 0, 40, 2,
+	10, 11, 40, 2, 14, 9, 39, 3, 5, 15, 4, 39, 2, 9, 14, 39, 2, 14, 9, 38, 3, 4, 15, 5,
+	38, 2, 9, 14, 38, 2, 14, 10, 37, 3, 4, 15, 5, 37, 2, 9, 15, 37, 2, 13, 10, 36, 3, 4,
+	15, 5, 36, 3, 8, 15, 1, 36, 2, 13, 10, 35, 3, 3, 15, 6, 35, 3, 8, 15, 1, 35, 2, 12,
+	11, 34, 3, 3, 15, 6, 34, 3, 7, 15, 2, 34, 2, 12, 11, 33, 3, 2, 15, 7, 33, 3, 7, 15,
+	2, 33, 2, 12, 12, 32, 3, 2, 15, 7, 32, 3, 7, 15, 2, 32, 2, 11, 12, 31, 3, 2, 15, 7,
+	31, 3, 6, 15, 3, 31, 2, 11, 12, 30, 3, 1, 15, 8, 30, 3, 6, 15, 3, 30, 2, 11, 13, 29,
+	3, 1, 15, 8, 29, 3, 6, 15, 3, 29, 2, 10, 13, 28, 3, 1, 15, 8, 28, 3, 5, 15, 4, 28,
+	2, 10, 13, 28, 2, 15, 9, 27, 3, 5, 15, 4, 27, 2, 10, 14, 27, 2, 14, 9, 26, 3, 5, 15,
+	4, 26, 2, 9, 14, 26, 2, 14, 9, 25, 3, 4, 15, 5, 25, 2, 9, 14, 25, 2, 13, 10, 24, 3,
+	4, 15, 5, 24, 2, 8, 15, 24, 2, 13, 10, 23, 3, 3, 15, 5, 23, 3, 8, 15, 1, 23, 2, 13,
+	10, 22, 3, 3, 15, 6, 22, 3, 8, 15, 1, 22, 2, 12, 11, 21, 3, 3, 15, 6, 21, 3, 7, 15,
+	2, 21, 2, 12, 11, 20, 3, 2, 15, 7, 20, 3, 7, 15, 2, 20, 2, 12, 12, 19, 3, 2, 15, 7,
+	19, 3, 7, 15, 2, 19, 2, 11, 12, 18, 3, 2, 15, 7, 18, 3, 6, 15, 3, 18, 2, 11, 12, 17,
+	3, 1, 15, 8, 17, 3, 6, 15, 3, 17, 2, 11, 13, 16, 3, 1, 15, 8, 16, 3, 6, 15, 3, 16,
+	2, 10, 13, 15, 3, 1, 15, 8, 15, 3, 5, 15, 4, 15, 2, 10, 13, 15, 2, 15, 9, 14, 3, 5,
+	15, 4, 14, 2, 10, 14, 14, 2, 14, 9, 13, 3, 5, 15, 4, 13, 2, 9, 14, 13, 2, 14, 9, 12,
+	3, 4, 15, 5, 12, 2, 9, 14, 12, 2, 13, 10, 11, 3, 4, 15, 5, 11, 3, 8, 15, 1, 11, 2,
+	13, 10, 10, 3, 3, 15, 6, 10, 3, 8, 15, 1, 10, 2, 13, 11, 9, 3, 3, 15, 6, 9, 3, 8,
+	15, 1, 9, 2, 12, 11, 8, 3, 3, 15, 6, 8, 3, 7, 15, 2, 8, 2, 12, 11, 7, 3, 2, 15,
+	7, 7, 3, 7, 15, 2, 7, 2, 12, 12, 6, 3, 2, 15, 7, 6, 3, 7, 15, 2, 6, 2, 11, 12,
+	5, 3, 2, 15, 7, 5, 3, 6, 15, 3, 5, 2, 11, 12, 4, 3, 1, 15, 8, 4, 3, 6, 15, 3,
+	4, 2, 11, 13, 3, 3, 1, 15, 8, 3, 3, 6, 15, 3, 3, 2, 10, 13, 2, 3, 1, 15, 8, 2,
+	3, 5, 15, 4, 2, 2, 10, 13, 2, 2, 14, 9, 1, 3, 5, 15, 4, 1, 2, 9, 14, 1, 2, 14,
+	9, 0, 3, 4, 15, 4, 1, 1, 4, 0, 0, 0, 0, 42, 2, 1, 3, 42, 2, 9, 14, 42, 2, 14,
+	9, 41, 3, 5, 15, 4, 41, 2, 10, 14, 40, 3, 1, 15, 9, 40, 3, 5, 15, 4, 40, 2, 10, 13,
+	39, 3, 1, 15, 8, 39, 3, 6, 15, 3, 39, 2, 11, 13, 38, 3, 1, 15, 8, 38, 3, 6, 15, 3,
+	38, 2, 11, 12, 37, 3, 2, 15, 7, 37, 3, 7, 15, 2, 37, 2, 12, 12, 36, 3, 2, 15, 7, 36,
+	3, 7, 15, 2, 36, 2, 12, 11, 35, 3, 3, 15, 6, 35, 3, 8, 15, 1, 35, 2, 13, 11, 34, 3,
+	3, 15, 6, 34, 3, 8, 15, 1, 34, 2, 13, 10, 33, 3, 4, 15, 5, 33, 2, 9, 15, 33, 2, 14,
+	10, 32, 3, 4, 15, 5, 32, 2, 9, 14, 32, 2, 14, 9, 31, 3, 5, 15, 4, 31, 2, 10, 14, 31,
+	2, 14, 9, 30, 3, 5, 15, 4, 30, 2, 10, 13, 29, 3, 1, 15, 8, 29, 3, 6, 15, 3, 29, 2,
+	11, 13, 28, 3, 1, 15, 8, 28, 3, 6, 15, 3, 28, 2, 11, 12, 27, 3, 2, 15, 7, 27, 3, 7,
+	15, 3, 27, 2, 11, 12, 26, 3, 2, 15, 7, 26, 3, 7, 15, 2, 26, 2, 12, 11, 25, 3, 3, 15,
+	6, 25, 3, 8, 15, 2, 25, 2, 12, 11, 24, 3, 3, 15, 6, 24, 3, 8, 15, 1, 24, 2, 13, 10,
+	23, 3, 4, 15, 6, 23, 3, 8, 15, 1, 23, 2, 13, 10, 22, 3, 4, 15, 5, 22, 2, 9, 14, 22,
+	2, 14, 10, 21, 3, 5, 15, 5, 21, 2, 9, 14, 21, 2, 14, 9, 20, 3, 5, 15, 4, 20, 2, 10,
+	13, 19, 3, 1, 15, 9, 19, 3, 5, 15, 4, 19, 2, 10, 13, 18, 3, 1, 15, 8, 18, 3, 6, 15,
+	3, 18, 2, 11, 13, 17, 3, 1, 15, 8, 17, 3, 6, 15, 3, 17, 2, 11, 12, 16, 3, 2, 15, 7,
+	16, 3, 7, 15, 2, 16, 2, 12, 12, 15, 3, 2, 15, 7, 15, 3, 7, 15, 2, 15, 2, 12, 11, 14,
+	3, 3, 15, 6, 14, 3, 8, 15, 1, 14, 2, 13, 11, 13, 3, 3, 15, 6, 13, 3, 8, 15, 1, 13,
+	2, 13, 10, 12, 3, 4, 15, 5, 12, 2, 9, 15, 12, 2, 14, 10, 11, 3, 4, 15, 5, 11, 2, 9,
+	14, 11, 2, 14, 9, 10, 3, 5, 15, 4, 10, 2, 10, 14, 10, 2, 15, 9, 9, 3, 5, 15, 4, 9,
+	2, 10, 13, 8, 3, 1, 15, 8, 8, 3, 6, 15, 3, 8, 2, 11, 13, 7, 3, 1, 15, 8, 7, 3,
+	6, 15, 3, 7, 2, 11, 12, 6, 3, 2, 15, 7, 6, 3, 7, 15, 2, 6, 2, 12, 12, 5, 3, 2,
+	15, 7, 5, 3, 7, 15, 2, 5, 2, 12, 11, 4, 3, 3, 15, 6, 4, 3, 8, 15, 2, 4, 2, 12,
+	11, 3, 3, 3, 15, 6, 3, 3, 8, 15, 1, 3, 2, 13, 10, 2, 3, 4, 15, 6, 2, 3, 9, 15,
+	1, 2, 2, 13, 10, 1, 3, 4, 15, 5, 1, 2, 9, 14, 1, 2, 14, 9, 0, 3, 4, 15, 5, 1,
+	1, 4, 0, 0, 0, 0, 0, 0, 44, 2, 3, 7, 44, 2, 9, 14, 44, 2, 14, 9, 43, 3, 5, 15,
+	4, 43, 2, 11, 13, 42, 3, 2, 15, 8, 42, 3, 7, 15, 3, 42, 2, 12, 12, 41, 3, 3, 15, 6,
+	41, 3, 8, 15, 1, 41, 2, 13, 10, 40, 3, 4, 15, 5, 40, 2, 9, 14, 40, 2, 14, 9, 39, 3,
+	5, 15, 4, 39, 2, 11, 13, 38, 3, 2, 15, 8, 38, 3, 7, 15, 3, 38, 2, 12, 12, 37, 3, 3,
+	15, 6, 37, 3, 8, 15, 1, 37, 2, 13, 10, 36, 3, 4, 15, 5, 36, 2, 9, 14, 36, 2, 14, 9,
+	35, 3, 5, 15, 4, 35, 2, 11, 13, 34, 3, 2, 15, 8, 34, 3, 7, 15, 3, 34, 2, 12, 11, 33,
+	3, 3, 15, 6, 33, 3, 8, 15, 1, 33, 2, 13, 10, 32, 3, 4, 15, 5, 32, 2, 9, 14, 32, 2,
+	15, 9, 31, 3, 6, 15, 4, 31, 2, 11, 13, 30, 3, 2, 15, 8, 30, 3, 7, 15, 2, 30, 2, 12,
+	11, 29, 3, 3, 15, 6, 29, 3, 8, 15, 1, 29, 2, 13, 10, 28, 3, 4, 15, 5, 28, 2, 9, 14,
+	28, 2, 15, 9, 27, 3, 6, 15, 4, 27, 2, 11, 13, 26, 3, 2, 15, 8, 26, 3, 7, 15, 2, 26,
+	2, 12, 11, 25, 3, 3, 15, 6, 25, 3, 8, 15, 1, 25, 2, 13, 10, 24, 3, 4, 15, 5, 24, 2,
+	9, 14, 23, 3, 1, 15, 9, 23, 3, 6, 15, 4, 23, 2, 11, 13, 22, 3, 2, 15, 8, 22, 3, 7,
+	15, 2, 22, 2, 12, 11, 21, 3, 3, 15, 6, 21, 3, 8, 15, 1, 21, 2, 13, 10, 20, 3, 4, 15,
+	5, 20, 2, 10, 14, 19, 3, 1, 15, 9, 19, 3, 6, 15, 4, 19, 2, 11, 13, 18, 3, 2, 15, 7,
+	18, 3, 7, 15, 2, 18, 2, 12, 11, 17, 3, 3, 15, 6, 17, 3, 8, 15, 1, 17, 2, 13, 10, 16,
+	3, 4, 15, 5, 16, 2, 10, 14, 15, 3, 1, 15, 9, 15, 3, 6, 15, 4, 15, 2, 11, 13, 14, 3,
+	2, 15, 7, 14, 3, 7, 15, 2, 14, 2, 12, 11, 13, 3, 3, 15, 6, 13, 3, 8, 15, 1, 13, 2,
+	13, 10, 12, 3, 4, 15, 5, 12, 2, 10, 14, 11, 3, 1, 15, 9, 11, 3, 6, 15, 4, 11, 2, 11,
+	12, 10, 3, 2, 15, 7, 10, 3, 7, 15, 2, 10, 2, 12, 11, 9, 3, 3, 15, 6, 9, 3, 8, 15,
+	1, 9, 2, 14, 10, 8, 3, 5, 15, 5, 8, 2, 10, 14, 7, 3, 1, 15, 9, 7, 3, 6, 15, 3,
+	7, 2, 11, 12, 6, 3, 2, 15, 7, 6, 3, 7, 15, 2, 6, 2, 12, 11, 5, 3, 3, 15, 6, 5,
+	3, 8, 15, 1, 5, 2, 14, 10, 4, 3, 5, 15, 5, 4, 2, 10, 14, 3, 3, 1, 15, 9, 3, 3,
+	6, 15, 3, 3, 2, 11, 12, 2, 3, 2, 15, 7, 2, 3, 7, 15, 2, 2, 2, 12, 11, 1, 3, 3,
+	15, 6, 1, 3, 8, 15, 1, 1, 2, 14, 10, 0, 3, 4, 15, 5, 1, 1, 4, 0, 0, 0, 0, 0,
+	0, 46, 2, 4, 11, 46, 2, 9, 14, 45, 3, 1, 15, 9, 45, 3, 6, 15, 4, 45, 2, 11, 12, 44,
+	3, 3, 15, 7, 44, 3, 8, 15, 1, 44, 2, 13, 10, 43, 3, 5, 15, 5, 43, 2, 10, 13, 42, 3,
+	2, 15, 8, 42, 3, 7, 15, 3, 42, 2, 12, 11, 41, 3, 4, 15, 6, 41, 2, 9, 14, 41, 2, 14,
+	9, 40, 3, 6, 15, 4, 40, 2, 11, 12, 39, 3, 3, 15, 7, 39, 3, 8, 15, 2, 39, 2, 13, 10,
+	38, 3, 5, 15, 5, 38, 2, 10, 13, 37, 3, 1, 15, 8, 37, 3, 7, 15, 3, 37, 2, 12, 11, 36,
+	3, 4, 15, 6, 36, 3, 9, 15, 1, 36, 2, 14, 9, 35, 3, 6, 15, 4, 35, 2, 11, 12, 34, 3,
+	2, 15, 7, 34, 3, 8, 15, 2, 34, 2, 13, 10, 33, 3, 5, 15, 5, 33, 2, 10, 14, 32, 3, 1,
+	15, 8, 32, 3, 7, 15, 3, 32, 2, 12, 11, 31, 3, 3, 15, 6, 31, 3, 9, 15, 1, 31, 2, 14,
+	9, 30, 3, 6, 15, 4, 30, 2, 11, 13, 29, 3, 2, 15, 7, 29, 3, 8, 15, 2, 29, 2, 13, 10,
+	28, 3, 4, 15, 5, 28, 2, 10, 14, 27, 3, 1, 15, 8, 27, 3, 7, 15, 3, 27, 2, 12, 12, 26,
+	3, 3, 15, 6, 26, 3, 9, 15, 1, 26, 2, 14, 9, 25, 3, 5, 15, 4, 25, 2, 11, 13, 24, 3,
+	2, 15, 7, 24, 3, 8, 15, 2, 24, 2, 13, 11, 23, 3, 4, 15, 5, 23, 2, 10, 14, 22, 3, 1,
+	15, 8, 22, 3, 6, 15, 3, 22, 2, 12, 12, 21, 3, 3, 15, 6, 21, 3, 9, 15, 1, 21, 2, 14,
+	10, 20, 3, 5, 15, 4, 20, 2, 11, 13, 19, 3, 2, 15, 7, 19, 3, 7, 15, 2, 19, 2, 13, 11,
+	18, 3, 4, 15, 5, 18, 2, 10, 14, 17, 3, 1, 15, 9, 17, 3, 6, 15, 3, 17, 2, 12, 12, 16,
+	3, 3, 15, 6, 16, 3, 8, 15, 1, 16, 2, 14, 10, 15, 3, 5, 15, 4, 15, 2, 11, 13, 14, 3,
+	2, 15, 8, 14, 3, 7, 15, 2, 14, 2, 13, 11, 13, 3, 4, 15, 5, 13, 2, 9, 14, 12, 3, 1,
+	15, 9, 12, 3, 6, 15, 3, 12, 2, 12, 12, 11, 3, 3, 15, 7, 11, 3, 8, 15, 1, 11, 2, 14,
+	10, 10, 3, 5, 15, 4, 10, 2, 10, 13, 9, 3, 2, 15, 8, 9, 3, 7, 15, 2, 9, 2, 13, 11,
+	8, 3, 4, 15, 6, 8, 2, 9, 14, 7, 3, 1, 15, 9, 7, 3, 6, 15, 3, 7, 2, 11, 12, 6,
+	3, 3, 15, 7, 6, 3, 8, 15, 1, 6, 2, 14, 10, 5, 3, 5, 15, 5, 5, 2, 10, 13, 4, 3,
+	2, 15, 8, 4, 3, 7, 15, 2, 4, 2, 12, 11, 3, 3, 4, 15, 6, 3, 2, 9, 14, 2, 3, 1,
+	15, 9, 2, 3, 6, 15, 4, 2, 2, 11, 12, 1, 3, 3, 15, 7, 1, 3, 8, 15, 1, 1, 2, 13,
+	10, 0, 3, 4, 15, 5, 1, 1, 4, 0, 0, 0, 0, 0, 0, 48, 3, 4, 14, 2, 48, 2, 9, 14,
+	47, 3, 1, 15, 9, 47, 3, 7, 15, 3, 47, 2, 12, 11, 46, 3, 4, 15, 6, 46, 2, 10, 14, 45,
+	3, 1, 15, 8, 45, 3, 7, 15, 3, 45, 2, 13, 11, 44, 3, 4, 15, 5, 44, 2, 10, 14, 43, 3,
+	2, 15, 8, 43, 3, 7, 15, 2, 43, 2, 13, 11, 42, 3, 5, 15, 5, 42, 2, 10, 13, 41, 3, 2,
+	15, 8, 41, 3, 8, 15, 2, 41, 2, 13, 10, 40, 3, 5, 15, 5, 40, 2, 10, 13, 39, 3, 2, 15,
+	7, 39, 3, 8, 15, 2, 39, 2, 13, 10, 38, 3, 5, 15, 5, 38, 2, 11, 13, 37, 3, 2, 15, 7,
+	37, 3, 8, 15, 2, 37, 2, 14, 10, 36, 3, 5, 15, 4, 36, 2, 11, 13, 35, 3, 3, 15, 7, 35,
+	3, 8, 15, 1, 35, 2, 14, 10, 34, 3, 6, 15, 4, 34, 2, 11, 12, 33, 3, 3, 15, 7, 33, 3,
+	9, 15, 1, 33, 2, 14, 9, 32, 3, 6, 15, 4, 32, 2, 12, 12, 31, 3, 3, 15, 6, 31, 3, 9,
+	15, 1, 30, 3, 1, 15, 9, 30, 3, 6, 15, 3, 30, 2, 12, 12, 29, 3, 4, 15, 6, 29, 2, 9,
+	14, 28, 3, 1, 15, 9, 28, 3, 7, 15, 3, 28, 2, 12, 11, 27, 3, 4, 15, 6, 27, 2, 9, 14,
+	26, 3, 1, 15, 8, 26, 3, 7, 15, 3, 26, 2, 12, 11, 25, 3, 4, 15, 6, 25, 2, 10, 14, 24,
+	3, 1, 15, 8, 24, 3, 7, 15, 3, 24, 2, 13, 11, 23, 3, 4, 15, 5, 23, 2, 10, 14, 22, 3,
+	2, 15, 8, 22, 3, 7, 15, 2, 22, 2, 13, 11, 21, 3, 5, 15, 5, 21, 2, 10, 13, 20, 3, 2,
+	15, 8, 20, 3, 8, 15, 2, 20, 2, 13, 10, 19, 3, 5, 15, 5, 19, 2, 11, 13, 18, 3, 2, 15,
+	7, 18, 3, 8, 15, 2, 18, 2, 14, 10, 17, 3, 5, 15, 4, 17, 2, 11, 13, 16, 3, 3, 15, 7,
+	16, 3, 8, 15, 1, 16, 2, 14, 10, 15, 3, 6, 15, 4, 15, 2, 11, 12, 14, 3, 3, 15, 7, 14,
+	3, 9, 15, 1, 14, 2, 14, 9, 13, 3, 6, 15, 4, 13, 2, 11, 12, 12, 3, 3, 15, 7, 12, 3,
+	9, 15, 1, 12, 2, 14, 9, 11, 3, 6, 15, 4, 11, 2, 12, 12, 10, 3, 3, 15, 6, 10, 3, 9,
+	15, 1, 9, 3, 1, 15, 9, 9, 3, 6, 15, 3, 9, 2, 12, 12, 8, 3, 4, 15, 6, 8, 2, 9,
+	14, 7, 3, 1, 15, 9, 7, 3, 7, 15, 3, 7, 2, 12, 11, 6, 3, 4, 15, 6, 6, 2, 10, 14,
+	5, 3, 1, 15, 8, 5, 3, 7, 15, 3, 5, 2, 13, 11, 4, 3, 4, 15, 5, 4, 2, 10, 14, 3,
+	3, 2, 15, 8, 3, 3, 7, 15, 2, 3, 2, 13, 11, 2, 3, 5, 15, 5, 2, 2, 10, 13, 1, 3,
+	2, 15, 8, 1, 3, 8, 15, 2, 1, 2, 13, 10, 0, 3, 4, 15, 5, 1, 1, 4, 0, 0, 0, 0,
+	51, 1, 1, 50, 3, 4, 15, 4, 50, 2, 10, 14, 49, 3, 2, 15, 8, 49, 3, 8, 15, 2, 49, 2,
+	13, 10, 48, 3, 5, 15, 4, 48, 2, 11, 12, 47, 3, 3, 15, 7, 47, 3, 9, 15, 1, 46, 3, 1,
+	15, 9, 46, 3, 7, 15, 3, 46, 2, 13, 11, 45, 3, 5, 15, 5, 45, 2, 11, 13, 44, 3, 3, 15,
+	7, 44, 3, 9, 15, 1, 43, 3, 1, 15, 9, 43, 3, 7, 15, 3, 43, 2, 13, 11, 42, 3, 5, 15,
+	5, 42, 2, 10, 13, 41, 3, 3, 15, 7, 41, 3, 8, 15, 1, 41, 2, 14, 9, 40, 3, 6, 15, 4,
+	40, 2, 12, 12, 39, 3, 4, 15, 6, 39, 2, 10, 14, 38, 3, 2, 15, 8, 38, 3, 8, 15, 2, 38,
+	2, 14, 10, 37, 3, 6, 15, 4, 37, 2, 12, 12, 36, 3, 4, 15, 6, 36, 2, 10, 14, 35, 3, 2,
+	15, 8, 35, 3, 8, 15, 2, 35, 2, 13, 10, 34, 3, 6, 15, 4, 34, 2, 11, 12, 33, 3, 3, 15,
+	6, 33, 3, 9, 14, 1, 32, 3, 1, 15, 9, 32, 3, 7, 15, 3, 32, 2, 13, 11, 31, 3, 5, 15,
+	5, 31, 2, 11, 13, 30, 3, 3, 15, 7, 30, 3, 9, 15, 1, 29, 3, 1, 15, 9, 29, 3, 7, 15,
+	3, 29, 2, 13, 11, 28, 3, 5, 15, 5, 28, 2, 11, 13, 27, 3, 3, 15, 7, 27, 3, 9, 15, 1,
+	26, 3, 1, 14, 9, 26, 3, 6, 15, 3, 26, 2, 12, 11, 25, 3, 4, 15, 6, 25, 2, 10, 13, 24,
+	3, 2, 15, 8, 24, 3, 8, 15, 2, 24, 2, 14, 10, 23, 3, 6, 15, 4, 23, 2, 12, 12, 22, 3,
+	4, 15, 6, 22, 2, 10, 14, 21, 3, 2, 15, 8, 21, 3, 8, 15, 2, 21, 2, 14, 10, 20, 3, 6,
+	15, 4, 20, 2, 11, 12, 19, 3, 4, 15, 6, 19, 2, 9, 14, 18, 3, 1, 15, 8, 18, 3, 7, 15,
+	3, 18, 2, 13, 11, 17, 3, 5, 15, 5, 17, 2, 11, 13, 16, 3, 3, 15, 7, 16, 3, 9, 15, 1,
+	15, 3, 1, 15, 9, 15, 3, 7, 15, 3, 15, 2, 13, 11, 14, 3, 5, 15, 5, 14, 2, 11, 13, 13,
+	3, 3, 15, 7, 13, 3, 9, 15, 1, 12, 3, 1, 14, 9, 12, 3, 7, 15, 3, 12, 2, 12, 11, 11,
+	3, 4, 15, 5, 11, 2, 10, 13, 10, 3, 2, 15, 8, 10, 3, 8, 15, 2, 10, 2, 14, 10, 9, 3,
+	6, 15, 4, 9, 2, 12, 12, 8, 3, 4, 15, 6, 8, 2, 10, 14, 7, 3, 2, 15, 8, 7, 3, 8,
+	15, 2, 7, 2, 14, 10, 6, 3, 6, 15, 4, 6, 2, 12, 12, 5, 3, 4, 15, 6, 5, 2, 10, 14,
+	4, 3, 2, 15, 8, 4, 3, 7, 15, 2, 4, 2, 13, 10, 3, 3, 5, 15, 5, 3, 2, 11, 12, 2,
+	3, 3, 15, 7, 2, 3, 9, 15, 1, 1, 3, 1, 15, 9, 1, 3, 7, 15, 3, 1, 2, 13, 11, 0,
+	3, 4, 15, 5, 1, 1, 4, 0, 0, 0, 0, 53, 1, 3, 52, 3, 4, 15, 5, 52, 2, 10, 14, 51,
+	3, 2, 15, 8, 51, 3, 8, 15, 2, 50, 3, 1, 14, 9, 50, 3, 7, 15, 3, 50, 2, 13, 11, 49,
+	3, 5, 15, 5, 49, 2, 11, 12, 48, 3, 4, 15, 6, 48, 2, 10, 14, 47, 3, 2, 15, 8, 47, 3,
+	8, 15, 2, 46, 3, 1, 15, 9, 46, 3, 7, 15, 3, 46, 2, 13, 11, 45, 3, 5, 15, 5, 45, 2,
+	12, 12, 44, 3, 4, 15, 6, 44, 2, 10, 14, 43, 3, 2, 15, 8, 43, 3, 9, 15, 2, 42, 3, 1,
+	15, 9, 42, 3, 7, 15, 3, 42, 2, 13, 11, 41, 3, 6, 15, 5, 41, 2, 12, 12, 40, 3, 4, 15,
+	6, 40, 2, 10, 14, 39, 3, 3, 15, 8, 39, 3, 9, 15, 1, 38, 3, 1, 15, 9, 38, 3, 7, 15,
+	3, 38, 2, 13, 11, 37, 3, 6, 15, 4, 37, 2, 12, 12, 36, 3, 4, 15, 6, 36, 2, 10, 14, 35,
+	3, 3, 15, 7, 35, 3, 9, 15, 1, 34, 3, 1, 15, 9, 34, 3, 7, 15, 3, 34, 2, 13, 10, 33,
+	3, 6, 15, 4, 33, 2, 12, 12, 32, 3, 4, 15, 6, 32, 2, 10, 13, 31, 3, 3, 15, 7, 31, 3,
+	9, 15, 1, 30, 3, 1, 15, 9, 30, 3, 7, 15, 3, 30, 2, 13, 10, 29, 3, 6, 15, 4, 29, 2,
+	12, 12, 28, 3, 4, 15, 6, 28, 2, 10, 13, 27, 3, 3, 15, 7, 27, 3, 9, 15, 1, 26, 3, 1,
+	15, 9, 26, 3, 7, 15, 3, 26, 2, 14, 10, 25, 3, 6, 15, 4, 25, 2, 12, 12, 24, 3, 4, 15,
+	6, 24, 2, 11, 13, 23, 3, 3, 15, 7, 23, 3, 9, 15, 1, 22, 3, 1, 15, 9, 22, 3, 8, 15,
+	3, 22, 2, 14, 10, 21, 3, 6, 15, 4, 21, 2, 12, 12, 20, 3, 5, 15, 6, 20, 2, 11, 13, 19,
+	3, 3, 15, 7, 19, 3, 9, 15, 1, 18, 3, 2, 15, 9, 18, 3, 8, 15, 2, 18, 2, 14, 10, 17,
+	3, 6, 15, 4, 17, 2, 12, 12, 16, 3, 5, 15, 5, 16, 2, 11, 13, 15, 3, 3, 15, 7, 15, 3,
+	9, 15, 1, 14, 3, 2, 15, 8, 14, 3, 8, 15, 2, 14, 2, 14, 10, 13, 3, 6, 15, 4, 13, 2,
+	12, 11, 12, 3, 5, 15, 5, 12, 2, 11, 13, 11, 3, 3, 15, 7, 11, 3, 9, 14, 1, 10, 3, 2,
+	15, 8, 10, 3, 8, 15, 2, 10, 2, 14, 10, 9, 3, 6, 15, 4, 9, 2, 12, 11, 8, 3, 5, 15,
+	5, 8, 2, 11, 13, 7, 3, 3, 15, 7, 7, 3, 9, 14, 1, 6, 3, 2, 15, 8, 6, 3, 8, 15,
+	2, 6, 2, 14, 10, 5, 3, 6, 15, 4, 5, 2, 13, 11, 4, 3, 5, 15, 5, 4, 2, 11, 13, 3,
+	3, 3, 15, 7, 3, 3, 10, 14, 1, 2, 3, 2, 15, 8, 2, 3, 8, 15, 2, 2, 2, 14, 10, 1,
+	3, 7, 15, 4, 1, 2, 13, 11, 0, 3, 4, 15, 5, 1, 1, 4, 0, 0, 0, 0, 55, 1, 4, 54,
+	3, 4, 15, 5, 54, 2, 10, 14, 53, 3, 3, 15, 7, 53, 3, 9, 15, 1, 52, 3, 2, 15, 8, 52,
+	3, 8, 15, 2, 51, 3, 1, 15, 9, 51, 3, 7, 15, 3, 51, 2, 14, 10, 50, 3, 7, 15, 4, 50,
+	2, 13, 11, 49, 3, 6, 15, 5, 49, 2, 12, 12, 48, 3, 5, 15, 6, 48, 2, 11, 13, 47, 3, 4,
+	15, 6, 47, 2, 10, 14, 46, 3, 3, 15, 7, 46, 3, 9, 15, 1, 45, 3, 2, 15, 8, 45, 3, 8,
+	15, 2, 44, 3, 1, 15, 9, 44, 3, 7, 15, 3, 44, 2, 14, 10, 43, 3, 7, 15, 4, 43, 2, 13,
+	11, 42, 3, 6, 15, 5, 42, 2, 12, 12, 41, 3, 5, 15, 6, 41, 2, 11, 13, 40, 3, 4, 15, 7,
+	40, 2, 10, 14, 39, 3, 3, 15, 7, 39, 3, 9, 15, 1, 38, 3, 2, 15, 8, 38, 3, 8, 15, 2,
+	37, 3, 1, 15, 9, 37, 3, 7, 15, 3, 37, 2, 14, 10, 36, 3, 6, 15, 4, 36, 2, 13, 11, 35,
+	3, 6, 15, 5, 35, 2, 12, 12, 34, 3, 5, 15, 6, 34, 2, 11, 13, 33, 3, 4, 15, 7, 33, 2,
+	10, 14, 32, 3, 3, 15, 8, 32, 3, 9, 15, 1, 31, 3, 2, 15, 8, 31, 3, 8, 15, 2, 30, 3,
+	1, 15, 9, 30, 3, 7, 15, 3, 30, 2, 14, 10, 29, 3, 6, 15, 4, 29, 2, 13, 11, 28, 3, 5,
+	15, 5, 28, 2, 12, 12, 27, 3, 5, 15, 6, 27, 2, 11, 13, 26, 3, 4, 15, 7, 26, 2, 10, 14,
+	25, 3, 3, 15, 8, 25, 3, 9, 15, 1, 24, 3, 2, 15, 9, 24, 3, 8, 15, 2, 23, 3, 1, 14,
+	9, 23, 3, 7, 15, 3, 23, 2, 14, 10, 22, 3, 6, 15, 4, 22, 2, 13, 11, 21, 3, 5, 15, 5,
+	21, 2, 12, 12, 20, 3, 4, 15, 6, 20, 2, 11, 13, 19, 3, 4, 15, 7, 19, 2, 10, 14, 18, 3,
+	3, 15, 8, 18, 3, 9, 15, 1, 17, 3, 2, 15, 9, 17, 3, 8, 15, 2, 16, 3, 1, 14, 10, 16,
+	3, 7, 15, 3, 16, 2, 13, 10, 15, 3, 6, 15, 4, 15, 2, 13, 11, 14, 3, 5, 15, 5, 14, 2,
+	12, 12, 13, 3, 4, 15, 6, 13, 2, 11, 13, 12, 3, 3, 15, 7, 12, 3, 10, 14, 1, 11, 3, 3,
+	15, 8, 11, 3, 9, 15, 1, 10, 3, 2, 15, 9, 10, 3, 8, 15, 2, 9, 3, 1, 14, 10, 9, 3,
+	7, 15, 3, 9, 2, 13, 11, 8, 3, 6, 15, 4, 8, 2, 12, 11, 7, 3, 5, 15, 5, 7, 2, 12,
+	12, 6, 3, 4, 15, 6, 6, 2, 11, 13, 5, 3, 3, 15, 7, 5, 3, 10, 14, 1, 4, 3, 2, 15,
+	8, 4, 3, 9, 15, 1, 3, 3, 2, 15, 9, 3, 3, 8, 15, 2, 2, 3, 1, 14, 10, 2, 3, 7,
+	15, 3, 2, 2, 13, 11, 1, 3, 6, 15, 4, 1, 2, 12, 11, 0, 3, 4, 15, 5, 1, 1, 4, 0,
+	0, 0, 0, 57, 1, 4, 56, 3, 4, 15, 5, 56, 2, 11, 13, 55, 3, 4, 15, 7, 55, 2, 10, 14,
+	54, 3, 3, 15, 7, 54, 3, 10, 14, 1, 53, 3, 3, 15, 7, 53, 3, 10, 14, 1, 52, 3, 3, 15,
+	8, 52, 3, 9, 15, 1, 51, 3, 2, 15, 8, 51, 3, 9, 15, 2, 50, 3, 2, 15, 8, 50, 3, 9,
+	15, 2, 49, 3, 2, 15, 9, 49, 3, 8, 15, 2, 48, 3, 1, 15, 9, 48, 3, 8, 15, 3, 47, 3,
+	1, 15, 9, 47, 3, 8, 15, 3, 46, 3, 1, 14, 10, 46, 3, 7, 15, 3, 46, 2, 14, 10, 45, 3,
+	7, 15, 4, 45, 2, 14, 10, 44, 3, 7, 15, 4, 44, 2, 13, 11, 43, 3, 6, 15, 4, 43, 2, 13,
+	11, 42, 3, 6, 15, 5, 42, 2, 13, 11, 41, 3, 6, 15, 5, 41, 2, 12, 12, 40, 3, 5, 15, 5,
+	40, 2, 12, 12, 39, 3, 5, 15, 6, 39, 2, 12, 12, 38, 3, 5, 15, 6, 38, 2, 11, 13, 37, 3,
+	4, 15, 6, 37, 2, 11, 13, 36, 3, 4, 15, 7, 36, 2, 11, 13, 35, 3, 4, 15, 7, 35, 2, 10,
+	14, 34, 3, 3, 15, 7, 34, 3, 10, 14, 1, 33, 3, 3, 15, 8, 33, 3, 10, 14, 1, 32, 3, 3,
+	15, 8, 32, 3, 9, 15, 1, 31, 3, 2, 15, 8, 31, 3, 9, 15, 2, 30, 3, 2, 15, 8, 30, 3,
+	9, 15, 2, 29, 3, 2, 15, 9, 29, 3, 8, 15, 2, 28, 3, 1, 15, 9, 28, 3, 8, 15, 3, 27,
+	3, 1, 15, 9, 27, 3, 8, 15, 3, 26, 3, 1, 14, 10, 26, 3, 7, 15, 3, 26, 2, 14, 10, 25,
+	3, 7, 15, 4, 25, 2, 14, 10, 24, 3, 7, 15, 4, 24, 2, 13, 11, 23, 3, 6, 15, 4, 23, 2,
+	13, 11, 22, 3, 6, 15, 5, 22, 2, 13, 11, 21, 3, 6, 15, 5, 21, 2, 12, 12, 20, 3, 5, 15,
+	5, 20, 2, 12, 12, 19, 3, 5, 15, 6, 19, 2, 12, 12, 18, 3, 5, 15, 6, 18, 2, 11, 13, 17,
+	3, 4, 15, 6, 17, 2, 11, 13, 16, 3, 4, 15, 7, 16, 2, 11, 13, 15, 3, 4, 15, 7, 15, 2,
+	10, 14, 14, 3, 3, 15, 7, 14, 3, 10, 14, 1, 13, 3, 3, 15, 8, 13, 3, 10, 14, 1, 12, 3,
+	3, 15, 8, 12, 3, 9, 15, 1, 11, 3, 2, 15, 8, 11, 3, 9, 15, 2, 10, 3, 2, 15, 9, 10,
+	3, 9, 15, 2, 9, 3, 2, 15, 9, 9, 3, 8, 15, 2, 8, 3, 1, 15, 9, 8, 3, 8, 15, 3,
+	7, 3, 1, 14, 10, 7, 3, 8, 15, 3, 6, 3, 1, 14, 10, 6, 3, 7, 15, 3, 6, 2, 14, 10,
+	5, 3, 7, 15, 4, 5, 2, 13, 11, 4, 3, 7, 15, 4, 4, 2, 13, 11, 3, 3, 6, 15, 4, 3,
+	2, 13, 11, 2, 3, 6, 15, 5, 2, 2, 13, 12, 1, 3, 6, 15, 5, 1, 2, 12, 12, 0, 3, 4,
+	15, 5, 1, 1, 4, 0, 0, 0, 0, 59, 1, 4, 58, 3, 4, 15, 5, 58, 2, 11, 13, 57, 3, 4,
+	15, 6, 57, 2, 11, 13, 56, 3, 5, 15, 6, 56, 2, 12, 13, 55, 3, 5, 15, 6, 55, 2, 12, 12,
+	54, 3, 5, 15, 6, 54, 2, 12, 12, 53, 3, 6, 15, 5, 53, 2, 12, 12, 52, 3, 6, 15, 5, 52,
+	2, 13, 12, 51, 3, 6, 15, 5, 51, 2, 13, 11, 50, 3, 6, 15, 4, 50, 2, 13, 11, 49, 3, 7,
+	15, 4, 49, 2, 13, 11, 48, 3, 7, 15, 4, 48, 2, 14, 11, 47, 3, 7, 15, 4, 47, 2, 14, 10,
+	46, 3, 7, 15, 3, 45, 3, 1, 14, 10, 45, 3, 8, 15, 3, 44, 3, 1, 14, 10, 44, 3, 8, 15,
+	3, 43, 3, 1, 15, 10, 43, 3, 8, 15, 3, 42, 3, 2, 15, 9, 42, 3, 8, 15, 2, 41, 3, 2,
+	15, 9, 41, 3, 9, 15, 2, 40, 3, 2, 15, 9, 40, 3, 9, 15, 2, 39, 3, 2, 15, 9, 39, 3,
+	9, 15, 2, 38, 3, 3, 15, 8, 38, 3, 9, 15, 1, 37, 3, 3, 15, 8, 37, 3, 10, 15, 1, 36,
+	3, 3, 15, 8, 36, 3, 10, 14, 1, 35, 3, 3, 15, 7, 35, 3, 10, 14, 1, 34, 3, 4, 15, 7,
+	34, 2, 10, 14, 33, 3, 4, 15, 7, 33, 2, 11, 14, 32, 3, 4, 15, 7, 32, 2, 11, 13, 31, 3,
+	4, 15, 6, 31, 2, 11, 13, 30, 3, 5, 15, 6, 30, 2, 11, 13, 29, 3, 5, 15, 6, 29, 2, 12,
+	13, 28, 3, 5, 15, 6, 28, 2, 12, 12, 27, 3, 5, 15, 5, 27, 2, 12, 12, 26, 3, 6, 15, 5,
+	26, 2, 12, 12, 25, 3, 6, 15, 5, 25, 2, 13, 11, 24, 3, 6, 15, 5, 24, 2, 13, 11, 23, 3,
+	6, 15, 4, 23, 2, 13, 11, 22, 3, 7, 15, 4, 22, 2, 13, 11, 21, 3, 7, 15, 4, 21, 2, 14,
+	10, 20, 3, 7, 15, 4, 19, 3, 1, 14, 10, 19, 3, 7, 15, 3, 18, 3, 1, 14, 10, 18, 3, 8,
+	15, 3, 17, 3, 1, 14, 10, 17, 3, 8, 15, 3, 16, 3, 1, 15, 9, 16, 3, 8, 15, 3, 15, 3,
+	2, 15, 9, 15, 3, 8, 15, 2, 14, 3, 2, 15, 9, 14, 3, 9, 15, 2, 13, 3, 2, 15, 9, 13,
+	3, 9, 15, 2, 12, 3, 2, 15, 8, 12, 3, 9, 15, 2, 11, 3, 3, 15, 8, 11, 3, 9, 15, 1,
+	10, 3, 3, 15, 8, 10, 3, 10, 14, 1, 9, 3, 3, 15, 8, 9, 3, 10, 14, 1, 8, 3, 3, 15,
+	7, 8, 3, 10, 14, 1, 7, 3, 4, 15, 7, 7, 2, 10, 14, 6, 3, 4, 15, 7, 6, 2, 11, 13,
+	5, 3, 4, 15, 7, 5, 2, 11, 13, 4, 3, 4, 15, 6, 4, 2, 11, 13, 3, 3, 5, 15, 6, 3,
+	2, 11, 13, 2, 3, 5, 15, 6, 2, 2, 12, 12, 1, 3, 5, 15, 6, 1, 2, 12, 12, 0, 3, 4,
+	15, 5, 1, 1, 4, 0, 0, 0, 0, 61, 1, 4, 60, 3, 4, 15, 5, 60, 2, 11, 13, 59, 3, 5,
+	15, 6, 59, 2, 12, 12, 58, 3, 6, 15, 5, 58, 2, 13, 11, 57, 3, 7, 15, 4, 56, 3, 1, 14,
+	10, 56, 3, 8, 15, 3, 55, 3, 2, 15, 9, 55, 3, 9, 15, 2, 54, 3, 2, 15, 9, 54, 3, 9,
+	15, 2, 53, 3, 3, 15, 8, 53, 3, 10, 14, 1, 52, 3, 4, 15, 7, 52, 2, 11, 13, 51, 3, 5,
+	15, 6, 51, 2, 12, 12, 50, 3, 6, 15, 5, 50, 2, 13, 11, 49, 3, 7, 15, 4, 49, 2, 14, 11,
+	48, 3, 7, 15, 4, 47, 3, 1, 14, 10, 47, 3, 8, 15, 3, 46, 3, 2, 15, 9, 46, 3, 9, 15,
+	2, 45, 3, 3, 15, 8, 45, 3, 10, 14, 1, 44, 3, 4, 15, 7, 44, 2, 11, 13, 43, 3, 5, 15,
+	6, 43, 2, 12, 13, 42, 3, 5, 15, 6, 42, 2, 12, 12, 41, 3, 6, 15, 5, 41, 2, 13, 11, 40,
+	3, 7, 15, 4, 39, 3, 1, 14, 10, 39, 3, 8, 15, 3, 38, 3, 2, 15, 9, 38, 3, 9, 15, 2,
+	37, 3, 3, 15, 8, 37, 3, 10, 15, 1, 36, 3, 3, 15, 8, 36, 3, 10, 14, 1, 35, 3, 4, 15,
+	7, 35, 2, 11, 13, 34, 3, 5, 15, 6, 34, 2, 12, 12, 33, 3, 6, 15, 5, 33, 2, 13, 11, 32,
+	3, 7, 15, 4, 31, 3, 1, 14, 10, 31, 3, 8, 15, 3, 30, 3, 1, 15, 10, 30, 3, 8, 15, 3,
+	29, 3, 2, 15, 9, 29, 3, 9, 15, 2, 28, 3, 3, 15, 8, 28, 3, 10, 14, 1, 27, 3, 4, 15,
+	7, 27, 2, 11, 13, 26, 3, 5, 15, 6, 26, 2, 12, 12, 25, 3, 6, 15, 5, 25, 2, 13, 12, 24,
+	3, 6, 15, 5, 24, 2, 14, 11, 23, 3, 7, 15, 4, 22, 3, 1, 14, 10, 22, 3, 8, 15, 3, 21,
+	3, 2, 15, 9, 21, 3, 9, 15, 2, 20, 3, 3, 15, 8, 20, 3, 10, 14, 1, 19, 3, 4, 15, 7,
+	19, 2, 11, 14, 18, 3, 4, 15, 7, 18, 2, 12, 13, 17, 3, 5, 15, 6, 17, 2, 12, 12, 16, 3,
+	6, 15, 5, 16, 2, 13, 11, 15, 3, 7, 15, 4, 14, 3, 1, 14, 10, 14, 3, 8, 15, 3, 13, 3,
+	2, 15, 9, 13, 3, 9, 15, 2, 12, 3, 2, 15, 9, 12, 3, 10, 15, 2, 11, 3, 3, 15, 8, 11,
+	3, 10, 14, 1, 10, 3, 4, 15, 7, 10, 2, 11, 13, 9, 3, 5, 15, 6, 9, 2, 12, 12, 8, 3,
+	6, 15, 5, 8, 2, 13, 11, 7, 3, 7, 15, 4, 7, 2, 14, 11, 6, 3, 8, 15, 4, 5, 3, 1,
+	15, 10, 5, 3, 8, 15, 3, 4, 3, 2, 15, 9, 4, 3, 9, 15, 2, 3, 3, 3, 15, 8, 3, 3,
+	10, 14, 1, 2, 3, 4, 15, 7, 2, 2, 11, 13, 1, 3, 5, 15, 6, 1, 2, 12, 13, 0, 3, 4,
+	15, 6, 1, 1, 4, 0, 0, 0, 0, 63, 1, 3, 62, 3, 5, 15, 5, 62, 2, 12, 13, 61, 3, 6,
+	15, 5, 61, 2, 13, 11, 60, 3, 7, 15, 4, 59, 3, 2, 15, 10, 59, 3, 9, 15, 2, 58, 3, 3,
+	15, 8, 58, 3, 10, 14, 1, 57, 3, 4, 15, 7, 57, 2, 12, 13, 56, 3, 6, 15, 5, 56, 2, 13,
+	11, 55, 3, 7, 15, 4, 54, 3, 1, 15, 10, 54, 3, 9, 15, 3, 53, 3, 3, 15, 8, 53, 3, 10,
+	14, 1, 52, 3, 4, 15, 7, 52, 2, 12, 13, 51, 3, 6, 15, 6, 51, 2, 13, 11, 50, 3, 7, 15,
+	4, 49, 3, 1, 14, 10, 49, 3, 9, 15, 3, 48, 3, 3, 15, 9, 48, 3, 10, 14, 1, 47, 3, 4,
+	15, 7, 47, 2, 11, 13, 46, 3, 6, 15, 6, 46, 2, 13, 12, 45, 3, 7, 15, 4, 44, 3, 1, 14,
+	10, 44, 3, 8, 15, 3, 43, 3, 3, 15, 9, 43, 3, 10, 15, 1, 42, 3, 4, 15, 7, 42, 2, 11,
+	13, 41, 3, 5, 15, 6, 41, 2, 13, 12, 40, 3, 7, 15, 4, 39, 3, 1, 14, 10, 39, 3, 8, 15,
+	3, 38, 3, 2, 15, 9, 38, 3, 10, 15, 2, 37, 3, 4, 15, 7, 37, 2, 11, 13, 36, 3, 5, 15,
+	6, 36, 2, 13, 12, 35, 3, 7, 15, 5, 34, 3, 1, 14, 10, 34, 3, 8, 15, 3, 33, 3, 2, 15,
+	9, 33, 3, 10, 15, 2, 32, 3, 4, 15, 8, 32, 2, 11, 13, 31, 3, 5, 15, 6, 31, 2, 12, 12,
+	30, 3, 7, 15, 5, 29, 3, 1, 14, 11, 29, 3, 8, 15, 3, 28, 3, 2, 15, 9, 28, 3, 9, 15,
+	2, 27, 3, 4, 15, 8, 27, 2, 11, 14, 26, 3, 5, 15, 6, 26, 2, 12, 12, 25, 3, 6, 15, 5,
+	24, 3, 1, 14, 11, 24, 3, 8, 15, 3, 23, 3, 2, 15, 9, 23, 3, 9, 15, 2, 22, 3, 3, 15,
+	8, 22, 3, 11, 14, 1, 21, 3, 5, 15, 6, 21, 2, 12, 12, 20, 3, 6, 15, 5, 20, 2, 13, 11,
+	19, 3, 8, 15, 4, 18, 3, 2, 15, 9, 18, 3, 9, 15, 2, 17, 3, 3, 15, 8, 17, 3, 10, 14,
+	1, 16, 3, 5, 15, 7, 16, 2, 12, 12, 15, 3, 6, 15, 5, 15, 2, 13, 11, 14, 3, 7, 15, 4,
+	13, 3, 2, 15, 10, 13, 3, 9, 15, 2, 12, 3, 3, 15, 8, 12, 3, 10, 14, 1, 11, 3, 5, 15,
+	7, 11, 2, 12, 13, 10, 3, 6, 15, 5, 10, 2, 13, 11, 9, 3, 7, 15, 4, 8, 3, 2, 15, 10,
+	8, 3, 9, 15, 2, 7, 3, 3, 15, 8, 7, 3, 10, 14, 1, 6, 3, 4, 15, 7, 6, 2, 12, 13,
+	5, 3, 6, 15, 5, 5, 2, 13, 11, 4, 3, 7, 15, 4, 3, 3, 1, 14, 10, 3, 3, 9, 15, 3,
+	2, 3, 3, 15, 8, 2, 3, 10, 14, 1, 1, 3, 4, 15, 7, 1, 2, 11, 13, 0, 3, 4, 15, 6,
+	1, 1, 4, 0, 0, 0, 0, 65, 1, 2, 64, 3, 5, 15, 4, 64, 2, 12, 12, 63, 3, 7, 15, 5,
+	62, 3, 1, 14, 10, 62, 3, 9, 15, 3, 61, 3, 3, 15, 8, 61, 3, 11, 14, 1, 60, 3, 5, 15,
+	6, 60, 2, 13, 12, 59, 3, 7, 15, 4, 58, 3, 2, 15, 10, 58, 3, 9, 15, 2, 57, 3, 4, 15,
+	8, 57, 2, 11, 13, 56, 3, 6, 15, 6, 56, 2, 13, 11, 55, 3, 8, 15, 4, 54, 3, 2, 15, 9,
+	54, 3, 10, 15, 2, 53, 3, 4, 15, 7, 53, 2, 12, 13, 52, 3, 6, 15, 5, 51, 3, 1, 14, 11,
+	51, 3, 8, 15, 3, 50, 3, 3, 15, 9, 50, 3, 10, 14, 1, 49, 3, 5, 15, 7, 49, 2, 12, 12,
+	48, 3, 7, 15, 5, 47, 3, 1, 14, 10, 47, 3, 9, 15, 3, 46, 3, 3, 15, 8, 46, 3, 11, 14,
+	1, 45, 3, 5, 15, 6, 45, 2, 13, 12, 44, 3, 7, 15, 4, 43, 3, 2, 15, 10, 43, 3, 9, 15,
+	2, 42, 3, 4, 15, 8, 42, 2, 11, 13, 41, 3, 6, 15, 6, 41, 2, 13, 11, 40, 3, 8, 15, 4,
+	39, 3, 2, 15, 9, 39, 3, 10, 15, 2, 38, 3, 4, 15, 7, 38, 2, 12, 13, 37, 3, 6, 15, 5,
+	36, 3, 1, 14, 11, 36, 3, 8, 15, 3, 35, 3, 3, 15, 9, 35, 3, 10, 14, 1, 34, 3, 5, 15,
+	7, 34, 2, 12, 12, 33, 3, 7, 15, 5, 32, 3, 1, 14, 10, 32, 3, 9, 15, 3, 31, 3, 3, 15,
+	8, 31, 3, 11, 14, 1, 30, 3, 5, 15, 6, 30, 2, 13, 12, 29, 3, 7, 15, 4, 28, 3, 2, 15,
+	10, 28, 3, 9, 15, 2, 27, 3, 4, 15, 8, 27, 2, 11, 13, 26, 3, 6, 15, 6, 25, 3, 1, 14,
+	11, 25, 3, 8, 15, 4, 24, 3, 3, 15, 9, 24, 3, 10, 14, 1, 23, 3, 5, 15, 7, 23, 2, 12,
+	12, 22, 3, 7, 15, 5, 21, 3, 1, 14, 10, 21, 3, 9, 15, 3, 20, 3, 3, 15, 8, 20, 3, 11,
+	14, 1, 19, 3, 5, 15, 6, 19, 2, 13, 12, 18, 3, 7, 15, 4, 17, 3, 2, 15, 10, 17, 3, 9,
+	15, 2, 16, 3, 4, 15, 8, 16, 2, 11, 13, 15, 3, 6, 15, 6, 15, 2, 13, 11, 14, 3, 8, 15,
+	4, 13, 3, 2, 15, 9, 13, 3, 10, 15, 2, 12, 3, 4, 15, 7, 12, 2, 12, 13, 11, 3, 6, 15,
+	5, 10, 3, 1, 14, 11, 10, 3, 8, 15, 3, 9, 3, 3, 15, 9, 9, 3, 10, 14, 1, 8, 3, 5,
+	15, 7, 8, 2, 12, 12, 7, 3, 7, 15, 5, 6, 3, 1, 14, 10, 6, 3, 9, 15, 3, 5, 3, 3,
+	15, 8, 5, 3, 11, 14, 1, 4, 3, 5, 15, 6, 4, 2, 13, 12, 3, 3, 7, 15, 4, 2, 3, 2,
+	15, 10, 2, 3, 9, 15, 2, 1, 3, 4, 15, 8, 1, 2, 11, 13, 0, 3, 4, 15, 6, 1, 1, 4,
+	0, 0, 0, 0, 0, 0, 66, 3, 5, 14, 2, 66, 2, 12, 12, 65, 3, 7, 15, 5, 64, 3, 2, 15,
+	10, 64, 3, 10, 15, 2, 63, 3, 5, 15, 7, 63, 2, 12, 12, 62, 3, 7, 15, 4, 61, 3, 2, 15,
+	10, 61, 3, 10, 15, 2, 60, 3, 5, 15, 7, 60, 2, 13, 12, 59, 3, 7, 15, 4, 58, 3, 2, 15,
+	10, 58, 3, 10, 15, 2, 57, 3, 5, 15, 7, 57, 2, 13, 12, 56, 3, 7, 15, 4, 55, 3, 2, 15,
+	9, 55, 3, 10, 15, 2, 54, 3, 5, 15, 7, 54, 2, 13, 12, 53, 3, 7, 15, 4, 52, 3, 2, 15,
+	9, 52, 3, 10, 15, 2, 51, 3, 5, 15, 7, 51, 2, 13, 12, 50, 3, 8, 15, 4, 49, 3, 2, 15,
+	9, 49, 3, 10, 15, 2, 48, 3, 5, 15, 7, 48, 2, 13, 12, 47, 3, 8, 15, 4, 46, 3, 2, 15,
+	9, 46, 3, 10, 14, 2, 45, 3, 5, 15, 7, 45, 2, 13, 12, 44, 3, 8, 15, 4, 43, 3, 3, 15,
+	9, 43, 3, 10, 14, 2, 42, 3, 5, 15, 7, 42, 2, 13, 12, 41, 3, 8, 15, 4, 40, 3, 3, 15,
+	9, 40, 3, 10, 14, 1, 39, 3, 5, 15, 7, 39, 2, 13, 12, 38, 3, 8, 15, 4, 37, 3, 3, 15,
+	9, 37, 3, 10, 14, 1, 36, 3, 5, 15, 7, 36, 2, 13, 12, 35, 3, 8, 15, 4, 34, 3, 3, 15,
+	9, 34, 3, 10, 14, 1, 33, 3, 5, 15, 7, 33, 2, 13, 12, 32, 3, 8, 15, 4, 31, 3, 3, 15,
+	9, 31, 3, 10, 14, 1, 30, 3, 5, 15, 6, 30, 2, 13, 12, 29, 3, 8, 15, 4, 28, 3, 3, 15,
+	9, 28, 3, 11, 14, 1, 27, 3, 5, 15, 6, 27, 2, 13, 12, 26, 3, 8, 15, 4, 25, 3, 3, 15,
+	9, 25, 3, 11, 14, 1, 24, 3, 5, 15, 6, 24, 2, 13, 11, 23, 3, 8, 15, 4, 22, 3, 3, 15,
+	9, 22, 3, 11, 14, 1, 21, 3, 6, 15, 6, 21, 2, 13, 11, 20, 3, 8, 15, 4, 19, 3, 3, 15,
+	9, 19, 3, 11, 14, 1, 18, 3, 6, 15, 6, 18, 2, 13, 11, 17, 3, 8, 15, 4, 16, 3, 3, 15,
+	9, 16, 3, 11, 14, 1, 15, 3, 6, 15, 6, 15, 2, 13, 11, 14, 3, 8, 15, 4, 13, 3, 3, 15,
+	9, 13, 3, 11, 14, 1, 12, 3, 6, 15, 6, 11, 3, 1, 13, 11, 11, 3, 8, 15, 4, 10, 3, 3,
+	15, 9, 10, 3, 11, 14, 1, 9, 3, 6, 15, 6, 8, 3, 1, 13, 11, 8, 3, 8, 15, 3, 7, 3,
+	3, 15, 9, 7, 3, 11, 14, 1, 6, 3, 6, 15, 6, 5, 3, 1, 14, 11, 5, 3, 8, 15, 3, 4,
+	3, 3, 15, 9, 4, 3, 11, 14, 1, 3, 3, 6, 15, 6, 2, 3, 1, 14, 11, 2, 3, 8, 15, 3,
+	1, 3, 3, 15, 8, 1, 3, 11, 14, 1, 0, 3, 4, 15, 6, 1, 1, 4, 0, 0, 0, 0, 0, 0,
+	68, 2, 5, 12, 68, 2, 13, 12, 67, 3, 8, 15, 4, 66, 3, 3, 15, 9, 66, 3, 11, 14, 1, 65,
+	3, 6, 15, 6, 64, 3, 1, 14, 11, 64, 3, 9, 15, 3, 63, 3, 5, 15, 7, 63, 2, 13, 12, 62,
+	3, 8, 15, 4, 61, 3, 3, 15, 9, 61, 3, 11, 14, 1, 60, 3, 6, 15, 6, 59, 3, 1, 14, 11,
+	59, 3, 9, 15, 3, 58, 3, 5, 15, 7, 58, 2, 13, 12, 57, 3, 8, 15, 4, 56, 3, 3, 15, 9,
+	56, 3, 11, 14, 1, 55, 3, 6, 15, 6, 54, 3, 1, 14, 11, 54, 3, 9, 15, 3, 53, 3, 5, 15,
+	7, 53, 2, 13, 12, 52, 3, 8, 15, 4, 51, 3, 3, 15, 9, 51, 3, 11, 14, 1, 50, 3, 6, 15,
+	6, 49, 3, 1, 14, 11, 49, 3, 9, 15, 3, 48, 3, 5, 15, 7, 48, 2, 13, 12, 47, 3, 8, 15,
+	4, 46, 3, 3, 15, 9, 46, 3, 11, 14, 1, 45, 3, 6, 15, 6, 44, 3, 1, 14, 11, 44, 3, 9,
+	15, 3, 43, 3, 5, 15, 8, 43, 2, 13, 12, 42, 3, 8, 15, 4, 41, 3, 3, 15, 9, 41, 3, 11,
+	14, 1, 40, 3, 6, 15, 6, 39, 3, 1, 14, 11, 39, 3, 9, 15, 3, 38, 3, 5, 15, 8, 38, 2,
+	12, 12, 37, 3, 8, 15, 4, 36, 3, 3, 15, 9, 36, 3, 11, 14, 1, 35, 3, 6, 15, 6, 34, 3,
+	1, 14, 11, 34, 3, 9, 15, 3, 33, 3, 5, 15, 8, 33, 2, 12, 12, 32, 3, 8, 15, 4, 31, 3,
+	3, 15, 9, 31, 3, 11, 14, 1, 30, 3, 6, 15, 6, 29, 3, 1, 14, 11, 29, 3, 9, 15, 3, 28,
+	3, 5, 15, 8, 28, 2, 12, 12, 27, 3, 8, 15, 4, 26, 3, 3, 15, 9, 26, 3, 11, 14, 1, 25,
+	3, 6, 15, 6, 24, 3, 1, 14, 11, 24, 3, 9, 15, 3, 23, 3, 5, 15, 8, 23, 2, 12, 12, 22,
+	3, 8, 15, 4, 21, 3, 3, 15, 9, 21, 3, 11, 14, 1, 20, 3, 6, 15, 6, 19, 3, 1, 14, 11,
+	19, 3, 9, 15, 3, 18, 3, 4, 15, 8, 18, 2, 12, 12, 17, 3, 8, 15, 4, 16, 3, 3, 15, 9,
+	16, 3, 11, 14, 1, 15, 3, 6, 15, 6, 14, 3, 1, 14, 11, 14, 3, 9, 15, 3, 13, 3, 4, 15,
+	8, 13, 2, 12, 12, 12, 3, 8, 15, 4, 11, 3, 3, 15, 9, 11, 3, 11, 14, 1, 10, 3, 6, 15,
+	6, 9, 3, 1, 14, 11, 9, 3, 9, 15, 3, 8, 3, 4, 15, 8, 8, 2, 12, 12, 7, 3, 8, 15,
+	4, 6, 3, 3, 15, 9, 6, 3, 11, 14, 1, 5, 3, 6, 15, 6, 4, 3, 1, 14, 11, 4, 3, 9,
+	15, 3, 3, 3, 4, 15, 8, 3, 2, 12, 12, 2, 3, 8, 15, 4, 1, 3, 3, 15, 9, 1, 3, 11,
+	14, 1, 0, 3, 4, 15, 6, 1, 1, 4, 0, 0, 0, 0, 0, 0, 70, 2, 4, 8, 70, 2, 13, 12,
+	69, 3, 8, 15, 4, 68, 3, 4, 15, 9, 68, 2, 12, 13, 67, 3, 8, 15, 5, 66, 3, 3, 15, 9,
+	66, 3, 11, 14, 1, 65, 3, 7, 15, 5, 64, 3, 3, 15, 10, 64, 3, 11, 14, 2, 63, 3, 6, 15,
+	6, 62, 3, 2, 14, 10, 62, 3, 10, 15, 2, 61, 3, 6, 15, 7, 60, 3, 1, 14, 11, 60, 3, 9,
+	15, 3, 59, 3, 5, 15, 7, 58, 3, 1, 13, 12, 58, 3, 9, 15, 4, 57, 3, 4, 15, 8, 57, 2,
+	12, 12, 56, 3, 8, 15, 4, 55, 3, 4, 15, 9, 55, 3, 12, 13, 1, 54, 3, 7, 15, 5, 53, 3,
+	3, 15, 9, 53, 3, 11, 14, 1, 52, 3, 7, 15, 6, 51, 3, 2, 15, 10, 51, 3, 11, 14, 2, 50,
+	3, 6, 15, 6, 49, 3, 2, 14, 11, 49, 3, 10, 15, 2, 48, 3, 5, 15, 7, 47, 3, 1, 14, 11,
+	47, 3, 9, 15, 3, 46, 3, 5, 15, 8, 46, 2, 13, 12, 45, 3, 9, 15, 4, 44, 3, 4, 15, 8,
+	44, 2, 12, 13, 43, 3, 8, 15, 4, 42, 3, 4, 15, 9, 42, 3, 12, 13, 1, 41, 3, 7, 15, 5,
+	40, 3, 3, 15, 9, 40, 3, 11, 14, 1, 39, 3, 7, 15, 6, 38, 3, 2, 15, 10, 38, 3, 10, 15,
+	2, 37, 3, 6, 15, 6, 36, 3, 2, 14, 11, 36, 3, 10, 15, 3, 35, 3, 5, 15, 7, 34, 3, 1,
+	13, 11, 34, 3, 9, 15, 3, 33, 3, 5, 15, 8, 33, 2, 13, 12, 32, 3, 8, 15, 4, 31, 3, 4,
+	15, 8, 31, 2, 12, 13, 30, 3, 8, 15, 5, 29, 3, 3, 15, 9, 29, 3, 12, 13, 1, 28, 3, 7,
+	15, 5, 27, 3, 3, 15, 10, 27, 3, 11, 14, 1, 26, 3, 6, 15, 6, 25, 3, 2, 15, 10, 25, 3,
+	10, 15, 2, 24, 3, 6, 15, 7, 23, 3, 1, 14, 11, 23, 3, 10, 15, 3, 22, 3, 5, 15, 7, 21,
+	3, 1, 13, 12, 21, 3, 9, 15, 3, 20, 3, 5, 15, 8, 20, 2, 13, 12, 19, 3, 8, 15, 4, 18,
+	3, 4, 15, 8, 18, 2, 12, 13, 17, 3, 8, 15, 5, 16, 3, 3, 15, 9, 16, 3, 11, 14, 1, 15,
+	3, 7, 15, 5, 14, 3, 3, 15, 10, 14, 3, 11, 14, 2, 13, 3, 6, 15, 6, 12, 3, 2, 14, 10,
+	12, 3, 10, 15, 2, 11, 3, 6, 15, 7, 10, 3, 1, 14, 11, 10, 3, 9, 15, 3, 9, 3, 5, 15,
+	7, 8, 3, 1, 13, 12, 8, 3, 9, 15, 4, 7, 3, 4, 15, 8, 7, 2, 13, 12, 6, 3, 8, 15,
+	4, 5, 3, 4, 15, 9, 5, 2, 12, 13, 4, 3, 7, 15, 5, 3, 3, 3, 15, 9, 3, 3, 11, 14,
+	1, 2, 3, 7, 15, 6, 1, 3, 2, 15, 10, 1, 3, 11, 14, 2, 0, 3, 4, 15, 6, 1, 1, 4,
+	0, 0, 0, 0, 72, 2, 3, 4, 72, 2, 13, 12, 71, 3, 9, 15, 4, 70, 3, 4, 15, 8, 70, 2,
+	13, 12, 69, 3, 9, 15, 4, 68, 3, 5, 15, 8, 67, 3, 1, 13, 12, 67, 3, 9, 15, 4, 66, 3,
+	5, 15, 8, 65, 3, 1, 13, 12, 65, 3, 9, 15, 3, 64, 3, 5, 15, 7, 63, 3, 1, 14, 11, 63,
+	3, 10, 15, 3, 62, 3, 6, 15, 7, 61, 3, 2, 14, 11, 61, 3, 10, 15, 3, 60, 3, 6, 15, 7,
+	59, 3, 2, 14, 11, 59, 3, 10, 15, 2, 58, 3, 6, 15, 6, 57, 3, 2, 15, 10, 57, 3, 11, 15,
+	2, 56, 3, 7, 15, 6, 55, 3, 2, 15, 10, 55, 3, 11, 14, 2, 54, 3, 7, 15, 6, 53, 3, 3,
+	15, 10, 53, 3, 11, 14, 1, 52, 3, 7, 15, 6, 51, 3, 3, 15, 10, 51, 3, 11, 14, 1, 50, 3,
+	7, 15, 5, 49, 3, 3, 15, 9, 49, 3, 12, 13, 1, 48, 3, 8, 15, 5, 47, 3, 4, 15, 9, 47,
+	3, 12, 13, 1, 46, 3, 8, 15, 5, 45, 3, 4, 15, 9, 45, 2, 12, 13, 44, 3, 8, 15, 4, 43,
+	3, 4, 15, 8, 43, 2, 13, 12, 42, 3, 9, 15, 4, 41, 3, 5, 15, 8, 41, 2, 13, 12, 40, 3,
+	9, 15, 4, 39, 3, 5, 15, 8, 38, 3, 1, 13, 12, 38, 3, 9, 15, 3, 37, 3, 5, 15, 8, 36,
+	3, 1, 13, 12, 36, 3, 9, 15, 3, 35, 3, 5, 15, 7, 34, 3, 1, 14, 11, 34, 3, 10, 15, 3,
+	33, 3, 6, 15, 7, 32, 3, 2, 14, 11, 32, 3, 10, 15, 3, 31, 3, 6, 15, 7, 30, 3, 2, 14,
+	11, 30, 3, 10, 15, 2, 29, 3, 6, 15, 6, 28, 3, 2, 15, 10, 28, 3, 11, 14, 2, 27, 3, 7,
+	15, 6, 26, 3, 3, 15, 10, 26, 3, 11, 14, 2, 25, 3, 7, 15, 6, 24, 3, 3, 15, 10, 24, 3,
+	11, 14, 1, 23, 3, 7, 15, 5, 22, 3, 3, 15, 10, 22, 3, 11, 14, 1, 21, 3, 7, 15, 5, 20,
+	3, 3, 15, 9, 20, 3, 12, 13, 1, 19, 3, 8, 15, 5, 18, 3, 4, 15, 9, 18, 3, 12, 13, 1,
+	17, 3, 8, 15, 5, 16, 3, 4, 15, 9, 16, 2, 12, 13, 15, 3, 8, 15, 4, 14, 3, 4, 15, 8,
+	14, 2, 13, 12, 13, 3, 9, 15, 4, 12, 3, 5, 15, 8, 11, 3, 1, 13, 12, 11, 3, 9, 15, 4,
+	10, 3, 5, 15, 8, 9, 3, 1, 13, 12, 9, 3, 9, 15, 3, 8, 3, 5, 15, 7, 7, 3, 1, 14,
+	12, 7, 3, 9, 15, 3, 6, 3, 5, 15, 7, 5, 3, 1, 14, 11, 5, 3, 10, 15, 3, 4, 3, 6,
+	15, 7, 3, 3, 2, 14, 11, 3, 3, 10, 15, 3, 2, 3, 6, 15, 7, 1, 3, 2, 14, 11, 1, 3,
+	10, 15, 2, 0, 3, 4, 15, 6, 1, 1, 4, 0, 0, 0, 0, 0, 0, 74, 2, 12, 10, 73, 3, 9,
+	15, 4, 72, 3, 5, 15, 8, 71, 3, 1, 14, 12, 71, 3, 10, 15, 3, 70, 3, 6, 15, 7, 69, 3,
+	3, 15, 10, 69, 3, 11, 14, 2, 68, 3, 7, 15, 5, 67, 3, 4, 15, 9, 67, 3, 12, 13, 1, 66,
+	3, 9, 15, 4, 65, 3, 5, 15, 8, 64, 3, 1, 14, 12, 64, 3, 10, 15, 3, 63, 3, 6, 15, 7,
+	62, 3, 3, 15, 10, 62, 3, 11, 14, 2, 61, 3, 7, 15, 5, 60, 3, 4, 15, 9, 60, 3, 12, 13,
+	1, 59, 3, 9, 15, 4, 58, 3, 5, 15, 8, 57, 3, 1, 14, 12, 57, 3, 10, 15, 3, 56, 3, 6,
+	15, 7, 55, 3, 3, 15, 10, 55, 3, 11, 14, 2, 54, 3, 7, 15, 5, 53, 3, 4, 15, 9, 53, 3,
+	12, 13, 1, 52, 3, 9, 15, 4, 51, 3, 5, 15, 8, 50, 3, 1, 14, 12, 50, 3, 10, 15, 3, 49,
+	3, 6, 15, 7, 48, 3, 3, 15, 10, 48, 3, 11, 14, 2, 47, 3, 8, 15, 5, 46, 3, 4, 15, 9,
+	46, 2, 12, 13, 45, 3, 9, 15, 4, 44, 3, 5, 15, 8, 43, 3, 1, 14, 12, 43, 3, 10, 15, 3,
+	42, 3, 6, 15, 7, 41, 3, 3, 15, 10, 41, 3, 11, 14, 2, 40, 3, 8, 15, 5, 39, 3, 4, 15,
+	9, 39, 2, 12, 13, 38, 3, 9, 15, 4, 37, 3, 5, 15, 8, 36, 3, 1, 14, 12, 36, 3, 10, 15,
+	3, 35, 3, 6, 15, 7, 34, 3, 3, 15, 10, 34, 3, 11, 14, 2, 33, 3, 8, 15, 5, 32, 3, 4,
+	15, 9, 32, 2, 12, 13, 31, 3, 9, 15, 4, 30, 3, 5, 15, 8, 29, 3, 1, 14, 11, 29, 3, 10,
+	15, 3, 28, 3, 6, 15, 7, 27, 3, 3, 15, 10, 27, 3, 11, 14, 2, 26, 3, 8, 15, 5, 25, 3,
+	4, 15, 9, 25, 2, 13, 13, 24, 3, 9, 15, 4, 23, 3, 5, 15, 8, 22, 3, 1, 14, 11, 22, 3,
+	10, 15, 3, 21, 3, 6, 15, 7, 20, 3, 3, 15, 10, 20, 3, 11, 14, 2, 19, 3, 8, 15, 5, 18,
+	3, 4, 15, 9, 18, 2, 13, 13, 17, 3, 9, 15, 4, 16, 3, 5, 15, 8, 15, 3, 1, 14, 11, 15,
+	3, 10, 15, 3, 14, 3, 6, 15, 7, 13, 3, 3, 15, 10, 13, 3, 11, 14, 2, 12, 3, 8, 15, 5,
+	11, 3, 4, 15, 9, 11, 2, 13, 13, 10, 3, 9, 15, 4, 9, 3, 5, 15, 8, 8, 3, 2, 14, 11,
+	8, 3, 10, 15, 3, 7, 3, 6, 15, 6, 6, 3, 3, 15, 10, 6, 3, 11, 14, 2, 5, 3, 8, 15,
+	5, 4, 3, 4, 15, 9, 4, 2, 13, 13, 3, 3, 9, 15, 4, 2, 3, 5, 15, 8, 1, 3, 2, 14,
+	11, 1, 3, 10, 15, 3, 0, 3, 4, 15, 6, 1, 1, 4, 0, 0, 0, 0, 0, 0, 76, 2, 11, 5,
+	75, 3, 9, 15, 5, 74, 3, 5, 15, 8, 73, 3, 2, 14, 11, 73, 3, 11, 15, 2, 72, 3, 7, 15,
+	6, 71, 3, 4, 15, 9, 70, 3, 1, 13, 12, 70, 3, 10, 15, 4, 69, 3, 6, 15, 7, 68, 3, 3,
+	15, 10, 68, 3, 12, 14, 1, 67, 3, 9, 15, 5, 66, 3, 5, 15, 8, 65, 3, 2, 14, 11, 65, 3,
+	11, 15, 3, 64, 3, 7, 15, 6, 63, 3, 4, 15, 9, 62, 3, 1, 13, 12, 62, 3, 10, 15, 4, 61,
+	3, 6, 15, 7, 60, 3, 3, 15, 10, 60, 3, 12, 14, 1, 59, 3, 8, 15, 5, 58, 3, 5, 15, 8,
+	57, 3, 2, 14, 11, 57, 3, 11, 15, 3, 56, 3, 7, 15, 6, 55, 3, 4, 15, 9, 54, 3, 1, 13,
+	13, 54, 3, 9, 15, 4, 53, 3, 6, 15, 7, 52, 3, 3, 15, 10, 52, 3, 12, 14, 2, 51, 3, 8,
+	15, 5, 50, 3, 5, 15, 8, 49, 3, 2, 14, 12, 49, 3, 11, 15, 3, 48, 3, 7, 15, 6, 47, 3,
+	4, 15, 9, 46, 4, 1, 13, 13, 1, 46, 3, 9, 15, 4, 45, 3, 6, 15, 7, 44, 3, 3, 15, 10,
+	44, 3, 12, 14, 2, 43, 3, 8, 15, 5, 42, 3, 5, 15, 8, 41, 3, 2, 14, 12, 41, 3, 10, 15,
+	3, 40, 3, 7, 15, 6, 39, 3, 4, 15, 9, 39, 3, 13, 13, 1, 38, 3, 9, 15, 4, 37, 3, 6,
+	15, 7, 36, 3, 3, 15, 11, 36, 3, 11, 14, 2, 35, 3, 8, 15, 5, 34, 3, 5, 15, 8, 33, 3,
+	2, 14, 12, 33, 3, 10, 15, 3, 32, 3, 7, 15, 6, 31, 3, 4, 15, 10, 31, 3, 13, 13, 1, 30,
+	3, 9, 15, 4, 29, 3, 6, 15, 7, 28, 3, 3, 15, 11, 28, 3, 11, 14, 2, 27, 3, 8, 15, 5,
+	26, 3, 5, 15, 9, 25, 3, 1, 14, 12, 25, 3, 10, 15, 3, 24, 3, 7, 15, 6, 23, 3, 4, 15,
+	10, 23, 3, 12, 13, 1, 22, 3, 9, 15, 4, 21, 3, 6, 15, 7, 20, 3, 2, 15, 11, 20, 3, 11,
+	14, 2, 19, 3, 8, 15, 5, 18, 3, 5, 15, 9, 17, 3, 1, 13, 12, 17, 3, 10, 15, 3, 16, 3,
+	7, 15, 6, 15, 3, 3, 15, 10, 15, 3, 12, 13, 1, 14, 3, 9, 15, 4, 13, 3, 6, 15, 8, 12,
+	3, 2, 14, 11, 12, 3, 11, 14, 2, 11, 3, 8, 15, 5, 10, 3, 5, 15, 9, 9, 3, 1, 13, 12,
+	9, 3, 10, 15, 3, 8, 3, 7, 15, 7, 7, 3, 3, 15, 10, 7, 3, 12, 13, 1, 6, 3, 9, 15,
+	4, 5, 3, 6, 15, 8, 4, 3, 2, 14, 11, 4, 3, 11, 14, 2, 3, 3, 8, 15, 5, 2, 3, 4,
+	15, 9, 1, 3, 1, 13, 12, 1, 3, 10, 15, 3, 0, 3, 4, 15, 7, 1, 1, 4, 0, 0, 0, 0,
+	78, 1, 7, 77, 3, 8, 15, 4, 76, 3, 5, 15, 8, 75, 3, 3, 14, 11, 75, 3, 12, 14, 2, 74,
+	3, 9, 15, 5, 73, 3, 6, 15, 8, 72, 3, 3, 15, 11, 72, 3, 12, 14, 2, 71, 3, 9, 15, 5,
+	70, 3, 6, 15, 8, 69, 3, 3, 15, 11, 69, 3, 12, 14, 2, 68, 3, 9, 15, 5, 67, 3, 6, 15,
+	8, 66, 3, 3, 15, 11, 66, 3, 12, 13, 1, 65, 3, 9, 15, 4, 64, 3, 6, 15, 7, 63, 3, 3,
+	15, 10, 63, 3, 12, 13, 1, 62, 3, 9, 15, 4, 61, 3, 6, 15, 7, 60, 3, 3, 15, 10, 60, 3,
+	12, 13, 1, 59, 3, 9, 15, 4, 58, 3, 6, 15, 7, 57, 3, 4, 15, 10, 56, 4, 1, 13, 13, 1,
+	56, 3, 10, 15, 4, 55, 3, 7, 15, 7, 54, 3, 4, 15, 10, 53, 4, 1, 13, 13, 1, 53, 3, 10,
+	15, 4, 52, 3, 7, 15, 7, 51, 3, 4, 15, 10, 50, 4, 1, 13, 13, 1, 50, 3, 10, 15, 4, 49,
+	3, 7, 15, 7, 48, 3, 4, 15, 9, 47, 3, 1, 13, 12, 47, 3, 10, 15, 3, 46, 3, 7, 15, 6,
+	45, 3, 4, 15, 9, 44, 3, 1, 13, 12, 44, 3, 10, 15, 3, 43, 3, 7, 15, 6, 42, 3, 4, 15,
+	9, 41, 3, 1, 13, 12, 41, 3, 10, 15, 3, 40, 3, 8, 15, 6, 39, 3, 5, 15, 9, 38, 3, 2,
+	14, 12, 38, 3, 11, 15, 3, 37, 3, 8, 15, 6, 36, 3, 5, 15, 9, 35, 3, 2, 14, 12, 35, 3,
+	11, 15, 3, 34, 3, 8, 15, 6, 33, 3, 5, 15, 9, 32, 3, 2, 14, 12, 32, 3, 11, 15, 3, 31,
+	3, 8, 15, 6, 30, 3, 5, 15, 8, 29, 3, 2, 14, 11, 29, 3, 11, 14, 2, 28, 3, 8, 15, 5,
+	27, 3, 5, 15, 8, 26, 3, 2, 14, 11, 26, 3, 11, 14, 2, 25, 3, 8, 15, 5, 24, 3, 5, 15,
+	8, 23, 3, 2, 14, 11, 23, 3, 11, 14, 2, 22, 3, 9, 15, 5, 21, 3, 6, 15, 8, 20, 3, 3,
+	15, 11, 20, 3, 12, 14, 2, 19, 3, 9, 15, 5, 18, 3, 6, 15, 8, 17, 3, 3, 15, 11, 17, 3,
+	12, 14, 2, 16, 3, 9, 15, 5, 15, 3, 6, 15, 8, 14, 3, 3, 15, 11, 14, 3, 12, 14, 2, 13,
+	3, 9, 15, 4, 12, 3, 6, 15, 7, 11, 3, 3, 15, 10, 11, 3, 12, 13, 1, 10, 3, 9, 15, 4,
+	9, 3, 6, 15, 7, 8, 3, 3, 15, 10, 8, 3, 12, 13, 1, 7, 3, 9, 15, 4, 6, 3, 6, 15,
+	7, 5, 3, 3, 15, 10, 4, 4, 1, 13, 13, 1, 4, 3, 10, 15, 4, 3, 3, 7, 15, 7, 2, 3,
+	4, 15, 10, 1, 4, 1, 13, 13, 1, 1, 3, 10, 15, 4, 0, 3, 4, 15, 7, 1, 1, 4, 0, 0,
+	0, 0, 80, 1, 1, 79, 3, 8, 15, 1, 78, 3, 5, 15, 8, 77, 3, 3, 15, 11, 77, 3, 12, 14,
+	2, 76, 3, 9, 15, 4, 75, 3, 7, 15, 7, 74, 3, 4, 15, 10, 73, 3, 2, 14, 12, 73, 3, 11,
+	15, 3, 72, 3, 8, 15, 5, 71, 3, 6, 15, 8, 70, 3, 3, 15, 11, 69, 4, 1, 12, 13, 1, 69,
+	3, 10, 15, 4, 68, 3, 7, 15, 7, 67, 3, 5, 15, 9, 66, 3, 2, 14, 12, 66, 3, 11, 14, 3,
+	65, 3, 9, 15, 5, 64, 3, 6, 15, 8, 63, 3, 4, 15, 10, 62, 4, 1, 13, 13, 1, 62, 3, 10,
+	15, 4, 61, 3, 8, 15, 6, 60, 3, 5, 15, 9, 59, 3, 2, 14, 11, 59, 3, 12, 14, 2, 58, 3,
+	9, 15, 5, 57, 3, 7, 15, 7, 56, 3, 4, 15, 10, 55, 4, 1, 13, 13, 1, 55, 3, 11, 15, 3,
+	54, 3, 8, 15, 6, 53, 3, 5, 15, 8, 52, 3, 3, 15, 11, 52, 3, 12, 14, 2, 51, 3, 9, 15,
+	4, 50, 3, 7, 15, 7, 49, 3, 4, 15, 10, 48, 3, 2, 14, 12, 48, 3, 11, 15, 3, 47, 3, 8,
+	15, 5, 46, 3, 6, 15, 8, 45, 3, 3, 15, 11, 44, 4, 1, 12, 13, 1, 44, 3, 10, 15, 4, 43,
+	3, 7, 15, 7, 42, 3, 5, 15, 9, 41, 3, 2, 14, 12, 41, 3, 11, 14, 3, 40, 3, 9, 15, 5,
+	39, 3, 6, 15, 8, 38, 3, 4, 15, 10, 37, 4, 1, 13, 13, 1, 37, 3, 10, 15, 4, 36, 3, 8,
+	15, 6, 35, 3, 5, 15, 9, 34, 3, 2, 14, 11, 34, 3, 12, 14, 2, 33, 3, 9, 15, 5, 32, 3,
+	7, 15, 7, 31, 3, 4, 15, 10, 30, 4, 1, 13, 12, 1, 30, 3, 11, 15, 3, 29, 3, 8, 15, 6,
+	28, 3, 5, 15, 8, 27, 3, 3, 15, 11, 27, 3, 12, 14, 2, 26, 3, 10, 15, 4, 25, 3, 7, 15,
+	7, 24, 3, 4, 15, 10, 23, 3, 2, 14, 12, 23, 3, 11, 15, 3, 22, 3, 8, 15, 5, 21, 3, 6,
+	15, 8, 20, 3, 3, 15, 11, 19, 4, 1, 12, 13, 1, 19, 3, 10, 15, 4, 18, 3, 7, 15, 7, 17,
+	3, 5, 15, 9, 16, 3, 2, 14, 12, 16, 3, 11, 14, 3, 15, 3, 9, 15, 5, 14, 3, 6, 15, 8,
+	13, 3, 4, 15, 10, 12, 4, 1, 13, 13, 1, 12, 3, 10, 15, 4, 11, 3, 8, 15, 6, 10, 3, 5,
+	15, 9, 9, 3, 2, 14, 11, 9, 3, 12, 14, 2, 8, 3, 9, 15, 5, 7, 3, 7, 15, 7, 6, 3,
+	4, 15, 10, 5, 4, 1, 13, 12, 1, 5, 3, 11, 15, 3, 4, 3, 8, 15, 6, 3, 3, 5, 15, 8,
+	2, 3, 3, 15, 11, 2, 3, 12, 14, 2, 1, 3, 10, 15, 4, 0, 3, 4, 15, 7, 1, 1, 4, 0,
+	0, 0, 0, 0, 0, 81, 2, 7, 8, 80, 3, 5, 15, 9, 79, 3, 3, 15, 11, 78, 4, 1, 12, 13,
+	2, 78, 3, 10, 15, 4, 77, 3, 8, 15, 6, 76, 3, 6, 15, 8, 75, 3, 3, 15, 11, 74, 4, 1,
+	13, 13, 1, 74, 3, 11, 15, 3, 73, 3, 8, 15, 6, 72, 3, 6, 15, 8, 71, 3, 4, 15, 10, 70,
+	4, 2, 13, 12, 1, 70, 3, 11, 15, 3, 69, 3, 9, 15, 5, 68, 3, 7, 15, 7, 67, 3, 5, 15,
+	10, 66, 3, 2, 14, 12, 66, 3, 12, 14, 2, 65, 3, 10, 15, 5, 64, 3, 7, 15, 7, 63, 3, 5,
+	15, 9, 62, 3, 3, 15, 11, 61, 4, 1, 12, 13, 2, 61, 3, 10, 15, 4, 60, 3, 8, 15, 6, 59,
+	3, 6, 15, 8, 58, 3, 4, 15, 11, 57, 4, 1, 13, 13, 1, 57, 3, 11, 15, 3, 56, 3, 9, 15,
+	6, 55, 3, 6, 15, 8, 54, 3, 4, 15, 10, 53, 4, 2, 14, 12, 1, 53, 3, 11, 15, 3, 52, 3,
+	9, 15, 5, 51, 3, 7, 15, 7, 50, 3, 5, 15, 10, 49, 3, 2, 14, 12, 49, 3, 12, 14, 2, 48,
+	3, 10, 15, 4, 47, 3, 7, 15, 7, 46, 3, 5, 15, 9, 45, 3, 3, 15, 11, 44, 4, 1, 12, 13,
+	2, 44, 3, 10, 15, 4, 43, 3, 8, 15, 6, 42, 3, 6, 15, 8, 41, 3, 4, 15, 11, 40, 4, 1,
+	13, 13, 1, 40, 3, 11, 15, 3, 39, 3, 9, 15, 6, 38, 3, 6, 15, 8, 37, 3, 4, 15, 10, 36,
+	4, 2, 14, 12, 1, 36, 3, 11, 14, 3, 35, 3, 9, 15, 5, 34, 3, 7, 15, 7, 33, 3, 5, 15,
+	9, 32, 3, 3, 14, 12, 32, 3, 12, 14, 2, 31, 3, 10, 15, 4, 30, 3, 8, 15, 7, 29, 3, 5,
+	15, 9, 28, 3, 3, 15, 11, 27, 4, 1, 13, 13, 2, 27, 3, 10, 15, 4, 26, 3, 8, 15, 6, 25,
+	3, 6, 15, 8, 24, 3, 4, 15, 11, 23, 4, 1, 13, 13, 1, 23, 3, 11, 15, 3, 22, 3, 9, 15,
+	6, 21, 3, 6, 15, 8, 20, 3, 4, 15, 10, 19, 4, 2, 14, 12, 1, 19, 3, 11, 14, 3, 18, 3,
+	9, 15, 5, 17, 3, 7, 15, 7, 16, 3, 5, 15, 9, 15, 3, 3, 14, 12, 15, 3, 12, 14, 2, 14,
+	3, 10, 15, 4, 13, 3, 8, 15, 7, 12, 3, 5, 15, 9, 11, 3, 3, 15, 11, 10, 4, 1, 13, 13,
+	2, 10, 3, 10, 15, 4, 9, 3, 8, 15, 6, 8, 3, 6, 15, 8, 7, 3, 4, 15, 10, 6, 4, 2,
+	13, 13, 1, 6, 3, 11, 15, 3, 5, 3, 9, 15, 5, 4, 3, 7, 15, 8, 3, 3, 4, 15, 10, 2,
+	3, 2, 14, 12, 2, 3, 12, 14, 3, 1, 3, 9, 15, 5, 0, 3, 4, 15, 7, 1, 1, 4, 0, 0,
+	0, 0, 83, 2, 4, 1, 82, 3, 5, 15, 8, 81, 3, 3, 14, 12, 80, 4, 1, 12, 14, 2, 80, 3,
+	11, 15, 4, 79, 3, 9, 15, 6, 78, 3, 7, 15, 8, 77, 3, 5, 15, 10, 76, 3, 3, 15, 11, 75,
+	4, 1, 13, 13, 2, 75, 3, 11, 15, 4, 74, 3, 9, 15, 5, 73, 3, 7, 15, 7, 72, 3, 5, 15,
+	9, 71, 3, 4, 15, 11, 70, 4, 2, 13, 13, 1, 70, 3, 11, 15, 3, 69, 3, 9, 15, 5, 68, 3,
+	8, 15, 7, 67, 3, 6, 15, 9, 66, 3, 4, 15, 11, 65, 4, 2, 14, 12, 1, 65, 3, 12, 14, 3,
+	64, 3, 10, 15, 5, 63, 3, 8, 15, 6, 62, 3, 6, 15, 8, 61, 3, 4, 15, 10, 60, 4, 2, 14,
+	12, 1, 59, 4, 1, 12, 14, 2, 59, 3, 10, 15, 4, 58, 3, 8, 15, 6, 57, 3, 7, 15, 8, 56,
+	3, 5, 15, 10, 55, 3, 3, 14, 12, 54, 4, 1, 13, 13, 2, 54, 3, 11, 15, 4, 53, 3, 9, 15,
+	6, 52, 3, 7, 15, 8, 51, 3, 5, 15, 9, 50, 3, 3, 15, 11, 49, 4, 1, 13, 13, 2, 49, 3,
+	11, 15, 3, 48, 3, 9, 15, 5, 47, 3, 7, 15, 7, 46, 3, 6, 15, 9, 45, 3, 4, 15, 11, 44,
+	4, 2, 13, 13, 1, 44, 3, 11, 15, 3, 43, 3, 10, 15, 5, 42, 3, 8, 15, 7, 41, 3, 6, 15,
+	9, 40, 3, 4, 15, 10, 39, 4, 2, 14, 12, 1, 39, 3, 12, 14, 3, 38, 3, 10, 15, 4, 37, 3,
+	8, 15, 6, 36, 3, 6, 15, 8, 35, 3, 4, 15, 10, 34, 3, 3, 14, 12, 33, 4, 1, 12, 14, 2,
+	33, 3, 10, 15, 4, 32, 3, 9, 15, 6, 31, 3, 7, 15, 8, 30, 3, 5, 15, 10, 29, 3, 3, 15,
+	11, 28, 4, 1, 13, 13, 2, 28, 3, 11, 15, 4, 27, 3, 9, 15, 6, 26, 3, 7, 15, 7, 25, 3,
+	5, 15, 9, 24, 3, 3, 15, 11, 23, 4, 2, 13, 13, 1, 23, 3, 11, 15, 3, 22, 3, 9, 15, 5,
+	21, 3, 8, 15, 7, 20, 3, 6, 15, 9, 19, 3, 4, 15, 11, 18, 4, 2, 13, 13, 1, 18, 3, 12,
+	14, 3, 17, 3, 10, 15, 5, 16, 3, 8, 15, 7, 15, 3, 6, 15, 8, 14, 3, 4, 15, 10, 13, 4,
+	2, 14, 12, 1, 12, 4, 1, 12, 14, 3, 12, 3, 10, 15, 4, 11, 3, 8, 15, 6, 10, 3, 6, 15,
+	8, 9, 3, 5, 15, 10, 8, 3, 3, 14, 12, 7, 4, 1, 12, 14, 2, 7, 3, 11, 15, 4, 6, 3,
+	9, 15, 6, 5, 3, 7, 15, 8, 4, 3, 5, 15, 10, 3, 3, 3, 15, 11, 2, 4, 1, 13, 13, 2,
+	2, 3, 11, 15, 4, 1, 3, 9, 15, 5, 0, 3, 4, 15, 7, 1, 1, 4, 0, 0, 0, 0, 0, 0,
+	84, 3, 4, 13, 2, 83, 4, 2, 14, 13, 1, 82, 4, 1, 12, 14, 3, 82, 3, 11, 15, 4, 81, 3,
+	9, 15, 6, 80, 3, 8, 15, 7, 79, 3, 6, 15, 9, 78, 3, 5, 15, 10, 77, 3, 3, 15, 12, 76,
+	4, 2, 13, 13, 2, 76, 3, 12, 15, 3, 75, 3, 10, 15, 5, 74, 3, 9, 15, 6, 73, 3, 7, 15,
+	8, 72, 3, 6, 15, 9, 71, 3, 4, 15, 11, 70, 4, 3, 14, 12, 1, 69, 4, 1, 13, 14, 2, 69,
+	3, 11, 15, 4, 68, 3, 10, 15, 5, 67, 3, 8, 15, 7, 66, 3, 7, 15, 8, 65, 3, 5, 15, 10,
+	64, 3, 4, 15, 11, 63, 4, 2, 14, 13, 1, 62, 4, 1, 12, 14, 3, 62, 3, 11, 15, 4, 61, 3,
+	9, 15, 6, 60, 3, 8, 15, 7, 59, 3, 6, 15, 9, 58, 3, 5, 15, 10, 57, 3, 3, 15, 12, 56,
+	4, 2, 13, 13, 2, 56, 3, 12, 15, 3, 55, 3, 10, 15, 5, 54, 3, 9, 15, 6, 53, 3, 7, 15,
+	8, 52, 3, 6, 15, 9, 51, 3, 4, 15, 11, 50, 4, 3, 14, 12, 1, 49, 4, 1, 13, 14, 2, 49,
+	3, 11, 15, 4, 48, 3, 10, 15, 5, 47, 3, 8, 15, 7, 46, 3, 7, 15, 8, 45, 3, 5, 15, 10,
+	44, 3, 4, 15, 11, 43, 4, 2, 13, 13, 1, 42, 4, 1, 12, 14, 3, 42, 3, 11, 15, 4, 41, 3,
+	9, 15, 6, 40, 3, 8, 15, 7, 39, 3, 6, 15, 9, 38, 3, 5, 15, 10, 37, 3, 3, 14, 12, 36,
+	4, 2, 13, 13, 2, 36, 3, 11, 15, 3, 35, 3, 10, 15, 5, 34, 3, 9, 15, 6, 33, 3, 7, 15,
+	8, 32, 3, 6, 15, 9, 31, 3, 4, 15, 11, 30, 4, 3, 14, 12, 1, 29, 4, 1, 12, 14, 2, 29,
+	3, 11, 15, 4, 28, 3, 9, 15, 5, 27, 3, 8, 15, 7, 26, 3, 7, 15, 8, 25, 3, 5, 15, 10,
+	24, 3, 4, 15, 11, 23, 4, 2, 13, 13, 1, 22, 4, 1, 12, 14, 3, 22, 3, 10, 15, 4, 21, 3,
+	9, 15, 6, 20, 3, 8, 15, 7, 19, 3, 6, 15, 9, 18, 3, 5, 15, 10, 17, 3, 3, 14, 12, 16,
+	4, 2, 13, 13, 2, 16, 3, 11, 15, 3, 15, 3, 10, 15, 5, 14, 3, 8, 15, 6, 13, 3, 7, 15,
+	8, 12, 3, 6, 15, 9, 11, 3, 4, 15, 11, 10, 4, 3, 14, 12, 1, 9, 4, 1, 12, 14, 2, 9,
+	3, 11, 15, 4, 8, 3, 9, 15, 5, 7, 3, 8, 15, 7, 6, 3, 6, 15, 8, 5, 3, 5, 15, 10,
+	4, 3, 4, 15, 11, 3, 4, 2, 13, 13, 2, 2, 4, 1, 12, 14, 3, 2, 3, 10, 15, 4, 1, 3,
+	9, 15, 6, 0, 3, 4, 15, 7, 1, 1, 4, 0, 0, 0, 0, 86, 2, 2, 5, 85, 3, 2, 13, 13,
+	85, 3, 12, 15, 4, 84, 3, 11, 15, 5, 83, 3, 9, 15, 6, 82, 3, 8, 15, 7, 81, 3, 7, 15,
+	8, 80, 3, 6, 15, 9, 79, 3, 5, 15, 10, 78, 3, 4, 15, 11, 77, 4, 3, 14, 12, 1, 76, 4,
+	2, 13, 14, 2, 75, 4, 1, 12, 15, 4, 75, 3, 11, 15, 5, 74, 3, 9, 15, 6, 73, 3, 8, 15,
+	7, 72, 3, 7, 15, 8, 71, 3, 6, 15, 9, 70, 3, 5, 15, 10, 69, 3, 4, 15, 11, 68, 4, 3,
+	14, 12, 1, 67, 4, 2, 13, 14, 2, 66, 4, 1, 12, 15, 3, 66, 3, 11, 15, 5, 65, 3, 10, 15,
+	6, 64, 3, 8, 15, 7, 63, 3, 7, 15, 8, 62, 3, 6, 15, 9, 61, 3, 5, 15, 10, 60, 3, 4,
+	15, 11, 59, 4, 3, 14, 12, 1, 58, 4, 2, 13, 13, 2, 57, 4, 1, 12, 15, 3, 57, 3, 11, 15,
+	5, 56, 3, 10, 15, 6, 55, 3, 8, 15, 7, 54, 3, 7, 15, 8, 53, 3, 6, 15, 9, 52, 3, 5,
+	15, 10, 51, 3, 4, 15, 11, 50, 4, 3, 14, 12, 1, 49, 4, 2, 13, 13, 2, 48, 4, 1, 12, 15,
+	3, 48, 3, 11, 15, 4, 47, 3, 10, 15, 6, 46, 3, 8, 15, 7, 45, 3, 7, 15, 8, 44, 3, 6,
+	15, 9, 43, 3, 5, 15, 10, 42, 3, 4, 15, 11, 41, 4, 3, 14, 12, 1, 40, 4, 2, 13, 13, 2,
+	39, 4, 1, 12, 14, 3, 39, 3, 11, 15, 4, 38, 3, 10, 15, 6, 37, 3, 9, 15, 7, 36, 3, 7,
+	15, 8, 35, 3, 6, 15, 9, 34, 3, 5, 15, 10, 33, 3, 4, 15, 11, 32, 4, 3, 14, 12, 1, 31,
+	4, 2, 13, 13, 2, 30, 4, 1, 12, 14, 3, 30, 3, 11, 15, 4, 29, 3, 10, 15, 6, 28, 3, 9,
+	15, 7, 27, 3, 7, 15, 8, 26, 3, 6, 15, 9, 25, 3, 5, 15, 10, 24, 3, 4, 15, 11, 23, 4,
+	3, 14, 12, 1, 22, 4, 2, 13, 13, 2, 21, 4, 1, 12, 14, 3, 21, 3, 11, 15, 4, 20, 3, 10,
+	15, 5, 19, 3, 9, 15, 7, 18, 3, 8, 15, 8, 17, 3, 6, 15, 9, 16, 3, 5, 15, 10, 15, 3,
+	4, 15, 11, 14, 4, 3, 14, 12, 1, 13, 4, 2, 13, 13, 2, 12, 4, 1, 12, 14, 3, 12, 3, 11,
+	15, 4, 11, 3, 10, 15, 5, 10, 3, 9, 15, 7, 9, 3, 8, 15, 8, 8, 3, 6, 15, 9, 7, 3,
+	5, 15, 10, 6, 3, 4, 15, 11, 5, 4, 3, 14, 12, 1, 4, 4, 2, 13, 13, 2, 3, 4, 1, 12,
+	14, 3, 3, 3, 11, 15, 4, 2, 3, 10, 15, 5, 1, 3, 9, 15, 6, 0, 3, 4, 15, 8, 1, 1,
+	4, 0, 0, 0, 0, 0, 0, 87, 3, 1, 11, 7, 87, 3, 11, 15, 5, 86, 3, 10, 15, 5, 85, 3,
+	9, 15, 6, 84, 3, 9, 15, 7, 83, 3, 8, 15, 8, 82, 3, 7, 15, 8, 81, 3, 6, 15, 9, 80,
+	3, 6, 15, 10, 79, 3, 5, 15, 11, 78, 3, 4, 15, 11, 77, 4, 3, 14, 12, 1, 76, 4, 3, 14,
+	13, 2, 75, 4, 2, 13, 14, 3, 74, 4, 1, 12, 14, 3, 74, 3, 11, 15, 4, 73, 3, 11, 15, 5,
+	72, 3, 10, 15, 6, 71, 3, 9, 15, 6, 70, 3, 8, 15, 7, 69, 3, 8, 15, 8, 68, 3, 7, 15,
+	9, 67, 3, 6, 15, 9, 66, 3, 5, 15, 10, 65, 3, 5, 15, 11, 64, 4, 4, 15, 12, 1, 63, 4,
+	3, 14, 12, 1, 62, 4, 3, 14, 13, 2, 61, 4, 2, 13, 14, 3, 60, 4, 1, 12, 15, 4, 60, 3,
+	11, 15, 4, 59, 3, 11, 15, 5, 58, 3, 10, 15, 6, 57, 3, 9, 15, 7, 56, 3, 8, 15, 7, 55,
+	3, 8, 15, 8, 54, 3, 7, 15, 9, 53, 3, 6, 15, 9, 52, 3, 5, 15, 10, 51, 3, 5, 15, 11,
+	50, 4, 4, 15, 12, 1, 49, 4, 3, 14, 12, 1, 48, 4, 2, 13, 13, 2, 47, 4, 2, 13, 14, 3,
+	46, 4, 1, 12, 15, 4, 46, 3, 11, 15, 4, 45, 3, 10, 15, 5, 44, 3, 10, 15, 6, 43, 3, 9,
+	15, 7, 42, 3, 8, 15, 7, 41, 3, 7, 15, 8, 40, 3, 7, 15, 9, 39, 3, 6, 15, 10, 38, 3,
+	5, 15, 10, 37, 3, 4, 15, 11, 36, 4, 4, 15, 12, 1, 35, 4, 3, 14, 13, 2, 34, 4, 2, 13,
+	13, 2, 33, 4, 2, 12, 14, 3, 32, 4, 1, 12, 15, 4, 32, 3, 11, 15, 5, 31, 3, 10, 15, 5,
+	30, 3, 10, 15, 6, 29, 3, 9, 15, 7, 28, 3, 8, 15, 8, 27, 3, 7, 15, 8, 26, 3, 7, 15,
+	9, 25, 3, 6, 15, 10, 24, 3, 5, 15, 10, 23, 3, 4, 15, 11, 22, 4, 4, 15, 12, 1, 21, 4,
+	3, 14, 13, 2, 20, 4, 2, 13, 13, 2, 19, 4, 1, 12, 14, 3, 18, 4, 1, 12, 15, 4, 18, 3,
+	11, 15, 5, 17, 3, 10, 15, 5, 16, 3, 9, 15, 6, 15, 3, 9, 15, 7, 14, 3, 8, 15, 8, 13,
+	3, 7, 15, 8, 12, 3, 6, 15, 9, 11, 3, 6, 15, 10, 10, 3, 5, 15, 11, 9, 3, 4, 15, 11,
+	8, 4, 3, 14, 12, 1, 7, 4, 3, 14, 13, 2, 6, 4, 2, 13, 14, 3, 5, 4, 1, 12, 14, 3,
+	4, 4, 1, 11, 15, 4, 4, 3, 11, 15, 5, 3, 3, 10, 15, 6, 2, 3, 9, 15, 6, 1, 3, 9,
+	15, 7, 0, 3, 4, 15, 8, 1, 1, 4, 0, 0, 0, 0, 90, 1, 5, 89, 3, 10, 15, 2, 88, 3,
+	9, 15, 7, 87, 3, 9, 15, 7, 86, 3, 9, 15, 7, 85, 3, 8, 15, 8, 84, 3, 8, 15, 8, 83,
+	3, 7, 15, 8, 82, 3, 7, 15, 9, 81, 3, 7, 15, 9, 80, 3, 6, 15, 10, 79, 3, 6, 15, 10,
+	78, 3, 6, 15, 10, 77, 3, 5, 15, 11, 76, 3, 5, 15, 11, 75, 4, 4, 15, 11, 1, 74, 4, 4,
+	15, 12, 1, 73, 4, 4, 15, 12, 1, 72, 4, 3, 14, 13, 2, 71, 4, 3, 14, 13, 2, 70, 4, 3,
+	13, 13, 3, 69, 4, 2, 13, 14, 3, 68, 4, 2, 13, 14, 3, 67, 4, 2, 12, 14, 4, 66, 4, 1,
+	12, 15, 4, 65, 4, 1, 12, 15, 4, 65, 3, 11, 15, 5, 64, 3, 11, 15, 5, 63, 3, 10, 15, 5,
+	62, 3, 10, 15, 6, 61, 3, 10, 15, 6, 60, 3, 9, 15, 7, 59, 3, 9, 15, 7, 58, 3, 9, 15,
+	7, 57, 3, 8, 15, 8, 56, 3, 8, 15, 8, 55, 3, 7, 15, 8, 54, 3, 7, 15, 9, 53, 3, 7,
+	15, 9, 52, 3, 6, 15, 10, 51, 3, 6, 15, 10, 50, 3, 6, 15, 10, 49, 3, 5, 15, 11, 48, 3,
+	5, 15, 11, 47, 4, 5, 15, 11, 1, 46, 4, 4, 15, 12, 1, 45, 4, 4, 15, 12, 1, 44, 4, 3,
+	14, 13, 2, 43, 4, 3, 14, 13, 2, 42, 4, 3, 13, 13, 2, 41, 4, 2, 13, 14, 3, 40, 4, 2,
+	13, 14, 3, 39, 4, 2, 12, 14, 4, 38, 4, 1, 12, 15, 4, 37, 4, 1, 12, 15, 4, 37, 3, 11,
+	15, 5, 36, 3, 11, 15, 5, 35, 3, 10, 15, 5, 34, 3, 10, 15, 6, 33, 3, 10, 15, 6, 32, 3,
+	9, 15, 7, 31, 3, 9, 15, 7, 30, 3, 9, 15, 7, 29, 3, 8, 15, 8, 28, 3, 8, 15, 8, 27,
+	3, 8, 15, 8, 26, 3, 7, 15, 9, 25, 3, 7, 15, 9, 24, 3, 6, 15, 9, 23, 3, 6, 15, 10,
+	22, 3, 6, 15, 10, 21, 3, 5, 15, 11, 20, 3, 5, 15, 11, 19, 4, 5, 15, 11, 1, 18, 4, 4,
+	15, 12, 1, 17, 4, 4, 15, 12, 1, 16, 4, 3, 14, 12, 2, 15, 4, 3, 14, 13, 2, 14, 4, 3,
+	14, 13, 2, 13, 4, 2, 13, 14, 3, 12, 4, 2, 13, 14, 3, 11, 4, 2, 12, 14, 4, 10, 4, 1,
+	12, 15, 4, 9, 4, 1, 12, 15, 4, 8, 4, 1, 11, 15, 5, 8, 3, 11, 15, 5, 7, 3, 11, 15,
+	5, 6, 3, 10, 15, 6, 5, 3, 10, 15, 6, 4, 3, 9, 15, 6, 3, 3, 9, 15, 7, 2, 3, 9,
+	15, 7, 1, 3, 8, 15, 8, 0, 3, 4, 15, 8, 1, 1, 4, 0, 0, 0, 0, 0, 0, 91, 2, 8,
+	8, 90, 3, 8, 15, 8, 89, 3, 8, 15, 8, 88, 3, 8, 15, 8, 87, 3, 8, 15, 8, 86, 3, 8,
+	15, 8, 85, 3, 8, 15, 8, 84, 3, 8, 15, 8, 83, 3, 8, 15, 8, 82, 3, 8, 15, 8, 81, 3,
+	8, 15, 8, 80, 3, 8, 15, 8, 79, 3, 8, 15, 8, 78, 3, 8, 15, 8, 77, 3, 8, 15, 8, 76,
+	3, 8, 15, 8, 75, 3, 8, 15, 8, 74, 3, 8, 15, 8, 73, 3, 8, 15, 8, 72, 3, 8, 15, 8,
+	71, 3, 8, 15, 8, 70, 3, 8, 15, 8, 69, 3, 8, 15, 8, 68, 3, 8, 15, 8, 67, 3, 8, 15,
+	8, 66, 3, 8, 15, 8, 65, 3, 8, 15, 8, 64, 3, 8, 15, 8, 63, 3, 8, 15, 8, 62, 3, 8,
+	15, 8, 61, 3, 8, 15, 8, 60, 3, 8, 15, 8, 59, 3, 8, 15, 8, 58, 3, 8, 15, 8, 57, 3,
+	8, 15, 8, 56, 3, 8, 15, 8, 55, 3, 8, 15, 8, 54, 3, 8, 15, 8, 53, 3, 8, 15, 8, 52,
+	3, 8, 15, 8, 51, 3, 8, 15, 8, 50, 3, 8, 15, 8, 49, 3, 8, 15, 8, 48, 3, 8, 15, 8,
+	47, 3, 8, 15, 8, 46, 3, 8, 15, 8, 45, 3, 8, 15, 8, 44, 3, 8, 15, 8, 43, 3, 8, 15,
+	8, 42, 3, 8, 15, 8, 41, 3, 8, 15, 8, 40, 3, 8, 15, 8, 39, 3, 8, 15, 8, 38, 3, 8,
+	15, 8, 37, 3, 8, 15, 8, 36, 3, 8, 15, 8, 35, 3, 8, 15, 8, 34, 3, 8, 15, 8, 33, 3,
+	8, 15, 8, 32, 3, 8, 15, 8, 31, 3, 8, 15, 8, 30, 3, 8, 15, 8, 29, 3, 8, 15, 8, 28,
+	3, 8, 15, 8, 27, 3, 8, 15, 8, 26, 3, 8, 15, 8, 25, 3, 8, 15, 8, 24, 3, 8, 15, 8,
+	23, 3, 8, 15, 8, 22, 3, 8, 15, 8, 21, 3, 8, 15, 8, 20, 3, 8, 15, 8, 19, 3, 8, 15,
+	8, 18, 3, 8, 15, 8, 17, 3, 8, 15, 8, 16, 3, 8, 15, 8, 15, 3, 8, 15, 8, 14, 3, 8,
+	15, 8, 13, 3, 8, 15, 8, 12, 3, 8, 15, 8, 11, 3, 8, 15, 8, 10, 3, 8, 15, 8, 9, 3,
+	8, 15, 8, 8, 3, 8, 15, 8, 7, 3, 8, 15, 8, 6, 3, 8, 15, 8, 5, 3, 8, 15, 8, 4,
+	3, 8, 15, 8, 3, 3, 8, 15, 8, 2, 3, 8, 15, 8, 1, 3, 8, 15, 8, 0, 3, 4, 15, 8,
+	1, 1, 4, 0, 0, 0, 0, 93, 1, 2, 92, 3, 7, 15, 5, 91, 3, 7, 15, 10, 90, 3, 7, 15,
+	9, 89, 3, 8, 15, 9, 88, 3, 8, 15, 9, 87, 3, 8, 15, 8, 86, 3, 9, 15, 8, 85, 3, 9,
+	15, 7, 84, 3, 10, 15, 7, 83, 3, 10, 15, 7, 82, 3, 10, 15, 6, 81, 3, 11, 15, 6, 79, 4,
+	1, 11, 15, 6, 78, 4, 1, 11, 15, 5, 77, 4, 1, 12, 15, 5, 76, 4, 2, 12, 15, 4, 75, 4,
+	2, 13, 15, 4, 74, 4, 3, 13, 14, 4, 73, 4, 3, 13, 14, 3, 72, 4, 3, 14, 13, 3, 71, 4,
+	4, 14, 13, 3, 70, 4, 4, 14, 13, 2, 69, 4, 4, 15, 12, 2, 68, 4, 5, 15, 12, 2, 67, 4,
+	5, 15, 12, 1, 66, 4, 5, 15, 11, 1, 65, 3, 6, 15, 11, 64, 3, 6, 15, 10, 63, 3, 7, 15,
+	10, 62, 3, 7, 15, 10, 61, 3, 7, 15, 9, 60, 3, 8, 15, 9, 59, 3, 8, 15, 9, 58, 3, 8,
+	15, 8, 57, 3, 9, 15, 8, 56, 3, 9, 15, 7, 55, 3, 10, 15, 7, 54, 3, 10, 15, 7, 53, 3,
+	10, 15, 6, 52, 3, 11, 15, 6, 50, 4, 1, 11, 15, 6, 49, 4, 1, 11, 15, 5, 48, 4, 1, 12,
+	15, 5, 47, 4, 2, 12, 15, 5, 46, 4, 2, 13, 15, 4, 45, 4, 2, 13, 14, 4, 44, 4, 3, 13,
+	14, 3, 43, 4, 3, 14, 13, 3, 42, 4, 4, 14, 13, 3, 41, 4, 4, 14, 13, 2, 40, 4, 4, 15,
+	12, 2, 39, 4, 5, 15, 12, 2, 38, 4, 5, 15, 12, 1, 37, 4, 5, 15, 11, 1, 36, 3, 6, 15,
+	11, 35, 3, 6, 15, 10, 34, 3, 7, 15, 10, 33, 3, 7, 15, 10, 32, 3, 7, 15, 9, 31, 3, 8,
+	15, 9, 30, 3, 8, 15, 9, 29, 3, 8, 15, 8, 28, 3, 9, 15, 8, 27, 3, 9, 15, 8, 26, 3,
+	9, 15, 7, 25, 3, 10, 15, 7, 24, 3, 10, 15, 6, 23, 3, 11, 15, 6, 21, 4, 1, 11, 15, 6,
+	20, 4, 1, 11, 15, 5, 19, 4, 1, 12, 15, 5, 18, 4, 2, 12, 15, 5, 17, 4, 2, 12, 15, 4,
+	16, 4, 2, 13, 14, 4, 15, 4, 3, 13, 14, 3, 14, 4, 3, 14, 14, 3, 13, 4, 4, 14, 13, 3,
+	12, 4, 4, 14, 13, 2, 11, 4, 4, 15, 12, 2, 10, 4, 5, 15, 12, 2, 9, 4, 5, 15, 12, 1,
+	8, 4, 5, 15, 11, 1, 7, 4, 6, 15, 11, 1, 6, 3, 6, 15, 11, 5, 3, 6, 15, 10, 4, 3,
+	7, 15, 10, 3, 3, 7, 15, 9, 2, 3, 8, 15, 9, 1, 3, 8, 15, 9, 0, 3, 4, 15, 8, 1,
+	1, 4, 0, 0, 0, 0, 0, 0, 94, 2, 5, 7, 93, 3, 5, 15, 11, 92, 4, 6, 15, 11, 1, 91,
+	3, 7, 15, 10, 90, 3, 8, 15, 9, 89, 3, 8, 15, 9, 88, 3, 9, 15, 8, 87, 3, 10, 15, 7,
+	86, 3, 11, 15, 6, 84, 4, 1, 11, 15, 6, 83, 4, 2, 12, 15, 5, 82, 4, 3, 13, 14, 4, 81,
+	4, 3, 14, 14, 3, 80, 4, 4, 14, 13, 3, 79, 4, 5, 15, 12, 2, 78, 4, 6, 15, 11, 1, 77,
+	3, 6, 15, 11, 76, 3, 7, 15, 10, 75, 3, 8, 15, 9, 74, 3, 9, 15, 8, 73, 3, 9, 15, 8,
+	72, 3, 10, 15, 7, 70, 4, 1, 11, 15, 6, 69, 4, 1, 12, 15, 5, 68, 4, 2, 12, 15, 5, 67,
+	4, 3, 13, 14, 4, 66, 4, 4, 14, 14, 3, 65, 4, 4, 15, 13, 3, 64, 4, 5, 15, 12, 2, 63,
+	4, 6, 15, 11, 1, 62, 3, 7, 15, 11, 61, 3, 7, 15, 10, 60, 3, 8, 15, 9, 59, 3, 9, 15,
+	8, 58, 3, 9, 15, 8, 57, 3, 10, 15, 7, 55, 4, 1, 11, 15, 6, 54, 4, 1, 12, 15, 5, 53,
+	4, 2, 12, 15, 5, 52, 4, 3, 13, 14, 4, 51, 4, 4, 14, 13, 3, 50, 4, 4, 15, 13, 2, 49,
+	4, 5, 15, 12, 2, 48, 4, 6, 15, 11, 1, 47, 3, 7, 15, 10, 46, 3, 7, 15, 10, 45, 3, 8,
+	15, 9, 44, 3, 9, 15, 8, 43, 3, 10, 15, 7, 42, 3, 10, 15, 7, 40, 4, 1, 11, 15, 6, 39,
+	4, 2, 12, 15, 5, 38, 4, 2, 13, 15, 4, 37, 4, 3, 13, 14, 4, 36, 4, 4, 14, 13, 3, 35,
+	4, 5, 15, 12, 2, 34, 4, 5, 15, 12, 2, 33, 4, 6, 15, 11, 1, 32, 3, 7, 15, 10, 31, 3,
+	8, 15, 10, 30, 3, 8, 15, 9, 29, 3, 9, 15, 8, 28, 3, 10, 15, 7, 27, 3, 10, 15, 7, 25,
+	4, 1, 11, 15, 6, 24, 4, 2, 12, 15, 5, 23, 4, 2, 13, 15, 4, 22, 4, 3, 13, 14, 4, 21,
+	4, 4, 14, 13, 3, 20, 4, 5, 15, 12, 2, 19, 4, 5, 15, 12, 1, 18, 4, 6, 15, 11, 1, 17,
+	3, 7, 15, 10, 16, 3, 8, 15, 9, 15, 3, 8, 15, 9, 14, 3, 9, 15, 8, 13, 3, 10, 15, 7,
+	12, 3, 11, 15, 6, 10, 4, 1, 11, 15, 6, 9, 4, 2, 12, 15, 5, 8, 4, 3, 13, 14, 4, 7,
+	4, 3, 14, 14, 3, 6, 4, 4, 14, 13, 3, 5, 4, 5, 15, 12, 2, 4, 4, 6, 15, 11, 1, 3,
+	4, 6, 15, 11, 1, 2, 3, 7, 15, 10, 1, 3, 8, 15, 9, 0, 3, 4, 15, 9, 1, 1, 4, 0,
+	0, 0, 0, 0, 0, 95, 3, 4, 13, 5, 94, 4, 5, 15, 13, 2, 93, 4, 6, 15, 12, 2, 92, 3,
+	7, 15, 11, 91, 3, 8, 15, 9, 90, 3, 9, 15, 8, 89, 3, 10, 15, 7, 87, 4, 1, 11, 15, 6,
+	86, 4, 2, 12, 15, 5, 85, 4, 4, 14, 14, 4, 84, 4, 5, 15, 13, 3, 83, 4, 6, 15, 12, 2,
+	82, 4, 7, 15, 11, 1, 81, 3, 8, 15, 9, 80, 3, 9, 15, 8, 79, 3, 10, 15, 7, 77, 4, 1,
+	11, 15, 6, 76, 4, 2, 12, 15, 5, 75, 4, 3, 14, 14, 4, 74, 4, 5, 15, 13, 3, 73, 4, 6,
+	15, 12, 2, 72, 4, 7, 15, 11, 1, 71, 3, 8, 15, 10, 70, 3, 9, 15, 8, 69, 3, 10, 15, 7,
+	67, 4, 1, 11, 15, 6, 66, 4, 2, 12, 15, 5, 65, 4, 3, 13, 14, 4, 64, 4, 5, 15, 13, 3,
+	63, 4, 6, 15, 12, 2, 62, 4, 7, 15, 11, 1, 61, 3, 8, 15, 10, 60, 3, 9, 15, 8, 59, 3,
+	10, 15, 7, 57, 4, 1, 11, 15, 6, 56, 4, 2, 12, 15, 5, 55, 4, 3, 13, 14, 4, 54, 4, 4,
+	15, 13, 3, 53, 4, 6, 15, 12, 2, 52, 4, 7, 15, 11, 1, 51, 3, 8, 15, 10, 50, 3, 9, 15,
+	8, 49, 3, 10, 15, 7, 47, 4, 1, 11, 15, 6, 46, 4, 2, 12, 15, 5, 45, 4, 3, 13, 14, 4,
+	44, 4, 4, 14, 13, 3, 43, 4, 6, 15, 12, 2, 42, 4, 7, 15, 11, 1, 41, 3, 8, 15, 10, 40,
+	3, 9, 15, 9, 39, 3, 10, 15, 7, 37, 4, 1, 11, 15, 6, 36, 4, 2, 12, 15, 5, 35, 4, 3,
+	13, 14, 4, 34, 4, 4, 14, 13, 3, 33, 4, 6, 15, 12, 2, 32, 4, 7, 15, 11, 1, 31, 3, 8,
+	15, 10, 30, 3, 9, 15, 9, 29, 3, 10, 15, 7, 27, 4, 1, 11, 15, 6, 26, 4, 2, 12, 15, 5,
+	25, 4, 3, 13, 14, 4, 24, 4, 4, 14, 13, 3, 23, 4, 5, 15, 12, 2, 22, 4, 7, 15, 11, 1,
+	21, 3, 8, 15, 10, 20, 3, 9, 15, 9, 19, 3, 10, 15, 8, 17, 4, 1, 11, 15, 6, 16, 4, 2,
+	12, 15, 5, 15, 4, 3, 13, 14, 4, 14, 4, 4, 14, 13, 3, 13, 4, 5, 15, 12, 2, 12, 4, 7,
+	15, 11, 1, 11, 3, 8, 15, 10, 10, 3, 9, 15, 9, 9, 3, 10, 15, 8, 7, 4, 1, 11, 15, 6,
+	6, 4, 2, 12, 15, 5, 5, 4, 3, 13, 14, 4, 4, 4, 4, 14, 13, 3, 3, 4, 5, 15, 12, 2,
+	2, 4, 6, 15, 11, 1, 1, 3, 8, 15, 10, 0, 3, 4, 15, 9, 1, 1, 4, 0, 0, 0, 0, 97,
+	2, 1, 2, 96, 3, 3, 13, 13, 95, 4, 4, 14, 14, 4, 94, 4, 6, 15, 12, 2, 93, 4, 7, 15,
+	11, 1, 92, 3, 9, 15, 9, 91, 3, 10, 15, 8, 89, 4, 2, 12, 15, 6, 88, 4, 3, 13, 15, 5,
+	87, 4, 5, 15, 13, 3, 86, 4, 6, 15, 12, 2, 85, 3, 8, 15, 10, 84, 3, 9, 15, 9, 82, 4,
+	1, 11, 15, 7, 81, 4, 2, 12, 15, 6, 80, 4, 4, 14, 14, 4, 79, 4, 5, 15, 13, 3, 78, 4,
+	7, 15, 11, 1, 77, 3, 8, 15, 10, 76, 3, 10, 15, 8, 74, 4, 1, 11, 15, 7, 73, 4, 3, 13,
+	15, 5, 72, 4, 4, 14, 14, 4, 71, 4, 6, 15, 12, 2, 70, 4, 7, 15, 11, 1, 69, 3, 9, 15,
+	9, 68, 3, 10, 15, 8, 66, 4, 2, 12, 15, 6, 65, 4, 3, 13, 15, 5, 64, 4, 5, 15, 13, 3,
+	63, 4, 6, 15, 12, 2, 62, 3, 8, 15, 10, 61, 3, 9, 15, 9, 59, 4, 1, 11, 15, 7, 58, 4,
+	2, 12, 15, 6, 57, 4, 4, 14, 14, 4, 56, 4, 5, 15, 13, 3, 55, 4, 7, 15, 11, 1, 54, 3,
+	8, 15, 10, 53, 3, 10, 15, 8, 51, 4, 1, 11, 15, 7, 50, 4, 3, 13, 15, 5, 49, 4, 4, 14,
+	13, 4, 48, 4, 6, 15, 12, 2, 47, 4, 7, 15, 11, 1, 46, 3, 9, 15, 9, 45, 3, 10, 15, 8,
+	43, 4, 2, 12, 15, 6, 42, 4, 3, 13, 14, 5, 41, 4, 5, 15, 13, 3, 40, 4, 6, 15, 11, 2,
+	39, 3, 8, 15, 10, 38, 3, 9, 15, 9, 36, 4, 1, 11, 15, 7, 35, 4, 2, 12, 15, 6, 34, 4,
+	4, 14, 14, 4, 33, 4, 5, 15, 12, 3, 32, 4, 7, 15, 11, 1, 31, 3, 8, 15, 9, 30, 3, 10,
+	15, 8, 28, 4, 1, 11, 15, 7, 27, 4, 3, 13, 15, 5, 26, 4, 4, 14, 13, 4, 25, 4, 6, 15,
+	12, 2, 24, 4, 7, 15, 10, 1, 23, 3, 9, 15, 9, 22, 3, 10, 15, 8, 20, 4, 2, 12, 15, 6,
+	19, 4, 3, 13, 14, 5, 18, 4, 5, 15, 13, 3, 17, 4, 6, 15, 11, 2, 16, 3, 8, 15, 10, 15,
+	3, 9, 15, 8, 13, 4, 1, 11, 15, 7, 12, 4, 2, 12, 15, 6, 11, 4, 4, 14, 14, 4, 10, 4,
+	5, 15, 12, 3, 9, 4, 7, 15, 11, 1, 8, 3, 8, 15, 9, 7, 3, 10, 15, 8, 5, 4, 2, 11,
+	15, 6, 4, 4, 3, 13, 15, 5, 3, 4, 4, 14, 13, 4, 2, 4, 6, 15, 12, 2, 1, 4, 7, 15,
+	10, 1, 0, 3, 4, 15, 9, 1, 1, 4, 0, 0, 0, 0, 0, 0, 99, 2, 8, 1, 97, 4, 2, 12,
+	15, 4, 96, 4, 4, 14, 14, 5, 95, 4, 6, 15, 12, 3, 94, 4, 8, 15, 11, 1, 93, 3, 10, 15,
+	9, 91, 4, 2, 11, 15, 7, 90, 4, 4, 13, 15, 5, 89, 4, 5, 15, 13, 3, 88, 4, 7, 15, 11,
+	1, 87, 3, 9, 15, 9, 85, 4, 1, 11, 15, 7, 84, 4, 3, 13, 15, 5, 83, 4, 5, 15, 13, 4,
+	82, 4, 7, 15, 11, 2, 81, 3, 9, 15, 9, 79, 4, 1, 11, 15, 8, 78, 4, 3, 12, 15, 6, 77,
+	4, 5, 14, 14, 4, 76, 4, 6, 15, 12, 2, 75, 3, 8, 15, 10, 73, 4, 1, 10, 15, 8, 72, 4,
+	2, 12, 15, 6, 71, 4, 4, 14, 14, 4, 70, 4, 6, 15, 12, 2, 69, 4, 8, 15, 10, 1, 68, 3,
+	10, 15, 8, 66, 4, 2, 12, 15, 7, 65, 4, 4, 13, 14, 5, 64, 4, 6, 15, 13, 3, 63, 4, 8,
+	15, 11, 1, 62, 3, 9, 15, 9, 60, 4, 2, 11, 15, 7, 59, 4, 3, 13, 15, 5, 58, 4, 5, 15,
+	13, 3, 57, 4, 7, 15, 11, 1, 56, 3, 9, 15, 9, 54, 4, 1, 11, 15, 7, 53, 4, 3, 13, 15,
+	6, 52, 4, 5, 15, 13, 4, 51, 4, 7, 15, 11, 2, 50, 3, 9, 15, 10, 48, 4, 1, 10, 15, 8,
+	47, 4, 3, 12, 15, 6, 46, 4, 4, 14, 14, 4, 45, 4, 6, 15, 12, 2, 44, 3, 8, 15, 10, 43,
+	3, 10, 15, 8, 41, 4, 2, 12, 15, 6, 40, 4, 4, 14, 14, 4, 39, 4, 6, 15, 12, 3, 38, 4,
+	8, 15, 10, 1, 37, 3, 10, 15, 9, 35, 4, 2, 11, 15, 7, 34, 4, 4, 13, 15, 5, 33, 4, 6,
+	15, 13, 3, 32, 4, 7, 15, 11, 1, 31, 3, 9, 15, 9, 29, 4, 1, 11, 15, 7, 28, 4, 3, 13,
+	15, 5, 27, 4, 5, 15, 13, 3, 26, 4, 7, 15, 11, 2, 25, 3, 9, 15, 9, 23, 4, 1, 11, 15,
+	8, 22, 4, 3, 13, 15, 6, 21, 4, 5, 14, 13, 4, 20, 4, 7, 15, 12, 2, 19, 3, 8, 15, 10,
+	17, 4, 1, 10, 15, 8, 16, 4, 3, 12, 15, 6, 15, 4, 4, 14, 14, 4, 14, 4, 6, 15, 12, 2,
+	13, 4, 8, 15, 10, 1, 12, 3, 10, 15, 8, 10, 4, 2, 12, 15, 6, 9, 4, 4, 14, 14, 5, 8,
+	4, 6, 15, 12, 3, 7, 4, 8, 15, 11, 1, 6, 3, 10, 15, 9, 4, 4, 2, 11, 15, 7, 3, 4,
+	4, 13, 15, 5, 2, 4, 5, 15, 13, 3, 1, 4, 7, 15, 11, 1, 0, 3, 4, 15, 9, 1, 1, 4,
+	0, 0, 0, 0, 0, 0, 100, 2, 9, 8, 98, 4, 2, 11, 15, 7, 97, 4, 4, 13, 15, 5, 96, 4,
+	6, 15, 12, 3, 95, 4, 8, 15, 10, 1, 93, 4, 1, 11, 15, 8, 92, 4, 3, 13, 15, 6, 91, 4,
+	6, 15, 13, 3, 90, 4, 8, 15, 11, 1, 88, 4, 1, 10, 15, 8, 87, 4, 3, 12, 15, 6, 86, 4,
+	5, 15, 13, 4, 85, 4, 7, 15, 11, 2, 84, 3, 10, 15, 9, 82, 4, 2, 12, 15, 7, 81, 4, 5,
+	14, 14, 5, 80, 4, 7, 15, 12, 2, 79, 3, 9, 15, 10, 77, 4, 2, 11, 15, 7, 76, 4, 4, 13,
+	15, 5, 75, 4, 6, 15, 12, 3, 74, 4, 8, 15, 10, 1, 72, 4, 1, 11, 15, 8, 71, 4, 3, 13,
+	15, 6, 70, 4, 6, 15, 13, 4, 69, 4, 8, 15, 11, 1, 67, 4, 1, 10, 15, 9, 66, 4, 3, 12,
+	15, 6, 65, 4, 5, 15, 14, 4, 64, 4, 7, 15, 11, 2, 63, 3, 10, 15, 9, 61, 4, 2, 12, 15,
+	7, 60, 4, 4, 14, 14, 5, 59, 4, 7, 15, 12, 2, 58, 3, 9, 15, 10, 56, 4, 2, 11, 15, 7,
+	55, 4, 4, 13, 15, 5, 54, 4, 6, 15, 12, 3, 53, 4, 8, 15, 10, 1, 51, 4, 1, 11, 15, 8,
+	50, 4, 3, 13, 15, 6, 49, 4, 6, 15, 13, 4, 48, 4, 8, 15, 11, 1, 46, 4, 1, 10, 15, 9,
+	45, 4, 3, 12, 15, 6, 44, 4, 5, 14, 14, 4, 43, 4, 7, 15, 11, 2, 42, 3, 9, 15, 9, 40,
+	4, 2, 12, 15, 7, 39, 4, 4, 14, 14, 5, 38, 4, 7, 15, 12, 3, 37, 3, 9, 15, 10, 35, 4,
+	2, 11, 15, 8, 34, 4, 4, 13, 15, 5, 33, 4, 6, 15, 13, 3, 32, 4, 8, 15, 10, 1, 30, 4,
+	1, 11, 15, 8, 29, 4, 3, 13, 15, 6, 28, 4, 6, 15, 13, 4, 27, 4, 8, 15, 11, 1, 25, 4,
+	1, 10, 15, 9, 24, 4, 3, 12, 15, 6, 23, 4, 5, 14, 14, 4, 22, 4, 7, 15, 11, 2, 21, 3,
+	9, 15, 9, 19, 4, 2, 12, 15, 7, 18, 4, 4, 14, 14, 5, 17, 4, 7, 15, 12, 3, 16, 3, 9,
+	15, 10, 14, 4, 2, 11, 15, 8, 13, 4, 4, 13, 15, 5, 12, 4, 6, 15, 13, 3, 11, 4, 8, 15,
+	10, 1, 9, 4, 1, 10, 15, 8, 8, 4, 3, 13, 15, 6, 7, 4, 5, 15, 13, 4, 6, 4, 8, 15,
+	11, 2, 5, 3, 10, 15, 9, 3, 4, 3, 12, 15, 7, 2, 4, 5, 14, 14, 4, 1, 4, 7, 15, 12,
+	2, 0, 3, 4, 15, 9, 1, 1, 4, 0, 0, 0, 0, 102, 1, 1, 101, 3, 8, 15, 1, 99, 4, 2,
+	11, 15, 8, 98, 4, 4, 14, 15, 5, 97, 4, 7, 15, 12, 3, 96, 3, 10, 15, 9, 94, 4, 3, 12,
+	15, 7, 93, 4, 5, 15, 14, 4, 92, 4, 8, 15, 11, 2, 90, 4, 1, 11, 15, 8, 89, 4, 4, 13,
+	15, 6, 88, 4, 7, 15, 12, 3, 87, 4, 9, 15, 10, 1, 85, 4, 3, 12, 15, 7, 84, 4, 5, 14,
+	14, 5, 83, 4, 8, 15, 11, 2, 81, 4, 1, 10, 15, 9, 80, 4, 4, 13, 15, 6, 79, 4, 6, 15,
+	13, 4, 78, 4, 9, 15, 10, 1, 76, 4, 2, 11, 15, 8, 75, 4, 5, 14, 14, 5, 74, 4, 7, 15,
+	12, 2, 72, 4, 1, 10, 15, 9, 71, 4, 3, 13, 15, 7, 70, 4, 6, 15, 13, 4, 69, 4, 8, 15,
+	11, 1, 67, 4, 2, 11, 15, 8, 66, 4, 4, 14, 15, 5, 65, 4, 7, 15, 12, 3, 64, 3, 10, 15,
+	9, 62, 4, 3, 12, 15, 7, 61, 4, 5, 15, 14, 4, 60, 4, 8, 15, 11, 2, 58, 4, 1, 11, 15,
+	8, 57, 4, 4, 13, 15, 6, 56, 4, 7, 15, 12, 3, 55, 4, 9, 15, 10, 1, 53, 4, 3, 12, 15,
+	7, 52, 4, 5, 14, 14, 5, 51, 4, 8, 15, 11, 2, 49, 4, 1, 10, 15, 9, 48, 4, 4, 13, 15,
+	6, 47, 4, 6, 15, 13, 4, 46, 4, 9, 15, 10, 1, 44, 4, 2, 11, 15, 8, 43, 4, 5, 14, 14,
+	5, 42, 4, 7, 15, 12, 2, 40, 4, 1, 10, 15, 9, 39, 4, 3, 12, 15, 7, 38, 4, 6, 15, 13,
+	4, 37, 4, 8, 15, 11, 1, 35, 4, 2, 11, 15, 8, 34, 4, 4, 14, 15, 5, 33, 4, 7, 15, 12,
+	3, 32, 3, 10, 15, 10, 30, 4, 3, 12, 15, 7, 29, 4, 5, 15, 14, 4, 28, 4, 8, 15, 11, 2,
+	26, 4, 1, 11, 15, 8, 25, 4, 4, 13, 15, 6, 24, 4, 7, 15, 12, 3, 23, 4, 9, 15, 10, 1,
+	21, 4, 3, 12, 15, 7, 20, 4, 5, 14, 14, 5, 19, 4, 8, 15, 11, 2, 17, 4, 1, 10, 15, 9,
+	16, 4, 4, 13, 15, 6, 15, 4, 6, 15, 13, 4, 14, 4, 9, 15, 10, 1, 12, 4, 2, 11, 15, 8,
+	11, 4, 5, 14, 14, 5, 10, 4, 7, 15, 12, 2, 8, 4, 1, 10, 15, 9, 7, 4, 3, 12, 15, 7,
+	6, 4, 6, 15, 13, 4, 5, 4, 8, 15, 11, 1, 3, 4, 2, 11, 15, 8, 2, 4, 4, 14, 15, 5,
+	1, 4, 7, 15, 12, 3, 0, 3, 4, 15, 10, 1, 1, 4, 0, 0, 0, 0, 103, 1, 4, 102, 3, 8,
+	15, 7, 100, 4, 2, 11, 15, 8, 99, 4, 5, 14, 14, 5, 98, 4, 8, 15, 12, 3, 96, 4, 2, 11,
+	15, 9, 95, 4, 5, 14, 15, 6, 94, 4, 8, 15, 12, 3, 92, 4, 2, 11, 15, 9, 91, 4, 5, 14,
+	15, 6, 90, 4, 8, 15, 12, 3, 88, 4, 1, 11, 15, 9, 87, 4, 4, 13, 15, 6, 86, 4, 7, 15,
+	12, 3, 84, 4, 1, 10, 15, 9, 83, 4, 4, 13, 15, 6, 82, 4, 7, 15, 12, 3, 80, 4, 1, 10,
+	15, 9, 79, 4, 4, 13, 15, 6, 78, 4, 7, 15, 12, 3, 76, 4, 1, 10, 15, 9, 75, 4, 4, 13,
+	15, 6, 74, 4, 7, 15, 13, 4, 72, 5, 1, 10, 15, 10, 1, 71, 4, 4, 13, 15, 7, 70, 4, 7,
+	15, 13, 4, 68, 5, 1, 10, 15, 10, 1, 67, 4, 4, 13, 15, 7, 66, 4, 7, 15, 13, 4, 65, 4,
+	9, 15, 10, 1, 63, 4, 3, 12, 15, 7, 62, 4, 6, 15, 13, 4, 61, 4, 9, 15, 10, 1, 59, 4,
+	3, 12, 15, 7, 58, 4, 6, 15, 13, 4, 57, 4, 9, 15, 10, 1, 55, 4, 3, 12, 15, 7, 54, 4,
+	6, 15, 13, 4, 53, 4, 9, 15, 10, 1, 51, 4, 3, 12, 15, 8, 50, 4, 6, 15, 14, 5, 49, 4,
+	9, 15, 11, 2, 47, 4, 3, 12, 15, 8, 46, 4, 6, 15, 14, 5, 45, 4, 9, 15, 11, 2, 43, 4,
+	3, 12, 15, 8, 42, 4, 6, 15, 14, 5, 41, 4, 8, 15, 11, 2, 39, 4, 2, 11, 15, 8, 38, 4,
+	5, 14, 14, 5, 37, 4, 8, 15, 11, 2, 35, 4, 2, 11, 15, 8, 34, 4, 5, 14, 14, 5, 33, 4,
+	8, 15, 11, 2, 31, 4, 2, 11, 15, 8, 30, 4, 5, 14, 14, 5, 29, 4, 8, 15, 11, 2, 27, 4,
+	2, 11, 15, 9, 26, 4, 5, 14, 15, 6, 25, 4, 8, 15, 12, 3, 23, 4, 2, 11, 15, 9, 22, 4,
+	5, 14, 15, 6, 21, 4, 8, 15, 12, 3, 19, 4, 2, 11, 15, 9, 18, 4, 4, 14, 15, 6, 17, 4,
+	7, 15, 12, 3, 15, 4, 1, 10, 15, 9, 14, 4, 4, 13, 15, 6, 13, 4, 7, 15, 12, 3, 11, 4,
+	1, 10, 15, 9, 10, 4, 4, 13, 15, 6, 9, 4, 7, 15, 12, 3, 7, 4, 1, 10, 15, 9, 6, 4,
+	4, 13, 15, 6, 5, 4, 7, 15, 13, 3, 3, 5, 1, 10, 15, 10, 1, 2, 4, 4, 13, 15, 7, 1,
+	4, 7, 15, 13, 4, 0, 4, 4, 15, 10, 1, 1, 1, 4, 0, 0, 0, 0, 104, 2, 5, 5, 103, 3,
+	8, 15, 11, 101, 4, 2, 11, 15, 9, 100, 4, 6, 15, 14, 5, 99, 4, 9, 15, 11, 2, 97, 4, 4,
+	12, 15, 7, 96, 4, 7, 15, 13, 4, 94, 5, 1, 10, 15, 10, 1, 93, 4, 5, 14, 15, 6, 92, 4,
+	8, 15, 12, 3, 90, 4, 3, 11, 15, 9, 89, 4, 6, 15, 14, 5, 88, 4, 9, 15, 11, 2, 86, 4,
+	4, 12, 15, 7, 85, 4, 7, 15, 13, 4, 83, 5, 1, 10, 15, 10, 1, 82, 4, 5, 14, 15, 6, 81,
+	4, 8, 15, 12, 3, 79, 4, 3, 11, 15, 8, 78, 4, 6, 15, 14, 5, 77, 4, 9, 15, 11, 2, 75,
+	4, 4, 13, 15, 7, 74, 4, 7, 15, 13, 4, 72, 5, 2, 10, 15, 9, 1, 71, 4, 5, 14, 15, 6,
+	70, 4, 8, 15, 12, 3, 68, 4, 3, 12, 15, 8, 67, 4, 6, 15, 14, 5, 65, 5, 1, 9, 15, 11,
+	2, 64, 4, 4, 13, 15, 7, 63, 4, 7, 15, 13, 4, 61, 5, 2, 10, 15, 9, 1, 60, 4, 5, 14,
+	15, 6, 59, 4, 8, 15, 12, 3, 57, 4, 3, 12, 15, 8, 56, 4, 6, 15, 14, 5, 54, 5, 1, 9,
+	15, 10, 2, 53, 4, 4, 13, 15, 7, 52, 4, 7, 15, 13, 4, 50, 4, 2, 11, 15, 9, 49, 4, 5,
+	14, 15, 6, 48, 4, 8, 15, 11, 3, 46, 4, 3, 12, 15, 8, 45, 4, 6, 15, 14, 5, 43, 5, 1,
+	10, 15, 10, 2, 42, 4, 4, 13, 15, 7, 41, 4, 7, 15, 13, 4, 39, 4, 2, 11, 15, 9, 38, 4,
+	5, 14, 15, 6, 37, 4, 9, 15, 11, 3, 35, 4, 3, 12, 15, 8, 34, 4, 6, 15, 14, 5, 32, 5,
+	1, 10, 15, 10, 1, 31, 4, 4, 13, 15, 7, 30, 4, 7, 15, 12, 4, 28, 4, 2, 11, 15, 9, 27,
+	4, 5, 14, 15, 6, 26, 4, 9, 15, 11, 2, 24, 4, 3, 12, 15, 8, 23, 4, 6, 15, 13, 5, 21,
+	5, 1, 10, 15, 10, 1, 20, 4, 4, 13, 15, 7, 19, 4, 8, 15, 12, 3, 17, 4, 2, 11, 15, 9,
+	16, 4, 5, 14, 14, 6, 15, 4, 9, 15, 11, 2, 13, 4, 3, 12, 15, 8, 12, 4, 7, 15, 13, 5,
+	10, 5, 1, 10, 15, 10, 1, 9, 4, 4, 13, 15, 7, 8, 4, 8, 15, 12, 3, 6, 4, 2, 11, 15,
+	9, 5, 4, 5, 14, 14, 6, 4, 4, 9, 15, 11, 2, 2, 4, 3, 12, 15, 8, 1, 4, 7, 15, 13,
+	4, 0, 4, 4, 15, 10, 1, 1, 1, 4, 0, 0, 0, 0, 0, 0, 105, 2, 4, 10, 104, 3, 8, 15,
+	12, 102, 4, 3, 12, 15, 9, 101, 4, 7, 15, 14, 5, 99, 5, 2, 10, 15, 10, 1, 98, 4, 5, 14,
+	15, 6, 96, 5, 1, 9, 15, 11, 3, 95, 4, 4, 13, 15, 7, 94, 4, 8, 15, 12, 4, 92, 4, 3,
+	12, 15, 9, 91, 4, 7, 15, 14, 5, 89, 5, 2, 10, 15, 10, 1, 88, 4, 5, 14, 15, 6, 86, 5,
+	1, 9, 15, 11, 3, 85, 4, 4, 13, 15, 7, 84, 4, 8, 15, 12, 4, 82, 4, 3, 12, 15, 9, 81,
+	4, 7, 15, 14, 5, 79, 5, 2, 10, 15, 10, 1, 78, 4, 5, 14, 15, 6, 76, 5, 1, 9, 15, 11,
+	3, 75, 4, 4, 13, 15, 7, 74, 4, 8, 15, 12, 4, 72, 4, 3, 12, 15, 9, 71, 4, 7, 15, 14,
+	5, 69, 5, 2, 10, 15, 10, 1, 68, 4, 5, 14, 15, 6, 67, 4, 9, 15, 11, 3, 65, 4, 4, 13,
+	15, 8, 64, 4, 8, 15, 12, 4, 62, 4, 3, 12, 15, 9, 61, 4, 7, 15, 14, 5, 59, 5, 2, 10,
+	15, 10, 1, 58, 4, 5, 14, 15, 6, 57, 4, 9, 15, 11, 3, 55, 4, 4, 13, 15, 8, 54, 4, 8,
+	15, 12, 4, 52, 4, 3, 12, 15, 9, 51, 4, 7, 15, 14, 5, 49, 5, 2, 10, 15, 10, 1, 48, 4,
+	5, 14, 15, 6, 47, 4, 9, 15, 11, 3, 45, 4, 4, 13, 15, 8, 44, 4, 8, 15, 12, 4, 42, 4,
+	3, 11, 15, 9, 41, 4, 7, 15, 14, 5, 39, 5, 2, 10, 15, 10, 1, 38, 4, 5, 14, 15, 6, 37,
+	4, 9, 15, 11, 3, 35, 4, 4, 13, 15, 8, 34, 4, 8, 15, 13, 4, 32, 4, 3, 11, 15, 9, 31,
+	4, 7, 15, 14, 5, 29, 5, 2, 10, 15, 10, 1, 28, 4, 5, 14, 15, 6, 27, 4, 9, 15, 11, 3,
+	25, 4, 4, 13, 15, 8, 24, 4, 8, 15, 13, 4, 22, 4, 3, 11, 15, 9, 21, 4, 7, 15, 14, 5,
+	19, 5, 2, 10, 15, 10, 1, 18, 4, 5, 14, 15, 6, 17, 4, 9, 15, 11, 3, 15, 4, 4, 13, 15,
+	8, 14, 4, 8, 15, 13, 4, 12, 4, 3, 11, 15, 9, 11, 4, 6, 15, 14, 5, 9, 5, 2, 10, 15,
+	10, 2, 8, 4, 5, 14, 15, 6, 7, 4, 9, 15, 11, 3, 5, 4, 4, 13, 15, 8, 4, 4, 8, 15,
+	13, 4, 2, 4, 3, 11, 15, 9, 1, 4, 6, 15, 14, 5, 0, 4, 4, 15, 10, 2, 1, 1, 4, 0,
+	0, 0, 0, 0, 0, 106, 3, 4, 12, 4, 105, 4, 8, 15, 13, 3, 103, 4, 4, 12, 15, 9, 102, 4,
+	8, 15, 13, 4, 100, 4, 4, 12, 15, 9, 99, 4, 8, 15, 13, 5, 97, 5, 3, 12, 15, 9, 1, 96,
+	4, 7, 15, 13, 5, 94, 5, 3, 11, 15, 9, 1, 93, 4, 7, 15, 14, 5, 91, 5, 3, 11, 15, 10,
+	1, 90, 4, 7, 15, 14, 6, 88, 5, 2, 11, 15, 10, 2, 87, 4, 6, 15, 14, 6, 85, 5, 2, 10,
+	15, 10, 2, 84, 4, 6, 15, 15, 6, 82, 5, 2, 10, 15, 11, 2, 81, 4, 6, 14, 15, 7, 79, 5,
+	1, 10, 15, 11, 2, 78, 4, 6, 14, 15, 7, 76, 5, 1, 10, 15, 11, 3, 75, 4, 5, 14, 15, 7,
+	73, 5, 1, 9, 15, 11, 3, 72, 4, 5, 13, 15, 7, 70, 5, 1, 9, 15, 12, 3, 69, 4, 5, 13,
+	15, 8, 68, 4, 9, 15, 12, 4, 66, 4, 4, 13, 15, 8, 65, 4, 8, 15, 12, 4, 63, 4, 4, 12,
+	15, 8, 62, 4, 8, 15, 13, 4, 60, 4, 4, 12, 15, 9, 59, 4, 8, 15, 13, 5, 57, 4, 3, 12,
+	15, 9, 56, 4, 8, 15, 13, 5, 54, 5, 3, 12, 15, 9, 1, 53, 4, 7, 15, 13, 5, 51, 5, 3,
+	11, 15, 9, 1, 50, 4, 7, 15, 14, 5, 48, 5, 3, 11, 15, 10, 1, 47, 4, 7, 15, 14, 6, 45,
+	5, 2, 11, 15, 10, 2, 44, 4, 6, 15, 14, 6, 42, 5, 2, 10, 15, 10, 2, 41, 4, 6, 14, 15,
+	6, 39, 5, 2, 10, 15, 11, 2, 38, 4, 6, 14, 15, 7, 36, 5, 1, 10, 15, 11, 3, 35, 4, 5,
+	14, 15, 7, 33, 5, 1, 10, 15, 11, 3, 32, 4, 5, 14, 15, 7, 30, 5, 1, 9, 15, 11, 3, 29,
+	4, 5, 13, 15, 7, 27, 5, 1, 9, 15, 12, 3, 26, 4, 5, 13, 15, 8, 25, 4, 9, 15, 12, 4,
+	23, 4, 4, 13, 15, 8, 22, 4, 8, 15, 12, 4, 20, 4, 4, 12, 15, 8, 19, 4, 8, 15, 13, 4,
+	17, 4, 4, 12, 15, 9, 16, 4, 8, 15, 13, 5, 14, 5, 3, 12, 15, 9, 1, 13, 4, 7, 15, 13,
+	5, 11, 5, 3, 12, 15, 9, 1, 10, 4, 7, 15, 14, 5, 8, 5, 3, 11, 15, 9, 1, 7, 4, 7,
+	15, 14, 5, 5, 5, 3, 11, 15, 10, 1, 4, 4, 7, 15, 14, 6, 2, 5, 2, 11, 15, 10, 2, 1,
+	4, 6, 15, 14, 6, 0, 4, 4, 15, 10, 2, 1, 1, 4, 0, 0, 0, 0, 0, 0, 107, 3, 4, 12,
+	8, 106, 4, 9, 15, 13, 4, 104, 4, 5, 13, 15, 8, 102, 5, 1, 9, 15, 12, 4, 101, 4, 5, 14,
+	15, 8, 99, 5, 2, 10, 15, 11, 3, 98, 4, 6, 14, 15, 7, 96, 5, 2, 10, 15, 11, 3, 95, 4,
+	7, 15, 14, 6, 93, 5, 3, 11, 15, 10, 2, 92, 4, 7, 15, 14, 6, 90, 5, 4, 12, 15, 9, 1,
+	89, 4, 8, 15, 13, 5, 87, 5, 4, 12, 15, 9, 1, 85, 5, 1, 9, 15, 12, 4, 84, 4, 5, 13,
+	15, 8, 82, 5, 1, 9, 15, 12, 4, 81, 4, 6, 14, 15, 7, 79, 5, 2, 10, 15, 11, 3, 78, 4,
+	6, 14, 15, 7, 76, 5, 2, 11, 15, 11, 2, 75, 4, 7, 15, 14, 6, 73, 5, 3, 11, 15, 10, 2,
+	72, 4, 8, 15, 14, 5, 70, 5, 4, 12, 15, 9, 1, 69, 4, 8, 15, 13, 5, 67, 4, 4, 13, 15,
+	9, 65, 5, 1, 9, 15, 12, 4, 64, 4, 5, 13, 15, 8, 62, 5, 1, 9, 15, 12, 4, 61, 4, 6,
+	14, 15, 7, 59, 5, 2, 10, 15, 11, 3, 58, 4, 6, 15, 15, 7, 56, 5, 3, 11, 15, 10, 2, 55,
+	4, 7, 15, 14, 6, 53, 5, 3, 11, 15, 10, 2, 52, 4, 8, 15, 13, 5, 50, 5, 4, 12, 15, 9,
+	1, 49, 4, 8, 15, 13, 5, 47, 4, 5, 13, 15, 8, 45, 5, 1, 9, 15, 12, 4, 44, 4, 5, 13,
+	15, 8, 42, 5, 1, 10, 15, 12, 3, 41, 4, 6, 14, 15, 7, 39, 5, 2, 10, 15, 11, 3, 38, 4,
+	7, 15, 15, 6, 36, 5, 3, 11, 15, 10, 2, 35, 4, 7, 15, 14, 6, 33, 5, 3, 12, 15, 10, 1,
+	32, 4, 8, 15, 13, 5, 30, 5, 4, 12, 15, 9, 1, 29, 4, 8, 15, 13, 5, 27, 4, 5, 13, 15,
+	8, 25, 5, 1, 9, 15, 12, 4, 24, 4, 5, 14, 15, 8, 22, 5, 2, 10, 15, 11, 3, 21, 4, 6,
+	14, 15, 7, 19, 5, 2, 10, 15, 11, 3, 18, 4, 7, 15, 14, 6, 16, 5, 3, 11, 15, 10, 2, 15,
+	4, 7, 15, 14, 6, 13, 5, 4, 12, 15, 9, 1, 12, 4, 8, 15, 13, 5, 10, 5, 4, 12, 15, 9,
+	1, 9, 4, 9, 15, 13, 4, 7, 4, 5, 13, 15, 8, 5, 5, 1, 9, 15, 12, 4, 4, 4, 6, 14,
+	15, 7, 2, 5, 2, 10, 15, 11, 3, 1, 4, 6, 14, 15, 7, 0, 4, 4, 15, 11, 2, 1, 1, 4,
+	0, 0, 0, 0, 0, 0, 108, 3, 4, 12, 12, 106, 5, 1, 9, 15, 13, 5, 105, 4, 6, 14, 15, 8,
+	103, 5, 3, 11, 15, 11, 3, 102, 4, 7, 15, 14, 6, 100, 5, 4, 12, 15, 9, 1, 98, 5, 1, 9,
+	15, 13, 5, 97, 4, 6, 14, 15, 8, 95, 5, 3, 11, 15, 11, 3, 94, 4, 7, 15, 14, 6, 92, 5,
+	4, 12, 15, 9, 1, 90, 5, 1, 9, 15, 13, 5, 89, 4, 6, 14, 15, 8, 87, 5, 3, 11, 15, 11,
+	3, 86, 4, 7, 15, 14, 6, 84, 5, 4, 12, 15, 9, 1, 82, 5, 1, 9, 15, 13, 5, 81, 4, 6,
+	14, 15, 8, 79, 5, 3, 11, 15, 11, 3, 78, 4, 7, 15, 14, 6, 76, 5, 4, 12, 15, 9, 1, 74,
+	5, 1, 9, 15, 13, 5, 73, 4, 6, 14, 15, 8, 71, 5, 3, 11, 15, 11, 3, 70, 4, 8, 15, 14,
+	6, 68, 5, 4, 12, 15, 9, 1, 66, 5, 1, 9, 15, 13, 5, 65, 4, 6, 14, 15, 8, 63, 5, 3,
+	11, 15, 11, 3, 62, 4, 8, 15, 14, 6, 60, 5, 4, 12, 15, 9, 1, 58, 5, 1, 9, 15, 12, 5,
+	57, 4, 6, 14, 15, 8, 55, 5, 3, 11, 15, 11, 3, 54, 4, 8, 15, 14, 6, 52, 5, 4, 12, 15,
+	9, 1, 50, 5, 1, 9, 15, 12, 5, 49, 4, 6, 14, 15, 8, 47, 5, 3, 11, 15, 11, 3, 46, 4,
+	8, 15, 14, 6, 44, 5, 4, 12, 15, 9, 1, 42, 5, 1, 9, 15, 12, 5, 41, 4, 6, 14, 15, 8,
+	39, 5, 3, 11, 15, 11, 3, 38, 4, 8, 15, 14, 6, 36, 5, 4, 12, 15, 9, 1, 34, 5, 1, 9,
+	15, 12, 5, 33, 4, 6, 14, 15, 8, 31, 5, 3, 11, 15, 11, 3, 30, 4, 8, 15, 14, 6, 28, 5,
+	4, 12, 15, 9, 1, 26, 5, 1, 9, 15, 12, 4, 25, 4, 6, 14, 15, 8, 23, 5, 3, 11, 15, 11,
+	3, 22, 4, 8, 15, 14, 6, 20, 5, 4, 12, 15, 9, 1, 18, 5, 1, 9, 15, 12, 4, 17, 4, 6,
+	14, 15, 8, 15, 5, 3, 11, 15, 11, 3, 14, 4, 8, 15, 14, 6, 12, 5, 4, 12, 15, 9, 1, 10,
+	5, 1, 9, 15, 12, 4, 9, 4, 6, 14, 15, 8, 7, 5, 3, 11, 15, 11, 3, 6, 4, 8, 15, 14,
+	6, 4, 5, 4, 12, 15, 9, 1, 2, 5, 1, 9, 15, 12, 4, 1, 4, 6, 14, 15, 8, 0, 4, 4,
+	15, 11, 3, 1, 1, 4, 0, 0, 0, 0, 111, 1, 2, 109, 3, 5, 12, 14, 107, 5, 2, 10, 15, 12,
+	5, 106, 4, 7, 15, 15, 7, 104, 5, 4, 12, 15, 10, 2, 102, 5, 2, 10, 15, 12, 5, 101, 4, 7,
+	15, 15, 7, 99, 5, 4, 12, 15, 10, 2, 97, 5, 2, 10, 15, 13, 5, 96, 4, 7, 15, 15, 7, 94,
+	5, 4, 12, 15, 10, 2, 92, 5, 2, 9, 15, 13, 5, 91, 4, 7, 15, 15, 7, 89, 5, 4, 12, 15,
+	10, 2, 87, 5, 2, 9, 15, 13, 5, 86, 4, 7, 15, 15, 7, 84, 5, 4, 12, 15, 10, 2, 82, 5,
+	2, 9, 15, 13, 5, 81, 4, 7, 15, 15, 8, 79, 5, 4, 12, 15, 10, 2, 77, 5, 2, 9, 15, 13,
+	5, 76, 4, 7, 14, 15, 8, 74, 5, 4, 12, 15, 10, 2, 72, 5, 2, 9, 15, 13, 5, 71, 4, 7,
+	14, 15, 8, 69, 5, 4, 12, 15, 10, 3, 67, 5, 1, 9, 15, 13, 5, 66, 4, 7, 14, 15, 8, 64,
+	5, 4, 12, 15, 10, 3, 62, 5, 1, 9, 15, 13, 5, 61, 4, 7, 14, 15, 8, 59, 5, 4, 12, 15,
+	10, 3, 57, 5, 1, 9, 15, 13, 5, 56, 4, 7, 14, 15, 8, 54, 5, 4, 12, 15, 10, 3, 52, 5,
+	1, 9, 15, 13, 5, 51, 4, 6, 14, 15, 8, 49, 5, 4, 12, 15, 10, 3, 47, 5, 1, 9, 15, 13,
+	5, 46, 4, 6, 14, 15, 8, 44, 5, 4, 12, 15, 11, 3, 42, 5, 1, 9, 15, 13, 5, 41, 4, 6,
+	14, 15, 8, 39, 5, 4, 11, 15, 11, 3, 37, 5, 1, 9, 15, 13, 5, 36, 4, 6, 14, 15, 8, 34,
+	5, 4, 11, 15, 11, 3, 32, 5, 1, 9, 15, 13, 6, 31, 4, 6, 14, 15, 8, 29, 5, 4, 11, 15,
+	11, 3, 27, 5, 1, 9, 15, 13, 6, 26, 4, 6, 14, 15, 8, 24, 5, 4, 11, 15, 11, 3, 22, 5,
+	1, 9, 15, 13, 6, 21, 4, 6, 14, 15, 8, 19, 5, 4, 11, 15, 11, 3, 17, 5, 1, 9, 15, 13,
+	6, 16, 5, 6, 14, 15, 8, 1, 14, 5, 3, 11, 15, 11, 3, 12, 5, 1, 9, 15, 13, 6, 11, 5,
+	6, 14, 15, 8, 1, 9, 5, 3, 11, 15, 11, 3, 7, 5, 1, 9, 15, 14, 6, 6, 5, 6, 14, 15,
+	8, 1, 4, 5, 3, 11, 15, 11, 3, 2, 5, 1, 8, 15, 14, 6, 1, 5, 6, 14, 15, 8, 1, 0,
+	4, 4, 15, 11, 3, 1, 1, 4, 0, 0, 0, 0, 112, 1, 4, 110, 4, 5, 12, 15, 2, 108, 5, 3,
+	10, 15, 12, 5, 106, 5, 1, 8, 15, 14, 7, 105, 5, 6, 14, 15, 9, 1, 103, 5, 4, 12, 15, 11,
+	3, 101, 5, 2, 10, 15, 13, 5, 100, 4, 8, 15, 15, 7, 98, 5, 6, 13, 15, 9, 2, 96, 5, 4,
+	11, 15, 11, 4, 94, 5, 2, 9, 15, 13, 6, 93, 4, 7, 15, 15, 8, 91, 5, 5, 13, 15, 10, 2,
+	89, 5, 3, 11, 15, 12, 4, 87, 5, 1, 9, 15, 14, 6, 86, 5, 7, 14, 15, 8, 1, 84, 5, 5,
+	12, 15, 10, 3, 82, 5, 3, 10, 15, 12, 5, 80, 5, 1, 8, 15, 14, 7, 79, 5, 6, 14, 15, 9,
+	1, 77, 5, 4, 12, 15, 11, 3, 75, 5, 2, 10, 15, 13, 5, 74, 4, 8, 15, 15, 7, 72, 5, 6,
+	13, 15, 9, 2, 70, 5, 4, 11, 15, 11, 4, 68, 5, 2, 9, 15, 13, 6, 67, 4, 7, 15, 15, 8,
+	65, 5, 5, 13, 15, 10, 2, 63, 5, 3, 11, 15, 12, 4, 61, 5, 1, 9, 15, 14, 6, 60, 5, 7,
+	14, 15, 8, 1, 58, 5, 5, 12, 15, 10, 3, 56, 5, 3, 10, 15, 12, 5, 54, 5, 1, 8, 15, 14,
+	7, 53, 5, 6, 14, 15, 9, 1, 51, 5, 4, 12, 15, 11, 3, 49, 5, 2, 10, 15, 13, 5, 48, 4,
+	8, 15, 15, 7, 46, 5, 6, 13, 15, 9, 2, 44, 5, 4, 11, 15, 11, 4, 42, 5, 1, 9, 15, 14,
+	6, 41, 5, 7, 14, 15, 8, 1, 39, 5, 5, 12, 15, 10, 3, 37, 5, 3, 10, 15, 12, 5, 35, 5,
+	1, 8, 15, 14, 7, 34, 5, 6, 14, 15, 9, 1, 32, 5, 4, 12, 15, 11, 3, 30, 5, 2, 10, 15,
+	13, 5, 29, 4, 8, 15, 15, 7, 27, 5, 6, 13, 15, 9, 2, 25, 5, 4, 11, 15, 11, 4, 23, 5,
+	2, 9, 15, 13, 6, 22, 4, 7, 15, 15, 8, 20, 5, 5, 13, 15, 10, 2, 18, 5, 3, 11, 15, 12,
+	4, 16, 5, 1, 9, 15, 14, 6, 15, 5, 7, 14, 15, 8, 1, 13, 5, 5, 12, 15, 10, 3, 11, 5,
+	3, 10, 15, 12, 5, 9, 5, 1, 8, 15, 14, 7, 8, 5, 6, 14, 15, 9, 1, 6, 5, 4, 12, 15,
+	11, 3, 4, 5, 2, 10, 15, 13, 5, 3, 4, 8, 15, 15, 7, 1, 5, 6, 13, 15, 9, 2, 0, 4,
+	4, 15, 11, 4, 1, 1, 4, 0, 0, 0, 0, 113, 1, 5, 111, 4, 5, 13, 15, 3, 109, 5, 4, 11,
+	15, 12, 5, 107, 5, 2, 10, 15, 13, 6, 105, 5, 1, 8, 15, 15, 7, 104, 5, 7, 14, 15, 9, 2,
+	102, 5, 5, 13, 15, 10, 3, 100, 5, 4, 11, 15, 12, 4, 98, 5, 3, 10, 15, 13, 6, 96, 5, 1,
+	8, 15, 15, 7, 95, 5, 7, 14, 15, 9, 1, 93, 5, 6, 13, 15, 10, 3, 91, 5, 4, 11, 15, 12,
+	4, 89, 5, 3, 10, 15, 13, 6, 87, 5, 1, 9, 15, 14, 7, 86, 5, 7, 14, 15, 9, 1, 84, 5,
+	6, 13, 15, 10, 3, 82, 5, 4, 12, 15, 11, 4, 80, 5, 3, 10, 15, 13, 6, 78, 5, 1, 9, 15,
+	14, 7, 77, 5, 7, 15, 15, 8, 1, 75, 5, 6, 13, 15, 10, 3, 73, 5, 4, 12, 15, 11, 4, 71,
+	5, 3, 10, 15, 13, 5, 69, 5, 2, 9, 15, 14, 7, 68, 5, 7, 15, 15, 8, 1, 66, 5, 6, 13,
+	15, 10, 2, 64, 5, 5, 12, 15, 11, 4, 62, 5, 3, 10, 15, 13, 5, 60, 5, 2, 9, 15, 14, 7,
+	59, 5, 8, 15, 15, 8, 1, 57, 5, 6, 13, 15, 10, 2, 55, 5, 5, 12, 15, 11, 4, 53, 5, 3,
+	11, 15, 12, 5, 51, 5, 2, 9, 15, 14, 7, 50, 5, 8, 15, 15, 8, 1, 48, 5, 6, 14, 15, 9,
+	2, 46, 5, 5, 12, 15, 11, 4, 44, 5, 3, 11, 15, 12, 5, 42, 5, 2, 9, 15, 14, 6, 40, 6,
+	1, 8, 15, 15, 8, 1, 39, 5, 6, 14, 15, 9, 2, 37, 5, 5, 12, 15, 11, 3, 35, 5, 4, 11,
+	15, 12, 5, 33, 5, 2, 9, 15, 13, 6, 31, 5, 1, 8, 15, 15, 8, 30, 5, 7, 14, 15, 9, 2,
+	28, 5, 5, 12, 15, 10, 3, 26, 5, 4, 11, 15, 12, 5, 24, 5, 2, 10, 15, 13, 6, 22, 5, 1,
+	8, 15, 15, 7, 21, 5, 7, 14, 15, 9, 2, 19, 5, 5, 13, 15, 10, 3, 17, 5, 4, 11, 15, 12,
+	5, 15, 5, 2, 10, 15, 13, 6, 13, 5, 1, 8, 15, 15, 7, 12, 5, 7, 14, 15, 9, 2, 10, 5,
+	5, 13, 15, 10, 3, 8, 5, 4, 11, 15, 12, 4, 6, 5, 3, 10, 15, 13, 6, 4, 5, 1, 8, 15,
+	14, 7, 3, 5, 7, 14, 15, 9, 1, 1, 5, 6, 13, 15, 10, 3, 0, 4, 4, 15, 11, 4, 1, 1,
+	4, 0, 0, 0, 0, 114, 1, 5, 112, 4, 6, 13, 15, 4, 110, 5, 5, 12, 15, 11, 4, 108, 5, 4,
+	11, 15, 12, 5, 106, 5, 3, 10, 15, 13, 6, 104, 5, 2, 9, 15, 14, 7, 102, 6, 2, 9, 15, 15,
+	8, 1, 100, 6, 1, 8, 15, 15, 9, 2, 99, 5, 7, 14, 15, 9, 2, 97, 5, 6, 13, 15, 10, 3,
+	95, 5, 5, 12, 15, 11, 4, 93, 5, 4, 11, 15, 12, 5, 91, 5, 4, 11, 15, 13, 6, 89, 5, 3,
+	10, 15, 14, 7, 87, 5, 2, 9, 15, 14, 7, 85, 6, 1, 8, 15, 15, 8, 1, 84, 5, 7, 14, 15,
+	9, 2, 82, 5, 6, 13, 15, 10, 3, 80, 5, 6, 13, 15, 11, 4, 78, 5, 5, 12, 15, 12, 5, 76,
+	5, 4, 11, 15, 12, 5, 74, 5, 3, 10, 15, 13, 6, 72, 5, 2, 9, 15, 14, 7, 70, 6, 1, 8,
+	15, 15, 8, 1, 68, 6, 1, 8, 15, 15, 9, 2, 67, 5, 7, 14, 15, 10, 3, 65, 5, 6, 13, 15,
+	10, 3, 63, 5, 5, 12, 15, 11, 4, 61, 5, 4, 11, 15, 12, 5, 59, 5, 3, 10, 15, 13, 6, 57,
+	5, 3, 10, 15, 14, 7, 55, 6, 2, 9, 15, 15, 8, 1, 53, 6, 1, 8, 15, 15, 8, 1, 52, 5,
+	7, 14, 15, 9, 2, 50, 5, 6, 13, 15, 10, 3, 48, 5, 5, 12, 15, 11, 4, 46, 5, 5, 12, 15,
+	12, 5, 44, 5, 4, 11, 15, 13, 6, 42, 5, 3, 10, 15, 14, 6, 40, 5, 2, 9, 15, 14, 7, 38,
+	6, 1, 8, 15, 15, 8, 1, 37, 5, 7, 14, 15, 9, 2, 35, 5, 7, 14, 15, 10, 3, 33, 5, 6,
+	13, 15, 11, 4, 31, 5, 5, 12, 15, 12, 4, 29, 5, 4, 11, 15, 12, 5, 27, 5, 3, 10, 15, 13,
+	6, 25, 5, 2, 9, 15, 14, 7, 23, 6, 2, 9, 15, 15, 8, 1, 21, 6, 1, 8, 15, 15, 9, 2,
+	20, 5, 7, 14, 15, 10, 2, 18, 5, 6, 13, 15, 10, 3, 16, 5, 5, 12, 15, 11, 4, 14, 5, 4,
+	11, 15, 12, 5, 12, 5, 4, 11, 15, 13, 6, 10, 5, 3, 10, 15, 14, 7, 8, 5, 2, 9, 15, 15,
+	8, 6, 6, 1, 8, 15, 15, 8, 1, 5, 5, 7, 14, 15, 9, 2, 3, 5, 6, 13, 15, 10, 3, 1,
+	5, 6, 13, 15, 11, 4, 0, 4, 4, 15, 12, 5, 1, 1, 4, 0, 0, 0, 0, 115, 1, 5, 113, 4,
+	6, 13, 15, 4, 111, 5, 6, 13, 15, 11, 4, 109, 5, 6, 13, 15, 11, 4, 107, 5, 6, 12, 15, 12,
+	5, 105, 5, 5, 12, 15, 12, 5, 103, 5, 5, 12, 15, 12, 5, 101, 5, 5, 12, 15, 12, 6, 99, 5,
+	4, 11, 15, 13, 6, 97, 5, 4, 11, 15, 13, 6, 95, 5, 4, 11, 15, 13, 6, 93, 5, 4, 11, 15,
+	13, 7, 91, 5, 3, 10, 15, 14, 7, 89, 5, 3, 10, 15, 14, 7, 87, 5, 3, 10, 15, 14, 7, 85,
+	6, 3, 10, 15, 14, 8, 1, 83, 6, 2, 9, 15, 15, 8, 1, 81, 6, 2, 9, 15, 15, 8, 1, 79,
+	6, 2, 9, 15, 15, 8, 2, 77, 6, 2, 9, 15, 15, 9, 2, 75, 6, 1, 8, 15, 15, 9, 2, 73,
+	6, 1, 8, 15, 15, 9, 2, 71, 6, 1, 8, 15, 15, 9, 3, 69, 6, 1, 7, 14, 15, 10, 3, 68,
+	5, 7, 14, 15, 10, 3, 66, 5, 7, 14, 15, 10, 3, 64, 5, 7, 14, 15, 10, 4, 62, 5, 6, 13,
+	15, 11, 4, 60, 5, 6, 13, 15, 11, 4, 58, 5, 6, 13, 15, 11, 4, 56, 5, 6, 13, 15, 11, 5,
+	54, 5, 5, 12, 15, 12, 5, 52, 5, 5, 12, 15, 12, 5, 50, 5, 5, 12, 15, 12, 5, 48, 5, 5,
+	11, 15, 12, 6, 46, 5, 4, 11, 15, 13, 6, 44, 5, 4, 11, 15, 13, 6, 42, 5, 4, 11, 15, 13,
+	6, 40, 5, 4, 10, 15, 13, 7, 38, 5, 3, 10, 15, 14, 7, 36, 5, 3, 10, 15, 14, 7, 34, 6,
+	3, 10, 15, 14, 7, 1, 32, 6, 3, 9, 15, 14, 8, 1, 30, 6, 2, 9, 15, 15, 8, 1, 28, 6,
+	2, 9, 15, 15, 8, 1, 26, 6, 2, 9, 15, 15, 8, 2, 24, 6, 2, 8, 15, 15, 9, 2, 22, 6,
+	1, 8, 15, 15, 9, 2, 20, 6, 1, 8, 15, 15, 9, 2, 18, 6, 1, 8, 14, 15, 9, 3, 16, 6,
+	1, 7, 14, 15, 10, 3, 15, 5, 7, 14, 15, 10, 3, 13, 5, 7, 14, 15, 10, 3, 11, 5, 7, 13,
+	15, 10, 4, 9, 5, 6, 13, 15, 11, 4, 7, 5, 6, 13, 15, 11, 4, 5, 5, 6, 13, 15, 11, 4,
+	3, 5, 6, 12, 15, 11, 5, 1, 5, 5, 12, 15, 12, 5, 0, 4, 4, 15, 12, 5, 1, 1, 4, 0,
+	0, 0, 0, 116, 1, 5, 114, 4, 7, 13, 15, 4, 111, 6, 1, 7, 14, 15, 11, 4, 109, 6, 1, 7,
+	14, 15, 10, 4, 107, 6, 1, 8, 14, 15, 10, 3, 105, 6, 2, 8, 15, 15, 10, 3, 103, 6, 2, 8,
+	15, 15, 9, 3, 101, 6, 2, 9, 15, 15, 9, 2, 99, 6, 3, 9, 15, 15, 9, 2, 97, 6, 3, 9,
+	15, 15, 8, 2, 95, 6, 3, 10, 15, 15, 8, 1, 93, 6, 4, 10, 15, 14, 8, 1, 91, 6, 4, 10,
+	15, 14, 7, 1, 89, 5, 4, 11, 15, 14, 7, 87, 5, 5, 11, 15, 13, 7, 85, 5, 5, 11, 15, 13,
+	6, 83, 5, 5, 12, 15, 13, 6, 81, 5, 6, 12, 15, 12, 6, 79, 5, 6, 12, 15, 12, 5, 77, 5,
+	6, 13, 15, 12, 5, 75, 5, 7, 13, 15, 11, 5, 73, 5, 7, 13, 15, 11, 4, 70, 6, 1, 7, 14,
+	15, 11, 4, 68, 6, 1, 8, 14, 15, 10, 4, 66, 6, 1, 8, 14, 15, 10, 3, 64, 6, 2, 8, 15,
+	15, 10, 3, 62, 6, 2, 8, 15, 15, 9, 3, 60, 6, 2, 9, 15, 15, 9, 2, 58, 6, 3, 9, 15,
+	15, 9, 2, 56, 6, 3, 9, 15, 15, 8, 2, 54, 6, 3, 10, 15, 15, 8, 1, 52, 6, 4, 10, 15,
+	14, 8, 1, 50, 6, 4, 10, 15, 14, 7, 1, 48, 5, 4, 11, 15, 14, 7, 46, 5, 5, 11, 15, 13,
+	7, 44, 5, 5, 11, 15, 13, 6, 42, 5, 5, 12, 15, 13, 6, 40, 5, 6, 12, 15, 12, 6, 38, 5,
+	6, 12, 15, 12, 5, 36, 5, 6, 13, 15, 12, 5, 34, 5, 7, 13, 15, 11, 5, 32, 5, 7, 13, 15,
+	11, 4, 29, 6, 1, 7, 14, 15, 11, 4, 27, 6, 1, 8, 14, 15, 10, 4, 25, 6, 1, 8, 14, 15,
+	10, 3, 23, 6, 2, 8, 15, 15, 10, 3, 21, 6, 2, 9, 15, 15, 9, 3, 19, 6, 2, 9, 15, 15,
+	9, 2, 17, 6, 3, 9, 15, 15, 9, 2, 15, 6, 3, 10, 15, 15, 8, 2, 13, 6, 3, 10, 15, 14,
+	8, 1, 11, 6, 4, 10, 15, 14, 8, 1, 9, 6, 4, 11, 15, 14, 7, 1, 7, 5, 4, 11, 15, 13,
+	7, 5, 5, 5, 11, 15, 13, 7, 3, 5, 5, 12, 15, 13, 6, 1, 5, 5, 12, 15, 13, 6, 0, 4,
+	4, 15, 12, 6, 1, 1, 4, 0, 0, 0, 0, 117, 1, 5, 114, 5, 1, 7, 14, 15, 4, 112, 6, 2,
+	8, 15, 15, 10, 4, 110, 6, 3, 9, 15, 15, 9, 3, 108, 6, 4, 10, 15, 15, 8, 2, 106, 6, 5,
+	11, 15, 14, 8, 1, 104, 5, 6, 12, 15, 13, 7, 102, 5, 6, 13, 15, 12, 6, 99, 6, 1, 7, 14,
+	15, 11, 5, 97, 6, 2, 8, 15, 15, 10, 4, 95, 6, 3, 9, 15, 15, 9, 3, 93, 6, 4, 10, 15,
+	15, 8, 2, 91, 6, 5, 11, 15, 14, 7, 1, 89, 5, 6, 12, 15, 13, 7, 87, 5, 7, 13, 15, 12,
+	6, 84, 6, 1, 7, 14, 15, 11, 5, 82, 6, 2, 8, 15, 15, 10, 4, 80, 6, 3, 9, 15, 15, 9,
+	3, 78, 6, 4, 10, 15, 15, 8, 2, 76, 6, 5, 11, 15, 14, 7, 1, 74, 5, 6, 12, 15, 13, 6,
+	72, 5, 7, 13, 15, 12, 6, 69, 6, 1, 8, 14, 15, 11, 5, 67, 6, 2, 8, 15, 15, 10, 4, 65,
+	6, 3, 9, 15, 15, 9, 3, 63, 6, 4, 10, 15, 15, 8, 2, 61, 6, 5, 11, 15, 14, 7, 1, 59,
+	5, 6, 12, 15, 13, 6, 57, 5, 7, 13, 15, 12, 5, 54, 6, 1, 8, 14, 15, 11, 5, 52, 6, 2,
+	9, 15, 15, 10, 4, 50, 6, 3, 9, 15, 15, 9, 3, 48, 6, 4, 10, 15, 14, 8, 2, 46, 6, 5,
+	11, 15, 14, 7, 1, 44, 5, 6, 12, 15, 13, 6, 42, 5, 7, 13, 15, 12, 5, 39, 6, 1, 8, 14,
+	15, 11, 4, 37, 6, 2, 9, 15, 15, 10, 4, 35, 6, 3, 10, 15, 15, 9, 3, 33, 6, 4, 10, 15,
+	14, 8, 2, 31, 6, 5, 11, 15, 13, 7, 1, 29, 5, 6, 12, 15, 13, 6, 26, 6, 1, 7, 13, 15,
+	12, 5, 24, 6, 1, 8, 14, 15, 11, 4, 22, 6, 2, 9, 15, 15, 10, 3, 20, 6, 3, 10, 15, 15,
+	9, 3, 18, 6, 4, 11, 15, 14, 8, 2, 16, 6, 5, 11, 15, 13, 7, 1, 14, 5, 6, 12, 15, 12,
+	6, 11, 6, 1, 7, 13, 15, 12, 5, 9, 6, 1, 8, 14, 15, 11, 4, 7, 6, 2, 9, 15, 15, 10,
+	3, 5, 6, 3, 10, 15, 15, 9, 2, 3, 6, 4, 11, 15, 14, 8, 2, 1, 6, 5, 11, 15, 13, 7,
+	1, 0, 4, 4, 15, 12, 6, 1, 1, 4, 0, 0, 0, 0, 118, 1, 5, 115, 5, 2, 8, 14, 15, 3,
+	113, 6, 3, 9, 15, 15, 10, 4, 111, 6, 5, 11, 15, 14, 8, 2, 109, 6, 6, 12, 15, 13, 7, 1,
+	106, 6, 2, 8, 14, 15, 11, 5, 104, 6, 3, 9, 15, 15, 10, 4, 102, 6, 5, 11, 15, 15, 8, 2,
+	100, 6, 6, 12, 15, 13, 7, 1, 97, 6, 2, 8, 14, 15, 12, 5, 95, 6, 3, 9, 15, 15, 10, 4,
+	93, 6, 5, 11, 15, 15, 9, 2, 91, 6, 6, 12, 15, 13, 7, 1, 88, 6, 1, 8, 14, 15, 12, 6,
+	86, 6, 3, 9, 15, 15, 10, 4, 84, 6, 4, 11, 15, 15, 9, 3, 82, 6, 6, 12, 15, 13, 7, 1,
+	79, 6, 1, 7, 14, 15, 12, 6, 77, 6, 3, 9, 15, 15, 10, 4, 75, 6, 4, 10, 15, 15, 9, 3,
+	73, 6, 6, 12, 15, 13, 7, 1, 70, 6, 1, 7, 13, 15, 12, 6, 68, 6, 3, 9, 15, 15, 10, 4,
+	66, 6, 4, 10, 15, 15, 9, 3, 64, 6, 6, 12, 15, 13, 7, 1, 61, 6, 1, 7, 13, 15, 12, 6,
+	59, 6, 3, 9, 15, 15, 10, 4, 57, 6, 4, 10, 15, 15, 9, 3, 55, 6, 6, 12, 15, 14, 7, 1,
+	52, 6, 1, 7, 13, 15, 12, 6, 50, 6, 3, 9, 15, 15, 11, 4, 48, 6, 4, 10, 15, 15, 9, 3,
+	46, 6, 6, 12, 15, 14, 8, 1, 43, 6, 1, 7, 13, 15, 12, 6, 41, 6, 2, 9, 15, 15, 11, 5,
+	39, 6, 4, 10, 15, 15, 9, 3, 37, 6, 5, 12, 15, 14, 8, 2, 34, 6, 1, 7, 13, 15, 12, 6,
+	32, 6, 2, 8, 15, 15, 11, 5, 30, 6, 4, 10, 15, 15, 9, 3, 28, 6, 5, 11, 15, 14, 8, 2,
+	25, 6, 1, 7, 13, 15, 12, 6, 23, 6, 2, 8, 14, 15, 11, 5, 21, 6, 4, 10, 15, 15, 9, 3,
+	19, 6, 5, 11, 15, 14, 8, 2, 16, 6, 1, 7, 13, 15, 12, 6, 14, 6, 2, 8, 14, 15, 11, 5,
+	12, 6, 4, 10, 15, 15, 9, 3, 10, 6, 5, 11, 15, 14, 8, 2, 7, 6, 1, 7, 13, 15, 13, 6,
+	5, 6, 2, 8, 14, 15, 11, 5, 3, 6, 4, 10, 15, 15, 10, 3, 1, 6, 5, 11, 15, 14, 8, 2,
+	0, 4, 4, 15, 13, 7, 1, 1, 4, 0, 0, 0, 0, 119, 1, 4, 116, 5, 2, 8, 14, 15, 1, 114,
+	6, 4, 10, 15, 15, 10, 4, 111, 7, 1, 7, 12, 15, 13, 8, 2, 109, 6, 3, 9, 15, 15, 11, 5,
+	107, 6, 5, 11, 15, 15, 9, 3, 104, 7, 1, 7, 13, 15, 13, 7, 1, 102, 6, 3, 9, 15, 15, 11,
+	5, 100, 6, 5, 11, 15, 15, 9, 3, 97, 7, 1, 7, 13, 15, 13, 7, 1, 95, 6, 4, 9, 15, 15,
+	10, 5, 93, 6, 6, 12, 15, 14, 8, 3, 90, 6, 2, 8, 14, 15, 12, 6, 88, 6, 4, 10, 15, 15,
+	10, 4, 86, 6, 6, 12, 15, 14, 8, 2, 83, 6, 2, 8, 14, 15, 12, 6, 81, 6, 4, 10, 15, 15,
+	10, 4, 78, 7, 1, 6, 12, 15, 13, 8, 2, 76, 6, 3, 9, 14, 15, 11, 6, 74, 6, 5, 11, 15,
+	15, 9, 3, 71, 7, 1, 7, 13, 15, 13, 7, 1, 69, 6, 3, 9, 15, 15, 11, 5, 67, 6, 5, 11,
+	15, 15, 9, 3, 64, 7, 1, 7, 13, 15, 13, 7, 1, 62, 6, 3, 9, 15, 15, 11, 5, 60, 6, 6,
+	11, 15, 14, 9, 3, 57, 7, 2, 8, 13, 15, 12, 6, 1, 55, 6, 4, 10, 15, 15, 10, 4, 53, 6,
+	6, 12, 15, 14, 8, 2, 50, 6, 2, 8, 14, 15, 12, 6, 48, 6, 4, 10, 15, 15, 10, 4, 46, 6,
+	6, 12, 15, 14, 8, 2, 43, 6, 3, 8, 14, 15, 11, 6, 41, 6, 5, 11, 15, 15, 9, 4, 38, 7,
+	1, 7, 13, 15, 13, 7, 1, 36, 6, 3, 9, 15, 15, 11, 5, 34, 6, 5, 11, 15, 15, 9, 3, 31,
+	7, 1, 7, 13, 15, 13, 7, 1, 29, 6, 3, 9, 15, 15, 11, 5, 27, 6, 5, 11, 15, 14, 9, 3,
+	24, 7, 2, 8, 13, 15, 12, 7, 1, 22, 6, 4, 10, 15, 15, 10, 4, 20, 6, 6, 12, 15, 14, 8,
+	2, 17, 6, 2, 8, 14, 15, 12, 6, 15, 6, 4, 10, 15, 15, 10, 4, 13, 6, 6, 12, 15, 14, 8,
+	2, 10, 6, 2, 8, 14, 15, 12, 6, 8, 6, 5, 10, 15, 15, 10, 4, 5, 7, 1, 7, 12, 15, 13,
+	7, 2, 3, 6, 3, 9, 15, 15, 11, 5, 1, 6, 5, 11, 15, 15, 9, 3, 0, 5, 4, 15, 13, 7,
+	1, 1, 1, 4, 0, 0, 0, 0, 120, 1, 2, 117, 4, 3, 9, 14, 14, 115, 6, 6, 11, 15, 15, 9,
+	4, 112, 7, 3, 8, 14, 15, 12, 7, 1, 110, 6, 5, 11, 15, 15, 10, 4, 107, 7, 2, 8, 14, 15,
+	13, 7, 1, 105, 6, 5, 11, 15, 15, 10, 4, 102, 7, 2, 8, 13, 15, 13, 7, 2, 100, 6, 5, 10,
+	15, 15, 10, 5, 97, 7, 2, 7, 13, 15, 13, 8, 2, 95, 6, 5, 10, 15, 15, 10, 5, 92, 7, 2,
+	7, 13, 15, 13, 8, 2, 90, 6, 4, 10, 15, 15, 11, 5, 87, 7, 1, 7, 13, 15, 14, 8, 2, 85,
+	6, 4, 10, 15, 15, 11, 5, 82, 7, 1, 7, 12, 15, 14, 8, 3, 80, 6, 4, 9, 15, 15, 11, 6,
+	77, 7, 1, 6, 12, 15, 14, 9, 3, 75, 6, 3, 9, 15, 15, 12, 6, 73, 6, 6, 12, 15, 15, 9,
+	3, 70, 7, 3, 9, 14, 15, 12, 6, 1, 68, 6, 6, 11, 15, 15, 9, 4, 65, 7, 3, 8, 14, 15,
+	12, 7, 1, 63, 6, 6, 11, 15, 15, 9, 4, 60, 7, 3, 8, 14, 15, 12, 7, 1, 58, 6, 5, 11,
+	15, 15, 10, 4, 55, 7, 2, 8, 14, 15, 13, 7, 1, 53, 6, 5, 11, 15, 15, 10, 4, 50, 7, 2,
+	8, 13, 15, 13, 7, 2, 48, 6, 5, 10, 15, 15, 10, 5, 45, 7, 2, 7, 13, 15, 13, 8, 2, 43,
+	6, 4, 10, 15, 15, 11, 5, 40, 7, 1, 7, 13, 15, 14, 8, 2, 38, 6, 4, 10, 15, 15, 11, 5,
+	35, 7, 1, 7, 12, 15, 14, 8, 3, 33, 6, 4, 9, 15, 15, 11, 6, 30, 7, 1, 7, 12, 15, 14,
+	9, 3, 28, 6, 4, 9, 15, 15, 11, 6, 25, 7, 1, 6, 12, 15, 14, 9, 3, 23, 6, 3, 9, 15,
+	15, 12, 6, 21, 6, 6, 12, 15, 15, 9, 3, 18, 7, 3, 9, 14, 15, 12, 6, 1, 16, 6, 6, 11,
+	15, 15, 9, 4, 13, 7, 3, 8, 14, 15, 12, 7, 1, 11, 6, 5, 11, 15, 15, 10, 4, 8, 7, 2,
+	8, 14, 15, 13, 7, 1, 6, 6, 5, 11, 15, 15, 10, 4, 3, 7, 2, 8, 13, 15, 13, 7, 2, 1,
+	6, 5, 10, 15, 15, 10, 5, 0, 5, 4, 15, 13, 8, 2, 1, 1, 4, 0, 0, 0, 0, 0, 0, 118,
+	4, 4, 9, 14, 11, 115, 7, 1, 7, 12, 15, 15, 9, 4, 113, 7, 5, 10, 15, 15, 11, 6, 1, 110,
+	7, 3, 8, 13, 15, 13, 8, 3, 108, 6, 6, 11, 15, 15, 10, 5, 105, 7, 4, 9, 14, 15, 12, 7,
+	2, 102, 7, 2, 7, 12, 15, 14, 9, 4, 100, 6, 5, 10, 15, 15, 11, 6, 97, 7, 3, 8, 13, 15,
+	13, 8, 3, 94, 7, 1, 6, 11, 15, 15, 10, 5, 92, 7, 4, 9, 15, 15, 12, 7, 1, 89, 7, 2,
+	7, 12, 15, 14, 9, 4, 87, 6, 5, 10, 15, 15, 11, 6, 84, 7, 3, 8, 14, 15, 13, 8, 2, 81,
+	7, 1, 6, 11, 15, 15, 10, 5, 79, 7, 4, 9, 15, 15, 12, 7, 1, 76, 7, 2, 7, 13, 15, 14,
+	9, 3, 74, 6, 5, 10, 15, 15, 11, 6, 71, 7, 3, 8, 14, 15, 13, 8, 2, 68, 7, 1, 6, 12,
+	15, 15, 10, 4, 66, 7, 4, 9, 15, 15, 12, 7, 1, 63, 7, 2, 7, 13, 15, 14, 9, 3, 61, 6,
+	5, 11, 15, 15, 11, 5, 58, 7, 3, 8, 14, 15, 13, 8, 2, 55, 7, 1, 6, 12, 15, 15, 10, 4,
+	53, 7, 4, 10, 15, 15, 12, 6, 1, 50, 7, 2, 7, 13, 15, 14, 9, 3, 48, 6, 5, 11, 15, 15,
+	11, 5, 45, 7, 3, 9, 14, 15, 13, 7, 2, 42, 7, 1, 6, 12, 15, 15, 10, 4, 40, 7, 4, 10,
+	15, 15, 12, 6, 1, 37, 7, 2, 8, 13, 15, 14, 8, 3, 35, 6, 5, 11, 15, 15, 11, 5, 32, 7,
+	3, 9, 14, 15, 13, 7, 2, 29, 7, 1, 7, 12, 15, 15, 9, 4, 27, 7, 4, 10, 15, 15, 12, 6,
+	1, 24, 7, 2, 8, 13, 15, 14, 8, 3, 22, 6, 6, 11, 15, 15, 10, 5, 19, 7, 3, 9, 14, 15,
+	13, 7, 2, 16, 7, 1, 7, 12, 15, 15, 9, 4, 14, 7, 5, 10, 15, 15, 11, 6, 1, 11, 7, 2,
+	8, 13, 15, 14, 8, 3, 9, 6, 6, 11, 15, 15, 10, 5, 6, 7, 4, 9, 14, 15, 12, 7, 2, 3,
+	7, 1, 7, 12, 15, 15, 9, 4, 1, 7, 5, 10, 15, 15, 11, 6, 1, 0, 5, 4, 15, 13, 8, 3,
+	1, 1, 4, 0, 0, 0, 0, 0, 0, 119, 4, 4, 9, 14, 7, 116, 7, 3, 8, 13, 15, 14, 9, 3,
+	113, 7, 1, 6, 12, 15, 15, 11, 5, 111, 7, 5, 10, 15, 15, 12, 7, 2, 108, 7, 4, 9, 14, 15,
+	13, 8, 3, 105, 7, 3, 8, 13, 15, 14, 9, 4, 102, 7, 1, 6, 12, 15, 15, 11, 5, 100, 7, 5,
+	10, 15, 15, 12, 7, 2, 97, 7, 4, 9, 14, 15, 13, 8, 3, 94, 7, 3, 8, 13, 15, 14, 9, 4,
+	91, 7, 1, 6, 11, 15, 15, 11, 5, 89, 7, 5, 10, 15, 15, 12, 7, 2, 86, 7, 4, 9, 14, 15,
+	13, 8, 3, 83, 7, 2, 8, 13, 15, 15, 9, 4, 80, 7, 1, 6, 11, 15, 15, 11, 6, 78, 7, 5,
+	10, 15, 15, 12, 7, 2, 75, 7, 4, 9, 14, 15, 13, 8, 3, 72, 7, 2, 8, 13, 15, 15, 9, 4,
+	69, 7, 1, 6, 11, 15, 15, 11, 6, 67, 7, 5, 10, 15, 15, 12, 7, 2, 64, 7, 4, 9, 14, 15,
+	13, 8, 3, 61, 7, 2, 8, 13, 15, 15, 9, 4, 58, 8, 1, 6, 11, 15, 15, 11, 6, 1, 56, 7,
+	5, 10, 15, 15, 12, 7, 2, 53, 7, 4, 9, 14, 15, 13, 8, 3, 50, 7, 2, 7, 13, 15, 15, 10,
+	4, 47, 8, 1, 6, 11, 15, 15, 11, 6, 1, 45, 7, 5, 10, 15, 15, 12, 7, 2, 42, 7, 4, 9,
+	14, 15, 13, 8, 3, 39, 7, 2, 7, 13, 15, 15, 10, 4, 36, 8, 1, 6, 11, 15, 15, 11, 6, 1,
+	34, 7, 5, 10, 15, 15, 12, 7, 2, 31, 7, 4, 9, 14, 15, 13, 8, 3, 28, 7, 2, 7, 12, 15,
+	15, 10, 4, 25, 8, 1, 6, 11, 15, 15, 11, 6, 1, 23, 7, 5, 10, 15, 15, 12, 7, 2, 20, 7,
+	3, 9, 14, 15, 14, 8, 3, 17, 7, 2, 7, 12, 15, 15, 10, 5, 14, 8, 1, 6, 11, 15, 15, 11,
+	6, 1, 12, 7, 5, 10, 15, 15, 12, 7, 2, 9, 7, 3, 9, 14, 15, 14, 8, 3, 6, 7, 2, 7,
+	12, 15, 15, 10, 5, 3, 8, 1, 6, 11, 15, 15, 11, 6, 1, 1, 7, 5, 10, 15, 15, 12, 7, 2,
+	0, 5, 4, 15, 14, 8, 3, 1, 1, 4, 0, 0, 0, 0, 0, 0, 120, 4, 4, 9, 14, 3, 117, 7,
+	4, 9, 14, 15, 14, 9, 1, 114, 7, 3, 8, 13, 15, 15, 10, 5, 111, 8, 3, 8, 13, 15, 15, 10,
+	5, 1, 108, 8, 2, 7, 12, 15, 15, 11, 6, 1, 105, 8, 2, 7, 12, 15, 15, 11, 6, 1, 102, 8,
+	1, 6, 11, 15, 15, 12, 7, 2, 99, 8, 1, 6, 11, 15, 15, 12, 7, 2, 97, 7, 5, 10, 15, 15,
+	13, 8, 3, 94, 7, 5, 10, 15, 15, 13, 8, 3, 91, 7, 4, 9, 14, 15, 14, 9, 4, 88, 7, 4,
+	9, 14, 15, 14, 9, 4, 85, 7, 3, 8, 13, 15, 14, 10, 5, 82, 7, 3, 8, 13, 15, 15, 10, 5,
+	79, 8, 3, 7, 12, 15, 15, 11, 6, 1, 76, 8, 2, 7, 12, 15, 15, 11, 6, 1, 73, 8, 2, 6,
+	11, 15, 15, 11, 7, 2, 70, 8, 1, 6, 11, 15, 15, 12, 7, 2, 67, 8, 1, 6, 10, 15, 15, 12,
+	8, 3, 65, 7, 5, 10, 15, 15, 13, 8, 3, 62, 7, 5, 10, 14, 15, 13, 8, 4, 59, 7, 4, 9,
+	14, 15, 14, 9, 4, 56, 7, 4, 9, 13, 15, 14, 9, 5, 53, 7, 3, 8, 13, 15, 15, 10, 5, 50,
+	8, 3, 8, 13, 15, 15, 10, 5, 1, 47, 8, 2, 7, 12, 15, 15, 11, 6, 1, 44, 8, 2, 7, 12,
+	15, 15, 11, 6, 1, 41, 8, 1, 6, 11, 15, 15, 12, 7, 2, 38, 8, 1, 6, 11, 15, 15, 12, 7,
+	2, 36, 7, 5, 10, 15, 15, 13, 8, 3, 33, 7, 5, 10, 15, 15, 13, 8, 3, 30, 7, 4, 9, 14,
+	15, 14, 9, 4, 27, 7, 4, 9, 14, 15, 14, 9, 4, 24, 7, 3, 8, 13, 15, 15, 10, 5, 21, 7,
+	3, 8, 13, 15, 15, 10, 5, 18, 8, 2, 7, 12, 15, 15, 11, 6, 1, 15, 8, 2, 7, 12, 15, 15,
+	11, 6, 1, 12, 8, 2, 6, 11, 15, 15, 12, 7, 2, 9, 8, 1, 6, 11, 15, 15, 12, 7, 2, 6,
+	8, 1, 6, 10, 15, 15, 12, 8, 3, 4, 7, 5, 10, 15, 15, 13, 8, 3, 1, 7, 5, 9, 14, 15,
+	13, 9, 4, 0, 5, 4, 15, 14, 9, 4, 1, 1, 4, 0, 0, 0, 0, 0, 0, 121, 3, 4, 9, 11,
+	118, 6, 5, 9, 14, 15, 14, 10, 115, 7, 5, 10, 14, 15, 14, 9, 5, 111, 8, 1, 5, 10, 15, 15,
+	14, 9, 4, 108, 8, 1, 6, 10, 15, 15, 13, 9, 4, 105, 8, 2, 6, 11, 15, 15, 13, 8, 4, 102,
+	8, 2, 7, 11, 15, 15, 12, 8, 3, 99, 8, 2, 7, 12, 15, 15, 12, 7, 3, 96, 8, 3, 7, 12,
+	15, 15, 12, 7, 2, 93, 8, 3, 8, 12, 15, 15, 11, 7, 2, 90, 8, 3, 8, 13, 15, 15, 11, 6,
+	2, 87, 8, 4, 8, 13, 15, 15, 11, 6, 1, 84, 8, 4, 9, 13, 15, 15, 10, 6, 1, 81, 8, 4,
+	9, 14, 15, 15, 10, 5, 1, 78, 7, 5, 9, 14, 15, 14, 10, 5, 75, 7, 5, 10, 14, 15, 14, 9,
+	5, 71, 8, 1, 5, 10, 15, 15, 13, 9, 4, 68, 8, 1, 6, 10, 15, 15, 13, 8, 4, 65, 8, 2,
+	6, 11, 15, 15, 13, 8, 3, 62, 8, 2, 7, 11, 15, 15, 12, 8, 3, 59, 8, 2, 7, 12, 15, 15,
+	12, 7, 3, 56, 8, 3, 7, 12, 15, 15, 12, 7, 2, 53, 8, 3, 8, 12, 15, 15, 11, 7, 2, 50,
+	8, 3, 8, 13, 15, 15, 11, 6, 2, 47, 8, 4, 8, 13, 15, 15, 11, 6, 1, 44, 8, 4, 9, 13,
+	15, 15, 10, 6, 1, 41, 8, 4, 9, 14, 15, 15, 10, 5, 1, 38, 7, 5, 9, 14, 15, 14, 10, 5,
+	34, 8, 1, 5, 10, 14, 15, 14, 9, 5, 31, 8, 1, 6, 10, 15, 15, 13, 9, 4, 28, 8, 1, 6,
+	11, 15, 15, 13, 8, 4, 25, 8, 2, 6, 11, 15, 15, 13, 8, 3, 22, 8, 2, 7, 11, 15, 15, 12,
+	8, 3, 19, 8, 2, 7, 12, 15, 15, 12, 7, 3, 16, 8, 3, 7, 12, 15, 15, 12, 7, 2, 13, 8,
+	3, 8, 12, 15, 15, 11, 7, 2, 10, 8, 3, 8, 13, 15, 15, 11, 6, 2, 7, 8, 4, 8, 13, 15,
+	15, 11, 6, 1, 4, 8, 4, 9, 13, 15, 15, 10, 6, 1, 1, 8, 4, 9, 14, 15, 14, 10, 5, 1,
+	0, 5, 4, 15, 14, 9, 5, 1, 1, 4, 0, 0, 0, 0, 0, 0, 122, 3, 4, 9, 6, 118, 7, 1,
+	5, 10, 14, 15, 14, 8, 115, 8, 2, 7, 11, 15, 15, 13, 9, 4, 112, 8, 3, 8, 12, 15, 15, 12,
+	8, 3, 109, 8, 5, 9, 13, 15, 15, 11, 7, 2, 105, 9, 1, 6, 10, 15, 15, 14, 10, 5, 1, 102,
+	8, 3, 7, 11, 15, 15, 13, 9, 4, 99, 8, 4, 8, 13, 15, 15, 12, 7, 3, 95, 9, 1, 5, 9,
+	14, 15, 15, 11, 6, 2, 92, 9, 2, 6, 11, 15, 15, 14, 9, 5, 1, 89, 8, 3, 7, 12, 15, 15,
+	13, 8, 4, 86, 8, 4, 9, 13, 15, 15, 11, 7, 3, 82, 9, 1, 5, 10, 14, 15, 15, 10, 6, 1,
+	79, 8, 2, 7, 11, 15, 15, 13, 9, 5, 76, 8, 3, 8, 12, 15, 15, 12, 8, 3, 73, 8, 5, 9,
+	13, 15, 15, 11, 7, 2, 69, 9, 1, 6, 10, 15, 15, 14, 10, 5, 1, 66, 8, 3, 7, 11, 15, 15,
+	13, 9, 4, 63, 8, 4, 8, 13, 15, 15, 12, 7, 3, 59, 9, 1, 5, 9, 14, 15, 15, 11, 6, 2,
+	56, 9, 2, 6, 11, 15, 15, 14, 9, 5, 1, 53, 8, 3, 7, 12, 15, 15, 13, 8, 4, 50, 8, 4,
+	9, 13, 15, 15, 11, 7, 3, 46, 9, 1, 5, 10, 14, 15, 15, 10, 6, 1, 43, 8, 2, 7, 11, 15,
+	15, 13, 9, 5, 40, 8, 3, 8, 12, 15, 15, 12, 8, 3, 37, 8, 4, 9, 13, 15, 15, 11, 7, 2,
+	33, 9, 1, 6, 10, 14, 15, 14, 10, 6, 1, 30, 8, 2, 7, 11, 15, 15, 13, 9, 4, 27, 8, 4,
+	8, 12, 15, 15, 12, 8, 3, 24, 8, 5, 9, 14, 15, 15, 11, 6, 2, 20, 9, 2, 6, 10, 15, 15,
+	14, 10, 5, 1, 17, 8, 3, 7, 12, 15, 15, 13, 8, 4, 14, 8, 4, 8, 13, 15, 15, 12, 7, 3,
+	10, 9, 1, 5, 10, 14, 15, 15, 10, 6, 2, 7, 8, 2, 6, 11, 15, 15, 14, 9, 5, 4, 8, 3,
+	8, 12, 15, 15, 12, 8, 4, 1, 8, 4, 9, 13, 15, 15, 11, 7, 2, 0, 6, 4, 15, 14, 10, 6,
+	1, 1, 1, 4, 0, 0, 0, 0, 0, 0, 123, 3, 4, 8, 1, 119, 7, 2, 6, 10, 14, 15, 15, 4,
+	116, 8, 4, 8, 12, 15, 15, 13, 9, 5, 112, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 109, 9, 4,
+	8, 12, 15, 15, 13, 9, 5, 1, 105, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 102, 9, 4, 8, 12,
+	15, 15, 13, 9, 5, 1, 98, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 95, 9, 4, 8, 12, 15, 15,
+	13, 9, 5, 1, 91, 9, 2, 6, 10, 14, 15, 15, 11, 7, 3, 88, 9, 4, 8, 12, 15, 15, 13, 9,
+	5, 1, 84, 9, 1, 6, 10, 14, 15, 15, 11, 7, 3, 81, 9, 3, 8, 12, 15, 15, 13, 9, 5, 1,
+	77, 9, 1, 5, 10, 14, 15, 15, 11, 7, 3, 74, 9, 3, 7, 12, 15, 15, 13, 9, 5, 1, 70, 9,
+	1, 5, 10, 14, 15, 15, 11, 7, 3, 67, 9, 3, 7, 12, 15, 15, 14, 9, 5, 1, 63, 9, 1, 5,
+	9, 14, 15, 15, 12, 7, 3, 60, 9, 3, 7, 11, 15, 15, 14, 10, 5, 1, 56, 9, 1, 5, 9, 13,
+	15, 15, 12, 8, 3, 53, 9, 3, 7, 11, 15, 15, 14, 10, 6, 1, 49, 9, 1, 5, 9, 13, 15, 15,
+	12, 8, 3, 46, 9, 3, 7, 11, 15, 15, 14, 10, 6, 1, 42, 9, 1, 5, 9, 13, 15, 15, 12, 8,
+	4, 39, 9, 3, 7, 11, 15, 15, 14, 10, 6, 2, 35, 9, 1, 5, 9, 13, 15, 15, 12, 8, 4, 32,
+	9, 3, 7, 11, 15, 15, 14, 10, 6, 2, 28, 9, 1, 5, 9, 13, 15, 15, 12, 8, 4, 25, 9, 3,
+	7, 11, 15, 15, 14, 10, 6, 2, 21, 9, 1, 5, 9, 13, 15, 15, 12, 8, 4, 18, 9, 3, 7, 11,
+	15, 15, 14, 10, 6, 2, 15, 8, 5, 9, 13, 15, 15, 12, 8, 4, 11, 9, 2, 7, 11, 15, 15, 14,
+	10, 6, 2, 8, 8, 4, 9, 13, 15, 15, 12, 8, 4, 4, 9, 2, 6, 11, 15, 15, 15, 10, 6, 2,
+	1, 8, 4, 8, 13, 15, 15, 12, 8, 4, 0, 6, 4, 15, 15, 10, 6, 2, 1, 1, 4, 0, 0, 0,
+	0, 124, 2, 4, 5, 120, 6, 3, 6, 10, 14, 15, 13, 116, 10, 2, 5, 9, 13, 15, 15, 13, 9, 5,
+	1, 112, 10, 1, 4, 8, 12, 15, 15, 14, 10, 6, 2, 109, 9, 3, 7, 11, 15, 15, 15, 11, 7, 3,
+	105, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 101, 10, 1, 5, 9, 13, 15, 15, 13, 9, 5, 1, 98,
+	9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 94, 9, 3, 7, 11, 15, 15, 15, 11, 7, 3, 90, 10, 2,
+	6, 10, 14, 15, 15, 12, 8, 4, 1, 86, 10, 1, 5, 9, 13, 15, 15, 13, 9, 5, 2, 83, 9, 4,
+	8, 12, 15, 15, 14, 10, 6, 3, 79, 9, 3, 7, 11, 14, 15, 15, 11, 8, 4, 75, 10, 2, 6, 10,
+	13, 15, 15, 12, 9, 5, 1, 71, 10, 1, 5, 8, 12, 15, 15, 13, 10, 6, 2, 68, 9, 4, 7, 11,
+	15, 15, 15, 11, 7, 3, 64, 9, 3, 6, 10, 14, 15, 15, 12, 8, 4, 60, 10, 1, 5, 9, 13, 15,
+	15, 13, 9, 5, 1, 57, 9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 53, 9, 3, 7, 11, 15, 15, 15,
+	11, 7, 3, 49, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 45, 10, 1, 5, 9, 13, 15, 15, 13, 9,
+	5, 1, 42, 9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 38, 9, 3, 7, 11, 15, 15, 15, 11, 7, 3,
+	34, 10, 2, 6, 10, 14, 15, 15, 12, 8, 4, 1, 30, 10, 1, 5, 9, 13, 15, 15, 13, 9, 6, 2,
+	27, 9, 4, 8, 12, 15, 15, 14, 10, 7, 3, 23, 9, 3, 7, 11, 14, 15, 15, 11, 8, 4, 19, 10,
+	2, 6, 9, 13, 15, 15, 13, 9, 5, 1, 15, 10, 1, 5, 8, 12, 15, 15, 14, 10, 6, 2, 12, 9,
+	3, 7, 11, 15, 15, 15, 11, 7, 3, 8, 9, 2, 6, 10, 14, 15, 15, 12, 8, 4, 4, 10, 1, 5,
+	9, 13, 15, 15, 13, 9, 5, 1, 1, 9, 4, 8, 12, 15, 15, 14, 10, 6, 2, 0, 6, 4, 15, 15,
+	11, 7, 3, 1, 1, 4, 0, 0, 0, 0, 125, 1, 3, 121, 6, 3, 7, 10, 14, 15, 7, 117, 9, 3,
+	7, 10, 14, 15, 15, 13, 9, 5, 113, 10, 3, 7, 10, 14, 15, 15, 13, 9, 5, 2, 109, 10, 3, 7,
+	10, 14, 15, 15, 13, 9, 5, 2, 105, 10, 3, 7, 10, 14, 15, 15, 13, 9, 5, 2, 101, 10, 3, 7,
+	10, 14, 15, 15, 13, 9, 5, 2, 97, 10, 3, 7, 11, 14, 15, 15, 12, 9, 5, 2, 93, 10, 3, 7,
+	11, 14, 15, 15, 12, 9, 5, 2, 89, 10, 3, 7, 11, 14, 15, 15, 12, 9, 5, 2, 85, 10, 3, 7,
+	11, 14, 15, 15, 12, 9, 5, 1, 81, 10, 3, 7, 11, 14, 15, 15, 12, 9, 5, 1, 77, 10, 3, 7,
+	11, 14, 15, 15, 12, 9, 5, 1, 73, 10, 3, 7, 11, 14, 15, 15, 12, 9, 5, 1, 69, 10, 4, 7,
+	11, 14, 15, 15, 12, 9, 5, 1, 65, 10, 4, 7, 11, 14, 15, 15, 12, 9, 5, 1, 61, 10, 4, 7,
+	11, 14, 15, 15, 12, 8, 5, 1, 57, 10, 4, 7, 11, 15, 15, 15, 12, 8, 5, 1, 53, 10, 4, 7,
+	11, 15, 15, 15, 12, 8, 5, 1, 49, 10, 4, 7, 11, 15, 15, 15, 12, 8, 5, 1, 45, 10, 4, 7,
+	11, 15, 15, 15, 12, 8, 5, 1, 41, 10, 4, 7, 11, 15, 15, 15, 12, 8, 5, 1, 37, 10, 4, 7,
+	11, 15, 15, 15, 12, 8, 5, 1, 33, 10, 4, 8, 11, 15, 15, 15, 12, 8, 5, 1, 29, 10, 4, 8,
+	11, 15, 15, 15, 12, 8, 5, 1, 25, 10, 4, 8, 11, 15, 15, 15, 12, 8, 5, 1, 21, 10, 4, 8,
+	11, 15, 15, 15, 12, 8, 4, 1, 17, 10, 4, 8, 11, 15, 15, 15, 12, 8, 4, 1, 13, 10, 4, 8,
+	11, 15, 15, 15, 12, 8, 4, 1, 9, 10, 4, 8, 11, 15, 15, 15, 12, 8, 4, 1, 4, 11, 1, 4,
+	8, 11, 15, 15, 15, 12, 8, 4, 1, 1, 10, 4, 8, 11, 15, 15, 15, 12, 8, 4, 1, 0, 7, 4,
+	15, 15, 11, 8, 4, 1, 1, 2, 4, 1, 0, 0, 0, 0, 0, 0, 122, 5, 3, 7, 10, 13, 14, 117,
+	10, 1, 4, 8, 11, 14, 15, 15, 13, 10, 6, 113, 11, 2, 5, 9, 12, 15, 15, 15, 12, 8, 5, 2,
+	109, 11, 3, 7, 10, 13, 15, 15, 14, 11, 7, 4, 1, 104, 11, 1, 4, 8, 11, 14, 15, 15, 13, 10,
+	6, 3, 100, 11, 2, 5, 9, 12, 15, 15, 15, 12, 8, 5, 2, 96, 11, 3, 7, 10, 13, 15, 15, 14,
+	11, 7, 4, 1, 91, 11, 1, 4, 8, 11, 14, 15, 15, 13, 10, 6, 3, 87, 11, 2, 5, 9, 12, 15,
+	15, 15, 12, 8, 5, 2, 83, 11, 3, 7, 10, 13, 15, 15, 14, 11, 7, 4, 1, 78, 11, 1, 4, 8,
+	11, 14, 15, 15, 13, 10, 6, 3, 74, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2, 70, 11, 3,
+	6, 10, 13, 15, 15, 14, 11, 7, 4, 1, 65, 11, 1, 4, 8, 11, 14, 15, 15, 13, 10, 6, 3, 61,
+	11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2, 57, 11, 3, 6, 10, 13, 15, 15, 14, 11, 7, 4,
+	1, 52, 11, 1, 4, 8, 11, 14, 15, 15, 13, 10, 6, 3, 48, 11, 2, 5, 9, 12, 15, 15, 15, 12,
+	9, 5, 2, 44, 11, 3, 6, 10, 13, 15, 15, 14, 11, 7, 4, 1, 39, 11, 1, 4, 8, 11, 14, 15,
+	15, 13, 10, 6, 3, 35, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2, 31, 11, 3, 6, 10, 13,
+	15, 15, 14, 11, 7, 4, 1, 26, 11, 1, 4, 8, 11, 14, 15, 15, 13, 10, 6, 3, 22, 11, 2, 5,
+	9, 12, 15, 15, 15, 12, 9, 5, 2, 18, 11, 3, 6, 10, 13, 15, 15, 14, 11, 7, 4, 1, 13, 11,
+	1, 4, 8, 11, 14, 15, 15, 13, 10, 6, 3, 9, 11, 2, 5, 9, 12, 15, 15, 15, 12, 9, 5, 2,
+	5, 11, 3, 6, 10, 13, 15, 15, 14, 11, 7, 4, 1, 1, 10, 4, 8, 11, 14, 15, 15, 13, 10, 6,
+	3, 0, 7, 4, 15, 15, 12, 9, 5, 2, 1, 2, 4, 1, 0, 0, 0, 0, 0, 0, 123, 5, 3, 6,
+	9, 12, 5, 118, 10, 2, 5, 8, 12, 15, 15, 15, 14, 10, 4, 113, 12, 1, 4, 7, 11, 14, 15, 15,
+	14, 11, 8, 5, 2, 109, 11, 3, 7, 10, 13, 15, 15, 15, 12, 9, 6, 3, 104, 12, 3, 6, 9, 12,
+	15, 15, 15, 13, 10, 7, 4, 1, 99, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11, 8, 5, 2, 94, 12,
+	1, 4, 7, 10, 13, 15, 15, 15, 12, 9, 6, 3, 90, 11, 3, 6, 9, 12, 15, 15, 15, 13, 10, 7,
+	3, 85, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11, 7, 4, 1, 80, 12, 1, 4, 7, 10, 14, 15, 15,
+	15, 12, 8, 5, 2, 76, 11, 3, 6, 9, 13, 15, 15, 15, 12, 9, 6, 3, 71, 12, 2, 5, 9, 12,
+	15, 15, 15, 13, 10, 7, 4, 1, 66, 12, 1, 4, 8, 11, 14, 15, 15, 14, 11, 8, 5, 2, 62, 11,
+	4, 7, 10, 13, 15, 15, 15, 12, 9, 6, 3, 57, 12, 3, 6, 9, 12, 15, 15, 15, 13, 10, 7, 4,
+	1, 52, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11, 8, 5, 1, 47, 12, 1, 4, 7, 10, 13, 15, 15,
+	15, 12, 9, 5, 2, 43, 11, 3, 6, 9, 12, 15, 15, 15, 13, 10, 6, 3, 38, 12, 2, 5, 8, 11,
+	15, 15, 15, 14, 10, 7, 4, 1, 33, 12, 1, 4, 7, 11, 14, 15, 15, 14, 11, 8, 5, 2, 29, 11,
+	3, 6, 10, 13, 15, 15, 15, 12, 9, 6, 3, 24, 12, 2, 6, 9, 12, 15, 15, 15, 13, 10, 7, 4,
+	1, 19, 12, 2, 5, 8, 11, 14, 15, 15, 14, 11, 8, 5, 2, 14, 12, 1, 4, 7, 10, 13, 15, 15,
+	15, 12, 9, 6, 3, 10, 11, 3, 6, 9, 12, 15, 15, 15, 13, 10, 7, 4, 5, 12, 2, 5, 8, 11,
+	14, 15, 15, 14, 11, 8, 4, 1, 1, 11, 4, 7, 10, 13, 15, 15, 15, 12, 8, 5, 2, 0, 7, 4,
+	15, 15, 13, 9, 6, 3, 1, 2, 4, 1, 0, 0, 0, 0, 0, 0, 124, 4, 3, 6, 8, 9, 119, 9,
+	3, 6, 9, 12, 15, 15, 15, 14, 10, 113, 13, 1, 4, 6, 9, 12, 15, 15, 15, 14, 11, 8, 5, 3,
+	108, 13, 1, 4, 7, 10, 13, 15, 15, 15, 14, 11, 8, 5, 2, 103, 13, 1, 4, 7, 10, 13, 15, 15,
+	15, 13, 10, 7, 5, 2, 98, 13, 2, 5, 8, 10, 13, 15, 15, 15, 13, 10, 7, 4, 1, 93, 13, 2,
+	5, 8, 11, 14, 15, 15, 15, 12, 9, 7, 4, 1, 88, 12, 3, 6, 8, 11, 14, 15, 15, 15, 12, 9,
+	6, 3, 83, 12, 3, 6, 9, 12, 15, 15, 15, 14, 11, 9, 6, 3, 77, 13, 1, 4, 6, 9, 12, 15,
+	15, 15, 14, 11, 8, 5, 2, 72, 13, 1, 4, 7, 10, 13, 15, 15, 15, 14, 11, 8, 5, 2, 67, 13,
+	2, 4, 7, 10, 13, 15, 15, 15, 13, 10, 7, 5, 2, 62, 13, 2, 5, 8, 11, 13, 15, 15, 15, 13,
+	10, 7, 4, 1, 57, 13, 2, 5, 8, 11, 14, 15, 15, 15, 12, 9, 7, 4, 1, 52, 12, 3, 6, 8,
+	11, 14, 15, 15, 15, 12, 9, 6, 3, 47, 12, 3, 6, 9, 12, 15, 15, 15, 14, 11, 9, 6, 3, 41,
+	13, 1, 4, 6, 9, 12, 15, 15, 15, 14, 11, 8, 5, 2, 36, 13, 1, 4, 7, 10, 13, 15, 15, 15,
+	13, 11, 8, 5, 2, 31, 13, 2, 4, 7, 10, 13, 15, 15, 15, 13, 10, 7, 4, 2, 26, 13, 2, 5,
+	8, 11, 13, 15, 15, 15, 13, 10, 7, 4, 1, 21, 13, 2, 5, 8, 11, 14, 15, 15, 15, 12, 9, 7,
+	4, 1, 16, 12, 3, 6, 9, 11, 14, 15, 15, 15, 12, 9, 6, 3, 11, 12, 3, 6, 9, 12, 15, 15,
+	15, 14, 11, 9, 6, 3, 5, 13, 1, 4, 6, 9, 12, 15, 15, 15, 14, 11, 8, 5, 2, 1, 12, 4,
+	7, 10, 13, 15, 15, 15, 13, 11, 8, 5, 2, 0, 8, 4, 15, 15, 13, 10, 7, 4, 2, 1, 2, 4,
+	1, 0, 0, 0, 0, 125, 3, 2, 5, 7, 119, 10, 1, 4, 6, 9, 12, 14, 15, 15, 15, 4, 114, 14,
+	3, 5, 8, 11, 13, 15, 15, 15, 14, 11, 9, 6, 3, 1, 108, 14, 2, 5, 7, 10, 12, 15, 15, 15,
+	15, 12, 9, 7, 4, 2, 102, 14, 1, 4, 6, 9, 12, 14, 15, 15, 15, 13, 10, 8, 5, 2, 97, 14,
+	3, 6, 8, 11, 13, 15, 15, 15, 14, 11, 9, 6, 3, 1, 91, 14, 2, 5, 7, 10, 12, 15, 15, 15,
+	15, 12, 9, 7, 4, 2, 85, 14, 1, 4, 6, 9, 12, 14, 15, 15, 15, 13, 10, 8, 5, 2, 80, 14,
+	3, 6, 8, 11, 13, 15, 15, 15, 14, 11, 9, 6, 3, 1, 74, 14, 2, 5, 7, 10, 13, 15, 15, 15,
+	15, 12, 9, 7, 4, 2, 68, 14, 1, 4, 6, 9, 12, 14, 15, 15, 15, 13, 10, 8, 5, 2, 63, 14,
+	3, 6, 8, 11, 13, 15, 15, 15, 14, 11, 8, 6, 3, 1, 57, 14, 2, 5, 7, 10, 13, 15, 15, 15,
+	15, 12, 9, 7, 4, 2, 51, 14, 1, 4, 6, 9, 12, 14, 15, 15, 15, 13, 10, 8, 5, 2, 46, 14,
+	3, 6, 8, 11, 13, 15, 15, 15, 14, 11, 8, 6, 3, 1, 40, 14, 2, 5, 7, 10, 13, 15, 15, 15,
+	15, 12, 9, 7, 4, 1, 34, 14, 1, 4, 7, 9, 12, 14, 15, 15, 15, 13, 10, 8, 5, 2, 29, 14,
+	3, 6, 8, 11, 13, 15, 15, 15, 14, 11, 8, 6, 3, 1, 23, 14, 2, 5, 7, 10, 13, 15, 15, 15,
+	14, 12, 9, 7, 4, 1, 17, 14, 1, 4, 7, 9, 12, 14, 15, 15, 15, 13, 10, 8, 5, 2, 12, 14,
+	3, 6, 8, 11, 14, 15, 15, 15, 14, 11, 8, 6, 3, 1, 6, 14, 2, 5, 7, 10, 13, 15, 15, 15,
+	14, 12, 9, 7, 4, 1, 1, 13, 4, 7, 9, 12, 14, 15, 15, 15, 13, 10, 7, 5, 2, 0, 9, 4,
+	15, 15, 14, 11, 8, 6, 3, 1, 1, 2, 4, 1, 0, 0, 0, 0, 126, 3, 1, 3, 2, 120, 9, 2,
+	4, 6, 9, 11, 13, 15, 15, 10, 114, 15, 2, 5, 7, 9, 12, 14, 15, 15, 15, 14, 12, 9, 7, 5,
+	1, 107, 16, 1, 3, 5, 8, 10, 13, 15, 15, 15, 15, 13, 11, 9, 6, 4, 1, 101, 16, 2, 4, 6,
+	9, 11, 13, 15, 15, 15, 15, 12, 10, 8, 5, 3, 1, 95, 15, 2, 5, 7, 9, 12, 14, 15, 15, 15,
+	14, 12, 9, 7, 5, 2, 88, 16, 1, 3, 5, 8, 10, 12, 15, 15, 15, 15, 13, 11, 9, 6, 4, 2,
+	82, 16, 1, 4, 6, 8, 11, 13, 15, 15, 15, 15, 13, 10, 8, 6, 3, 1, 76, 15, 2, 4, 7, 9,
+	12, 14, 15, 15, 15, 14, 12, 10, 7, 5, 3, 69, 16, 1, 3, 5, 8, 10, 12, 15, 15, 15, 15, 14,
+	11, 9, 6, 4, 2, 63, 16, 1, 4, 6, 8, 11, 13, 15, 15, 15, 15, 13, 10, 8, 6, 3, 1, 57,
+	15, 2, 4, 7, 9, 11, 14, 15, 15, 15, 14, 12, 10, 7, 5, 3, 51, 15, 3, 5, 7, 10, 12, 14,
+	15, 15, 15, 14, 11, 9, 7, 4, 2, 44, 16, 1, 3, 6, 8, 11, 13, 15, 15, 15, 15, 13, 11, 8,
+	6, 4, 1, 38, 15, 2, 4, 7, 9, 11, 14, 15, 15, 15, 15, 12, 10, 7, 5, 3, 32, 15, 3, 5,
+	7, 10, 12, 14, 15, 15, 15, 14, 11, 9, 7, 4, 2, 25, 16, 1, 3, 6, 8, 10, 13, 15, 15, 15,
+	15, 13, 11, 8, 6, 4, 1, 19, 16, 2, 4, 6, 9, 11, 13, 15, 15, 15, 15, 12, 10, 8, 5, 3,
+	1, 13, 15, 2, 5, 7, 10, 12, 14, 15, 15, 15, 14, 12, 9, 7, 5, 2, 6, 16, 1, 3, 6, 8,
+	10, 13, 15, 15, 15, 15, 13, 11, 8, 6, 4, 1, 1, 15, 4, 6, 9, 11, 13, 15, 15, 15, 15, 12,
+	10, 8, 5, 3, 1, 0, 9, 4, 15, 15, 14, 12, 9, 7, 5, 2, 1, 2, 4, 2, 0, 0, 0, 0,
+	128, 1, 1, 121, 8, 2, 4, 6, 8, 10, 12, 14, 14, 114, 15, 2, 4, 6, 8, 10, 13, 15, 15, 15,
+	15, 14, 12, 10, 8, 6, 107, 17, 2, 4, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4,
+	2, 99, 18, 1, 3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 1, 92, 18, 1,
+	3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 5, 3, 1, 85, 18, 1, 3, 5, 7, 9,
+	11, 14, 15, 15, 15, 15, 14, 11, 9, 7, 5, 3, 1, 78, 18, 1, 3, 5, 8, 10, 12, 14, 15, 15,
+	15, 15, 13, 11, 9, 7, 5, 3, 1, 71, 18, 1, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11,
+	9, 7, 5, 3, 1, 64, 17, 2, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 4, 2,
+	57, 17, 2, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 10, 8, 6, 4, 2, 50, 17, 2, 4, 6,
+	8, 11, 13, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 2, 43, 17, 2, 5, 7, 9, 11, 13, 15, 15,
+	15, 15, 14, 12, 10, 8, 6, 4, 2, 35, 18, 1, 3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12,
+	10, 8, 6, 3, 1, 28, 18, 1, 3, 5, 7, 9, 11, 13, 15, 15, 15, 15, 14, 12, 10, 7, 5, 3,
+	1, 21, 18, 1, 3, 5, 7, 9, 12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 5, 3, 1, 14, 18, 1,
+	3, 6, 8, 10, 12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 5, 3, 1, 7, 17, 2, 4, 6, 8, 10,
+	12, 14, 15, 15, 15, 15, 13, 11, 9, 7, 5, 3, 1, 16, 4, 6, 8, 10, 12, 14, 15, 15, 15, 15,
+	13, 11, 9, 6, 4, 2, 0, 10, 4, 15, 15, 15, 12, 10, 8, 6, 4, 2, 1, 2, 4, 2, 0, 0,
+	0, 0, 0, 0, 122, 8, 2, 4, 5, 7, 9, 11, 13, 3, 114, 16, 2, 4, 6, 7, 9, 11, 13, 15,
+	15, 15, 15, 15, 14, 12, 10, 2, 106, 20, 2, 4, 6, 8, 10, 11, 13, 15, 15, 15, 15, 15, 13, 11,
+	10, 8, 6, 4, 2, 1, 97, 20, 1, 3, 4, 6, 8, 10, 12, 13, 15, 15, 15, 15, 15, 13, 11, 9,
+	8, 6, 4, 2, 89, 20, 1, 3, 5, 6, 8, 10, 12, 14, 15, 15, 15, 15, 15, 13, 11, 9, 7, 5,
+	4, 2, 81, 20, 1, 3, 5, 7, 9, 10, 12, 14, 15, 15, 15, 15, 14, 13, 11, 9, 7, 5, 3, 2,
+	73, 20, 1, 3, 5, 7, 9, 11, 12, 14, 15, 15, 15, 15, 14, 12, 10, 9, 7, 5, 3, 1, 65, 20,
+	2, 4, 5, 7, 9, 11, 13, 15, 15, 15, 15, 15, 14, 12, 10, 8, 7, 5, 3, 1, 57, 20, 2, 4,
+	6, 7, 9, 11, 13, 15, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4, 3, 1, 49, 19, 2, 4, 6, 8,
+	10, 11, 13, 15, 15, 15, 15, 15, 13, 11, 10, 8, 6, 4, 2, 40, 20, 1, 3, 4, 6, 8, 10, 12,
+	14, 15, 15, 15, 15, 15, 13, 11, 9, 8, 6, 4, 2, 32, 20, 1, 3, 5, 6, 8, 10, 12, 14, 15,
+	15, 15, 15, 15, 13, 11, 9, 7, 5, 4, 2, 24, 20, 1, 3, 5, 7, 9, 10, 12, 14, 15, 15, 15,
+	15, 14, 12, 11, 9, 7, 5, 3, 2, 16, 20, 2, 3, 5, 7, 9, 11, 12, 14, 15, 15, 15, 15, 14,
+	12, 10, 9, 7, 5, 3, 1, 8, 20, 2, 4, 5, 7, 9, 11, 13, 15, 15, 15, 15, 15, 14, 12, 10,
+	8, 6, 5, 3, 1, 1, 19, 4, 6, 8, 9, 11, 13, 15, 15, 15, 15, 15, 14, 12, 10, 8, 6, 4,
+	3, 1, 0, 11, 4, 15, 15, 15, 13, 11, 10, 8, 6, 4, 2, 1, 2, 4, 2, 0, 0, 0, 0, 0,
+	0, 123, 7, 1, 3, 4, 6, 7, 9, 5, 114, 16, 2, 4, 5, 7, 8, 10, 11, 13, 15, 15, 15, 15,
+	15, 15, 14, 7, 104, 23, 1, 3, 4, 6, 8, 9, 11, 12, 14, 15, 15, 15, 15, 15, 14, 13, 11, 10,
+	8, 6, 5, 3, 2, 95, 23, 2, 4, 5, 7, 8, 10, 11, 13, 15, 15, 15, 15, 15, 15, 14, 12, 10,
+	9, 7, 6, 4, 3, 1, 85, 23, 1, 3, 4, 6, 8, 9, 11, 12, 14, 15, 15, 15, 15, 15, 14, 13,
+	11, 10, 8, 6, 5, 3, 2, 75, 24, 1, 2, 4, 5, 7, 8, 10, 11, 13, 15, 15, 15, 15, 15, 15,
+	13, 12, 10, 9, 7, 6, 4, 2, 1, 66, 23, 1, 3, 4, 6, 8, 9, 11, 12, 14, 15, 15, 15, 15,
+	15, 14, 13, 11, 10, 8, 6, 5, 3, 2, 56, 24, 1, 2, 4, 5, 7, 8, 10, 12, 13, 15, 15, 15,
+	15, 15, 15, 13, 12, 10, 9, 7, 6, 4, 2, 1, 47, 23, 1, 3, 5, 6, 8, 9, 11, 12, 14, 15,
+	15, 15, 15, 15, 14, 13, 11, 9, 8, 6, 5, 3, 2, 37, 24, 1, 2, 4, 5, 7, 8, 10, 12, 13,
+	15, 15, 15, 15, 15, 15, 13, 12, 10, 9, 7, 6, 4, 2, 1, 28, 23, 1, 3, 5, 6, 8, 9, 11,
+	12, 14, 15, 15, 15, 15, 15, 14, 13, 11, 9, 8, 6, 5, 3, 2, 18, 24, 1, 2, 4, 5, 7, 8,
+	10, 12, 13, 15, 15, 15, 15, 15, 15, 13, 12, 10, 9, 7, 5, 4, 2, 1, 9, 23, 1, 3, 5, 6,
+	8, 9, 11, 12, 14, 15, 15, 15, 15, 15, 14, 13, 11, 9, 8, 6, 5, 3, 2, 1, 22, 4, 5, 7,
+	9, 10, 12, 13, 15, 15, 15, 15, 15, 15, 13, 12, 10, 9, 7, 5, 4, 2, 1, 0, 13, 4, 15, 15,
+	15, 14, 12, 11, 9, 8, 6, 5, 3, 2, 1, 3, 4, 2, 1, 0, 0, 0, 0, 125, 5, 2, 3, 4,
+	5, 4, 113, 17, 1, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15, 15, 15, 15, 15, 11, 102, 27, 1,
+	3, 4, 5, 7, 8, 9, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 11, 10, 9, 7, 6, 5,
+	3, 2, 90, 28, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 14, 15, 15, 15, 15, 15, 15, 15, 13, 12,
+	11, 9, 8, 7, 6, 4, 3, 2, 79, 28, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15,
+	15, 15, 15, 14, 13, 11, 10, 9, 8, 6, 5, 4, 2, 1, 68, 27, 2, 3, 4, 6, 7, 8, 10, 11,
+	12, 14, 15, 15, 15, 15, 15, 15, 15, 14, 12, 11, 10, 8, 7, 6, 4, 3, 2, 56, 28, 1, 2, 4,
+	5, 6, 8, 9, 10, 11, 13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 12, 10, 9, 8, 6, 5, 4, 3,
+	1, 45, 28, 2, 3, 4, 5, 7, 8, 9, 11, 12, 13, 15, 15, 15, 15, 15, 15, 15, 14, 12, 11, 10,
+	8, 7, 6, 5, 3, 2, 1, 33, 28, 1, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15, 15, 15, 15,
+	15, 15, 14, 13, 12, 11, 9, 8, 7, 5, 4, 3, 1, 22, 28, 1, 3, 4, 5, 7, 8, 9, 11, 12,
+	13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 11, 10, 9, 7, 6, 5, 3, 2, 1, 10, 28, 1, 2, 3,
+	5, 6, 7, 8, 10, 11, 12, 14, 15, 15, 15, 15, 15, 15, 15, 13, 12, 11, 9, 8, 7, 5, 4, 3,
+	2, 1, 26, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15, 15, 15, 14, 13, 11, 10, 9, 8,
+	6, 5, 4, 2, 1, 0, 15, 4, 15, 15, 15, 15, 14, 12, 11, 10, 8, 7, 6, 4, 3, 2, 1, 3,
+	4, 2, 1, 0, 0, 0, 0, 127, 3, 1, 2, 2, 113, 17, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 15, 15, 14, 98, 32, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 4, 84, 35, 1, 2, 3, 4, 5,
+	6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 10, 9, 8, 7,
+	6, 5, 4, 3, 2, 1, 70, 35, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 15, 15,
+	15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 56, 34, 1, 3, 4,
+	5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9,
+	8, 7, 6, 5, 4, 3, 1, 41, 35, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 8, 7, 6, 5, 4, 3, 2, 1, 27, 35, 1, 2,
+	3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10,
+	9, 8, 7, 6, 5, 4, 3, 2, 1, 13, 35, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 1, 32,
+	4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 12, 11, 10,
+	9, 8, 7, 5, 4, 3, 2, 1, 0, 19, 4, 15, 15, 15, 15, 15, 14, 12, 11, 10, 9, 8, 7, 6,
+	5, 4, 3, 2, 1, 1, 4, 4, 3, 2, 1, 0, 0, 0, 0, 0, 0, 112, 19, 1, 2, 3, 3, 4,
+	5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 13, 14, 14, 1, 93, 37, 1, 2, 3, 3, 4, 5, 6, 7,
+	7, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 12,
+	11, 10, 10, 9, 8, 74, 46, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 11, 11, 12, 13, 14,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 12, 11, 10, 10, 9, 8, 7, 7, 6, 5,
+	4, 3, 3, 2, 1, 55, 46, 1, 2, 3, 4, 4, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 12, 11, 10, 10, 9, 8, 7, 6, 6, 5,
+	4, 3, 3, 2, 1, 35, 47, 1, 1, 2, 3, 4, 4, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13,
+	14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 13, 12, 11, 10, 10, 9, 8, 7, 6, 6,
+	5, 4, 3, 2, 2, 1, 16, 47, 1, 1, 2, 3, 4, 4, 5, 6, 7, 8, 8, 9, 10, 11, 12, 12,
+	13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 13, 12, 11, 10, 9, 9, 8, 7, 6,
+	6, 5, 4, 3, 2, 2, 1, 1, 43, 4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 12, 12, 13, 14, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 13, 12, 11, 10, 9, 9, 8, 7, 6, 5, 5, 4,
+	3, 2, 2, 1, 0, 25, 4, 15, 15, 15, 15, 15, 15, 14, 13, 12, 12, 11, 10, 9, 9, 8, 7, 6,
+	5, 5, 4, 3, 2, 1, 1, 1, 5, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0, 0, 110, 21, 1, 1,
+	2, 2, 3, 3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 1, 81, 50, 1, 1, 2,
+	2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13, 12, 12, 1, 53,
+	69, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 13,
+	13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 13, 13, 12,
+	12, 11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 2, 2, 1, 1, 24, 70,
+	1, 1, 2, 2, 3, 3, 4, 4, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13,
+	13, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13, 12,
+	12, 11, 11, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 1, 64,
+	4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9,
+	9, 8, 8, 7, 7, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 36, 4, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 14, 14, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4,
+	4, 3, 3, 2, 1, 1, 1, 7, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 104, 26, 1, 1, 1,
+	2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 46,
+	85, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6,
+	7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13,
+	13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 1, 128, 4, 4, 4, 5, 5, 5, 5, 6,
+	6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12,
+	12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 14, 14, 13, 13,
+	13, 13, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1,
+	0, 71, 4, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 14, 14,
+	13, 13, 13, 12, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 7, 7,
+	7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 1, 1, 1,
+	1, 1, 13, 4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 1, 129, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 0, 131, 4, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 4, 1, 129, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 0, 0
+};
+
+#endif
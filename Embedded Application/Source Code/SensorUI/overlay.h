@@ -0,0 +1,363 @@
+/*
+
+ File        		: overlay.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the second LTDC layer, a small window
+									over the lean gauge that holds the needle. Its pixels are
+									ARGB4444 and the LTDC blends them over the frame buffer by
+									their alpha, so pixels left at OVERLAY_CLEAR show the gauge
+									underneath and the edges of an anti-aliased needle fade into
+									it. Moving the needle only rewrites the overlay, the gauge
+									ring and everything else on layer 1 are never drawn over or
+									repainted. The overlay has one buffer, so the main loop only
+									asks for the needle to move and the LTDC interrupt moves it
+									during the vertical blank, when nothing is being scanned out.
+
+*/
+
+#ifndef __OVERLAY_H
+#define __OVERLAY_H
+
+#include "main.h"
+
+// Window covering every position of the 128 pixel needle pivoting on (240, 272)
+#define OVERLAY_X 110
+#define OVERLAY_Y 142
+#define OVERLAY_WIDTH 260
+#define OVERLAY_HEIGHT (FB_HEIGHT - OVERLAY_Y)
+// Fully see-through, alpha 0
+#define OVERLAY_CLEAR 0x0000
+
+// Set to 1 to time the needle drawn as a line against the atlas images at start
+// up, see overlayBenchmark()
+#ifndef OVERLAY_BENCH
+#define OVERLAY_BENCH 0
+#endif
+
+typedef struct
+{
+	bool shown;
+	int x0, y0;             // Pivot
+	int x1, y1;             // Far end, for a needle drawn as a line
+	int sprite;             // Atlas image, -1 when the needle is a line
+	uint16_t colour;        // RGB565
+} OVERLAY_NEEDLE;
+
+typedef struct
+{
+	uint16_t *pixels;       // ARGB4444, whatever format the frame buffers are in
+	OVERLAY_NEEDLE needle;  // What is on screen
+	OVERLAY_NEEDLE next;    // What the next vertical blank will put on screen
+	volatile bool pending;  // 'next' is waiting for the vertical blank
+	uint32_t needleRedraws;  // Times the needle actually moved or changed colour
+	uint32_t needleCycles;   // CPU cycles the last redraw took
+	uint32_t needleMaxCycles;
+	uint32_t isrCycles;      // Redraw time and pixels since overlayCollect() last took them
+	uint32_t isrPixels;
+} OVERLAY;
+
+OVERLAY overlay;
+
+// Turns an RGB565 colour into an ARGB4444 one with 'alpha' from 0 to 15
+uint16_t overlayColour(uint32_t colour, uint32_t alpha)
+{
+	return (uint16_t)((alpha << 12) | ((colour >> 12) << 8) | (((colour >> 7) & 0xF) << 4) | ((colour >> 1) & 0xF));
+}
+
+// Sets up layer 2 as an alpha blended window, with its pixels straight after
+// the two frame buffers. Also starts the DWT cycle counter the needle is timed
+// with. Must be called after fbInit()
+void overlayInit(void)
+{
+	uint32_t ahbp = (LTDC->BPCR & LTDC_BPCR_AHBP) >> 16;
+	uint32_t avbp = LTDC->BPCR & LTDC_BPCR_AVBP;
+
+	overlay.pixels = (uint16_t *)(fbBuffer[0].pixels + (2 * FB_SIZE));
+	memset(&overlay.needle, 0, sizeof(overlay.needle));
+	overlay.needle.sprite = -1;
+	overlay.next = overlay.needle;
+	overlay.pending = false;
+	overlay.needleRedraws = 0;
+	overlay.needleMaxCycles = 0;
+	overlay.isrCycles = 0;
+	overlay.isrPixels = 0;
+	dma2dFill(overlay.pixels, OVERLAY_WIDTH, OVERLAY_WIDTH, OVERLAY_HEIGHT, OVERLAY_CLEAR, NULL);
+	dma2dWait();
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	// The window is given in LTDC timing coordinates, which start after the back porch
+	LTDC_Layer2->WHPCR = (OVERLAY_X + ahbp + 1) | ((OVERLAY_X + OVERLAY_WIDTH + ahbp) << 16);
+	LTDC_Layer2->WVPCR = (OVERLAY_Y + avbp + 1) | ((OVERLAY_Y + OVERLAY_HEIGHT + avbp) << 16);
+	LTDC_Layer2->PFCR = LTDC_PIXEL_FORMAT_ARGB4444;
+	LTDC_Layer2->CFBAR = (uint32_t)overlay.pixels;
+	LTDC_Layer2->CFBLR = ((OVERLAY_WIDTH * 2) << 16) | ((OVERLAY_WIDTH * 2) + 3);
+	LTDC_Layer2->CFBLNR = OVERLAY_HEIGHT;
+	LTDC_Layer2->CACR = 255;
+	LTDC_Layer2->DCCR = 0;
+	LTDC_Layer2->BFCR = LTDC_BLENDING_FACTOR1_PAxCA | LTDC_BLENDING_FACTOR2_PAxCA;
+	LTDC_Layer2->CR = LTDC_LxCR_LEN;
+	// Taken at the next vertical blank, along with paletteInit()'s change to layer 1
+	LTDC->SRCR = LTDC_SRCR_VBR;
+}
+
+// Sets one ARGB4444 overlay pixel, given in screen coordinates. Anything outside the window is ignored
+void overlayPutPixel(int x, int y, uint16_t colour)
+{
+	x -= OVERLAY_X;
+	y -= OVERLAY_Y;
+	if (x < 0 || y < 0 || x >= OVERLAY_WIDTH || y >= OVERLAY_HEIGHT)
+	{
+		return;
+	}
+	overlay.pixels[(y * OVERLAY_WIDTH) + x] = colour;
+	overlay.isrPixels++;
+}
+
+// Draws a line into the overlay in screen coordinates. Nothing but overlayInit()
+// uses DMA2D on the overlay, so there is nothing to wait for
+// Reference: https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+void overlayLine(int x0, int y0, int x1, int y1, uint16_t colour)
+{
+	int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+	int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+	int err = dx + dy, e2;
+
+	for (;;)
+	{
+		overlayPutPixel(x0, y0, colour);
+		if (x0 == x1 && y0 == y1)
+		{
+			break;
+		}
+		e2 = 2 * err;
+		if (e2 >= dy)
+		{
+			err += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx)
+		{
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+// Draws needle 'n' into the overlay, or wipes it back to OVERLAY_CLEAR when 'erase' is set
+void overlayDrawNeedle(const OVERLAY_NEEDLE *n, bool erase)
+{
+	if (n->sprite >= 0)
+	{
+		overlay.isrPixels += needleSpriteWrite(n->sprite, overlay.pixels, OVERLAY_WIDTH, OVERLAY_WIDTH,
+			OVERLAY_HEIGHT, n->x0 - OVERLAY_X, n->y0 - OVERLAY_Y, overlayColour(n->colour, 0), erase);
+	}
+	else
+	{
+		overlayLine(n->x0, n->y0, n->x1, n->y1, erase ? OVERLAY_CLEAR : overlayColour(n->colour, 15));
+	}
+}
+
+// Records how long a needle redraw took, from 'start' on the DWT cycle counter
+void overlayTimeNeedle(uint32_t start)
+{
+	overlay.needleCycles = DWT->CYCCNT - start;
+	if (overlay.needleCycles > overlay.needleMaxCycles)
+	{
+		overlay.needleMaxCycles = overlay.needleCycles;
+	}
+	overlay.isrCycles += overlay.needleCycles;
+	overlay.needleRedraws++;
+}
+
+// Called from the LTDC line interrupt at the start of the vertical blank. Layer 2
+// has a single buffer, so the needle is only ever moved here, where the LTDC isn't
+// reading it. The window starts well down the screen, so the redraw is long done
+// before the next frame's scan gets to it
+void overlayVblank(void)
+{
+	uint32_t start;
+
+	if (!overlay.pending)
+	{
+		return;
+	}
+	start = DWT->CYCCNT;
+	if (overlay.needle.shown)
+	{
+		overlayDrawNeedle(&overlay.needle, true);
+	}
+	if (overlay.next.shown)
+	{
+		overlayDrawNeedle(&overlay.next, false);
+	}
+	overlay.needle = overlay.next;
+	overlay.pending = false;
+	overlayTimeNeedle(start);
+}
+
+bool overlaySameNeedle(const OVERLAY_NEEDLE *a, const OVERLAY_NEEDLE *b)
+{
+	if (!a->shown || !b->shown)
+	{
+		return a->shown == b->shown;
+	}
+	return a->sprite == b->sprite && a->x0 == b->x0 && a->y0 == b->y0 && a->colour == b->colour &&
+		(a->sprite >= 0 || (a->x1 == b->x1 && a->y1 == b->y1));
+}
+
+// Asks for 'n' to be shown from the next vertical blank. A later request in the
+// same frame replaces it, and nothing happens if it is already what will show
+void overlayRequest(const OVERLAY_NEEDLE *n)
+{
+	if (overlaySameNeedle(n, &overlay.next))
+	{
+		return;
+	}
+	__disable_irq();
+	overlay.next = *n;
+	overlay.pending = !overlaySameNeedle(n, &overlay.needle);
+	__enable_irq();
+}
+
+// Shows the needle as a one pixel line from (x0, y0) to (x1, y1) in RGB565 'colour'
+void overlayNeedle(int x0, int y0, int x1, int y1, uint32_t colour)
+{
+	OVERLAY_NEEDLE n;
+
+	n.shown = true;
+	n.x0 = x0;
+	n.y0 = y0;
+	n.x1 = x1;
+	n.y1 = y1;
+	n.sprite = -1;
+	n.colour = (uint16_t)colour;
+	overlayRequest(&n);
+}
+
+// Shows atlas image 'index' with its pivot on (x, y) in RGB565 'colour'. Costs the
+// same at every angle
+void overlayNeedleSprite(int x, int y, int index, uint32_t colour)
+{
+	OVERLAY_NEEDLE n;
+
+	n.shown = true;
+	n.x0 = x;
+	n.y0 = y;
+	n.x1 = x;
+	n.y1 = y;
+	n.sprite = index;
+	n.colour = (uint16_t)colour;
+	overlayRequest(&n);
+}
+
+// Takes the needle off screen, used while the settings screen is showing
+void overlayHideNeedle(void)
+{
+	OVERLAY_NEEDLE n;
+
+	memset(&n, 0, sizeof(n));
+	n.sprite = -1;
+	overlayRequest(&n);
+}
+
+// Adds the pixels the interrupt wrote to fbPixelWrites and returns the cycles it
+// spent redrawing, both since the last call. Used by the performance overlay
+uint32_t overlayCollect(void)
+{
+	uint32_t cycles;
+
+	__disable_irq();
+	cycles = overlay.isrCycles;
+	fbPixelWrites += overlay.isrPixels;
+	overlay.isrCycles = 0;
+	overlay.isrPixels = 0;
+	__enable_irq();
+	return cycles;
+}
+
+#if OVERLAY_BENCH
+
+typedef struct
+{
+	uint32_t calls;
+	uint32_t lineCycles;     // Time per needle update, wiping the last line and drawing the next
+	uint32_t spriteCycles;   // The same with the atlas images
+	uint32_t linePixels;     // Overlay pixels written per update
+	uint32_t spritePixels;
+} OVERLAY_BENCH_STATS;
+
+OVERLAY_BENCH_STATS overlayBenchStats;
+
+// Sweeps a 'length' pixel needle pivoting on (x, y) from -90 to 90 degrees a degree
+// at a time and times each update, wiping the last needle and drawing the next, with
+// the DWT. 'sprites' picks the atlas images rather than lines. Returns the total
+// cycles and adds the updates and pixels to 'calls' and 'pixels'
+uint32_t overlayBenchSweep(int x, int y, int length, bool sprites, uint32_t *calls, uint32_t *pixels)
+{
+	OVERLAY_NEEDLE last, n;
+	uint32_t start, cycles = 0;
+	int angle, step;
+
+	memset(&last, 0, sizeof(last));
+	memset(&n, 0, sizeof(n));
+	overlay.isrPixels = 0;
+	for (angle = -NEEDLE_MAX_ANGLE; angle <= NEEDLE_MAX_ANGLE; angle++)
+	{
+		step = angle * SINE_STEPS_PER_DEGREE;
+		n.shown = true;
+		n.x0 = x;
+		n.y0 = y;
+		n.x1 = x + sineScale(length, sinQ15(step));
+		n.y1 = y + sineScale(length, -cosQ15(step));
+		n.sprite = sprites ? needleSpriteIndex(step) : -1;
+		n.colour = 0xFFFF;
+		if (sprites && (length != NEEDLE_LENGTH || !needleSpriteReady(n.sprite)))
+		{
+			continue;
+		}
+
+		start = DWT->CYCCNT;
+		if (last.shown)
+		{
+			overlayDrawNeedle(&last, true);
+		}
+		overlayDrawNeedle(&n, false);
+		cycles += DWT->CYCCNT - start;
+		last = n;
+		(*calls)++;
+	}
+	*pixels += overlay.isrPixels;
+	overlay.isrPixels = 0;
+	if (last.shown)
+	{
+		overlayDrawNeedle(&last, true);
+	}
+	return cycles;
+}
+
+// Times needle updates drawn as lines against the atlas images. Run at start up
+// before the needle is first shown, the overlay is left clear
+void overlayBenchmark(int x, int y, int length)
+{
+	uint32_t lineCalls = 0, spriteCalls = 0, linePixels = 0, spritePixels = 0, lineCycles, spriteCycles;
+
+	memset(&overlayBenchStats, 0, sizeof(overlayBenchStats));
+	lineCycles = overlayBenchSweep(x, y, length, false, &lineCalls, &linePixels);
+	spriteCycles = overlayBenchSweep(x, y, length, true, &spriteCalls, &spritePixels);
+	overlayBenchStats.calls = lineCalls;
+	if (lineCalls != 0 && spriteCalls != 0)
+	{
+		overlayBenchStats.lineCycles = lineCycles / lineCalls;
+		overlayBenchStats.linePixels = linePixels / lineCalls;
+		overlayBenchStats.spriteCycles = spriteCycles / spriteCalls;
+		overlayBenchStats.spritePixels = spritePixels / spriteCalls;
+	}
+}
+
+#endif
+
+#endif
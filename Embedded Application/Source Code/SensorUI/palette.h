@@ -0,0 +1,159 @@
+/*
+
+ File        		: palette.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the colours the screens are drawn in.
+									Normally the frame buffers hold RGB565 pixels and the named
+									colours below are RGB565 values. With HUD_USE_CLUT set to 1
+									the frame buffers hold one byte per pixel instead, the LTDC
+									turns each byte into a colour through its look-up table, and
+									the named colours are indexes into that table. The main
+									screen is drawn in the two theme entries, so changing the
+									colour scheme only reloads those two entries and no pixels
+									are written at all.
+
+*/
+
+#ifndef __PALETTE_H
+#define __PALETTE_H
+
+#include "main.h"
+
+// Set to 1 for 8-bit indexed (L8) frame buffers
+#ifndef HUD_USE_CLUT
+#define HUD_USE_CLUT 0
+#endif
+
+// Entries in the LTDC look-up table
+#define PALETTE_SIZE 256
+
+#if HUD_USE_CLUT
+typedef uint8_t FB_PIXEL;
+
+#define HUD_BLACK 0
+#define HUD_WHITE 1
+#define HUD_CYAN 2
+#define HUD_MAGENTA 3
+#define HUD_RED 4
+#define HUD_HIGHLIGHT 5
+// Background and foreground of the main screen, set by paletteSetTheme()
+#define HUD_THEME_BACK 6
+#define HUD_THEME_FORE 7
+#else
+typedef uint16_t FB_PIXEL;
+
+#define HUD_BLACK GLCD_COLOR_BLACK
+#define HUD_WHITE GLCD_COLOR_WHITE
+#define HUD_CYAN 0x07F9
+#define HUD_MAGENTA GLCD_COLOR_MAGENTA
+#define HUD_RED 0xFA20
+#define HUD_HIGHLIGHT 0x033F
+#define HUD_THEME_BACK paletteTheme[0]
+#define HUD_THEME_FORE paletteTheme[1]
+#endif
+
+typedef struct
+{
+	uint32_t themeChanges;   // Times paletteSetTheme() changed a colour
+	uint32_t entriesLoaded;  // Look-up table entries written to the LTDC
+} PALETTE_STATS;
+
+// RGB565 colour of every entry, only the ones the named colours use are set
+uint16_t paletteRGB[PALETTE_SIZE] =
+{
+	GLCD_COLOR_BLACK, GLCD_COLOR_WHITE, 0x07F9, GLCD_COLOR_MAGENTA, 0xFA20, 0x033F,
+	GLCD_COLOR_BLACK, GLCD_COLOR_WHITE
+};
+// Current theme colours in RGB565
+uint16_t paletteTheme[2] = {GLCD_COLOR_BLACK, GLCD_COLOR_WHITE};
+PALETTE_STATS paletteStats;
+// Range of entries changed since they were last written to the LTDC, empty when first > last
+volatile int paletteFirstDirty = 0;
+volatile int paletteLastDirty = PALETTE_SIZE - 1;
+
+// RGB565 colour that a pixel value stands for, for anything that isn't drawn into
+// the frame buffers, such as the overlay
+uint16_t paletteToRGB565(uint32_t colour)
+{
+#if HUD_USE_CLUT
+	return paletteRGB[colour & (PALETTE_SIZE - 1)];
+#else
+	return (uint16_t)colour;
+#endif
+}
+
+// Writes the changed entries into the LTDC look-up table. Called from the vertical
+// blank interrupt so a colour never changes part way down the panel
+void paletteLoad(void)
+{
+#if HUD_USE_CLUT
+	int i;
+
+	for (i = paletteFirstDirty; i <= paletteLastDirty; i++)
+	{
+		LTDC_Layer1->CLUTWR = ((uint32_t)i << 24) | dma2dRGB888(paletteRGB[i]);
+		paletteStats.entriesLoaded++;
+	}
+	paletteFirstDirty = PALETTE_SIZE;
+	paletteLastDirty = -1;
+#endif
+}
+
+// Changes one entry, which reaches the screen at the next vertical blank
+void paletteSet(int index, uint16_t colour)
+{
+	if (paletteRGB[index] == colour)
+	{
+		return;
+	}
+	paletteRGB[index] = colour;
+	__disable_irq();
+	if (index < paletteFirstDirty)
+	{
+		paletteFirstDirty = index;
+	}
+	if (index > paletteLastDirty)
+	{
+		paletteLastDirty = index;
+	}
+	__enable_irq();
+}
+
+// Sets the main screen colours. In CLUT mode this reloads the two theme entries,
+// otherwise the new colours are used for whatever is drawn next
+void paletteSetTheme(uint16_t back, uint16_t fore)
+{
+	if (paletteTheme[0] == back && paletteTheme[1] == fore)
+	{
+		return;
+	}
+	paletteTheme[0] = back;
+	paletteTheme[1] = fore;
+#if HUD_USE_CLUT
+	paletteSet(HUD_THEME_BACK, back);
+	paletteSet(HUD_THEME_FORE, fore);
+#endif
+	paletteStats.themeChanges++;
+}
+
+// Switches layer 1 over to L8 pixels with a stride of one byte a pixel and marks the
+// whole table to be loaded. Both happen at the next vertical blank, the layer when the
+// LTDC reloads it and the table when the interrupt calls paletteLoad(), so the panel
+// never shows a part frame in the wrong format. Must be called before anything is drawn
+void paletteInit(void)
+{
+#if HUD_USE_CLUT
+	__disable_irq();
+	paletteFirstDirty = 0;
+	paletteLastDirty = PALETTE_SIZE - 1;
+	__enable_irq();
+	LTDC_Layer1->PFCR = LTDC_PIXEL_FORMAT_L8;
+	LTDC_Layer1->CFBLR = (GLCD_WIDTH << 16) | (GLCD_WIDTH + 3);
+	LTDC_Layer1->CR |= LTDC_LxCR_CLUTEN;
+	LTDC->SRCR = LTDC_SRCR_VBR;
+#endif
+}
+
+#endif
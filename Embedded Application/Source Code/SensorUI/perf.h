@@ -0,0 +1,173 @@
+/*
+
+ File        		: perf.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the performance overlay. The main loop
+									times each stage of a frame with the DWT cycle counter and
+									the results are kept in perfStats. Tapping the free corner
+									between the left chevrons and the temperature dial shows
+									them on screen in the 6x8 font, along with the frame rate
+									and the pixels written each frame. The numbers on screen
+									are only refreshed a few times a second, and then only the
+									characters that changed are drawn, so the overlay costs very
+									little of the frame.
+
+*/
+
+#ifndef __PERF_H
+#define __PERF_H
+
+#include "main.h"
+
+// Set to 1 to show the overlay from start up
+#ifndef PERF_OVERLAY_SHOWN
+#define PERF_OVERLAY_SHOWN 0
+#endif
+
+// Corner of the main screen the overlay is drawn in, clear of every widget
+#define PERF_X 90
+#define PERF_Y 4
+#define PERF_LINE_HEIGHT 10
+#define PERF_LINES (PERF_STAGES + 2)
+#define PERF_WIDTH (11 * 6)
+#define PERF_HEIGHT (PERF_LINES * PERF_LINE_HEIGHT)
+// Frames between updates of the numbers on screen
+#define PERF_REFRESH_FRAMES 15
+
+typedef enum
+{
+	PERF_IMU_READ,      // Reading the accelerometer and gyro over I2C
+	PERF_CONVERT,       // Fusing the samples into the angles
+	PERF_NEEDLE,        // Moving the lean needle
+	PERF_CHEVRONS,      // Working out and drawing both chevron bars
+	PERF_ENCODERS,      // Reading the rotary encoders
+	PERF_TEMPERATURE,   // Updating the temperature reading
+	PERF_OVERLAY,       // Drawing this overlay
+	PERF_STAGES
+} PERF_STAGE;
+
+typedef struct
+{
+	uint32_t cycles[PERF_STAGES];     // Time each stage took in the last frame
+	uint32_t maxCycles[PERF_STAGES];
+	uint32_t frames;
+	uint32_t fpsTenths;               // Frames a second, times ten
+	uint32_t pixelsPerFrame;          // Frame buffer and overlay pixels written by the last frame
+	bool shown;
+} PERF_STATS;
+
+PERF_STATS perfStats;
+// Cycles added up so far this frame
+uint32_t perfAccum[PERF_STAGES];
+TEXT_SLOT perfSlots[PERF_LINES];
+uint32_t perfLastPixels = 0;
+uint32_t perfWindowFrames = 0;
+uint32_t perfWindowStart = 0;
+
+const char *const perfNames[PERF_STAGES] = {"imu", "cnv", "ndl", "chv", "enc", "tmp", "ovl"};
+
+void perfInit(void)
+{
+	int i;
+
+	memset(&perfStats, 0, sizeof(perfStats));
+	memset(perfAccum, 0, sizeof(perfAccum));
+	for (i = 0; i < PERF_LINES; i++)
+	{
+		textSlotInit(&perfSlots[i], PERF_X, PERF_Y + (i * PERF_LINE_HEIGHT), 0);
+		perfSlots[i].font = &GLCD_Font_6x8;
+	}
+	perfStats.shown = PERF_OVERLAY_SHOWN;
+	perfLastPixels = fbPixelWrites;
+	perfWindowStart = HAL_GetTick();
+}
+
+// Adds the time since 'start' on the DWT cycle counter to a stage
+void perfRecord(PERF_STAGE stage, uint32_t start)
+{
+	perfAccum[stage] += DWT->CYCCNT - start;
+}
+
+// Adds cycles that were timed somewhere else to a stage, such as a widget's render
+void perfAdd(PERF_STAGE stage, uint32_t cycles)
+{
+	perfAccum[stage] += cycles;
+}
+
+// Shows or hides the overlay. Hiding it paints the corner back in the theme background
+void perfToggle(void)
+{
+	int i;
+
+	perfStats.shown = !perfStats.shown;
+	if (!perfStats.shown)
+	{
+		fbFillRect(PERF_X, PERF_Y, PERF_WIDTH, PERF_HEIGHT, HUD_THEME_BACK);
+	}
+	// Whatever the slots showed is gone, or has to be drawn again
+	for (i = 0; i < PERF_LINES; i++)
+	{
+		perfSlots[i].generation = 0;
+	}
+}
+
+// Draws the numbers, only the characters that changed since the last time
+void perfDraw(void)
+{
+	char buffer[TEXT_SLOT_MAX + 1];
+	uint32_t perMicro = SystemCoreClock / 1000000;
+	int i;
+
+	sprintf(buffer, "fps%6lu.%lu", (unsigned long)(perfStats.fpsTenths / 10), (unsigned long)(perfStats.fpsTenths % 10));
+	textSlotDraw(&perfSlots[0], buffer, HUD_THEME_FORE, HUD_THEME_BACK);
+	sprintf(buffer, "pix%8lu", (unsigned long)perfStats.pixelsPerFrame);
+	textSlotDraw(&perfSlots[1], buffer, HUD_THEME_FORE, HUD_THEME_BACK);
+	for (i = 0; i < PERF_STAGES; i++)
+	{
+		sprintf(buffer, "%s%6luus", perfNames[i], (unsigned long)(perfStats.cycles[i] / perMicro));
+		textSlotDraw(&perfSlots[i + 2], buffer, HUD_THEME_FORE, HUD_THEME_BACK);
+	}
+}
+
+// Ends the frame's timings and draws the overlay if it is shown. Called after
+// widgetsRender() and before fbPresent(), so the overlay is part of the frame.
+// Its own time and pixels are counted in the next frame
+void perfFrame(void)
+{
+	uint32_t start = DWT->CYCCNT, now = HAL_GetTick();
+	int i;
+
+	for (i = 0; i < PERF_STAGES; i++)
+	{
+		perfStats.cycles[i] = perfAccum[i];
+		if (perfAccum[i] > perfStats.maxCycles[i])
+		{
+			perfStats.maxCycles[i] = perfAccum[i];
+		}
+		perfAccum[i] = 0;
+	}
+	perfStats.pixelsPerFrame = fbPixelWrites - perfLastPixels;
+	perfLastPixels = fbPixelWrites;
+	perfStats.frames++;
+
+	// Frame rate over about a second at a time
+	perfWindowFrames++;
+	if (now - perfWindowStart >= 1000)
+	{
+		perfStats.fpsTenths = (perfWindowFrames * 10000) / (now - perfWindowStart);
+		perfWindowFrames = 0;
+		perfWindowStart = now;
+	}
+
+	// Also drawn straight away when the screen behind it has been repainted
+	if (perfStats.shown && (perfStats.frames % PERF_REFRESH_FRAMES == 0 ||
+		perfSlots[0].generation != textGeneration))
+	{
+		perfDraw();
+		perfRecord(PERF_OVERLAY, start);
+	}
+}
+
+#endif
@@ -0,0 +1,117 @@
+/*
+
+ File        		: raster.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file that fills convex polygons one horizontal span
+									per row. A pixel belongs to the polygon when its centre is
+									inside, so two polygons that share an edge never write the
+									same pixel twice.
+
+*/
+
+#ifndef __RASTER_H
+#define __RASTER_H
+
+#include "main.h"
+
+// Most corners a polygon passed to rasterConvex() can have
+#define RASTER_MAX_POINTS 8
+
+typedef struct
+{
+	int x, y;
+} RASTER_POINT;
+
+// One entry of the edge table, x is 16.16 fixed point at the centre of the current row
+typedef struct
+{
+	int yStart, yEnd;
+	int32_t x, slope;
+} RASTER_EDGE;
+
+// Called with the pixels x0 up to (but not including) x1 on row y
+typedef void (*RASTER_SPAN)(int y, int x0, int x1);
+
+// Walks a convex polygon from top to bottom, handing each row's span to 'span'.
+// Corners can be given in either direction
+void rasterConvex(const RASTER_POINT *pts, int n, RASTER_SPAN span)
+{
+	RASTER_EDGE edges[RASTER_MAX_POINTS];
+	const RASTER_POINT *a, *b, *t;
+	int numEdges = 0, yMin, yMax, y, i;
+	int32_t left, right;
+
+	if (n < 3 || n > RASTER_MAX_POINTS)
+	{
+		return;
+	}
+
+	// Build the edge table, horizontal edges never cross a row centre so are left out
+	yMin = pts[0].y;
+	yMax = pts[0].y;
+	for (i = 0; i < n; i++)
+	{
+		a = &pts[i];
+		b = &pts[(i + 1) % n];
+		if (a->y < yMin)
+			yMin = a->y;
+		if (a->y > yMax)
+			yMax = a->y;
+		if (a->y == b->y)
+		{
+			continue;
+		}
+		if (a->y > b->y)
+		{
+			t = a;
+			a = b;
+			b = t;
+		}
+		edges[numEdges].yStart = a->y;
+		edges[numEdges].yEnd = b->y;
+		// Multiplied rather than shifted up, x can be negative and shifting that left is undefined
+		edges[numEdges].slope = ((int32_t)(b->x - a->x) * 65536) / (b->y - a->y);
+		edges[numEdges].x = ((int32_t)a->x * 65536) + (edges[numEdges].slope / 2);
+		numEdges++;
+	}
+
+	for (y = yMin; y < yMax; y++)
+	{
+		left = 0x7FFFFFFF;
+		right = -0x7FFFFFFF;
+		for (i = 0; i < numEdges; i++)
+		{
+			if (y >= edges[i].yStart && y < edges[i].yEnd)
+			{
+				if (edges[i].x < left)
+					left = edges[i].x;
+				if (edges[i].x > right)
+					right = edges[i].x;
+				edges[i].x += edges[i].slope;
+			}
+		}
+		// Pixels whose centres are from 'left' up to 'right'
+		left = (left + 0x7FFF) >> 16;
+		right = (right + 0x7FFF) >> 16;
+		if (right > left)
+		{
+			span(y, (int)left, (int)right);
+		}
+	}
+}
+
+// Span filler for rasterConvex() in the current colour
+void rasterFillSpan(int y, int x0, int x1)
+{
+	fbFillSpan(x0, y, x1 - x0, fbColour);
+}
+
+void rasterFillConvex(const RASTER_POINT *pts, int n, uint32_t colour)
+{
+	fbSetColour(colour);
+	rasterConvex(pts, n, rasterFillSpan);
+}
+
+#endif
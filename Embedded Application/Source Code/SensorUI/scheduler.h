@@ -0,0 +1,122 @@
+/*
+
+ File        		: scheduler.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the frame scheduler. The main loop runs
+									once every FRAME_VBLANKS vertical blanks of the LTDC, so
+									the HUD updates at a steady rate locked to the panel. Each
+									frame reads the sensors first and then draws, and whatever
+									time is left before the next frame is due is spent asleep
+									in WFI until the LTDC line interrupt wakes the core. Frame
+									time, jitter and overruns are timed with the DWT cycle
+									counter.
+
+*/
+
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+#include "main.h"
+
+// Vertical blanks per frame, 1 runs at the panel's rate of about 60 Hz and 2 at about 30 Hz
+#ifndef FRAME_VBLANKS
+#define FRAME_VBLANKS 2
+#endif
+
+typedef struct
+{
+	uint32_t frames;
+	uint32_t overruns;       // Frames that weren't finished by the time the next one was due
+	uint32_t skipped;        // Frames left out because of overruns
+	uint32_t periodCycles;   // Time from the start of the last frame to the start of this one
+	uint32_t targetCycles;   // What that should be, FRAME_VBLANKS times the measured vertical blank period
+	uint32_t jitterCycles;   // Difference between the two
+	uint32_t maxJitterCycles;
+	uint32_t sampleCycles;   // Time the last frame spent reading the sensors
+	uint32_t renderCycles;   // Time the last frame spent drawing and presenting
+	uint32_t maxBusyCycles;  // Longest sample and render phases together
+	uint32_t sleepCycles;    // Time spent asleep waiting for the last frame to be due
+} FRAME_STATS;
+
+FRAME_STATS frameStats;
+// Vertical blank the next frame is due on
+uint32_t frameDue;
+// DWT cycle counts at the start of the frame and of its render phase
+uint32_t frameStart, frameRenderStart;
+bool frameStarted = false;
+
+// Starts the schedule again from the next vertical blank, without counting the gap
+// as an overrun. Used at start up and after anything that stalls the loop on purpose,
+// such as the settings screen
+void frameResync(void)
+{
+	frameDue = fbVblanks + 1;
+	frameStarted = false;
+}
+
+// Sleeps until the next frame is due, then starts it. Frames that are already late
+// start straight away and the schedule moves on to the next whole frame period
+void frameWait(void)
+{
+	uint32_t sleep = DWT->CYCCNT, now, late;
+
+	// Each LTDC line interrupt wakes the core, as does the SysTick. Interrupts are held
+	// off from the check to the sleep, so a vertical blank in between is left pending
+	// and ends the WFI straight away instead of waiting for the next SysTick
+	__disable_irq();
+	while ((int32_t)(fbVblanks - frameDue) < 0)
+	{
+		__WFI();
+		__enable_irq();
+		__disable_irq();
+	}
+	__enable_irq();
+	now = DWT->CYCCNT;
+	frameStats.sleepCycles = now - sleep;
+
+	late = fbVblanks - frameDue;
+	if (late > 0)
+	{
+		frameStats.overruns++;
+		frameStats.skipped += late / FRAME_VBLANKS;
+	}
+	frameDue = fbVblanks + FRAME_VBLANKS;
+
+	if (frameStarted)
+	{
+		frameStats.periodCycles = now - frameStart;
+		frameStats.targetCycles = FRAME_VBLANKS * fbVblankCycles;
+		frameStats.jitterCycles = frameStats.periodCycles > frameStats.targetCycles ?
+			frameStats.periodCycles - frameStats.targetCycles : frameStats.targetCycles - frameStats.periodCycles;
+		if (frameStats.jitterCycles > frameStats.maxJitterCycles)
+		{
+			frameStats.maxJitterCycles = frameStats.jitterCycles;
+		}
+	}
+	frameStart = now;
+	frameStarted = true;
+}
+
+// Marks the end of the sample phase and the start of the render phase
+void frameSampled(void)
+{
+	frameRenderStart = DWT->CYCCNT;
+	frameStats.sampleCycles = frameRenderStart - frameStart;
+}
+
+// Marks the end of the frame, once it has been presented
+void frameDone(void)
+{
+	uint32_t now = DWT->CYCCNT;
+
+	frameStats.renderCycles = now - frameRenderStart;
+	if (now - frameStart > frameStats.maxBusyCycles)
+	{
+		frameStats.maxBusyCycles = now - frameStart;
+	}
+	frameStats.frames++;
+}
+
+#endif
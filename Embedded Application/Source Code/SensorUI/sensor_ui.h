@@ -39,69 +39,116 @@ int* getDigits(int num)
 // Function to remove the need to change colours in separate command
 void drawRectangle(int x, int y, int dx, int dy, uint32_t colour)
 {
-	GLCD_SetForegroundColor(colour);
-	GLCD_DrawRectangle(x, y, dx, dy);
-	GLCD_DrawPixel(x+dx, y+dy);
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
+	if (dlCapture(DL_RECTANGLE, x, y, dx, dy, colour, 0, NULL))
+	{
+		return;
+	}
+	fbSync();
+	fbSetColour(colour);
+	fbDrawRectangle(x, y, dx, dy);
+	fbPutPixel(x+dx, y+dy);
+	fbSetColour(HUD_BLACK);
+	fbMarkDamage(x, y, dx+1, dy+1);
 }
 
-// Function to remove the need to change foreground and background colours in separate command
+// Function to remove the need to change foreground and background colours in separate command.
+// The characters come out of the glyph cache already in these colours
 void drawString(int x, int y, char buffer[128], uint32_t foreColour, uint32_t backColour)
 {
-	GLCD_SetForegroundColor(foreColour);
-	GLCD_SetBackgroundColor(backColour);
-	GLCD_DrawString(x, y, buffer);
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
-	GLCD_SetBackgroundColor(GLCD_COLOR_WHITE);
+	if (dlCapture(DL_STRING, x, y, 0, 0, foreColour, backColour, buffer))
+	{
+		return;
+	}
+	textDrawString(x, y, buffer, foreColour, backColour);
 }
 
-// Draws the foundation of a circle using the center value and radius values
-void drawCircleFoundation(int centerX, int centerY, int distX, int distY)
+// Draws the part of a circle between rows 'yMin' and 'yMax' (not included)
+void drawCircleRows(int centerX, int centerY, int radius, int yMin, int yMax, uint32_t colour)
 {
-	GLCD_DrawPixel(centerX - distX, centerY - distY);
-	GLCD_DrawPixel(centerX + distX, centerY - distY);
-	GLCD_DrawPixel(centerX - distX, centerY + distY);
-	GLCD_DrawPixel(centerX + distX, centerY + distY);
-	GLCD_DrawPixel(centerX - distY, centerY - distX);
-	GLCD_DrawPixel(centerX + distY, centerY - distX);
-	GLCD_DrawPixel(centerX - distY, centerY + distX);
-	GLCD_DrawPixel(centerX + distY, centerY + distX);
+	int top = centerY - radius > yMin ? centerY - radius : yMin;
+	int bottom = centerY + radius + 1 < yMax ? centerY + radius + 1 : yMax;
+
+	fbSync();
+	fbSetColour(colour);
+	fbMarkDamage(centerX - radius, top, (2 * radius) + 1, bottom - top);
+	circleDrawRows(centerX, centerY, radius, yMin, yMax);
+	fbSetColour(HUD_BLACK);
 }
 
-// Drawing circles for the temperature and gyrometer displays
+// Drawing circles for the temperature and gyrometer displays. Only the rows
+// that are on screen are drawn, so the lean gauge skips its bottom half
 void drawCircle(int centerX, int centerY, int radius, uint32_t colour)
 {
-	// Drawing circle using Bresenham's circle algorithm
-// Reference = https://www.geeksforgeeks.org/bresenhams-circle-drawing-algorithm/
-	int x = 0, y = radius, dp = 3 - (2 * radius);
-	GLCD_SetForegroundColor(colour);
-	drawCircleFoundation(centerX, centerY, x, y);
-	while (y >= x)
-	{
-		// For every pixel drawn in 'drawCircleFoundation', 8 pixels will be drawn
-		x++;
-		
-		// Checks decision parameter and correspondingly updates d, x and y
-		if (dp > 0)
-		{
-			y--;
-			dp = dp + (4 * (x - y)) + 10;
-		}
-		else
-		{
-			dp = dp + (4 * x) + 6;
-		}
-			drawCircleFoundation(centerX, centerY, x, y);
+	if (dlCapture(DL_CIRCLE, centerX, centerY, radius, 0, colour, 0, NULL))
+	{
+		return;
+	}
+	drawCircleRows(centerX, centerY, radius, 0, FB_HEIGHT, colour);
+}
+
+// Cohen-Sutherland outcode of a point, one bit for each side of the clip it is past
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+
+int clipOutcode(int x, int y)
+{
+	int code = 0;
+
+	if (x < fbClip.x0)
+		code |= CLIP_LEFT;
+	else if (x >= fbClip.x1)
+		code |= CLIP_RIGHT;
+	if (y < fbClip.y0)
+		code |= CLIP_TOP;
+	else if (y >= fbClip.y1)
+		code |= CLIP_BOTTOM;
+	return code;
+}
+
+// Division rounding down and up, for a positive 'b'
+int divFloor(int a, int b)
+{
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+int divCeil(int a, int b)
+{
+	return -divFloor(-a, b);
+}
+
+// Cuts the steps 'first' to 'last' of a Bresenham line down to the ones whose offset
+// across the line is from 'lo' to 'hi'. Step k of a line 'dMajor' long that moves
+// 'dMinor' across is floor((2*dMinor*k + dMajor - 1) / (2*dMajor)) across, so the
+// steps where it crosses the edges of the clip can be found without walking the line
+void clipLineSteps(int dMajor, int dMinor, int lo, int hi, int *first, int *last)
+{
+	int lower, upper;
+
+	if (dMinor == 0)
+	{
+		lower = lo <= 0 ? *first : *last + 1;
+		upper = hi >= 0 ? *last : *first - 1;
+	}
+	else
+	{
+		lower = divCeil((2 * dMajor * lo) - dMajor + 1, 2 * dMinor);
+		upper = divFloor((2 * dMajor * (hi + 1)) - dMajor, 2 * dMinor);
 	}
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
+	if (lower > *first)
+		*first = lower;
+	if (upper < *last)
+		*last = upper;
 }
 
-// Drawing a diagonal line for the chevrons and gyrometer arrow
+// Drawing a diagonal line for the chevrons and gyrometer arrow. Only the steps
+// inside the clip are walked, starting part way along when the line begins outside
 void drawDiagonalLineLow(int x0, int y0, int x1, int y1)
 {
 	// Drawing a line using the Bresenham's line algorithm
 	// Reference: https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
-	int dx, dy, yi, D, x, y;
+	int dx, dy, yi, D, x, y, first, last, across;
 	dx = x1 - x0;
 	dy = y1 - y0;
 	yi = 1;
@@ -110,13 +157,31 @@ void drawDiagonalLineLow(int x0, int y0, int x1, int y1)
 		yi = -1;
 		dy = -dy;
 	}
+	if (dx <= 0)
+	{
+		return;
+	}
+	
+	first = fbClip.x0 - x0 > 0 ? fbClip.x0 - x0 : 0;
+	last = fbClip.x1 - 1 - x0 < dx - 1 ? fbClip.x1 - 1 - x0 : dx - 1;
+	if (yi > 0)
+		clipLineSteps(dx, dy, fbClip.y0 - y0, fbClip.y1 - 1 - y0, &first, &last);
+	else
+		clipLineSteps(dx, dy, y0 - (fbClip.y1 - 1), y0 - fbClip.y0, &first, &last);
+	if (first > last)
+	{
+		fbClipStats.pixels += dx;
+		return;
+	}
+	fbClipStats.pixels += dx - (last - first + 1);
 	
-	D = (2 * dy) - dx;
-	y = y0;
+	across = ((2 * dy * first) + dx - 1) / (2 * dx);
+	D = (2 * dy) - dx + (2 * dy * first) - (2 * dx * across);
+	y = y0 + (yi * across);
 
-	for (x = x0; x < x1; x++)
+	for (x = x0 + first; x <= x0 + last; x++)
 	{
-		GLCD_DrawPixel(x, y);
+		fbPutPixel(x, y);
 		if (D > 0)
 		{
 			y = y + yi;
@@ -133,7 +198,7 @@ void drawDiagonalLineHigh(int x0, int y0, int x1, int y1)
 {
 	// Drawing a line using the Bresenham's line algorithm
 	// Reference: https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
-	int dx, dy, xi, D, x, y;
+	int dx, dy, xi, D, x, y, first, last, across;
 	dx = x1 - x0;
 	dy = y1 - y0;
 	xi = 1;
@@ -142,12 +207,31 @@ void drawDiagonalLineHigh(int x0, int y0, int x1, int y1)
 		xi = -1;
 		dx = -dx;
 	}
-	D = (2 * dx) - dy;
-	x = x0;
+	if (dy <= 0)
+	{
+		return;
+	}
+	
+	first = fbClip.y0 - y0 > 0 ? fbClip.y0 - y0 : 0;
+	last = fbClip.y1 - 1 - y0 < dy - 1 ? fbClip.y1 - 1 - y0 : dy - 1;
+	if (xi > 0)
+		clipLineSteps(dy, dx, fbClip.x0 - x0, fbClip.x1 - 1 - x0, &first, &last);
+	else
+		clipLineSteps(dy, dx, x0 - (fbClip.x1 - 1), x0 - fbClip.x0, &first, &last);
+	if (first > last)
+	{
+		fbClipStats.pixels += dy;
+		return;
+	}
+	fbClipStats.pixels += dy - (last - first + 1);
+	
+	across = ((2 * dx * first) + dy - 1) / (2 * dy);
+	D = (2 * dx) - dy + (2 * dx * first) - (2 * dy * across);
+	x = x0 + (xi * across);
 
-	for (y = y0; y < y1; y++)
+	for (y = y0 + first; y <= y0 + last; y++)
 	{
-		GLCD_DrawPixel(x, y);
+		fbPutPixel(x, y);
 		if (D > 0)
 		{
 			x = x + xi;
@@ -160,12 +244,22 @@ void drawDiagonalLineHigh(int x0, int y0, int x1, int y1)
 	}
 }
 				
-void drawDiagonalLine(int x0, int y0, int x1, int y1, uint32_t colour)
+// Draws a line in the current colour without marking any damage. A line with
+// both ends past the same side of the clip is thrown out straight away
+void drawLineSegment(int x0, int y0, int x1, int y1)
 {
-	GLCD_SetForegroundColor(colour);
+	int dx = abs(x1 - x0), dy = abs(y1 - y0);
+
+	if (clipOutcode(x0, y0) & clipOutcode(x1, y1))
+	{
+		fbClipStats.rejected++;
+		fbClipStats.pixels += dx > dy ? dx : dy;
+		return;
+	}
+
 	// These statements insure that the correct variation of the Bresenham's
 	// line algorithm is used for given starting and ending points
-	if (abs(y1 - y0) < abs(x1 - x0))
+	if (dy < dx)
 	{
 		if (x0 > x1)
 		{
@@ -187,84 +281,140 @@ void drawDiagonalLine(int x0, int y0, int x1, int y1, uint32_t colour)
 			drawDiagonalLineHigh(x0, y0, x1, y1);
 		}
 	}
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
 }
 
-// Draws a chevron relative to the starting x value.
+void drawDiagonalLine(int x0, int y0, int x1, int y1, uint32_t colour)
+{
+	if (dlCapture(DL_LINE, x0, y0, x1, y1, colour, 0, NULL))
+	{
+		return;
+	}
+	fbSync();
+	fbSetColour(colour);
+	fbMarkLineDamage(x0, y0, x1, y1);
+	drawLineSegment(x0, y0, x1, y1);
+	fbSetColour(HUD_BLACK);
+}
+
+// Span handler that only draws the two ends of each row, plus the whole of
+// the top and bottom rows, giving the chevron's outline
+void chevronOutlineSpan(int y, int x0, int x1)
+{
+	if (y == 0 || y == FB_HEIGHT - 1)
+	{
+		fbDrawHLine(x0, y, x1 - x0);
+		return;
+	}
+	fbPutPixel(x0, y);
+	fbPutPixel(x1 - 1, y);
+}
+
+// Draws the outline of a chevron relative to the starting x value.
 // This is used for the ultrasound sensors
 void drawChevron(int x, bool isReverse, uint32_t colour)
 {
-	GLCD_SetForegroundColor(colour);
-	// Ensures that the chevrons are drawn in the correct direction
-	if (isReverse)
+	RASTER_POINT top[4], bottom[4];
+
+	if (fbRejects(chevronMaskLeft(x, isReverse), 0, CHEVRON_WIDTH, FB_HEIGHT, 0))
 	{
-		drawDiagonalLine(478-x, 136, 471-x, 0, colour);
-		drawDiagonalLine(478-x, 136, 471-x, 272, colour);
-		GLCD_DrawHLine(461-x, 0, 10);
-		GLCD_DrawHLine(461-x, 270, 10);
-		drawDiagonalLine(468-x, 136, 461-x, 0, colour);
-		drawDiagonalLine(468-x, 136, 461-x, 272, colour);
+		return;
 	}
-	else
+	chevronHalves(x, isReverse, top, bottom);
+	fbSync();
+	fbSetColour(colour);
+	fbMarkDamage(chevronMaskLeft(x, isReverse), 0, CHEVRON_WIDTH, FB_HEIGHT);
+	rasterConvex(top, 4, chevronOutlineSpan);
+	rasterConvex(bottom, 4, chevronOutlineSpan);
+	fbSetColour(HUD_BLACK);
+}
+
+// Fill a 'w' by 'h' block a given colour
+void fillArea(int x, int y, int w, int h, uint32_t colour)
+{
+	if (dlCapture(DL_FILL_RECT, x, y, w, h, colour, 0, NULL))
 	{
-		drawDiagonalLine(x, 136, x+7, 0, colour);
-		drawDiagonalLine(x, 136, x+7, 272, colour);
-		GLCD_DrawHLine(x+7, 1, 10);
-		GLCD_DrawHLine(x+7, 271, 10);
-		drawDiagonalLine(x+10, 136, x+17, 0, colour);
-		drawDiagonalLine(x+10, 136, x+17, 272, colour);
+		return;
 	}
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
+	fbFillRect(x, y, w, h, colour);
 }
 
-// Fill the background a given colour
+// Fill the whole screen a given colour, which wipes out every text slot as well
 void fillBackground(uint32_t colour)
 {
-	int i, j;
-	GLCD_SetForegroundColor(colour);
-	for (i = 0; i < 479; i++)
+	if (dlCapture(DL_FILL_RECT, 0, 0, FB_WIDTH, FB_HEIGHT, colour, 0, NULL))
 	{
-		for (j = 0; j < 271; j++)
-		{
-			GLCD_DrawPixel(i, j);
-		}
+		return;
 	}
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
+	fbFillRect(0, 0, FB_WIDTH, FB_HEIGHT, colour);
+	textInvalidateSlots();
 }
 
-// Fill a rectangle a given colour
+// Fill the inside of a rectangle a given colour, leaving its border alone
 void fillRectangle(int x, int y, int dx, int dy, uint32_t colour)
 {
-	int i, j;
-	GLCD_SetForegroundColor(colour);
-	for (i = x + 1; i < x + dx; i++)
+	fillArea(x + 1, y + 1, dx - 1, dy - 1, colour);
+}
+
+// Straight lines for the palette crosses
+void drawHLine(int x, int y, int len, uint32_t colour)
+{
+	if (dlCapture(DL_HLINE, x, y, len, 0, colour, 0, NULL))
 	{
-		for (j = y + 1; j < y + dy; j++)
-		{
-			GLCD_DrawPixel(i, j);
-		}
+		return;
+	}
+	fbMarkDamage(x, y, len, 1);
+	fbFillSpan(x, y, len, colour);
+}
+
+void drawVLine(int x, int y, int len, uint32_t colour)
+{
+	if (dlCapture(DL_VLINE, x, y, len, 0, colour, 0, NULL))
+	{
+		return;
 	}
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
+	fbSync();
+	fbSetColour(colour);
+	fbMarkDamage(x, y, 1, len);
+	fbDrawVLine(x, y, len);
+	fbSetColour(HUD_BLACK);
 }
 
-// Fill a chevron with a given colour
+// Fill a chevron, outline included, with a given colour. The shape comes from the
+// pre-rasterized mask, so every pixel is written exactly once
 void fillChevron(int x, bool isReverse, uint32_t colour)
+{
+	chevronMaskBlit(x, isReverse, colour);
+}
+
+#if CHEVRON_BENCH
+
+typedef struct
+{
+	uint32_t calls;
+	uint32_t buildCycles;    // Time taken to rasterize the mask once
+	uint32_t lineCycles;     // Time per chevron for the original fill, twenty Bresenham lines
+	uint32_t rasterCycles;   // Time per chevron for the scanline rasterizer on both halves
+	uint32_t maskCycles;     // Time per chevron for the mask
+} CHEVRON_BENCH_STATS;
+
+CHEVRON_BENCH_STATS chevronBenchStats;
+
+// The chevron fill from before the rasterizer, five lines either side of each arm.
+// Kept only so the benchmark has something to compare against
+void fillChevronLines(int x, bool isReverse, uint32_t colour)
 {
 	int i;
-	GLCD_SetForegroundColor(colour);
-	if (isReverse)
+
+	for (i = 1; i < 6; i++)
 	{
-		for(i = 1; i < 6; i++)
+		if (isReverse)
 		{
 			drawDiagonalLine(478-x-i, 136, 471-x-i, 0, colour);
 			drawDiagonalLine(478-x-i, 136, 471-x-i, 272, colour);
 			drawDiagonalLine(468-x+i, 136, 461-x+i, 0, colour);
 			drawDiagonalLine(468-x+i, 136, 461-x+i, 272, colour);
 		}
-	}
-	else
-	{
-		for(i = 1; i < 6; i++)
+		else
 		{
 			drawDiagonalLine(x+i, 136, x+7+i, 0, colour);
 			drawDiagonalLine(x+i, 136, x+7+i, 272, colour);
@@ -272,17 +422,63 @@ void fillChevron(int x, bool isReverse, uint32_t colour)
 			drawDiagonalLine(x+10-i, 136, x+17-i, 272, colour);
 		}
 	}
-	GLCD_SetForegroundColor(GLCD_COLOR_BLACK);
 }
 
+// Fills all five chevrons on both sides each way and times them with the DWT.
+// Run at start up before the main screen is drawn, which paints over them
+void chevronBenchmark(void)
+{
+	RASTER_POINT top[4], bottom[4];
+	uint32_t start, lines = 0, raster = 0, mask = 0;
+	int i, side, x;
+
+	memset(&chevronBenchStats, 0, sizeof(chevronBenchStats));
+	start = DWT->CYCCNT;
+	chevronMaskBuild();
+	chevronBenchStats.buildCycles = DWT->CYCCNT - start;
+
+	for (side = 0; side < 2; side++)
+	{
+		for (i = 0; i < 5; i++)
+		{
+			x = i * CHEVRON_SPACING;
+
+			start = DWT->CYCCNT;
+			fillChevronLines(x, side == 1, HUD_BLACK);
+			fbSync();
+			lines += DWT->CYCCNT - start;
+
+			start = DWT->CYCCNT;
+			chevronHalves(x, side == 1, top, bottom);
+			fbMarkDamage(chevronMaskLeft(x, side == 1), 0, CHEVRON_WIDTH, FB_HEIGHT);
+			rasterFillConvex(top, 4, HUD_BLACK);
+			rasterFillConvex(bottom, 4, HUD_BLACK);
+			fbSync();
+			raster += DWT->CYCCNT - start;
+
+			start = DWT->CYCCNT;
+			chevronMaskBlit(x, side == 1, HUD_BLACK);
+			fbSync();
+			mask += DWT->CYCCNT - start;
+
+			chevronBenchStats.calls++;
+		}
+	}
+	chevronBenchStats.lineCycles = lines / chevronBenchStats.calls;
+	chevronBenchStats.rasterCycles = raster / chevronBenchStats.calls;
+	chevronBenchStats.maskCycles = mask / chevronBenchStats.calls;
+}
+
+#endif
+
 // Function for drawing the display for the colour palettes
 void drawPalette(int x, int y, int d)
 {
 	int f = (d+1)/2;
 	
-	drawRectangle(x, y, d, d, GLCD_COLOR_BLACK);
-	GLCD_DrawHLine(x, y+f, d);
-	GLCD_DrawVLine(x+f, y, d);
+	drawRectangle(x, y, d, d, HUD_BLACK);
+	drawHLine(x, y+f, d, HUD_BLACK);
+	drawVLine(x+f, y, d, HUD_BLACK);
 }
 
 // Filling the colour palettes with their respective colours
@@ -291,20 +487,20 @@ void fillPalette(int x, int y, int d, uint32_t colourPalette)
 	int f = (d+1)/2;
 	
 	fillRectangle(x, y, f, f, colourPalette);
-	fillRectangle(x+f, y, f-1, f, GLCD_COLOR_BLACK);
-	fillRectangle(x, y+f, f, f-1, GLCD_COLOR_BLACK);
+	fillRectangle(x+f, y, f-1, f, HUD_BLACK);
+	fillRectangle(x, y+f, f, f-1, HUD_BLACK);
 	fillRectangle(x+f, y+f, f-1, f-1, colourPalette);
 }
 
-// Highlights the chosen buttons in the settings menu
+// Highlights the chosen buttons in the settings menu with a ring 4 pixels thick,
+// starting 5 pixels out from the button's border
 void highlightButton(int x, int y, int dx, int dy, uint32_t colour)
 {
-	int i;
-	
-	for (i = 0; i < 4; i++)
-	{
-		drawRectangle(x-5-i, y-5-i, dx+10+(2*i), dy+10+(2*i), colour);
-	}
+	// Top and bottom of the ring, then the sides between them
+	fillArea(x-8, y-8, dx+17, 4, colour);
+	fillArea(x-8, y+dy+5, dx+17, 4, colour);
+	fillArea(x-8, y-4, 4, dy+9, colour);
+	fillArea(x+dx+5, y-4, 4, dy+9, colour);
 }
 
 // Function for highlighting temperature and distance units in the settings screen
@@ -313,13 +509,13 @@ void highlightTempUnit(int tempUnit)
 {
 	if (tempUnit)
 	{
-		highlightButton(25, 135, 70, 30, 0x033F);
-		highlightButton(131, 135, 70, 30, GLCD_COLOR_WHITE);
+		highlightButton(25, 135, 70, 30, HUD_HIGHLIGHT);
+		highlightButton(131, 135, 70, 30, HUD_WHITE);
 	}
 	else
 	{
-		highlightButton(131, 135, 70, 30, 0x033F);
-		highlightButton(25, 135, 70, 30, GLCD_COLOR_WHITE);
+		highlightButton(131, 135, 70, 30, HUD_HIGHLIGHT);
+		highlightButton(25, 135, 70, 30, HUD_WHITE);
 	}
 }
 
@@ -327,13 +523,13 @@ void highlightDistUnit(int distUnit)
 {
 	if (distUnit)
 	{
-		highlightButton(25, 215, 70, 30, 0x033F);
-		highlightButton(131, 215, 70, 30, GLCD_COLOR_WHITE);
+		highlightButton(25, 215, 70, 30, HUD_HIGHLIGHT);
+		highlightButton(131, 215, 70, 30, HUD_WHITE);
 	}
 	else
 	{
-		highlightButton(131, 215, 70, 30, 0x033F);
-		highlightButton(25, 215, 70, 30, GLCD_COLOR_WHITE);
+		highlightButton(131, 215, 70, 30, HUD_HIGHLIGHT);
+		highlightButton(25, 215, 70, 30, HUD_WHITE);
 	}
 }
 
@@ -342,32 +538,32 @@ void highlightColour(int colourScheme)
 	//Dependent on colour1 the values will be removed then replace with the required box
 	if (colourScheme == 0)
 	{
-		highlightButton(295, 120, 44, 44, 0x033F); //top left
-		highlightButton(295, 208, 44, 44, GLCD_COLOR_WHITE); //bot left
-		highlightButton(396, 120, 44, 44, GLCD_COLOR_WHITE); //top right
-		highlightButton(396, 208, 44, 44, GLCD_COLOR_WHITE); //bot right
+		highlightButton(295, 120, 44, 44, HUD_HIGHLIGHT); //top left
+		highlightButton(295, 208, 44, 44, HUD_WHITE); //bot left
+		highlightButton(396, 120, 44, 44, HUD_WHITE); //top right
+		highlightButton(396, 208, 44, 44, HUD_WHITE); //bot right
 		
 	}
 	else if(colourScheme == 1)
 	{
-		highlightButton(295, 120, 44, 44, GLCD_COLOR_WHITE); //top left
-		highlightButton(295, 208, 44, 44, GLCD_COLOR_WHITE); //bot left
-		highlightButton(396, 120, 44, 44, 0x033F); //top right
-		highlightButton(396, 208, 44, 44, GLCD_COLOR_WHITE); //bot right
+		highlightButton(295, 120, 44, 44, HUD_WHITE); //top left
+		highlightButton(295, 208, 44, 44, HUD_WHITE); //bot left
+		highlightButton(396, 120, 44, 44, HUD_HIGHLIGHT); //top right
+		highlightButton(396, 208, 44, 44, HUD_WHITE); //bot right
 	}
 	else if(colourScheme == 2)
 	{
-		highlightButton(295, 120, 44, 44, GLCD_COLOR_WHITE); //top left
-		highlightButton(295, 208, 44, 44, 0x033F); //bot left
-		highlightButton(396, 120, 44, 44, GLCD_COLOR_WHITE); //top right
-		highlightButton(396, 208, 44, 44, GLCD_COLOR_WHITE); //bot right
+		highlightButton(295, 120, 44, 44, HUD_WHITE); //top left
+		highlightButton(295, 208, 44, 44, HUD_HIGHLIGHT); //bot left
+		highlightButton(396, 120, 44, 44, HUD_WHITE); //top right
+		highlightButton(396, 208, 44, 44, HUD_WHITE); //bot right
 	}
 	else if(colourScheme == 3)
 	{
-		highlightButton(295, 120, 44, 44, GLCD_COLOR_WHITE); //top left
-		highlightButton(295, 208, 44, 44, GLCD_COLOR_WHITE); //bot left
-		highlightButton(396, 120, 44, 44, GLCD_COLOR_WHITE); //top right
-		highlightButton(396, 208, 44, 44, 0x033F); //bot right
+		highlightButton(295, 120, 44, 44, HUD_WHITE); //top left
+		highlightButton(295, 208, 44, 44, HUD_WHITE); //bot left
+		highlightButton(396, 120, 44, 44, HUD_WHITE); //top right
+		highlightButton(396, 208, 44, 44, HUD_HIGHLIGHT); //bot right
 	}
 }
 
@@ -378,6 +574,11 @@ int checkCoordsMain(int x, int y){
 			// Returns one to change menu screens
 			return 1;
 		}
+		// Corner the performance overlay is shown in
+		if (x >= PERF_X && x < PERF_X + PERF_WIDTH && y >= PERF_Y && y < PERF_Y + PERF_HEIGHT)
+		{
+			return 2;
+		}
 		return 0;
 }
 
@@ -450,92 +651,4 @@ int checkCoordsSettings(int x, int y)
 	return 0;
 }
 
-void displayDisChevronsLeft(int numChev, uint32_t colour1, uint32_t colour2)
-{
-	//Remove all current chevrons
-	drawChevron(68, false, colour1);
-	fillChevron(68, false, colour1);
-	drawChevron(51, false, colour1);
-	fillChevron(51, false, colour1);
-	drawChevron(34, false, colour1);
-	fillChevron(34, false, colour1);
-	drawChevron(17, false, colour1);
-	fillChevron(17, false, colour1);
-	drawChevron(0, false, colour1);
-	fillChevron(0, false, colour1);
-	
-	// Is used to place cheverons.
-	// No breaks are needed because if 1 is need then it goes straight to the bottom
-	// and if 5 are needed then it will droip through each switch case and add another chevron.
-	switch(numChev)
-	{
-		
-		case 5:
-			drawChevron(68, false, colour2);
-			fillChevron(68, false, colour2);
-			
-		case 4:
-				drawChevron(51, false, colour2);
-				fillChevron(51, false, colour2);
-			
-		case 3:
-				drawChevron(34, false, colour2);
-				fillChevron(34, false, colour2);
-			
-		case 2:
-				drawChevron(17, false, colour2);
-				fillChevron(17, false, colour2);
-			
-		case 1:
-				drawChevron(0, false, colour2);
-				fillChevron(0, false, colour2);
-			
-		default:
-			break;
-	}
-}
-
-void displayDisChevronsRight(int numChev, uint32_t colour1, uint32_t colour2)
-{
-	//Remove all current chevrons
-	drawChevron(68, true, colour1);
-	fillChevron(68, true, colour1);
-	drawChevron(51, true, colour1);
-	fillChevron(51, true, colour1);
-	drawChevron(34, true, colour1);
-	fillChevron(34, true, colour1);
-	drawChevron(17, true, colour1);
-	fillChevron(17, true, colour1);
-	drawChevron(0, true, colour1);
-	fillChevron(0, true, colour1);
-	// Is used to place cheverons.
-	// No breaks are needed because if 1 is need then it goes straight to the bottom
-	// and if 5 are needed then it will droip through each switch case and add another chevron.
-		switch(numChev)
-	{
-		case 5:
-			drawChevron(68, true, colour2);
-			fillChevron(68, true, colour2);
-			
-		case 4:
-				drawChevron(51, true, colour2);
-				fillChevron(51, true, colour2);
-			
-		case 3:
-				drawChevron(34, true, colour2);
-				fillChevron(34, true, colour2);
-			
-		case 2:
-				drawChevron(17, true, colour2);
-				fillChevron(17, true, colour2);
-			
-		case 1:
-				drawChevron(0, true, colour2);
-				fillChevron(0, true, colour2);
-			
-		default:
-			break;
-	}
-}
-
 #endif
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+
+ File        		: sine_table.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for a Q15 sine table at quarter degree steps,
+									so the gauge needle can be placed with integer maths instead
+									of double precision sin() and cos(), which the single precision
+									FPU has to do in software.
+
+*/
+
+#ifndef __SINE_TABLE_H
+#define __SINE_TABLE_H
+
+#include "main.h"
+
+// Table steps in one degree
+#define SINE_STEPS_PER_DEGREE 4
+// Steps in a quarter turn, the table holds one more so 90 degrees is included
+#define SINE_QUARTER (90 * SINE_STEPS_PER_DEGREE)
+#define SINE_ONE 32767
+
+// Set to 1 to time the table against the old double precision cos() and sin() at
+// start up, see sineBenchmark()
+#ifndef SINE_BENCH
+#define SINE_BENCH 0
+#endif
+
+// sin(i / 4 degrees) * 32767, rounded to the nearest whole number
+const int16_t sineQ15[SINE_QUARTER + 1] =
+{
+	0, 143, 286, 429, 572, 715, 858, 1001, 1144, 1286, 1429, 1572,
+	1715, 1858, 2000, 2143, 2286, 2428, 2571, 2713, 2856, 2998, 3141, 3283,
+	3425, 3567, 3709, 3851, 3993, 4135, 4277, 4419, 4560, 4702, 4843, 4985,
+	5126, 5267, 5408, 5549, 5690, 5831, 5971, 6112, 6252, 6393, 6533, 6673,
+	6813, 6952, 7092, 7232, 7371, 7510, 7649, 7788, 7927, 8066, 8204, 8343,
+	8481, 8619, 8757, 8894, 9032, 9169, 9306, 9443, 9580, 9717, 9853, 9989,
+	10126, 10261, 10397, 10533, 10668, 10803, 10938, 11073, 11207, 11341, 11475, 11609,
+	11743, 11876, 12009, 12142, 12275, 12407, 12539, 12671, 12803, 12935, 13066, 13197,
+	13328, 13458, 13588, 13718, 13848, 13977, 14107, 14235, 14364, 14492, 14621, 14748,
+	14876, 15003, 15130, 15257, 15383, 15509, 15635, 15761, 15886, 16011, 16135, 16260,
+	16383, 16507, 16631, 16754, 16876, 16999, 17121, 17242, 17364, 17485, 17606, 17726,
+	17846, 17966, 18085, 18204, 18323, 18441, 18559, 18677, 18794, 18911, 19028, 19144,
+	19260, 19375, 19491, 19605, 19720, 19834, 19947, 20061, 20173, 20286, 20398, 20510,
+	20621, 20732, 20842, 20952, 21062, 21172, 21280, 21389, 21497, 21605, 21712, 21819,
+	21925, 22031, 22137, 22242, 22347, 22451, 22555, 22659, 22762, 22864, 22967, 23068,
+	23170, 23271, 23371, 23471, 23571, 23670, 23768, 23867, 23964, 24062, 24158, 24255,
+	24351, 24446, 24541, 24636, 24730, 24823, 24916, 25009, 25101, 25193, 25284, 25375,
+	25465, 25554, 25644, 25732, 25821, 25909, 25996, 26083, 26169, 26255, 26340, 26425,
+	26509, 26593, 26676, 26759, 26841, 26923, 27004, 27085, 27165, 27245, 27324, 27403,
+	27481, 27558, 27635, 27712, 27788, 27863, 27938, 28013, 28087, 28160, 28233, 28305,
+	28377, 28448, 28519, 28589, 28659, 28728, 28796, 28864, 28932, 28998, 29065, 29130,
+	29196, 29260, 29324, 29388, 29451, 29513, 29575, 29636, 29697, 29757, 29817, 29876,
+	29934, 29992, 30049, 30106, 30162, 30218, 30273, 30327, 30381, 30434, 30487, 30539,
+	30591, 30642, 30692, 30742, 30791, 30840, 30888, 30935, 30982, 31028, 31074, 31119,
+	31163, 31207, 31250, 31293, 31335, 31377, 31418, 31458, 31498, 31537, 31575, 31613,
+	31650, 31687, 31723, 31759, 31794, 31828, 31862, 31895, 31927, 31959, 31990, 32021,
+	32051, 32080, 32109, 32137, 32165, 32192, 32218, 32244, 32269, 32294, 32318, 32341,
+	32364, 32386, 32407, 32428, 32448, 32468, 32487, 32505, 32523, 32540, 32556, 32572,
+	32587, 32602, 32616, 32630, 32642, 32654, 32666, 32677, 32687, 32697, 32706, 32714,
+	32722, 32729, 32736, 32742, 32747, 32752, 32756, 32759, 32762, 32764, 32766, 32767,
+	32767
+};
+
+// Turns an angle in degrees into the nearest table step
+int sineStep(float angle)
+{
+	return (int)(angle >= 0 ? (angle * SINE_STEPS_PER_DEGREE) + 0.5f : (angle * SINE_STEPS_PER_DEGREE) - 0.5f);
+}
+
+// Sine of 'step' quarter degrees in Q15, any angle is folded back onto the first quarter
+int32_t sinQ15(int step)
+{
+	step %= 4 * SINE_QUARTER;
+	if (step < 0)
+	{
+		step += 4 * SINE_QUARTER;
+	}
+	if (step <= SINE_QUARTER)
+	{
+		return sineQ15[step];
+	}
+	if (step <= 2 * SINE_QUARTER)
+	{
+		return sineQ15[(2 * SINE_QUARTER) - step];
+	}
+	if (step <= 3 * SINE_QUARTER)
+	{
+		return -sineQ15[step - (2 * SINE_QUARTER)];
+	}
+	return -sineQ15[(4 * SINE_QUARTER) - step];
+}
+
+int32_t cosQ15(int step)
+{
+	return sinQ15(step + SINE_QUARTER);
+}
+
+// Multiplies 'r' by a Q15 value, rounding down like a cast of a positive float would.
+// Shifting a negative value right is left to the compiler in C90, so a negative
+// product has its magnitude shifted instead, rounded up to give the floor once negated
+int sineScale(int r, int32_t q15)
+{
+	int32_t product = r * q15;
+
+	if (product < 0)
+	{
+		return -(int)((-product + 32767) >> 15);
+	}
+	return (int)(product >> 15);
+}
+
+#if SINE_BENCH
+
+typedef struct
+{
+	uint32_t calls;
+	uint32_t doubleCycles;   // Time per end point the way getCircumferenceXY() used to work it out
+	uint32_t tableCycles;    // Time per end point from the table
+	uint32_t maxError;       // Largest difference between the two in either axis (pixels)
+} SINE_BENCH_STATS;
+
+SINE_BENCH_STATS sineBenchStats;
+
+// Works out the end of a 128 pixel needle both ways for every quarter degree from
+// -90 to 90 and times them with the DWT. tests/test_sine_table.c checks accuracy
+void sineBenchmark(void)
+{
+	float angle, radAngle;
+	uint32_t start, doubleTotal = 0, tableTotal = 0;
+	int i, step, oldX, oldY, newX, newY, error;
+
+	memset(&sineBenchStats, 0, sizeof(sineBenchStats));
+	for (i = -SINE_QUARTER; i <= SINE_QUARTER; i++)
+	{
+		angle = (float)i / SINE_STEPS_PER_DEGREE;
+
+		start = DWT->CYCCNT;
+		radAngle = (float)(angle * (3.14159265f / 180.0)) + ((3 * 3.14159265f) / 2);
+		oldX = (int)((128 * (float)cos(radAngle)) + 240);
+		oldY = (int)((128 * (float)sin(radAngle)) + 272);
+		doubleTotal += DWT->CYCCNT - start;
+
+		start = DWT->CYCCNT;
+		step = sineStep(angle);
+		newX = 240 + sineScale(128, sinQ15(step));
+		newY = 272 + sineScale(128, -cosQ15(step));
+		tableTotal += DWT->CYCCNT - start;
+
+		error = abs(newX - oldX) > abs(newY - oldY) ? abs(newX - oldX) : abs(newY - oldY);
+		sineBenchStats.maxError = (uint32_t)error > sineBenchStats.maxError ? (uint32_t)error : sineBenchStats.maxError;
+		sineBenchStats.calls++;
+	}
+	sineBenchStats.doubleCycles = doubleTotal / sineBenchStats.calls;
+	sineBenchStats.tableCycles = tableTotal / sineBenchStats.calls;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+#!/bin/sh
+# Builds and runs every host test in this directory with the system gcc.
+# Tests that pull in main.c link against the HAL stand-ins in stubs/, with
+# -no-pie so the SDRAM array has an address that fits in 32 bits.
+cd "$(dirname "$0")" || exit 1
+out="${TMPDIR:-/tmp}/sensorui_tests"
+mkdir -p "$out"
+# The firmware keeps SDRAM addresses in uint32_t, which a 64 bit host warns about,
+# and main.c has a few warnings of its own that aren't what these tests are for
+quiet="-Wno-int-conversion -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -Wno-stringop-overflow"
+status=0
+for test in test_*.c
+do
+	name="${test%.c}"
+	if gcc -std=gnu89 -Wall -g -no-pie -I.. $quiet -Istubs "$test" stubs/stubs.c -o "$out/$name" -lm && "$out/$name"
+	then
+		echo "$name passed"
+	else
+		echo "$name FAILED"
+		status=1
+	fi
+done
+exit $status
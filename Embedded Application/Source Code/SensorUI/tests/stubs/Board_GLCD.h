@@ -0,0 +1,18 @@
+/*
+
+ File        		: Board_GLCD.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host stand-in for the Keil board GLCD driver.
+
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+typedef struct { uint16_t width; uint16_t height; uint32_t offset; uint32_t count; const uint8_t *bitmap; } const GLCD_FONT;
+int32_t GLCD_Initialize(void); int32_t GLCD_SetForegroundColor(uint32_t); int32_t GLCD_SetBackgroundColor(uint32_t);
+int32_t GLCD_ClearScreen(void); int32_t GLCD_SetFont(GLCD_FONT*); int32_t GLCD_DrawPixel(uint32_t,uint32_t);
+int32_t GLCD_DrawHLine(uint32_t,uint32_t,uint32_t); int32_t GLCD_DrawVLine(uint32_t,uint32_t,uint32_t);
+int32_t GLCD_DrawRectangle(uint32_t,uint32_t,uint32_t,uint32_t); int32_t GLCD_DrawString(uint32_t,uint32_t,const char*);
+int32_t GLCD_DrawChar(uint32_t,uint32_t,int32_t); int32_t GLCD_FrameBufferAccess(bool); uint32_t GLCD_FrameBufferAddress(void);
@@ -0,0 +1,13 @@
+/*
+
+ File        		: Board_Touch.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host stand-in for the Keil board touch driver.
+
+*/
+
+#include <stdint.h>
+typedef struct { int16_t x; int16_t y; uint8_t pressed; uint8_t padding; } TOUCH_STATE;
+int32_t Touch_Initialize(void); int32_t Touch_GetState(TOUCH_STATE*);
@@ -0,0 +1,16 @@
+/*
+
+ File        		: GLCD_Config.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host stand-in for the board's GLCD configuration.
+
+*/
+
+#define GLCD_WIDTH 480
+#define GLCD_HEIGHT 272
+#define GLCD_COLOR_BLACK 0x0000
+#define GLCD_COLOR_WHITE 0xFFFF
+#define GLCD_COLOR_MAGENTA 0xF81F
+#define GLCD_COLOR_BLUE 0x001F
@@ -0,0 +1,163 @@
+/*
+
+ File        		: stm32f7xx_hal.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host stand-in for the parts of the STM32F7 HAL and CMSIS the
+									SensorUI headers use, so they can be built with gcc for the
+									tests. Peripherals are plain structs defined in stubs.c.
+
+*/
+
+#ifndef STUB_HAL
+#define STUB_HAL
+#include <stdint.h>
+#include <stddef.h>
+#define __IO volatile
+typedef enum { HAL_OK, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET, GPIO_PIN_SET } GPIO_PinState;
+typedef struct { uint32_t Pin, Mode, Pull, Speed, Alternate; } GPIO_InitTypeDef;
+typedef struct { volatile uint32_t MODER, IDR, ODR, BSRR; } GPIO_TypeDef;
+extern GPIO_TypeDef *GPIOA,*GPIOB,*GPIOC,*GPIOG,*GPIOH,*GPIOI;
+#define GPIO_PIN_0 1
+#define GPIO_PIN_2 4
+#define GPIO_PIN_3 8
+#define GPIO_PIN_4 16
+#define GPIO_PIN_6 64
+#define GPIO_PIN_7 128
+#define GPIO_PIN_8 256
+#define GPIO_PIN_9 512
+#define GPIO_MODE_AF_OD 1
+#define GPIO_MODE_OUTPUT_PP 2
+#define GPIO_MODE_INPUT 3
+#define GPIO_MODE_IT_RISING 4
+#define GPIO_PULLUP 1
+#define GPIO_NOPULL 0
+#define GPIO_PULLDOWN 2
+#define GPIO_SPEED_FREQ_VERY_HIGH 3
+#define GPIO_SPEED_FREQ_LOW 0
+#define GPIO_AF4_I2C1 4
+void HAL_GPIO_Init(GPIO_TypeDef*, GPIO_InitTypeDef*);
+void HAL_GPIO_WritePin(GPIO_TypeDef*, uint16_t, GPIO_PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef*, uint16_t);
+void HAL_GPIO_EXTI_IRQHandler(uint16_t);
+void HAL_Delay(uint32_t); uint32_t HAL_GetTick(void); HAL_StatusTypeDef HAL_Init(void);
+typedef struct { uint32_t Timing, OwnAddress1, AddressingMode, DualAddressMode, OwnAddress2, OwnAddress2Masks, GeneralCallMode, NoStretchMode; } I2C_InitTypeDef;
+typedef struct { void *Instance; I2C_InitTypeDef Init; volatile uint32_t State; volatile uint32_t ErrorCode; } I2C_HandleTypeDef;
+extern void *I2C1;
+#define I2C_ADDRESSINGMODE_7BIT 1
+#define I2C_DUALADDRESS_DISABLE 0
+#define I2C_OA2_NOMASK 0
+#define I2C_GENERALCALL_DISABLE 0
+#define I2C_NOSTRETCH_DISABLE 0
+#define I2C_ANALOGFILTER_ENABLE 0
+#define I2C_MEMADD_SIZE_8BIT 1
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef*);
+HAL_StatusTypeDef HAL_I2CEx_ConfigAnalogFilter(I2C_HandleTypeDef*, uint32_t);
+HAL_StatusTypeDef HAL_I2CEx_ConfigDigitalFilter(I2C_HandleTypeDef*, uint32_t);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef*, uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t, uint32_t);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef*, uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t, uint32_t);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef*, uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef*, uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t);
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef*); void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef*);
+typedef struct { uint32_t Prescaler, CounterMode, Period, ClockDivision, AutoReloadPreload; } TIM_Base_InitTypeDef;
+typedef struct { uint32_t CR1, CNT, PSC, ARR, EGR; } TIM_TypeDef;
+typedef struct { TIM_TypeDef *Instance; TIM_Base_InitTypeDef Init; } TIM_HandleTypeDef;
+typedef struct { uint32_t MasterOutputTrigger, MasterSlaveMode; } TIM_MasterConfigTypeDef;
+extern TIM_TypeDef *TIM2;
+#define TIM_COUNTERMODE_UP 0
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0
+#define TIM_CLOCKDIVISION_DIV1 0
+#define TIM_TRGO_RESET 0
+#define TIM_MASTERSLAVEMODE_DISABLE 0
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef*, TIM_MasterConfigTypeDef*);
+#define __HAL_RCC_TIM2_CLK_ENABLE()
+#define __HAL_RCC_I2C1_CLK_ENABLE()
+#define __HAL_RCC_I2C1_FORCE_RESET()
+#define __HAL_RCC_I2C1_RELEASE_RESET()
+#define __HAL_RCC_GPIOA_CLK_ENABLE()
+#define __HAL_RCC_GPIOB_CLK_ENABLE()
+#define __HAL_RCC_GPIOC_CLK_ENABLE()
+#define __HAL_RCC_GPIOG_CLK_ENABLE()
+#define __HAL_RCC_GPIOH_CLK_ENABLE()
+#define __HAL_RCC_GPIOI_CLK_ENABLE()
+#define __HAL_RCC_PWR_CLK_ENABLE()
+#define __HAL_RCC_DMA2D_CLK_ENABLE()
+#define __HAL_RCC_SYSCFG_CLK_ENABLE()
+#define __HAL_PWR_VOLTAGESCALING_CONFIG(x)
+#define PWR_REGULATOR_VOLTAGE_SCALE1 0
+typedef struct { uint32_t PLLState, PLLSource, PLLM, PLLN, PLLP, PLLQ; } RCC_PLLInitTypeDef;
+typedef struct { uint32_t OscillatorType, HSEState; RCC_PLLInitTypeDef PLL; } RCC_OscInitTypeDef;
+typedef struct { uint32_t ClockType, SYSCLKSource, AHBCLKDivider, APB1CLKDivider, APB2CLKDivider; } RCC_ClkInitTypeDef;
+#define RCC_OSCILLATORTYPE_HSE 1
+#define RCC_HSE_ON 1
+#define RCC_PLL_ON 1
+#define RCC_PLLSOURCE_HSE 1
+#define RCC_PLLP_DIV2 2
+#define RCC_CLOCKTYPE_SYSCLK 1
+#define RCC_CLOCKTYPE_PCLK1 2
+#define RCC_CLOCKTYPE_PCLK2 4
+#define RCC_SYSCLKSOURCE_PLLCLK 2
+#define RCC_SYSCLK_DIV1 0
+#define RCC_HCLK_DIV4 4
+#define RCC_HCLK_DIV2 2
+#define FLASH_LATENCY_5 5
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef*);
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef*, uint32_t);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+extern uint32_t SystemCoreClock;
+typedef enum { LTDC_IRQn = 88, DMA2D_IRQn = 90, I2C1_EV_IRQn = 31, I2C1_ER_IRQn = 32, EXTI2_IRQn = 8 } IRQn_Type;
+void HAL_NVIC_SetPriority(IRQn_Type, uint32_t, uint32_t); void HAL_NVIC_EnableIRQ(IRQn_Type); void HAL_NVIC_DisableIRQ(IRQn_Type);
+/* LTDC */
+typedef struct { volatile uint32_t SSCR, BPCR, AWCR, TWCR, GCR, SRCR, BCCR, IER, ISR, ICR, LIPCR, CPSR, CDSR; } LTDC_TypeDef;
+typedef struct { volatile uint32_t CR, WHPCR, WVPCR, CKCR, PFCR, CACR, DCCR, BFCR, CFBAR, CFBLR, CFBLNR, CLUTWR; } LTDC_Layer_TypeDef;
+extern LTDC_TypeDef *LTDC; extern LTDC_Layer_TypeDef *LTDC_Layer1, *LTDC_Layer2;
+#define LTDC_SRCR_IMR 1
+#define LTDC_SRCR_VBR 2
+#define LTDC_IER_LIE 1
+#define LTDC_ISR_LIF 1
+#define LTDC_ICR_CLIF 1
+#define LTDC_AWCR_AAH 0x7FF
+#define LTDC_AWCR_AAW 0x0FFF0000
+#define LTDC_BPCR_AVBP 0x7FF
+#define LTDC_BPCR_AHBP 0x0FFF0000
+#define LTDC_LxCR_LEN 1
+#define LTDC_LxCR_COLKEN 2
+#define LTDC_LxCR_CLUTEN 16
+#define LTDC_CDSR_VSYNCS 4
+#define LTDC_CPSR_CYPOS 0xFFFF
+#define LTDC_PIXEL_FORMAT_RGB565 2
+#define LTDC_PIXEL_FORMAT_ARGB4444 4
+#define LTDC_PIXEL_FORMAT_L8 5
+#define LTDC_BLENDING_FACTOR1_CA 0x400
+#define LTDC_BLENDING_FACTOR2_CA 5
+#define LTDC_BLENDING_FACTOR1_PAxCA 0x600
+#define LTDC_BLENDING_FACTOR2_PAxCA 7
+/* DMA2D */
+typedef struct { volatile uint32_t CR, ISR, IFCR, FGMAR, FGOR, BGMAR, BGOR, FGPFCCR, FGCOLR, BGPFCCR, BGCOLR, FGCMAR, BGCMAR, OPFCCR, OCOLR, OMAR, OOR, NLR, LWR, AMTCR; } DMA2D_TypeDef;
+extern DMA2D_TypeDef *DMA2D;
+#define DMA2D_CR_START 1
+#define DMA2D_CR_TCIE 0x200
+#define DMA2D_CR_MODE_Pos 16
+#define DMA2D_ISR_TCIF 2
+#define DMA2D_IFCR_CTCIF 2
+#define DMA2D_NLR_NL_Pos 0
+#define DMA2D_NLR_PL_Pos 16
+#define DMA2D_FGPFCCR_AM_Pos 16
+#define DMA2D_FGPFCCR_ALPHA_Pos 24
+/* DWT / core */
+typedef struct { volatile uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { volatile uint32_t DEMCR; } CoreDebug_Type;
+extern DWT_Type *DWT; extern CoreDebug_Type *CoreDebug;
+#define DWT_CTRL_CYCCNTENA_Msk 1
+#define CoreDebug_DEMCR_TRCENA_Msk (1u<<24)
+#define __WFI()
+#define __DSB()
+#define __disable_irq()
+#define __enable_irq()
+#define __get_PRIMASK() 0
+#define __set_PRIMASK(x) ((void)(x))
+#endif
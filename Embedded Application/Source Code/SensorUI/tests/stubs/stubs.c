@@ -0,0 +1,87 @@
+/*
+
+ File        		: stubs.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host definitions for the stand-ins in this directory. SDRAM
+									is a static array, which the tests link with -no-pie so its
+									address fits the 32 bit GLCD_FrameBufferAddress(). The HAL
+									calls do nothing and report success. The DWT cycle counter is
+									a plain variable that only moves if a test moves it.
+
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f7xx_hal.h"
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "Board_Touch.h"
+
+static uint16_t sdram[4 * 1024 * 1024];
+
+GPIO_TypeDef gpio;
+GPIO_TypeDef *GPIOA = &gpio, *GPIOB = &gpio, *GPIOC = &gpio, *GPIOG = &gpio, *GPIOH = &gpio, *GPIOI = &gpio;
+void *I2C1;
+static TIM_TypeDef tim2;
+TIM_TypeDef *TIM2 = &tim2;
+static LTDC_TypeDef ltdc;
+LTDC_TypeDef *LTDC = &ltdc;
+static LTDC_Layer_TypeDef layer1, layer2;
+LTDC_Layer_TypeDef *LTDC_Layer1 = &layer1, *LTDC_Layer2 = &layer2;
+static DMA2D_TypeDef dma2d;
+DMA2D_TypeDef *DMA2D = &dma2d;
+static DWT_Type dwt;
+DWT_Type *DWT = &dwt;
+static CoreDebug_Type coreDebug;
+CoreDebug_Type *CoreDebug = &coreDebug;
+uint32_t SystemCoreClock = 168000000;
+
+static uint32_t tick;
+uint32_t HAL_GetTick(void) { return tick++; }
+void HAL_Delay(uint32_t delay) { tick += delay; }
+HAL_StatusTypeDef HAL_Init(void) { return HAL_OK; }
+
+void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init) {}
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {}
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin) { return GPIO_PIN_SET; }
+void HAL_GPIO_EXTI_IRQHandler(uint16_t pin) {}
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t pre, uint32_t sub) {}
+void HAL_NVIC_EnableIRQ(IRQn_Type irq) {}
+void HAL_NVIC_DisableIRQ(IRQn_Type irq) {}
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *init) { return HAL_OK; }
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *init, uint32_t latency) { return HAL_OK; }
+uint32_t HAL_RCC_GetPCLK1Freq(void) { return 42000000; }
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *tim) { return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *tim) { return HAL_OK; }
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *tim, TIM_MasterConfigTypeDef *cfg) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *i2c) { return HAL_OK; }
+HAL_StatusTypeDef HAL_I2CEx_ConfigAnalogFilter(I2C_HandleTypeDef *i2c, uint32_t f) { return HAL_OK; }
+HAL_StatusTypeDef HAL_I2CEx_ConfigDigitalFilter(I2C_HandleTypeDef *i2c, uint32_t f) { return HAL_OK; }
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *i2c, uint16_t dev, uint16_t reg, uint16_t size, uint8_t *data,
+	uint16_t len, uint32_t timeout) { memset(data, 0, len); return HAL_OK; }
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *i2c, uint16_t dev, uint16_t reg, uint16_t size, uint8_t *data,
+	uint16_t len, uint32_t timeout) { return HAL_OK; }
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *i2c, uint16_t dev, uint16_t reg, uint16_t size, uint8_t *data,
+	uint16_t len) { return HAL_OK; }
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *i2c, uint16_t dev, uint16_t reg, uint16_t size, uint8_t *data,
+	uint16_t len) { return HAL_OK; }
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *i2c) {}
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *i2c) {}
+
+int32_t GLCD_Initialize(void) { return 0; }
+int32_t GLCD_ClearScreen(void) { return 0; }
+uint32_t GLCD_FrameBufferAddress(void) { return (uint32_t)(uintptr_t)sdram; }
+static uint16_t glcdColour;
+int32_t GLCD_SetForegroundColor(uint32_t colour) { glcdColour = (uint16_t)colour; return 0; }
+int32_t GLCD_DrawPixel(uint32_t x, uint32_t y) { ((uint16_t *)sdram)[(y * GLCD_WIDTH) + x] = glcdColour; return 0; }
+int32_t Touch_Initialize(void) { return 0; }
+int32_t Touch_GetState(TOUCH_STATE *state) { memset(state, 0, sizeof(*state)); return 0; }
+
+static const uint8_t fontBits[256 * 3 * 24];
+GLCD_FONT GLCD_Font_16x24 = {16, 24, 32, 95, fontBits};
+GLCD_FONT GLCD_Font_6x8 = {6, 8, 32, 95, fontBits};
@@ -0,0 +1,109 @@
+/*
+
+ File        		: test_bgcache.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for bgcache.h. For every colour scheme and pair of
+									units the main screen is drawn from nothing, then shown
+									again after switching away, when its background comes back
+									from the cache. The two frames have to match byte for byte,
+									and the cached switch has to write fewer pixels. Cycling
+									through more settings than there are slots has to throw out
+									the one used least recently.
+
+ Build       		: gcc -std=gnu89 -no-pie -I.. -Istubs test_bgcache.c stubs/stubs.c -lm -o test_bgcache
+
+*/
+
+#define main sensorUiMain
+#include "main.c"
+#undef main
+
+FB_PIXEL drawn[FB_SIZE];
+int failures = 0;
+
+// Shows the main screen with the given settings and returns the pixel writes it took
+uint32_t show(int scheme, int temp, int dist)
+{
+	uint32_t start = fbPixelWrites;
+
+	colourScheme = (uint16_t)scheme;
+	tempUnit = (uint16_t)temp;
+	distUnit = (uint16_t)dist;
+	mainScreen();
+	return fbPixelWrites - start;
+}
+
+int main(void)
+{
+	uint32_t missWrites, hitWrites, hits;
+	int scheme, temp, dist;
+
+	fbInit();
+	overlayInit();
+	bgCacheInit();
+	fbSetFont(&GLCD_Font_16x24);
+	hudInit();
+	temperature = 42;
+
+	for (scheme = 0; scheme < 4; scheme++)
+	{
+		for (temp = 0; temp < 2; temp++)
+		{
+			for (dist = 0; dist < 2; dist++)
+			{
+				// Drawn from nothing, then away to other settings and back from the cache
+				bgCacheInit();
+				missWrites = show(scheme, temp, dist);
+				memcpy(drawn, fbBuffer[fbFront].pixels, sizeof(drawn));
+				show((scheme + 1) % 4, !temp, !dist);
+				hits = bgStats.hits;
+				hitWrites = show(scheme, temp, dist);
+
+				if (bgStats.hits != hits + 1)
+				{
+					printf("FAIL scheme %d units %d %d didn't come from the cache\n", scheme, temp, dist);
+					failures++;
+				}
+				if (memcmp(drawn, fbBuffer[fbFront].pixels, sizeof(drawn)) != 0)
+				{
+					printf("FAIL scheme %d units %d %d differs from the one drawn\n", scheme, temp, dist);
+					failures++;
+				}
+				if (hitWrites >= missWrites)
+				{
+					printf("FAIL scheme %d units %d %d took %u writes from the cache, %u drawn\n", scheme, temp,
+						dist, hitWrites, missWrites);
+					failures++;
+				}
+			}
+		}
+	}
+	printf("last switch: %u pixel writes drawn, %u from the cache\n", missWrites, hitWrites);
+
+	// One more setting than there are slots throws out the first, which was used least recently
+	bgCacheInit();
+	for (scheme = 0; scheme <= BG_CACHE_SLOTS; scheme++)
+	{
+		show(scheme % 4, scheme / 4, 1);
+	}
+	hits = bgStats.hits;
+	show(1, 0, 1);
+	if (bgStats.evictions != 1 || bgStats.hits != hits + 1)
+	{
+		printf("FAIL %u evictions, the second setting %s\n", bgStats.evictions,
+			bgStats.hits == hits + 1 ? "was kept" : "was thrown out");
+		failures++;
+	}
+	hits = bgStats.hits;
+	show(0, 0, 1);
+	if (bgStats.hits != hits)
+	{
+		printf("FAIL the least recently used setting was kept\n");
+		failures++;
+	}
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/*
+
+ File        		: test_chevron_bar.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for chevron_bar.h. fillChevron() is replaced by a
+									counter, and every change between 0 and 5 lit chevrons is
+									checked to repaint exactly the chevrons that switch, with a
+									first paint or a new colour scheme repainting the whole bar.
+
+ Build       		: gcc -std=gnu89 -Wall -I.. test_chevron_bar.c -o test_chevron_bar
+
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// chevron_bar.h only needs the standard types, so main.h and the HAL are left out
+#define __MAIN_H
+#include "chevron_bar.h"
+
+#define COUNT 5
+#define OFF 0x0000
+#define ON 0xF800
+
+int repaints = 0;
+int failures = 0;
+uint32_t painted[COUNT];
+
+void fillChevron(int x, bool isReverse, uint32_t colour)
+{
+	painted[x / CHEVRON_SPACING] = colour;
+	repaints++;
+}
+
+void check(bool ok, const char *what, int from, int to, int got, int want)
+{
+	if (!ok)
+	{
+		printf("FAIL %s %d -> %d: %d repaints, expected %d\n", what, from, to, got, want);
+		failures++;
+	}
+}
+
+int main(void)
+{
+	CHEVRON_BAR bar;
+	int from, to, i, got, want;
+	bool shown;
+
+	for (from = 0; from <= COUNT; from++)
+	{
+		for (to = 0; to <= COUNT; to++)
+		{
+			chevronBarInit(&bar, COUNT, false);
+			repaints = 0;
+			got = chevronBarSet(&bar, from, OFF, ON);
+			check(got == COUNT && repaints == COUNT, "first paint", from, from, got, COUNT);
+
+			repaints = 0;
+			got = chevronBarSet(&bar, to, OFF, ON);
+			want = from > to ? from - to : to - from;
+			check(got == want && repaints == want, "transition", from, to, got, want);
+
+			// Whatever was repainted, the screen has to end up showing 'to' chevrons lit
+			shown = true;
+			for (i = 0; i < COUNT; i++)
+			{
+				shown = shown && painted[i] == (i < to ? ON : OFF);
+			}
+			check(shown, "screen", from, to, got, want);
+
+			repaints = 0;
+			got = chevronBarSet(&bar, to, OFF, 0x07E0);
+			check(got == COUNT && repaints == COUNT, "new colours", to, to, got, COUNT);
+		}
+	}
+
+	// Out of range requests are clamped to the bar
+	chevronBarInit(&bar, COUNT, true);
+	chevronBarSet(&bar, -3, OFF, ON);
+	repaints = 0;
+	got = chevronBarSet(&bar, 99, OFF, ON);
+	check(got == COUNT, "clamped", -3, 99, got, COUNT);
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/*
+
+ File        		: test_circle.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for circle.h. Checks the const octant tables match
+									what circleOctant() works out for their radius, and that
+									drawCircle() gives exactly the pixels of the original loop,
+									which plotted all eight octants a pixel at a time, for radii
+									1 to 200 at centres on, across and off the edges of the
+									screen. Run with 'generate' to print the tables to paste
+									back into circle.h.
+
+ Build       		: gcc -std=gnu89 -no-pie -I.. -Istubs test_circle.c stubs/stubs.c -lm -o test_circle
+
+*/
+
+#define main sensorUiMain
+#include "main.c"
+#undef main
+
+FB_PIXEL expected[FB_SIZE];
+
+void plot(int x, int y)
+{
+	if (x >= 0 && y >= 0 && x < FB_WIDTH && y < FB_HEIGHT)
+	{
+		expected[(y * FB_WIDTH) + x] = 0xFFFF;
+	}
+}
+
+void plotOctants(int cx, int cy, int x, int y)
+{
+	plot(cx - x, cy - y);
+	plot(cx + x, cy - y);
+	plot(cx - x, cy + y);
+	plot(cx + x, cy + y);
+	plot(cx - y, cy - x);
+	plot(cx + y, cy - x);
+	plot(cx - y, cy + x);
+	plot(cx + y, cy + x);
+}
+
+// drawCircle() as it was before the octant tables
+void oldCircle(int cx, int cy, int radius)
+{
+	int x = 0, y = radius, dp = 3 - (2 * radius);
+
+	plotOctants(cx, cy, x, y);
+	while (y >= x)
+	{
+		x++;
+		if (dp > 0)
+		{
+			y--;
+			dp = dp + (4 * (x - y)) + 10;
+		}
+		else
+		{
+			dp = dp + (4 * x) + 6;
+		}
+		plotOctants(cx, cy, x, y);
+	}
+}
+
+// Prints one table in the layout circle.h uses
+void generate(const CIRCLE_TABLE *table)
+{
+	uint8_t offsets[CIRCLE_MAX_OCTANT];
+	int count = circleOctant(table->radius, offsets), i;
+
+	printf("const uint8_t circleOctant%d[%d] =\n{", table->radius, count);
+	for (i = 0; i < count; i++)
+	{
+		printf("%s%d%s", i % 16 == 0 ? "\n\t" : " ", offsets[i], i + 1 < count ? "," : "");
+	}
+	printf("\n};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+	const int centres[][2] = {{240, 136}, {240, 272}, {240, 71}, {233, 88}, {5, 5}, {470, 260}, {240, -50}};
+	uint8_t offsets[CIRCLE_MAX_OCTANT];
+	int tables = (int)(sizeof(circleTables) / sizeof(circleTables[0]));
+	int failures = 0, i, r, c, count;
+
+	if (argc > 1 && strcmp(argv[1], "generate") == 0)
+	{
+		for (i = 0; i < tables; i++)
+		{
+			generate(&circleTables[i]);
+		}
+		return 0;
+	}
+
+	for (i = 0; i < tables; i++)
+	{
+		count = circleOctant(circleTables[i].radius, offsets);
+		if (count != circleTables[i].count || memcmp(offsets, circleTables[i].offsets, count) != 0)
+		{
+			printf("FAIL table for radius %d doesn't match circleOctant()\n", circleTables[i].radius);
+			failures++;
+		}
+	}
+
+	fbInit();
+	for (r = 1; r <= 200; r++)
+	{
+		for (c = 0; c < (int)(sizeof(centres) / sizeof(centres[0])); c++)
+		{
+			fillBackground(0);
+			memset(expected, 0, sizeof(expected));
+			oldCircle(centres[c][0], centres[c][1], r);
+			drawCircle(centres[c][0], centres[c][1], r, 0xFFFF);
+			if (memcmp(expected, fbSurface->pixels, sizeof(expected)) != 0)
+			{
+				printf("FAIL radius %d at %d, %d differs from the old loop\n", r, centres[c][0], centres[c][1]);
+				failures++;
+			}
+		}
+	}
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
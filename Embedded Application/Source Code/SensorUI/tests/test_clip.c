@@ -0,0 +1,201 @@
+/*
+
+ File        		: test_clip.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for the clipping in framebuffer.h and sensor_ui.h.
+									Random lines, with and without a clip rectangle pushed, have
+									to give exactly the pixels of the original Bresenham loop
+									with every pixel outside the clip left out. A highlight ring
+									over the edge of the panel, the lean gauge, whose lower half
+									is below the screen, and a line and string past the bottom
+									right corner have to count the writes clipping took away and
+									the shapes it threw out whole in fbClipStats.
+
+ Build       		: gcc -std=gnu89 -no-pie -I.. -Istubs test_clip.c stubs/stubs.c -lm -o test_clip
+
+*/
+
+#define main sensorUiMain
+#include "main.c"
+#undef main
+
+#define LINES 20000
+
+FB_PIXEL expected[FB_SIZE];
+uint32_t seed = 1;
+int failures = 0;
+
+// Random number from 0 to 'range' - 1, the same every run
+int randomTo(int range)
+{
+	seed = (seed * 1103515245u) + 12345u;
+	return (int)((seed >> 16) % (uint32_t)range);
+}
+
+void plot(int x, int y, const DAMAGE_RECT *clip)
+{
+	if (x >= clip->x0 && x < clip->x1 && y >= clip->y0 && y < clip->y1)
+	{
+		expected[(y * FB_WIDTH) + x] = 1;
+	}
+}
+
+// The line as it was drawn before clipping, one pixel at a time, with the last
+// pixel left out. Pixels are only kept when they are inside 'clip'
+void oldLine(int x0, int y0, int x1, int y1, const DAMAGE_RECT *clip)
+{
+	int dx, dy, step, D, x, y, t;
+
+	if (abs(y1 - y0) < abs(x1 - x0))
+	{
+		if (x0 > x1)
+		{
+			t = x0; x0 = x1; x1 = t;
+			t = y0; y0 = y1; y1 = t;
+		}
+		dx = x1 - x0;
+		dy = y1 - y0;
+		step = dy < 0 ? -1 : 1;
+		dy = abs(dy);
+		D = (2 * dy) - dx;
+		for (x = x0, y = y0; x < x1; x++)
+		{
+			plot(x, y, clip);
+			if (D > 0)
+			{
+				y += step;
+				D += 2 * (dy - dx);
+			}
+			else
+			{
+				D += 2 * dy;
+			}
+		}
+	}
+	else
+	{
+		if (y0 > y1)
+		{
+			t = x0; x0 = x1; x1 = t;
+			t = y0; y0 = y1; y1 = t;
+		}
+		dx = x1 - x0;
+		dy = y1 - y0;
+		step = dx < 0 ? -1 : 1;
+		dx = abs(dx);
+		D = (2 * dx) - dy;
+		for (y = y0, x = x0; y < y1; y++)
+		{
+			plot(x, y, clip);
+			if (D > 0)
+			{
+				x += step;
+				D += 2 * (dx - dy);
+			}
+			else
+			{
+				D += 2 * dx;
+			}
+		}
+	}
+}
+
+// Pixels of a 'w' by 'h' block that are on the screen
+int onScreen(int x, int y, int w, int h)
+{
+	int x1 = x + w > FB_WIDTH ? FB_WIDTH : x + w, y1 = y + h > FB_HEIGHT ? FB_HEIGHT : y + h;
+
+	x = x < 0 ? 0 : x;
+	y = y < 0 ? 0 : y;
+	return x1 > x && y1 > y ? (x1 - x) * (y1 - y) : 0;
+}
+
+void check(bool ok, const char *what, uint32_t got, uint32_t want)
+{
+	printf("%s %s: %u (expected %u)\n", ok ? "ok  " : "FAIL", what, got, want);
+	if (!ok)
+	{
+		failures++;
+	}
+}
+
+int main(void)
+{
+	DAMAGE_RECT clip;
+	int x0, y0, x1, y1, i, n, ring, writes;
+	int lineFailures = 0;
+
+	fbInit();
+
+	// Lines from far off every side of the screen, half of them through a clip rectangle
+	for (n = 0; n < LINES; n++)
+	{
+		x0 = randomTo(1400) - 460;
+		y0 = randomTo(900) - 300;
+		x1 = randomTo(1400) - 460;
+		y1 = randomTo(900) - 300;
+		if (n & 1)
+		{
+			fbPushClip(randomTo(300) - 20, randomTo(200) - 20, randomTo(300), randomTo(200));
+		}
+		clip = fbClip;
+		memset(expected, 0, sizeof(expected));
+		memset(fbSurface->pixels, 0, FB_SIZE * sizeof(FB_PIXEL));
+		oldLine(x0, y0, x1, y1, &clip);
+		fbSetColour(1);
+		drawLineSegment(x0, y0, x1, y1);
+		for (i = 0; i < FB_SIZE; i++)
+		{
+			if (expected[i] != fbSurface->pixels[i])
+			{
+				if (lineFailures++ < 5)
+				{
+					printf("FAIL line %d, %d to %d, %d differs from the old loop\n", x0, y0, x1, y1);
+				}
+				break;
+			}
+		}
+		if (n & 1)
+		{
+			fbPopClip();
+		}
+	}
+	check(lineFailures == 0, "clipped lines that differ from the old loop", lineFailures, 0);
+
+	// The highlight ring on a button in the top right corner runs off the top and the right
+	ring = (2 * 87 * 4) + (2 * 4 * 39);
+	writes = onScreen(395, -3, 87, 4) + onScreen(395, 40, 87, 4) + onScreen(395, 1, 4, 39) + onScreen(478, 1, 4, 39);
+	memset(&fbClipStats, 0, sizeof(fbClipStats));
+	fbPixelWrites = 0;
+	highlightButton(403, 5, 70, 30, 0xFFFF);
+	check(fbClipStats.pixels == (uint32_t)(ring - writes), "highlight ring writes cut", fbClipStats.pixels, ring - writes);
+	check(fbPixelWrites == (uint32_t)writes, "highlight ring writes made", fbPixelWrites, writes);
+	check(fbClipStats.rejected == 0, "highlight ring sides thrown out", fbClipStats.rejected, 0);
+
+	// The lean gauge pivots on the bottom edge, so its lower half is left out before it
+	// is rasterized and nothing is cut a pixel at a time
+	memset(&fbClipStats, 0, sizeof(fbClipStats));
+	fbPixelWrites = 0;
+	drawCircle(240, 272, 130, 0xFFFF);
+	check(fbClipStats.pixels == 0, "gauge writes cut a pixel at a time", fbClipStats.pixels, 0);
+	check(fbPixelWrites > 0 && fbPixelWrites <= 4 * 130, "gauge writes made, within the top half's perimeter",
+		fbPixelWrites, 4 * 130);
+
+	// A line wholly below the screen is thrown out on its outcodes, and of a string past
+	// the bottom right corner the first character is cut and the second thrown out
+	memset(&fbClipStats, 0, sizeof(fbClipStats));
+	fbSetFont(&GLCD_Font_16x24);
+	drawDiagonalLine(240, 280, 300, 400, 0xFFFF);
+	check(fbClipStats.rejected == 1, "line below the screen thrown out", fbClipStats.rejected, 1);
+	check(fbClipStats.pixels == 120, "line below the screen writes cut", fbClipStats.pixels, 120);
+	memset(&fbClipStats, 0, sizeof(fbClipStats));
+	fbDrawString(470, 260, "AB");
+	check(fbClipStats.rejected == 1, "string characters thrown out", fbClipStats.rejected, 1);
+	check(fbClipStats.pixels == (uint32_t)((2 * 16 * 24) - onScreen(470, 260, 16, 24)), "string writes cut",
+		fbClipStats.pixels, (2 * 16 * 24) - onScreen(470, 260, 16, 24));
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
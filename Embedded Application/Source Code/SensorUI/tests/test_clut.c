@@ -0,0 +1,89 @@
+/*
+
+ File        		: test_clut.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for the L8 frame buffers in palette.h, built with
+									HUD_USE_CLUT set. Nothing may reach the LTDC look-up table
+									outside the vertical blank: start up only marks the table,
+									and the interrupt loads all of it. The main screen has to
+									be drawn in the named entries alone, and changing the colour
+									scheme has to leave every pixel as it was and load just the
+									theme entry that changed at the next blank.
+
+ Build       		: gcc -std=gnu89 -no-pie -I.. -Istubs test_clut.c stubs/stubs.c -lm -o test_clut
+
+*/
+
+#define HUD_USE_CLUT 1
+#define main sensorUiMain
+#include "main.c"
+#undef main
+
+FB_PIXEL drawn[FB_SIZE];
+int failures = 0;
+
+void check(bool ok, const char *what, uint32_t got, uint32_t want)
+{
+	printf("%s %s: %u (expected %u)\n", ok ? "ok  " : "FAIL", what, got, want);
+	if (!ok)
+	{
+		failures++;
+	}
+}
+
+// Runs the LTDC interrupt as it fires at the start of the vertical blank
+void vblank(void)
+{
+	LTDC->ISR = LTDC_ISR_LIF;
+	LTDC_IRQHandler();
+}
+
+int main(void)
+{
+	uint32_t loaded, other = 0, fore = 0;
+	int i;
+
+	fbInit();
+	check(paletteStats.entriesLoaded == 0, "entries written by fbInit()", paletteStats.entriesLoaded, 0);
+	check(LTDC_Layer1->PFCR == LTDC_PIXEL_FORMAT_L8, "layer 1 format", LTDC_Layer1->PFCR, LTDC_PIXEL_FORMAT_L8);
+	overlayInit();
+	check(LTDC->SRCR == LTDC_SRCR_VBR, "layers reloaded at the blank", LTDC->SRCR, LTDC_SRCR_VBR);
+	vblank();
+	check(paletteStats.entriesLoaded == PALETTE_SIZE, "entries written in the first blank",
+		paletteStats.entriesLoaded, PALETTE_SIZE);
+
+	bgCacheInit();
+	fbSetFont(&GLCD_Font_16x24);
+	hudInit();
+	temperature = 42;
+	colourScheme = 1;
+	mainScreen();
+	vblank();
+	memcpy(drawn, fbBuffer[fbFront].pixels, sizeof(drawn));
+	for (i = 0; i < FB_SIZE; i++)
+	{
+		other += drawn[i] > HUD_THEME_FORE;
+		fore += drawn[i] == HUD_THEME_FORE;
+	}
+	check(other == 0, "main screen pixels outside the named entries", other, 0);
+	check(fore > 0 && paletteToRGB565(HUD_THEME_FORE) == 0x07F9, "cyan scheme foreground", paletteToRGB565(HUD_THEME_FORE),
+		0x07F9);
+
+	// Red scheme has the same background, so the same pixels and only the foreground entry loaded
+	loaded = paletteStats.entriesLoaded;
+	colourScheme = 3;
+	mainScreen();
+	check(paletteStats.entriesLoaded == loaded, "entries written before the blank", paletteStats.entriesLoaded - loaded, 0);
+	vblank();
+	check(paletteStats.entriesLoaded - loaded == 1, "entries written for the scheme change",
+		paletteStats.entriesLoaded - loaded, 1);
+	check(LTDC_Layer1->CLUTWR == (((uint32_t)HUD_THEME_FORE << 24) | dma2dRGB888(0xFA20)), "entry written",
+		LTDC_Layer1->CLUTWR, ((uint32_t)HUD_THEME_FORE << 24) | dma2dRGB888(0xFA20));
+	check(memcmp(drawn, fbBuffer[fbFront].pixels, sizeof(drawn)) == 0, "pixels changed by the scheme change",
+		memcmp(drawn, fbBuffer[fbFront].pixels, sizeof(drawn)) != 0, 0);
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+/*
+
+ File        		: test_fusion.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for fusion.h. Replays a ride through both filters
+									at the 500 Hz the MPU is read at: level for a second, leaning
+									into 40 degrees over a second, holding the corner for six
+									and straightening up over one, with noise on every reading
+									and, for some runs, a gyro bias. In a coordinated corner the
+									accelerometer reads straight down through the bike, so only
+									the gyro knows the lean. Each filter has to follow the lean
+									through the corner, settle back to level afterwards, start
+									on the right angle and pull itself round from a wrong one.
+
+ Build       		: gcc -std=gnu89 -no-pie -I.. -Istubs test_fusion.c stubs/stubs.c -lm -o test_fusion
+
+*/
+
+#define main sensorUiMain
+#include "main.c"
+#undef main
+
+#define RATE_HZ 500
+#define RIDE_SECONDS 12
+// Largest error allowed while the corner is held, after the lean in has settled (degrees)
+#define TURN_TOLERANCE 6.0
+// Largest error allowed over the last second, once level again (degrees)
+#define STEADY_TOLERANCE 1.5
+// Longest the filter can take to come within a degree after starting wrong (s)
+#define CONVERGE_SECONDS 8.0
+
+const double pi = 3.14159265358979323846;
+uint32_t seed;
+int failures = 0;
+
+// Noise from -1 to 1, the same every run
+double noise(void)
+{
+	seed = (seed * 1103515245u) + 12345u;
+	return ((int)((seed >> 16) % 2001) - 1000) / 1000.0;
+}
+
+// Lean through the ride in degrees
+double lean(double t)
+{
+	if (t < 1.0)
+	{
+		return 0.0;
+	}
+	if (t < 2.0)
+	{
+		return 40.0 * (t - 1.0);
+	}
+	if (t < 8.0)
+	{
+		return 40.0;
+	}
+	if (t < 9.0)
+	{
+		return 40.0 * (9.0 - t);
+	}
+	return 0.0;
+}
+
+// Fills in the sample the MPU gives 'i' samples in while leaning 'phi' degrees and
+// rolling at 'rate' degrees a second. 'turning' has the accelerometer pushed straight
+// down through the bike, as it is in a coordinated corner, rather than seeing gravity
+void makeSample(IMU_SAMPLE *sample, int i, double phi, double rate, double bias, bool turning)
+{
+	double rad = phi * (pi / 180.0);
+
+	memset(sample, 0, sizeof(*sample));
+	sample->gyro[0] = (int16_t)(((rate + bias) * 131.0) + (3.0 * noise()));
+	sample->accel[0] = (int16_t)(50.0 * noise());
+	if (turning)
+	{
+		sample->accel[1] = (int16_t)(50.0 * noise());
+		sample->accel[2] = (int16_t)((16384.0 / cos(rad)) + (50.0 * noise()));
+	}
+	else
+	{
+		sample->accel[1] = (int16_t)((16384.0 * sin(rad)) + (50.0 * noise()));
+		sample->accel[2] = (int16_t)((16384.0 * cos(rad)) + (50.0 * noise()));
+	}
+	sample->micros = (uint32_t)(i + 1) * (1000000 / RATE_HZ);
+	sample->sequence = (uint32_t)i;
+}
+
+void check(bool ok, const char *filter, const char *what, double got, double limit)
+{
+	printf("%s %s %s: %.2f (limit %.2f)\n", ok ? "ok  " : "FAIL", filter, what, got, limit);
+	if (!ok)
+	{
+		failures++;
+	}
+}
+
+// Rides the corner, with 'turning' for a coordinated corner and 'bias' on the gyro (deg/s)
+void ride(int filter, const char *name, bool turning, double bias)
+{
+	IMU_SAMPLE sample;
+	double t, phi, rate, error, turnError = 0.0, steadyError = 0.0;
+	char what[64];
+	int i;
+
+	fusionInit();
+	fusionSetFilter(filter);
+	seed = 1;
+	for (i = 0; i < RIDE_SECONDS * RATE_HZ; i++)
+	{
+		t = (double)i / RATE_HZ;
+		phi = lean(t);
+		rate = (lean(t + 1e-4) - phi) / 1e-4;
+		makeSample(&sample, i, phi, rate, bias, turning && t >= 1.0 && t < 9.0);
+		fusionUpdate(&sample);
+
+		// Roll is turned round to match the screen
+		error = fabs(fusionOutput.roll + phi);
+		if (t > 2.5 && t < 8.0 && error > turnError)
+		{
+			turnError = error;
+		}
+		if (t > RIDE_SECONDS - 1.0 && error > steadyError)
+		{
+			steadyError = error;
+		}
+	}
+	sprintf(what, "%s corner, %.0f deg/s bias, error in corner", turning ? "coordinated" : "tilted", bias);
+	check(turnError <= TURN_TOLERANCE, name, what, turnError, TURN_TOLERANCE);
+	sprintf(what, "%s corner, %.0f deg/s bias, steady-state error", turning ? "coordinated" : "tilted", bias);
+	check(steadyError <= STEADY_TOLERANCE, name, what, steadyError, STEADY_TOLERANCE);
+}
+
+// Holds still at 'phi' degrees after starting level, and times how long it takes to be
+// within a degree. The first sample also has to start the filter on the right angle
+void converge(int filter, const char *name, double phi)
+{
+	IMU_SAMPLE sample;
+	double first, settled = -1.0;
+	int i;
+
+	fusionInit();
+	fusionSetFilter(filter);
+	seed = 2;
+	makeSample(&sample, 0, phi, 0.0, 0.0, false);
+	fusionUpdate(&sample);
+	first = fabs(fusionOutput.roll + phi);
+	check(first <= 1.0, name, "error on the first sample", first, 1.0);
+
+	// Starting level and then seeing a lean with no roll on the gyro, as if the filter
+	// had been thrown off, has to be pulled round by the accelerometer alone
+	fusionInit();
+	fusionSetFilter(filter);
+	makeSample(&sample, 0, 0.0, 0.0, 0.0, false);
+	fusionUpdate(&sample);
+	for (i = 1; i < (int)(CONVERGE_SECONDS * 2 * RATE_HZ) && settled < 0.0; i++)
+	{
+		makeSample(&sample, i, phi, 0.0, 0.0, false);
+		fusionUpdate(&sample);
+		if (fabs(fusionOutput.roll + phi) <= 1.0)
+		{
+			settled = (double)i / RATE_HZ;
+		}
+	}
+	check(settled >= 0.0 && settled <= CONVERGE_SECONDS, name, "seconds to come within a degree", settled,
+		CONVERGE_SECONDS);
+}
+
+int main(void)
+{
+	const char *names[2] = {"complementary", "madgwick"};
+	int filter;
+
+	for (filter = FUSION_COMPLEMENTARY; filter <= FUSION_MADGWICK; filter++)
+	{
+		converge(filter, names[filter], 28.6);
+		ride(filter, names[filter], false, 0.0);
+		ride(filter, names[filter], false, 1.0);
+		ride(filter, names[filter], true, 0.0);
+		ride(filter, names[filter], true, 1.0);
+	}
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures != 0;
+}
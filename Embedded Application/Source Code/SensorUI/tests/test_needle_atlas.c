@@ -0,0 +1,204 @@
+/*
+
+ File        		: test_needle_atlas.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Generator and host test for the needle atlas in
+									needle_atlas_data.h. Every image of the needle is rendered
+									anti-aliased from its distance to the centre line and packed
+									the way needleSpriteWrite() reads it. Run with 'generate' to
+									print needle_atlas_data.h, otherwise the images are rendered
+									again and have to match the tables byte for byte.
+
+ Build       		: gcc -std=gnu89 -Wall -I.. test_needle_atlas.c -lm -o test_needle_atlas
+
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+// The atlas only needs the standard types and the sine table steps, so main.h and the HAL are left out
+#define __MAIN_H
+#include "sine_table.h"
+#include "needle_atlas.h"
+
+// Half the width of the solid part of the needle, the edge fades out over one more pixel
+#define NEEDLE_HALF_WIDTH 0.75f
+// Room for the packed images while they are rendered
+#define ATLAS_LIMIT (NEEDLE_SPRITES * 1024)
+
+uint8_t atlas[ATLAS_LIMIT];
+NEEDLE_SPRITE sprites[NEEDLE_SPRITES];
+uint32_t pixels = 0;
+
+// How much of the pixel at 'px', 'py' the needle from the pivot to 'tx', 'ty'
+// covers, from 0 to 15
+int needleCoverage(float px, float py, float tx, float ty)
+{
+	float t = ((px * tx) + (py * ty)) / ((tx * tx) + (ty * ty));
+	float dx, dy, cover;
+
+	t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+	dx = px - (t * tx);
+	dy = py - (t * ty);
+	cover = NEEDLE_HALF_WIDTH + 0.5f - sqrtf((dx * dx) + (dy * dy));
+	cover = cover < 0.0f ? 0.0f : (cover > 1.0f ? 1.0f : cover);
+	return (int)((cover * 15.0f) + 0.5f);
+}
+
+// Where the needle's centre line crosses row 'y', kept within the ends of the needle
+float needleRowX(float y, float tx, float ty)
+{
+	float x = ty != 0.0f ? (y * tx) / ty : 0.0f;
+	float lo = tx < 0.0f ? tx : 0.0f, hi = tx > 0.0f ? tx : 0.0f;
+
+	return x < lo ? lo : (x > hi ? hi : x);
+}
+
+// Renders and packs the image for one angle in degrees, returning the bytes used
+uint32_t needleRender(NEEDLE_SPRITE *sprite, int angle, int length, uint8_t *out)
+{
+	float a = (float)angle * (3.14159265f / 180.0f);
+	float tx = (float)length * sinf(a), ty = -(float)length * cosf(a);
+	float reach = NEEDLE_HALF_WIDTH + 1.0f, left, right, xa, xb;
+	int top = (int)floorf((ty < 0.0f ? ty : 0.0f) - reach);
+	int bottom = (int)ceilf((ty > 0.0f ? ty : 0.0f) + reach);
+	int xMin = 0x7FFF, xMax = -0x7FFF, y, x, x0, x1, first, last;
+	uint32_t used = 0;
+	uint8_t *row;
+
+	// First pass finds the box, the second packs the rows into it
+	for (y = top; y <= bottom; y++)
+	{
+		xa = needleRowX((float)y - reach, tx, ty);
+		xb = needleRowX((float)y + reach, tx, ty);
+		left = (xa < xb ? xa : xb) - reach;
+		right = (xa > xb ? xa : xb) + reach;
+		for (x = (int)floorf(left); x <= (int)ceilf(right); x++)
+		{
+			if (needleCoverage((float)x, (float)y, tx, ty) != 0)
+			{
+				xMin = x < xMin ? x : xMin;
+				xMax = x > xMax ? x : xMax;
+			}
+		}
+	}
+	sprite->x = (int16_t)xMin;
+	sprite->y = (int16_t)top;
+	sprite->w = (uint16_t)(xMax - xMin + 1);
+	sprite->h = (uint16_t)(bottom - top + 1);
+
+	for (y = top; y <= bottom; y++)
+	{
+		xa = needleRowX((float)y - reach, tx, ty);
+		xb = needleRowX((float)y + reach, tx, ty);
+		x0 = (int)floorf((xa < xb ? xa : xb) - reach);
+		x1 = (int)ceilf((xa > xb ? xa : xb) + reach);
+		first = 0x7FFF;
+		last = -0x7FFF;
+		for (x = x0; x <= x1; x++)
+		{
+			if (needleCoverage((float)x, (float)y, tx, ty) != 0)
+			{
+				first = x < first ? x : first;
+				last = x > last ? x : last;
+			}
+		}
+		if (first > last)
+		{
+			first = xMin;
+			last = xMin - 1;
+		}
+		row = out + used;
+		row[0] = (uint8_t)(first - xMin);
+		row[1] = (uint8_t)(last - first + 1);
+		for (x = first; x <= last; x++)
+		{
+			row[2 + x - first] = (uint8_t)needleCoverage((float)x, (float)y, tx, ty);
+		}
+		used += 2 + (last - first + 1);
+		pixels += last - first + 1;
+	}
+	return used;
+}
+
+// Renders every angle into 'atlas' and 'sprites', returning the bytes used
+uint32_t render(void)
+{
+	uint32_t offset = 0;
+	int i;
+
+	for (i = 0; i < NEEDLE_SPRITES; i++)
+	{
+		sprites[i].offset = offset;
+		offset += needleRender(&sprites[i], i - NEEDLE_MAX_ANGLE, NEEDLE_LENGTH, atlas + offset);
+	}
+	return offset;
+}
+
+// Prints needle_atlas_data.h
+void generate(uint32_t bytes)
+{
+	uint32_t i;
+
+	printf("/*\n\n File        \t\t: needle_atlas_data.h\n\n Primary Author : Joshua Crafton\n\n");
+	printf(" Description \t\t: The needle images for needle_atlas.h, made by\n");
+	printf("\t\t\t\t\t\t\t\t\ttests/test_needle_atlas.c. Don't edit by hand, run it with\n");
+	printf("\t\t\t\t\t\t\t\t\t'generate' to make them again. %u bytes holding %u alpha\n", bytes, pixels);
+	printf("\t\t\t\t\t\t\t\t\tvalues for a needle %d pixels long.\n\n*/\n\n", NEEDLE_LENGTH);
+	printf("#ifndef __NEEDLE_ATLAS_DATA_H\n#define __NEEDLE_ATLAS_DATA_H\n\n");
+	printf("// Box relative to the pivot and where its rows start, for -%d to %d degrees\n", NEEDLE_MAX_ANGLE,
+		NEEDLE_MAX_ANGLE);
+	printf("const NEEDLE_SPRITE needleSprites[NEEDLE_SPRITES] =\n{\n");
+	for (i = 0; i < NEEDLE_SPRITES; i++)
+	{
+		printf("\t{%d, %d, %u, %u, %u}%s\n", sprites[i].x, sprites[i].y, sprites[i].w, sprites[i].h,
+			sprites[i].offset, i + 1 < NEEDLE_SPRITES ? "," : "");
+	}
+	printf("};\n\n// Every row of every image, a start column, a length and then that many alpha values\n");
+	printf("const uint8_t needleAtlas[%u] =\n{", bytes);
+	for (i = 0; i < bytes; i++)
+	{
+		printf("%s%u%s", i % 24 == 0 ? "\n\t" : " ", atlas[i], i + 1 < bytes ? "," : "");
+	}
+	printf("\n};\n\n#endif\n");
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t bytes = render();
+	int failures = 0, i;
+
+	if (argc > 1 && strcmp(argv[1], "generate") == 0)
+	{
+		generate(bytes);
+		return 0;
+	}
+
+	if (bytes != sizeof(needleAtlas))
+	{
+		printf("FAIL atlas is %u bytes, the tables hold %u\n", bytes, (uint32_t)sizeof(needleAtlas));
+		failures++;
+	}
+	else if (memcmp(atlas, needleAtlas, bytes) != 0)
+	{
+		printf("FAIL atlas differs from the tables\n");
+		failures++;
+	}
+	for (i = 0; i < NEEDLE_SPRITES; i++)
+	{
+		if (memcmp(&sprites[i], &needleSprites[i], sizeof(NEEDLE_SPRITE)) != 0)
+		{
+			printf("FAIL image for %d degrees differs from the tables\n", i - NEEDLE_MAX_ANGLE);
+			failures++;
+		}
+	}
+
+	printf("%u bytes, %u alpha values\n", bytes, pixels);
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/*
+
+ File        		: test_sine_table.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for sine_table.h against libm. Every table entry
+									has to be round(32767 * sin) for its quarter degree, and the
+									needle end points for angles from -90 to 90 degrees in 0.025
+									degree steps have to land within a pixel of where the old
+									double precision cos() and sin() put them. Scaling has to
+									round down for negative values as well as positive. Run with
+									'generate' to print the table to paste back into the header.
+
+ Build       		: gcc -std=gnu89 -I.. test_sine_table.c -lm -o test_sine_table
+
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+// sine_table.h only needs the standard types, so main.h and the HAL are left out
+#define __MAIN_H
+#include "sine_table.h"
+
+// Length of the lean needle and where it pivots, as set up in hudInit()
+#define RADIUS 128
+#define PIVOT_X 240
+#define PIVOT_Y 272
+// Largest error of a table entry allowed, as a fraction of one
+#define TABLE_TOLERANCE 1.6e-5
+
+int main(int argc, char **argv)
+{
+	const double pi = 3.14159265358979323846;
+	double worst = 0.0, error, rad;
+	float angle, radAngle;
+	int failures = 0, same = 0, total = 0, i, step, oldX, oldY, newX, newY;
+	int32_t q15;
+
+	if (argc > 1 && strcmp(argv[1], "generate") == 0)
+	{
+		printf("const int16_t sineQ15[SINE_QUARTER + 1] =\n{");
+		for (i = 0; i <= SINE_QUARTER; i++)
+		{
+			printf("%s%d%s", i % 12 == 0 ? "\n\t" : " ",
+				(int)floor((SINE_ONE * sin((i * pi) / (180.0 * SINE_STEPS_PER_DEGREE))) + 0.5), i < SINE_QUARTER ? "," : "");
+		}
+		printf("\n};\n");
+		return 0;
+	}
+
+	for (i = 0; i <= SINE_QUARTER; i++)
+	{
+		rad = (i * pi) / (180.0 * SINE_STEPS_PER_DEGREE);
+		if (sineQ15[i] != (int)floor((SINE_ONE * sin(rad)) + 0.5))
+		{
+			printf("FAIL entry %d is %d\n", i, sineQ15[i]);
+			failures++;
+		}
+		error = fabs((sineQ15[i] / (double)SINE_ONE) - sin(rad));
+		worst = error > worst ? error : worst;
+	}
+	if (worst > TABLE_TOLERANCE)
+	{
+		printf("FAIL table error %.2g\n", worst);
+		failures++;
+	}
+
+	// Folding onto the first quarter has to agree with libm all the way round
+	for (step = -8 * SINE_QUARTER; step <= 8 * SINE_QUARTER; step++)
+	{
+		rad = (step * pi) / (180.0 * SINE_STEPS_PER_DEGREE);
+		if (fabs((sinQ15(step) / (double)SINE_ONE) - sin(rad)) > TABLE_TOLERANCE ||
+			fabs((cosQ15(step) / (double)SINE_ONE) - cos(rad)) > TABLE_TOLERANCE)
+		{
+			printf("FAIL step %d folds wrongly\n", step);
+			failures++;
+		}
+	}
+
+	// Scaling rounds down either side of zero
+	for (i = -RADIUS; i <= RADIUS; i++)
+	{
+		for (q15 = -SINE_ONE; q15 <= SINE_ONE; q15++)
+		{
+			if (sineScale(i, q15) != (int)floor((i * (double)q15) / 32768.0))
+			{
+				printf("FAIL %d scaled by %d is %d\n", i, (int)q15, sineScale(i, q15));
+				failures++;
+			}
+		}
+	}
+
+	// End points, the old way being getCircumferenceXY() before the table
+	for (i = -3600; i <= 3600; i++)
+	{
+		angle = i * 0.025f;
+		radAngle = (float)(angle * (3.14159265f / 180.0)) + ((3 * 3.14159265f) / 2);
+		oldX = (int)((RADIUS * (float)cos(radAngle)) + PIVOT_X);
+		oldY = (int)((RADIUS * (float)sin(radAngle)) + PIVOT_Y);
+		step = sineStep(angle);
+		newX = PIVOT_X + sineScale(RADIUS, sinQ15(step));
+		newY = PIVOT_Y + sineScale(RADIUS, -cosQ15(step));
+		if (abs(newX - oldX) > 1 || abs(newY - oldY) > 1)
+		{
+			printf("FAIL %.3f degrees: %d, %d against %d, %d\n", angle, newX, newY, oldX, oldY);
+			failures++;
+		}
+		same += newX == oldX && newY == oldY;
+		total++;
+	}
+
+	printf("table error %.2g, %d of %d end points the same as libm, the rest within a pixel\n", worst, same, total);
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+/*
+
+ File        		: test_text_slot.c
+
+ Primary Author : Joshua Crafton
+
+ Description 		: Host test for the text slots in text.h. A slot that only
+									redraws the characters that changed has to leave exactly the
+									pixels of one drawn from nothing, including the temperature
+									reading, whose 16 pixel wide digits are placed 15 apart so
+									each one covers the first column of the next.
+
+ Build       		: gcc -std=gnu89 -no-pie -I.. -Istubs test_text_slot.c stubs/stubs.c -lm -o test_text_slot
+
+*/
+
+#define main sensorUiMain
+#include "main.c"
+#undef main
+
+FB_PIXEL expected[FB_SIZE];
+// A font where every glyph has its first column set and its last clear, so a
+// character drawn over the start of the next shows
+uint8_t testBits[95 * 2 * 24];
+GLCD_FONT testFont = {16, 24, 32, 95, testBits};
+int failures = 0;
+
+// Shows 'to' in a slot 'advance' pixels per character, once from nothing and once
+// after it showed 'from', and compares the two
+void check(int advance, const char *from, const char *to)
+{
+	TEXT_SLOT slot;
+
+	fillBackground(0);
+	textSlotInit(&slot, 220, 50, advance);
+	textSlotDraw(&slot, to, 0xFFFF, 0x0000);
+	memcpy(expected, fbSurface->pixels, sizeof(expected));
+
+	fillBackground(0);
+	textSlotInit(&slot, 220, 50, advance);
+	textSlotDraw(&slot, from, 0xFFFF, 0x0000);
+	textSlotDraw(&slot, to, 0xFFFF, 0x0000);
+	if (memcmp(expected, fbSurface->pixels, sizeof(expected)) != 0)
+	{
+		printf("FAIL \"%s\" to \"%s\" %d apart differs from drawing it whole\n", from, to, advance);
+		failures++;
+	}
+}
+
+int main(void)
+{
+	char from[8], to[8];
+	int i, a, b;
+
+	for (i = 0; i < (int)sizeof(testBits); i++)
+	{
+		testBits[i] = (uint8_t)((i * 37) ^ (i >> 3));
+	}
+	for (i = 0; i < 95 * 24; i++)
+	{
+		testBits[i * 2] |= 0x01;
+		testBits[(i * 2) + 1] &= 0x7F;
+	}
+
+	fbInit();
+	fbSetFont(&testFont);
+	for (a = 0; a < 1000; a += 37)
+	{
+		for (b = 0; b < 1000; b += 41)
+		{
+			sprintf(from, "%03d", a);
+			sprintf(to, "%03d", b);
+			check(15, from, to);
+			check(0, from, to);
+		}
+	}
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
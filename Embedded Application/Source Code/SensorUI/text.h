@@ -0,0 +1,241 @@
+/*
+
+ File        		: text.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for cached text drawing. Glyphs are expanded
+									to pixels once for each font and colour pair and kept in a
+									small cache, so drawing a character is a straight block copy.
+									Text slots remember what they last showed at a position and
+									only redraw the characters that have changed.
+
+*/
+
+#ifndef __TEXT_H
+#define __TEXT_H
+
+#include "main.h"
+
+// Glyphs kept at once, the least recently used one is replaced when it is full
+#define TEXT_CACHE_SIZE 24
+// Biggest glyph the cache can hold, enough for GLCD_Font_16x24
+#define TEXT_GLYPH_MAX_PIXELS (16 * 24)
+// Longest string a text slot can show
+#define TEXT_SLOT_MAX 15
+
+typedef struct
+{
+	const GLCD_FONT *font;  // NULL when the entry is empty
+	uint16_t fore, back;
+	int ch;
+	uint32_t lastUsed;
+	FB_PIXEL pixels[TEXT_GLYPH_MAX_PIXELS];
+} TEXT_GLYPH;
+
+// A place on screen that shows a short piece of text which changes over time
+typedef struct
+{
+	int x, y;
+	int advance;            // Pixels between characters, 0 for the font width
+	const GLCD_FONT *font;
+	uint16_t fore, back;
+	uint32_t generation;    // Matches textGeneration while what is on screen is known
+	char text[TEXT_SLOT_MAX + 1];
+} TEXT_SLOT;
+
+typedef struct
+{
+	uint32_t hits;          // Glyphs found in the cache
+	uint32_t misses;        // Glyphs that had to be expanded
+	uint32_t blits;         // Glyphs copied to the frame buffer
+	uint32_t skipped;       // Slot characters left alone because they hadn't changed
+} TEXT_STATS;
+
+TEXT_GLYPH textGlyphs[TEXT_CACHE_SIZE];
+TEXT_STATS textStats;
+uint32_t textClock = 0;
+// Bumped whenever the screen is cleared, so every slot knows it has to redraw
+uint32_t textGeneration = 1;
+
+// Forgets what every text slot is showing
+void textInvalidateSlots(void)
+{
+	textGeneration++;
+}
+
+// Expands one character of 'font' into frame buffer pixels, one row after another
+void textExpandGlyph(TEXT_GLYPH *glyph, const GLCD_FONT *font, int ch, uint16_t fore, uint16_t back)
+{
+	const uint8_t *bitmap;
+	FB_PIXEL *dst = glyph->pixels;
+	int bytesPerRow, i, j;
+
+	bytesPerRow = (font->width + 7) / 8;
+	bitmap = font->bitmap + ((ch - (int)font->offset) * bytesPerRow * font->height);
+	for (j = 0; j < font->height; j++, bitmap += bytesPerRow)
+	{
+		for (i = 0; i < font->width; i++)
+		{
+			*dst++ = ((bitmap[i >> 3] >> (i & 7)) & 1) ? fore : back;
+		}
+	}
+	glyph->font = font;
+	glyph->ch = ch;
+	glyph->fore = fore;
+	glyph->back = back;
+}
+
+// Finds a glyph in the cache, expanding it into the least recently used entry when
+// it isn't there. Returns NULL if the font is too big to cache
+TEXT_GLYPH *textGetGlyph(const GLCD_FONT *font, int ch, uint16_t fore, uint16_t back)
+{
+	TEXT_GLYPH *oldest = &textGlyphs[0];
+	int i;
+
+	if (font->width * font->height > TEXT_GLYPH_MAX_PIXELS)
+	{
+		return NULL;
+	}
+	textClock++;
+	for (i = 0; i < TEXT_CACHE_SIZE; i++)
+	{
+		if (textGlyphs[i].font == font && textGlyphs[i].ch == ch &&
+			textGlyphs[i].fore == fore && textGlyphs[i].back == back)
+		{
+			textGlyphs[i].lastUsed = textClock;
+			textStats.hits++;
+			return &textGlyphs[i];
+		}
+		if (textGlyphs[i].lastUsed < oldest->lastUsed)
+		{
+			oldest = &textGlyphs[i];
+		}
+	}
+
+	// The entry might still be the source of a DMA2D copy
+	fbSync();
+	textExpandGlyph(oldest, font, ch, fore, back);
+	oldest->lastUsed = textClock;
+	textStats.misses++;
+	return oldest;
+}
+
+// Draws one character of 'font' with its top left corner at 'x', 'y'
+void textDrawChar(int x, int y, const GLCD_FONT *font, int ch, uint16_t fore, uint16_t back)
+{
+	TEXT_GLYPH *glyph;
+	GLCD_FONT *oldFont = fbFont;
+	FB_PIXEL *dst;
+	int w = font->width, h = font->height, j;
+
+	if (fbRejects(x, y, w, h, w * h))
+	{
+		return;
+	}
+	glyph = textGetGlyph(font, ch, fore, back);
+	fbMarkDamage(x, y, w, h);
+	if (glyph == NULL || !fbContains(x, y, w, h))
+	{
+		// Partly outside the clip, so leave the clipping to the plain renderer
+		fbSetColour(fore);
+		fbSetBackColour(back);
+		fbSetFont((GLCD_FONT *)font);
+		fbSync();
+		fbDrawChar(x, y, ch);
+		fbSetFont(oldFont);
+		return;
+	}
+
+	dst = fbAddress(x, y);
+	if (w * h >= FB_DMA2D_MIN_PIXELS)
+	{
+		fbBlockCopy(glyph->pixels, w, dst, fbSurface->width, w, h);
+	}
+	else
+	{
+		fbSync();
+		for (j = 0; j < h; j++)
+		{
+			memcpy(dst + (j * fbSurface->width), glyph->pixels + (j * w), w * sizeof(FB_PIXEL));
+		}
+	}
+	fbPixelWrites += w * h;
+	textStats.blits++;
+}
+
+// Draws a whole string from the glyph cache in the current font
+void textDrawString(int x, int y, const char *str, uint32_t fore, uint32_t back)
+{
+	if (fbFont == NULL)
+	{
+		return;
+	}
+	while (*str)
+	{
+		textDrawChar(x, y, fbFont, *str++, (uint16_t)fore, (uint16_t)back);
+		x += fbFont->width;
+	}
+}
+
+// Sets up a slot at 'x', 'y' in the current font. 'advance' is the gap between
+// characters, or 0 to use the font width
+void textSlotInit(TEXT_SLOT *slot, int x, int y, int advance)
+{
+	slot->x = x;
+	slot->y = y;
+	slot->advance = advance;
+	slot->font = fbFont;
+	slot->generation = 0;
+	slot->text[0] = '\0';
+}
+
+// Shows 'str' in the slot. Only characters that differ from what is already
+// there are drawn, and if the text got shorter the leftover ones are cleared.
+// When the characters are closer together than the font is wide, drawing one
+// covers the start of the next, so the next is drawn again over it
+void textSlotDraw(TEXT_SLOT *slot, const char *str, uint32_t fore, uint32_t back)
+{
+	int advance, i, oldLen;
+	bool known, redrawAll, overlapped, redrawNext = false;
+
+	if (slot->font == NULL)
+	{
+		slot->font = fbFont;
+		if (slot->font == NULL)
+		{
+			return;
+		}
+	}
+	advance = slot->advance > 0 ? slot->advance : slot->font->width;
+	known = slot->generation == textGeneration;
+	redrawAll = !known || (uint16_t)fore != slot->fore || (uint16_t)back != slot->back;
+	oldLen = known ? (int)strlen(slot->text) : 0;
+	overlapped = advance < slot->font->width;
+
+	for (i = 0; str[i] != '\0' && i < TEXT_SLOT_MAX; i++)
+	{
+		if (!redrawAll && !redrawNext && i < oldLen && slot->text[i] == str[i])
+		{
+			textStats.skipped++;
+			continue;
+		}
+		textDrawChar(slot->x + (i * advance), slot->y, slot->font, str[i], (uint16_t)fore, (uint16_t)back);
+		slot->text[i] = str[i];
+		redrawNext = overlapped;
+	}
+	slot->text[i] = '\0';
+
+	// Blank out whatever was left over from longer text
+	if (i < oldLen)
+	{
+		fbFillRect(slot->x + (i * advance), slot->y, ((oldLen - i - 1) * advance) + slot->font->width,
+			slot->font->height, back);
+	}
+
+	slot->fore = (uint16_t)fore;
+	slot->back = (uint16_t)back;
+	slot->generation = textGeneration;
+}
+
+#endif
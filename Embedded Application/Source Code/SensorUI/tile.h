@@ -0,0 +1,211 @@
+/*
+
+ File        		: tile.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the tile renderer. The screen is split
+									into 32x32 tiles and each tile a display list touches is
+									drawn into a small buffer in DTCM, where overlapping shapes
+									only cost a fast on-chip write each. The finished tile is
+									then copied into the SDRAM back buffer with one DMA2D
+									transfer, so every pixel of it reaches SDRAM exactly once.
+									Turned off by default, set HUD_USE_TILES to 1 to use it.
+
+*/
+
+#ifndef __TILE_H
+#define __TILE_H
+
+#include "main.h"
+
+// Set to 1 to draw recorded screens through DTCM tiles instead of straight into SDRAM
+#ifndef HUD_USE_TILES
+#define HUD_USE_TILES 0
+#endif
+// Set to 1 to time tileRender() against dlReplay() at start up, see tileBenchmark()
+#ifndef TILE_BENCH
+#define TILE_BENCH 0
+#endif
+
+#define TILE_SIZE 32
+#define TILE_COLUMNS ((FB_WIDTH + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_ROWS ((FB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE)
+
+// DTCM starts at 0x20000000 and is zero wait state for both the CPU and the DMA2D
+#ifdef __ARMCC_VERSION
+#define TILE_DTCM __attribute__((section(".ARM.__at_0x20000000")))
+#else
+#define TILE_DTCM
+#endif
+
+typedef struct
+{
+	uint32_t frames;
+	uint32_t tiles;          // Tiles looked at by the last frame
+	uint32_t tilesDrawn;     // Tiles the list touched, so were drawn and copied out
+	uint32_t tilesSeeded;    // Tiles that had to start from what was in the back buffer
+	uint32_t composePixels;  // Pixels drawn into DTCM by the last frame
+	uint32_t sdramPixels;    // Pixels written to SDRAM by the last frame
+	uint32_t lastTicks;      // Time the last frame took (ms)
+} TILE_STATS;
+
+// Two buffers so one can be drawn into while the DMA2D copies out the other
+FB_PIXEL tileBuffer[2][TILE_SIZE * TILE_SIZE] TILE_DTCM;
+TILE_STATS tileStats;
+
+// True when the first command of 'list' to touch 'area' is a fill that covers all of
+// it, in which case nothing underneath the tile needs to be read back from SDRAM
+bool tileCoveredByFill(const DISPLAY_LIST *list, const DAMAGE_RECT *area)
+{
+	const DL_COMMAND *cmd;
+	int i;
+
+	for (i = 0; i < list->count; i++)
+	{
+		cmd = &list->cmds[i];
+		if (!dlOverlaps(&cmd->box, area))
+		{
+			continue;
+		}
+		return cmd->op == DL_FILL_RECT && cmd->box.x0 <= area->x0 && cmd->box.y0 <= area->y0 &&
+			cmd->box.x1 >= area->x1 && cmd->box.y1 >= area->y1;
+	}
+	return false;
+}
+
+// Draws 'list' into the back buffer one tile at a time. The result is the same
+// as dlReplay(), only tiles that a command touches are drawn or copied
+void tileRender(DISPLAY_LIST *list)
+{
+	FB_SURFACE *back = fbSurface;
+	FB_SURFACE tile;
+	DAMAGE_RECT area;
+	uint32_t start = HAL_GetTick();
+	uint32_t frameStart = fbPixelWrites, startPixels;
+	int row, col, i, which = 0;
+	bool touched;
+
+	list->stats.stateChanges = 0;
+	list->stats.stateDropped = 0;
+	tileStats.tiles = 0;
+	tileStats.tilesDrawn = 0;
+	tileStats.tilesSeeded = 0;
+	tileStats.composePixels = 0;
+	tileStats.sdramPixels = 0;
+
+	for (row = 0; row < TILE_ROWS; row++)
+	{
+		for (col = 0; col < TILE_COLUMNS; col++)
+		{
+			area.x0 = col * TILE_SIZE;
+			area.y0 = row * TILE_SIZE;
+			area.x1 = area.x0 + TILE_SIZE < FB_WIDTH ? area.x0 + TILE_SIZE : FB_WIDTH;
+			area.y1 = area.y0 + TILE_SIZE < FB_HEIGHT ? area.y0 + TILE_SIZE : FB_HEIGHT;
+			tileStats.tiles++;
+
+			touched = false;
+			for (i = 0; i < list->count && !touched; i++)
+			{
+				touched = dlOverlaps(&list->cmds[i].box, &area);
+			}
+			if (!touched)
+			{
+				continue;
+			}
+
+			tile.pixels = tileBuffer[which];
+			tile.width = area.x1 - area.x0;
+			tile.height = area.y1 - area.y0;
+			tile.x = area.x0;
+			tile.y = area.y0;
+
+			// The DMA2D finishes each transfer before starting the next, and the CPU
+			// drawing calls fbSync() first, so the other buffer can still be copying out
+			if (!tileCoveredByFill(list, &area))
+			{
+				fbBlockCopy(back->pixels + (area.y0 * FB_WIDTH) + area.x0, FB_WIDTH, tile.pixels, tile.width,
+					tile.width, tile.height);
+				tileStats.tilesSeeded++;
+			}
+
+			fbSetSurface(&tile);
+			fbDamageEnabled = false;
+			startPixels = fbPixelWrites;
+			dlReplayArea(list, &area);
+			tileStats.composePixels += fbPixelWrites - startPixels;
+			fbSetSurface(back);
+			fbDamageEnabled = true;
+
+			fbBlockCopy(tile.pixels, tile.width, back->pixels + (area.y0 * FB_WIDTH) + area.x0, FB_WIDTH,
+				tile.width, tile.height);
+			fbMarkDamage(area.x0, area.y0, tile.width, tile.height);
+			tileStats.sdramPixels += tile.width * tile.height;
+			tileStats.tilesDrawn++;
+			which = 1 - which;
+		}
+	}
+	fbSync();
+
+	// Only the copies out count as frame buffer writes, the same as a DMA2D fill
+	fbPixelWrites = frameStart + tileStats.sdramPixels;
+	list->stats.pixels = tileStats.composePixels;
+	list->stats.replays++;
+	tileStats.lastTicks = HAL_GetTick() - start;
+	tileStats.frames++;
+}
+
+#if TILE_BENCH
+
+typedef struct
+{
+	uint32_t calls;
+	uint32_t directCycles;   // Time per frame for dlReplay() straight into SDRAM
+	uint32_t tiledCycles;    // Time per frame for tileRender()
+	uint32_t directPixels;   // SDRAM pixel writes per frame for dlReplay(), fbPixelWrites
+	uint32_t tiledPixels;    // SDRAM pixel writes per frame for tileRender(), tileStats.sdramPixels
+	uint32_t composePixels;  // DTCM pixel writes per frame for tileRender()
+} TILE_BENCH_STATS;
+
+TILE_BENCH_STATS tileBenchStats;
+
+// Draws the recorded 'list' into the back buffer both ways, a few times over, and times
+// them with the DWT. Each frame starts from a cleared buffer so tiles are seeded the
+// same way they would be on screen
+void tileBenchmark(DISPLAY_LIST *list)
+{
+	uint32_t start, pixels, directTotal = 0, tiledTotal = 0;
+	int i;
+
+	memset(&tileBenchStats, 0, sizeof(tileBenchStats));
+	for (i = 0; i < 8; i++)
+	{
+		fbFillRect(0, 0, FB_WIDTH, FB_HEIGHT, HUD_BLACK);
+		textInvalidateSlots();
+		fbSync();
+		pixels = fbPixelWrites;
+		start = DWT->CYCCNT;
+		dlReplay(list);
+		fbSync();
+		directTotal += DWT->CYCCNT - start;
+		tileBenchStats.directPixels = fbPixelWrites - pixels;
+
+		fbFillRect(0, 0, FB_WIDTH, FB_HEIGHT, HUD_BLACK);
+		textInvalidateSlots();
+		fbSync();
+		start = DWT->CYCCNT;
+		tileRender(list);
+		tiledTotal += DWT->CYCCNT - start;
+		tileBenchStats.tiledPixels = tileStats.sdramPixels;
+		tileBenchStats.composePixels = tileStats.composePixels;
+	}
+	tileBenchStats.calls = 8;
+	tileBenchStats.directCycles = directTotal / tileBenchStats.calls;
+	tileBenchStats.tiledCycles = tiledTotal / tileBenchStats.calls;
+	fbFillRect(0, 0, FB_WIDTH, FB_HEIGHT, HUD_BLACK);
+	textInvalidateSlots();
+}
+
+#endif
+
+#endif
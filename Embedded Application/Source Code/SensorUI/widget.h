@@ -0,0 +1,373 @@
+/*
+
+ File        		: widget.h
+
+ Primary Author : Joshua Crafton
+
+ Description 		: The header file for the widgets that make up the main screen.
+									Each widget lives in a fixed pool, knows its bounds and is only
+									redrawn once something has marked it dirty. widgetsRender() is
+									called once a frame and draws the dirty widgets from the bottom
+									of the z-order up, so the cost of a frame depends on what
+									changed rather than on how many gauges there are.
+
+*/
+
+#ifndef __WIDGET_H
+#define __WIDGET_H
+
+#include "main.h"
+
+// Most widgets the pool can hold
+#define WIDGET_MAX 16
+
+typedef enum
+{
+	WIDGET_DIAL,        // Circle of 'radius' around 'cx', 'cy'
+	WIDGET_NEEDLE,      // Line of 'radius' from 'cx', 'cy', 'value' is the angle in sine table steps
+	WIDGET_CHEVRONS,    // Chevron bar, 'value' is the number lit
+	WIDGET_NUMBER,      // 'value' printed with 'format', a '.' while it is negative
+	WIDGET_LABEL,       // Fixed text that can be swapped, such as a unit
+	WIDGET_BUTTON       // Outlined box with a label inside
+} WIDGET_TYPE;
+
+typedef struct
+{
+	uint8_t type;
+	uint8_t z;              // Widgets with a higher z are drawn over lower ones
+	bool dirty;
+	bool onOverlay;         // Drawn on the LTDC overlay, so it never covers anything on layer 1
+	bool cached;            // Part of the background kept by bgcache.h
+	int x, y, w, h;         // Bounds on screen
+	int cx, cy, radius;
+	int value;
+	uint32_t cycles;        // Time its last render took, 0 on frames it wasn't drawn
+	const char *format;
+	char text[TEXT_SLOT_MAX + 1];
+	uint16_t fore, back;
+	TEXT_SLOT slot;
+	CHEVRON_BAR bar;
+} WIDGET;
+
+typedef struct
+{
+	uint32_t frames;
+	uint32_t lastRendered;  // Widgets drawn by the last frame
+	uint32_t maxRendered;
+	uint32_t rendered;      // Widgets drawn so far
+} WIDGET_STATS;
+
+WIDGET widgetPool[WIDGET_MAX];
+int widgetCount = 0;
+// Pool indexes from the bottom of the z-order to the top
+uint8_t widgetOrder[WIDGET_MAX];
+WIDGET_STATS widgetStats;
+
+// Takes a widget from the pool, NULL if it is full. Widgets are set up once and
+// live for as long as the program, so the pointer can be kept
+WIDGET *widgetAdd(WIDGET_TYPE type, int z, int x, int y, int w, int h)
+{
+	WIDGET *widget;
+	int i;
+
+	if (widgetCount == WIDGET_MAX)
+	{
+		return NULL;
+	}
+	widget = &widgetPool[widgetCount];
+	memset(widget, 0, sizeof(WIDGET));
+	widget->type = (uint8_t)type;
+	widget->z = (uint8_t)z;
+	widget->x = x;
+	widget->y = y;
+	widget->w = w;
+	widget->h = h;
+	widget->dirty = true;
+
+	// Later widgets of the same z go on top
+	for (i = widgetCount; i > 0 && widgetPool[widgetOrder[i - 1]].z > z; i--)
+	{
+		widgetOrder[i] = widgetOrder[i - 1];
+	}
+	widgetOrder[i] = (uint8_t)widgetCount;
+	widgetCount++;
+	return widget;
+}
+
+void widgetInvalidate(WIDGET *widget)
+{
+	widget->dirty = true;
+}
+
+// Everything on screen has been wiped, so every widget has to be drawn again
+void widgetInvalidateAll(void)
+{
+	int i;
+
+	for (i = 0; i < widgetCount; i++)
+	{
+		widgetPool[i].dirty = true;
+		if (widgetPool[i].type == WIDGET_CHEVRONS)
+		{
+			chevronBarInvalidate(&widgetPool[i].bar);
+		}
+	}
+}
+
+void widgetSetValue(WIDGET *widget, int value)
+{
+	if (widget != NULL && widget->value != value)
+	{
+		widget->value = value;
+		widget->dirty = true;
+	}
+}
+
+void widgetSetText(WIDGET *widget, const char *text)
+{
+	if (widget != NULL && strncmp(widget->text, text, TEXT_SLOT_MAX) != 0)
+	{
+		strncpy(widget->text, text, TEXT_SLOT_MAX);
+		widget->text[TEXT_SLOT_MAX] = '\0';
+		widget->dirty = true;
+	}
+}
+
+// Gives every widget the same colours, only the ones that change are redrawn
+void widgetSetColours(uint32_t fore, uint32_t back)
+{
+	int i;
+
+	for (i = 0; i < widgetCount; i++)
+	{
+		if (widgetPool[i].fore != (uint16_t)fore || widgetPool[i].back != (uint16_t)back)
+		{
+			widgetPool[i].fore = (uint16_t)fore;
+			widgetPool[i].back = (uint16_t)back;
+			widgetPool[i].dirty = true;
+		}
+	}
+}
+
+bool widgetOverlaps(const WIDGET *a, const WIDGET *b)
+{
+	return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+void widgetRender(WIDGET *widget)
+{
+	char buffer[TEXT_SLOT_MAX + 1];
+
+	switch (widget->type)
+	{
+		case WIDGET_DIAL:
+			drawCircle(widget->cx, widget->cy, widget->radius, widget->fore);
+			break;
+		case WIDGET_NEEDLE:
+#if NEEDLE_USE_SPRITES
+			// The images are only made for a needle NEEDLE_LENGTH long
+			if (widget->radius == NEEDLE_LENGTH && needleSpriteReady(needleSpriteIndex(widget->value)))
+			{
+				overlayNeedleSprite(widget->cx, widget->cy, needleSpriteIndex(widget->value),
+					paletteToRGB565(widget->fore));
+				break;
+			}
+#endif
+			// Turned a quarter turn so 0 points straight up from the pivot, which swaps cos
+			// for sin and sin for -cos
+			overlayNeedle(widget->cx, widget->cy,
+				widget->cx + sineScale(widget->radius, sinQ15(widget->value)),
+				widget->cy + sineScale(widget->radius, -cosQ15(widget->value)), paletteToRGB565(widget->fore));
+			break;
+		case WIDGET_CHEVRONS:
+			chevronBarSet(&widget->bar, widget->value, widget->back, widget->fore);
+			break;
+		case WIDGET_NUMBER:
+			if (widget->value < 0)
+			{
+				strcpy(buffer, ".");
+			}
+			else
+			{
+				sprintf(buffer, widget->format, widget->value);
+			}
+			textSlotDraw(&widget->slot, buffer, widget->fore, widget->back);
+			break;
+		case WIDGET_LABEL:
+			textSlotDraw(&widget->slot, widget->text, widget->fore, widget->back);
+			break;
+		case WIDGET_BUTTON:
+			drawRectangle(widget->x, widget->y, widget->w - 1, widget->h - 1, widget->fore);
+			textSlotDraw(&widget->slot, widget->text, widget->fore, widget->back);
+			break;
+	}
+}
+
+// Marks a widget as part of the background, which only changes with the settings
+void widgetSetCached(WIDGET *widget)
+{
+	if (widget != NULL)
+	{
+		widget->cached = true;
+	}
+}
+
+// Draws the dirty background widgets on their own, in z-order, so the result can
+// be saved. When 'restored' is set the background has come from the cache
+// instead and they are only marked as drawn
+void widgetsRenderCached(bool restored)
+{
+	WIDGET *widget;
+	int i;
+
+	for (i = 0; i < widgetCount; i++)
+	{
+		widget = &widgetPool[widgetOrder[i]];
+		if (!widget->cached || !widget->dirty)
+		{
+			continue;
+		}
+		if (!restored)
+		{
+			widgetRender(widget);
+		}
+		widget->dirty = false;
+	}
+}
+
+// Draws every dirty widget in z-order. Anything above a redrawn widget that
+// overlaps it is drawn again as well, so it stays on top
+void widgetsRender(void)
+{
+	WIDGET *widget, *above;
+	uint32_t rendered = 0, start;
+	int i, j;
+
+	for (i = 0; i < widgetCount; i++)
+	{
+		widget = &widgetPool[widgetOrder[i]];
+		widget->cycles = 0;
+		if (!widget->dirty)
+		{
+			continue;
+		}
+		start = DWT->CYCCNT;
+		widgetRender(widget);
+		widget->cycles = DWT->CYCCNT - start;
+		widget->dirty = false;
+		rendered++;
+		if (widget->onOverlay)
+		{
+			continue;
+		}
+		for (j = i + 1; j < widgetCount; j++)
+		{
+			above = &widgetPool[widgetOrder[j]];
+			if (!above->onOverlay && widgetOverlaps(widget, above))
+			{
+				above->dirty = true;
+			}
+		}
+	}
+
+	widgetStats.frames++;
+	widgetStats.lastRendered = rendered;
+	widgetStats.rendered += rendered;
+	if (rendered > widgetStats.maxRendered)
+	{
+		widgetStats.maxRendered = rendered;
+	}
+}
+
+// Helpers that set up each kind of widget
+
+WIDGET *widgetAddDial(int z, int cx, int cy, int radius)
+{
+	WIDGET *widget = widgetAdd(WIDGET_DIAL, z, cx - radius, cy - radius, (2 * radius) + 1, (2 * radius) + 1);
+
+	if (widget != NULL)
+	{
+		widget->cx = cx;
+		widget->cy = cy;
+		widget->radius = radius;
+	}
+	return widget;
+}
+
+WIDGET *widgetAddNeedle(int z, int cx, int cy, int length)
+{
+	WIDGET *widget = widgetAdd(WIDGET_NEEDLE, z, cx - length, cy - length, (2 * length) + 1, length + 1);
+
+	if (widget != NULL)
+	{
+		widget->cx = cx;
+		widget->cy = cy;
+		widget->radius = length;
+		widget->onOverlay = true;
+	}
+	return widget;
+}
+
+WIDGET *widgetAddChevrons(int z, int count, bool isReverse)
+{
+	int w = ((count - 1) * CHEVRON_SPACING) + CHEVRON_WIDTH;
+	WIDGET *widget = widgetAdd(WIDGET_CHEVRONS, z, isReverse ? FB_WIDTH - 1 - w : 0, 0, w, FB_HEIGHT);
+
+	if (widget != NULL)
+	{
+		chevronBarInit(&widget->bar, count, isReverse);
+	}
+	return widget;
+}
+
+// 'chars' is the most characters the text will need, for the bounds
+WIDGET *widgetAddText(WIDGET_TYPE type, int z, int x, int y, int chars, int advance)
+{
+	int width = fbFont != NULL ? fbFont->width : 0;
+	WIDGET *widget = widgetAdd(type, z, x, y, ((chars - 1) * (advance > 0 ? advance : width)) + width,
+		fbFont != NULL ? fbFont->height : 0);
+
+	if (widget != NULL)
+	{
+		widget->slot.x = x;
+		widget->slot.y = y;
+		widget->slot.advance = advance;
+	}
+	return widget;
+}
+
+WIDGET *widgetAddNumber(int z, int x, int y, int chars, int advance, const char *format)
+{
+	WIDGET *widget = widgetAddText(WIDGET_NUMBER, z, x, y, chars, advance);
+
+	if (widget != NULL)
+	{
+		widget->format = format;
+		widget->value = -1;
+	}
+	return widget;
+}
+
+WIDGET *widgetAddLabel(int z, int x, int y, int chars, const char *text)
+{
+	WIDGET *widget = widgetAddText(WIDGET_LABEL, z, x, y, chars, 0);
+
+	widgetSetText(widget, text);
+	return widget;
+}
+
+// The label sits 'textX', 'textY' in from the top left of the box
+WIDGET *widgetAddButton(int z, int x, int y, int w, int h, int textX, int textY, const char *text)
+{
+	WIDGET *widget = widgetAdd(WIDGET_BUTTON, z, x, y, w + 1, h + 1);
+
+	if (widget != NULL)
+	{
+		widget->slot.x = x + textX;
+		widget->slot.y = y + textY;
+		widgetSetText(widget, text);
+	}
+	return widget;
+}
+
+#endif